@@ -114,6 +114,7 @@ macro(FIND_AND_ADD_CLANG_LIB _libname_)
   endif()
 endmacro(FIND_AND_ADD_CLANG_LIB)
 
+FIND_AND_ADD_CLANG_LIB(clangCodeGen)
 FIND_AND_ADD_CLANG_LIB(clangFrontend)
 FIND_AND_ADD_CLANG_LIB(clangParse)
 FIND_AND_ADD_CLANG_LIB(clangRewrite)
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_BITCODECOMPILER_HPP_
+#define INCLUDE_SENTINEL_BITCODECOMPILER_HPP_
+
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <optional>
+#include "sentinel/IrMutator.hpp"
+
+namespace clang::tooling {
+class CompilationDatabase;
+}  // namespace clang::tooling
+
+namespace sentinel {
+
+/**
+ * @brief Compiles the files of a compilation database to LLVM IR (ir-mutation).
+ *
+ * A file is compiled with Clang and its command from compile_commands.json,
+ * without running the LLVM passes, and with line tables and column info so
+ * that IrMutator can find the instructions of a mutant. The options the
+ * build optimizes and generates code with are recorded in the BitcodeUnit.
+ */
+class BitcodeCompiler {
+ public:
+  /**
+   * @brief Load compile_commands.json from @p compileDbDir.
+   *
+   * @throw IOException if compile_commands.json cannot be loaded.
+   */
+  explicit BitcodeCompiler(const std::filesystem::path& compileDbDir);
+
+  ~BitcodeCompiler();
+
+  /**
+   * @brief Compile @p source to LLVM IR.
+   *
+   * @return nullopt if the file has no command or no object, the command
+   *         fails, or the object cannot be generated from the IR alone
+   *         (instrumentation for coverage, profiling or sanitizers, a code
+   *         model or relocation model other than the default ones).
+   */
+  std::optional<BitcodeUnit> compile(const std::filesystem::path& source);
+
+ private:
+  std::unique_ptr<clang::tooling::CompilationDatabase> mCompileDb;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_BITCODECOMPILER_HPP_
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_CANDIDATECACHE_HPP_
+#define INCLUDE_SENTINEL_CANDIDATECACHE_HPP_
+
+#include <filesystem>  // NOLINT
+#include <map>
+#include <optional>
+#include <string>
+#include "sentinel/FileCandidates.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Persistent store of the mutant candidates of source files shared between runs.
+ *
+ * The candidates of a file are keyed by its path and contents, a key given
+ * by the caller (compile command, target lines, ...) and a context hash
+ * covering everything else they depend on (sentinel version, operators).
+ * An entry also records the content hash of every file the preprocessor
+ * read while parsing, and is only reused while all of them are unchanged.
+ *
+ * Each entry is a separate file that is written to a temporary name and
+ * renamed into place, so concurrent runs may share the directory: a reader
+ * sees either no entry or a complete one.
+ */
+class CandidateCache {
+ public:
+  /**
+   * @brief Constructor. Hashes the run context.
+   *
+   * @param dir     Cache directory.
+   * @param context Text every entry depends on besides its file and key.
+   */
+  CandidateCache(const std::filesystem::path& dir, const std::string& context);
+
+  CandidateCache(const CandidateCache&) = delete;
+  CandidateCache& operator=(const CandidateCache&) = delete;
+
+  /**
+   * @brief Return the cached candidates of a file.
+   *
+   * @param file Source file.
+   * @param key  Text the candidates depend on besides the file and the context.
+   * @return the candidates, or std::nullopt if there are none, one of the files
+   *         read while parsing changed, or the entry is unreadable.
+   */
+  std::optional<FileCandidates> find(const std::filesystem::path& file, const std::string& key);
+
+  /**
+   * @brief Store the candidates of a file.
+   *
+   * Candidates without includes (the file could not be parsed) are not
+   * stored. Failures are logged and otherwise ignored; the cache only saves work.
+   *
+   * @param file       Source file.
+   * @param key        Text the candidates depend on besides the file and the context.
+   * @param candidates Candidates found by parsing @p file.
+   */
+  void store(const std::filesystem::path& file, const std::string& key, const FileCandidates& candidates);
+
+ private:
+  std::filesystem::path entryPath(const std::filesystem::path& file, const std::string& key);
+  const std::string& hashFile(const std::filesystem::path& path);
+
+  std::filesystem::path mDir;
+  std::string mContextHash;
+  std::map<std::filesystem::path, std::string> mFileHashes;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_CANDIDATECACHE_HPP_
@@ -40,8 +40,11 @@ class CliConfigParser {
    * @brief Apply only report-phase and control-flag CLI options onto a Config.
    *
    * Used when resuming from an existing workspace: only --output-dir,
-   * --threshold, and --verbose are applied. All other options are ignored
-   * because the workspace already holds the authoritative configuration.
+   * --threshold, --time-budget, --stream, --watch, --shared, --serve, and --verbose are applied. All other
+   * options are ignored because the workspace already holds the authoritative configuration.
+   * With --shared, the options that locate this process's checkout (--source-dir,
+   * --build-command, --compiledb-dir, --test-command, --test-result-dir) are applied too,
+   * since every process sharing the workspace evaluates mutants in its own checkout.
    *
    * @param cfg Config to modify in place.
    */
@@ -50,9 +53,12 @@ class CliConfigParser {
   /**
    * @brief Return the list of CLI option names explicitly set by the user.
    *
-   * Excludes control flags (--verbose, --clean, --dry-run, --init, --force),
+   * Excludes control flags (--verbose, --clean, --dry-run, --generate-only, --init, --force,
+   * --stream, --watch, --shared, --serve, --worker),
    * workspace/config selectors (--workspace, --config), report-phase options
-   * (--output-dir, --threshold), and merge mode (--merge-partition).
+   * (--output-dir, --threshold), the per-run --time-budget, and merge mode
+   * (--merge-partition, --merge-index-only, --merge-hard-link).
+   * With --shared, the checkout options applied by applyReportOnlyTo() are excluded too.
    *
    * @return Vector of option name strings (e.g., "--from", "--timeout").
    */
@@ -65,8 +71,12 @@ class CliConfigParser {
   bool isInit() const { return mInit; }
   /** @brief Returns true if --dry-run was specified. */
   bool isDryRun() const { return mDryRun; }
+  /** @brief Returns true if --generate-only was specified. */
+  bool isGenerateOnly() const { return mGenerateOnly; }
   /** @brief Returns true if --clean was specified. */
   bool isClean() const { return mClean; }
+  /** @brief Returns true if --shared was specified. */
+  bool isShared() const { return mShared; }
   /** @brief Returns true if --force was specified. */
   bool isForce() const { return mForce; }
   /** @brief Returns the workspace path if --workspace was specified (empty if not). */
@@ -117,6 +127,14 @@ class CliConfigParser {
   args::ValueFlag<std::filesystem::path> mTestResultDir;
   /** @brief Command line flag for test time limit. */
   args::ValueFlag<std::size_t> mTimeout;
+  /** @brief Command line flag to build only the Ninja targets affected by a mutant. */
+  args::Flag mTargetedBuild;
+  /** @brief Command line flag to stop a mutant's build at the first compiler error in the mutated file. */
+  args::Flag mFailFastBuild;
+  /** @brief Command line flag for the number of jobserver tokens. */
+  args::ValueFlag<std::size_t> mJobserver;
+  /** @brief Command line flag for pressure targets that hold back jobserver tokens. */
+  args::ValueFlagList<std::string> mPressureTargets;
 
   // Mutation options
   /** @brief Command line flag for diff base revision. */
@@ -143,12 +161,53 @@ class CliConfigParser {
   args::ValueFlagList<std::filesystem::path> mLcovTracefiles;
   /** @brief Command line flag to restrict mutant generation to lcov-covered lines. */
   args::Flag mRestrict;
+  /** @brief Command line flag for the verdict cache directory. */
+  args::ValueFlag<std::filesystem::path> mCacheDir;
+  /** @brief Command line flag to skip mutants that the weak-mutation pre-screen never saw infected. */
+  args::Flag mWeakMutation;
+  /** @brief Command line flag to select the tests of each mutant from a static call graph. */
+  args::Flag mStaticTestSelection;
+  /** @brief Command line flag to apply operator mutants to LLVM IR instead of rebuilding the source. */
+  args::Flag mIrMutation;
+  /** @brief Command line flag for the LLVM IR of the test program run in a JIT (experimental). */
+  args::ValueFlag<std::filesystem::path> mJitBitcode;
+  /** @brief Command line flag to keep the test results of each mutant in the workspace. */
+  args::Flag mKeepTestResults;
+  /** @brief Command line flag for the memory limit of a generation worker. */
+  args::ValueFlag<std::size_t> mGenerationMemoryLimit;
+  /** @brief Command line flag for the time limit of a generation worker. */
+  args::ValueFlag<std::size_t> mGenerationTimeout;
+  /** @brief Command line flag for the directory of cached mutant candidates. */
+  args::ValueFlag<std::filesystem::path> mCandidateCacheDir;
   /** @brief Command line flag for execution partition. */
   args::ValueFlag<std::string> mPartition;
+  /** @brief Command line flag for how mutants are assigned to partitions. */
+  args::ValueFlag<std::string> mPartitionBy;
+  /** @brief Command line flag for the workspace whose timings weight --partition-by=cost. */
+  args::ValueFlag<std::filesystem::path> mPartitionCosts;
+  /** @brief Command line flag for the file the mutant plan is written to. */
+  args::ValueFlag<std::filesystem::path> mGenerateOnly;
+  /** @brief Command line flag for the mutant plan to evaluate. */
+  args::ValueFlag<std::filesystem::path> mPlan;
   /** @brief Command line flag for merge partition workspaces. */
   args::ValueFlagList<std::filesystem::path> mMergePartitions;
+  /** @brief Command line flag to link instead of copy the logs of merged partitions. */
+  args::Flag mMergeIndexOnly;
+  args::Flag mMergeHardLink;
   /** @brief Command line flag for mutation threshold. */
   args::ValueFlag<double> mThreshold;
+  /** @brief Command line flag for the evaluation time budget. */
+  args::ValueFlag<std::size_t> mTimeBudget;
+  /** @brief Command line flag to overlap generation and evaluation. */
+  args::Flag mStream;
+  /** @brief Command line flag to keep watching the sources after the run. */
+  args::Flag mWatch;
+  /** @brief Command line flag to share the workspace with other sentinel processes. */
+  args::Flag mShared;
+  /** @brief Command line option for the address workers connect to. */
+  args::ValueFlag<std::string> mServe;
+  /** @brief Command line option for the coordinator address of a worker. */
+  args::ValueFlag<std::string> mWorker;
 };
 
 }  // namespace sentinel
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_CONCURRENTSTAGE_HPP_
+#define INCLUDE_SENTINEL_CONCURRENTSTAGE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include "sentinel/Stage.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Runs a producer/consumer pair of stages at the same time as one link of the chain.
+ *
+ * The producer executes on a background thread and the consumer on the calling thread.
+ * Both see a PipelineContext whose mutantQueue points to a bounded queue, so mutants
+ * flow from the producer to the consumer while the producer is still running.
+ * When the producer is skipped (e.g. mutants already exist on resume) the consumer
+ * runs alone, exactly as it would in a plain chain.
+ *
+ * If the producer fails, the queue is aborted, the consumer returns without completing
+ * and the producer's exception is rethrown. If the consumer fails, the queue is
+ * aborted so that the producer stops at its next push, and the consumer's exception
+ * is rethrown.
+ */
+class ConcurrentStage : public Stage {
+ public:
+  /// @brief Default number of mutants buffered between producer and consumer.
+  static constexpr std::size_t kDefaultCapacity = 64;
+
+  /**
+   * @brief Constructor.
+   * @param producer Stage that pushes mutants to ctx->mutantQueue (run on a background thread).
+   * @param consumer Stage that pops mutants from ctx->mutantQueue (run on the calling thread).
+   * @param capacity Maximum number of mutants buffered between the two.
+   */
+  ConcurrentStage(std::shared_ptr<Stage> producer, std::shared_ptr<Stage> consumer,
+                  std::size_t capacity = kDefaultCapacity);
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override;
+  StatusLine::Phase getPhase() const override;
+  bool execute(PipelineContext* ctx) override;
+
+ private:
+  std::shared_ptr<Stage> mProducer;
+  std::shared_ptr<Stage> mConsumer;
+  std::size_t mCapacity;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_CONCURRENTSTAGE_HPP_
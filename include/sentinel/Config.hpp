@@ -48,6 +48,46 @@ struct Partition {
   static Partition parse(const std::string& s);
 };
 
+/**
+ * @brief Build and test commands for the mutants in one part of the source tree (scopes).
+ */
+struct Scope {
+  std::string path;                     ///< Glob matched against source-relative paths ('*' also matches '/')
+  std::string buildCmd;                 ///< Command that builds what testCmd runs
+  std::string testCmd;                  ///< Command that runs the tests of the scope
+  std::filesystem::path testResultDir;  ///< Absolute path to the directory testCmd writes results to
+
+  /**
+   * @brief Find the most specific scope of a file.
+   *
+   * Among the scopes whose glob matches @p path, the one with the longest part
+   * before the first wildcard wins, then the one with the longest glob, then
+   * the first one listed.
+   *
+   * @param scopes Scopes to search.
+   * @param path   Source-relative path of the file.
+   * @return index of the scope in @p scopes, or nullopt if none matches.
+   */
+  static std::optional<std::size_t> find(const std::vector<Scope>& scopes, const std::filesystem::path& path);
+};
+
+/**
+ * @brief Parsed pressure target (e.g., "memory:10" keeps the memory pressure under 10%).
+ */
+struct PressureTarget {
+  std::string resource;  ///< "cpu", "memory" or "io"
+  double percent;        ///< Upper bound for the share of time tasks stall on the resource (0-100)
+
+  /**
+   * @brief Parse a "RESOURCE:PCT" string into a PressureTarget.
+   *
+   * @param s Pressure target string in the format "RESOURCE:PCT".
+   * @return Parsed PressureTarget.
+   * @throw std::invalid_argument if the format is invalid.
+   */
+  static PressureTarget parse(const std::string& s);
+};
+
 /**
  * @brief Unified configuration for sentinel.
  *
@@ -74,6 +114,31 @@ struct Config {
   std::filesystem::path testResultDir;
   /** @brief Time limit for test execution; nullopt = auto (1.5x baseline + 5s), 0 = no limit. */
   std::optional<std::size_t> timeout;
+  /**
+   * @brief When true and compileDbDir holds a Ninja build, build only the targets that depend on the
+   *        mutated file instead of running buildCmd.
+   */
+  bool targetedBuild = false;
+  /**
+   * @brief When true, a mutant's build is stopped at the first compiler error reported in the mutated file
+   *        and the mutant is recorded as a build failure without waiting for the other build jobs.
+   */
+  bool failFastBuild = false;
+  /**
+   * @brief Number of job tokens shared by the builds and tests of every sentinel of the user on this host
+   *        through a GNU make jobserver; nullopt = no jobserver, 0 = number of CPU cores.
+   */
+  std::optional<std::size_t> jobserver;
+  /**
+   * @brief Pressure targets ("RESOURCE:PCT"); while the pressure of a resource exceeds its target,
+   *        job tokens are held back from the jobserver (empty = fixed number of tokens).
+   */
+  std::vector<std::string> pressureTargets;
+  /**
+   * @brief Scopes with their own build and test commands (YAML only). A mutant uses the most specific
+   *        scope of its file, or buildCmd and testCmd if none matches (empty = no scopes).
+   */
+  std::vector<Scope> scopes;
 
   // Mutation options
   /** @brief Diff base revision for --from; nullopt = not specified. */
@@ -99,6 +164,42 @@ struct Config {
    * is skipped (kept in the report as SURVIVED*). Requires lcovTracefiles to be set.
    */
   bool restrictGeneration = false;
+  /** @brief Absolute path to the directory of cached mutant verdicts shared between runs (empty = disabled). */
+  std::filesystem::path cacheDir;
+  /**
+   * @brief When true, run the tests once against a build that probes every operator mutant and skip
+   *        the evaluation of mutants whose value never differs from the original (kept as SURVIVED).
+   */
+  bool weakMutation = false;
+  /**
+   * @brief When true and no lcovTracefiles are given, run only the Google Test cases that a static
+   *        call graph of the compilation database finds able to reach the mutated function.
+   */
+  bool staticTestSelection = false;
+  /**
+   * @brief When true, apply arithmetic, bitwise, relational and shift mutants to the LLVM IR of their
+   *        translation unit and replace its object, so the build command only relinks.
+   */
+  bool irMutation = false;
+  /**
+   * @brief LLVM IR of the whole test program (a Google Test binary). When set, operator mutants
+   *        that can be applied to it are tested by running it in a JIT instead of building (experimental).
+   */
+  std::filesystem::path jitBitcode;
+  /** @brief When true, move the test results of each mutant to its directory in the workspace. */
+  bool keepTestResults = false;
+  /**
+   * @brief Address space limit in MiB of the worker process parsing each source file during generation;
+   *        nullopt = no limit. Generation uses worker processes when this or generationTimeout is set.
+   */
+  std::optional<std::size_t> generationMemoryLimit;
+  /** @brief Time limit in seconds of the worker process parsing each source file; nullopt = no limit. */
+  std::optional<std::size_t> generationTimeout;
+  /**
+   * @brief Absolute path to the directory of cached mutant candidates of source files shared between runs
+   *        (empty = disabled).
+   */
+  std::filesystem::path candidateCacheDir;
 
   // CLI-only run parameters (not read from sentinel.yaml)
   /** @brief Maximum number of mutants to generate; 0 = unlimited (CLI-only). */
@@ -107,10 +208,38 @@ struct Config {
   std::optional<unsigned int> seed;
   /** @brief Mutation score threshold for success (CLI-only). */
   std::optional<double> threshold;
+  /**
+   * @brief Seconds of evaluation time available in this run, not counting the original build and test
+   *        or generation; nullopt = no budget (CLI-only).
+   *        When the next mutant would not finish in time, evaluation stops and the report is a sampled estimate.
+   */
+  std::optional<std::size_t> timeBudget;
   /** @brief Partition for parallel execution, e.g., "N/TOTAL" (CLI-only). */
   std::optional<std::string> partition;
+  /** @brief How mutants are assigned to partitions: "count" or "cost" (CLI-only). */
+  std::string partitionBy = "count";
+  /** @brief Absolute path to a previous workspace whose timings weight partitionBy "cost" (CLI-only). */
+  std::filesystem::path partitionCosts;
+  /** @brief Absolute path to a mutant plan to evaluate instead of generating mutants (CLI-only). */
+  std::filesystem::path planFile;
+  /** @brief Absolute path to write the mutant plan to; the run stops after generation (CLI-only). */
+  std::filesystem::path generateOnly;
   /** @brief Paths to partitioned workspaces to merge (CLI-only). */
   std::vector<std::filesystem::path> mergeWorkspaces;
+  /** @brief Link the mutant logs of merged partitions instead of copying them (CLI-only). */
+  bool mergeIndexOnly = false;
+  /** @brief Hard-link the files of merged partitions that cannot be cloned instead of copying them (CLI-only). */
+  bool mergeHardLink = false;
+  /** @brief Start evaluating mutants while generation is still running (CLI-only). */
+  bool stream = false;
+  /** @brief Keep running after the first run and re-evaluate edited source lines (CLI-only). */
+  bool watch = false;
+  /** @brief Evaluate the mutants of a workspace together with other sentinel processes (CLI-only). */
+  bool shared = false;
+  /** @brief Hand out mutants to workers connected on this address instead of evaluating them (CLI-only). */
+  std::optional<std::string> serveAddress;
+  /** @brief Evaluate mutants handed out by the coordinator on this address (CLI-only). */
+  std::optional<std::string> workerAddress;
 
   // Special control flags
   /** @brief Initialize sentinel in the current directory. */
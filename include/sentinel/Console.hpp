@@ -33,7 +33,9 @@ inline void print(const std::string& pattern, Args&&... args) {
  */
 template <typename... Args>
 inline void out(const std::string& pattern, Args&&... args) {
-  std::cout << fmt::format(pattern, std::forward<Args>(args)...) << '\n' << std::flush;
+  // Emit the line and its newline in one write so that lines printed from
+  // concurrently running stages do not interleave mid-line.
+  std::cout << (fmt::format(pattern, std::forward<Args>(args)...) + '\n') << std::flush;
 }
 
 /**
@@ -51,7 +53,7 @@ inline void flush() {
  */
 template <typename... Args>
 inline void err(const std::string& pattern, Args&&... args) {
-  std::cerr << fmt::format(pattern, std::forward<Args>(args)...) << std::endl;
+  std::cerr << (fmt::format(pattern, std::forward<Args>(args)...) + '\n') << std::flush;
 }
 
 }  // namespace sentinel::Console
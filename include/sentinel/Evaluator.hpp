@@ -7,7 +7,9 @@
 #define INCLUDE_SENTINEL_EVALUATOR_HPP_
 
 #include <filesystem>  // NOLINT
+#include <optional>
 #include <string>
+#include <vector>
 #include "sentinel/MutationResult.hpp"
 #include "sentinel/Result.hpp"
 
@@ -16,7 +18,7 @@ namespace sentinel {
 /**
  * @brief Represents the outcome of building and running tests on a mutant.
  */
-enum class TestExecutionState { SUCCESS, BUILD_FAILURE, TIMEOUT, UNCOVERED, RUNTIME_ERROR };
+enum class TestExecutionState { SUCCESS, BUILD_FAILURE, TIMEOUT, UNCOVERED, NOT_INFECTED, RUNTIME_ERROR };
 
 /**
  * @brief Evaluator class
@@ -40,9 +42,11 @@ class Evaluator {
    * @param mut target mutant
    * @param actualResultDir Directory Path of Actual Result
    * @param testState execution outcome of the mutant
+   * @param selectedTests tests the mutant was run against (nullopt = all)
    * @return MutationResult summary of compare
    */
-  MutationResult compare(const Mutant& mut, const std::filesystem::path& actualResultDir, TestExecutionState testState);
+  MutationResult compare(const Mutant& mut, const std::filesystem::path& actualResultDir, TestExecutionState testState,
+                         const std::optional<std::vector<std::string>>& selectedTests = std::nullopt);
 
  private:
   Result mExpectedResult;
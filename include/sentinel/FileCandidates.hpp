@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_FILECANDIDATES_HPP_
+#define INCLUDE_SENTINEL_FILECANDIDATES_HPP_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+#include "sentinel/Mutants.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Mutant candidates found by parsing a single source file.
+ */
+struct FileCandidates {
+  /**
+   * @brief Candidates located on the target lines of the file.
+   */
+  Mutants mutants;
+
+  /**
+   * @brief AST depth of each target line (weighted generator only); -1 if no statement covers the line.
+   */
+  std::map<std::size_t, int> depths;
+
+  /**
+   * @brief Absolute paths of the files the preprocessor read (the file itself, its headers and the
+   *        system headers); empty if the file could not be parsed.
+   */
+  std::vector<std::string> includes;
+
+  /**
+   * @brief Return the candidates as YAML documents: the depths and includes, then one document per mutant.
+   */
+  std::string serialize() const;
+
+  /**
+   * @brief Read candidates written by serialize().
+   *
+   * @throw std::runtime_error if @p data is not a serialization of candidates.
+   */
+  static FileCandidates deserialize(const std::string& data);
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_FILECANDIDATES_HPP_
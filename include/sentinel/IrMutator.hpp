@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_IRMUTATOR_HPP_
+#define INCLUDE_SENTINEL_IRMUTATOR_HPP_
+
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <string>
+#include "sentinel/Mutant.hpp"
+
+namespace llvm {
+class Module;
+}  // namespace llvm
+
+namespace sentinel {
+
+/**
+ * @brief A translation unit compiled to LLVM IR, with the options needed to generate its object again.
+ */
+struct BitcodeUnit {
+  /** @brief Bitcode of the unoptimized module, with line tables and column info. */
+  std::string bitcode;
+  /** @brief Absolute path of the object the build writes for the translation unit. */
+  std::filesystem::path object;
+  /** @brief Optimization level (-O0 ... -O3). */
+  unsigned optLevel = 0;
+  /** @brief Size optimization level (0, 1 for -Os, 2 for -Oz). */
+  unsigned sizeLevel = 0;
+  /** @brief True for position independent code, false for static code. */
+  bool pic = false;
+  /** @brief Target CPU (-mcpu/-march), empty for the default. */
+  std::string cpu;
+  /** @brief Comma-separated target features as written on the command line (-mavx2 ...). */
+  std::string features;
+  /** @brief Target ABI name (-mabi), empty for the default. */
+  std::string abi;
+  /** @brief Float ABI (-mfloat-abi): soft, softfp, hard, or empty for the default. */
+  std::string floatAbi;
+  /** @brief -ffunction-sections. */
+  bool functionSections = false;
+  /** @brief -fdata-sections. */
+  bool dataSections = false;
+  /** @brief True if the build emits debug info; otherwise it is stripped before code generation. */
+  bool debugInfo = false;
+};
+
+/**
+ * @brief Applies operator mutants to LLVM IR instead of the source (ir-mutation).
+ *
+ * The instructions of a mutant are those whose debug location is the
+ * position of its operator in its file, in every function (each template
+ * instantiation has its own). An arithmetic, bitwise or shift instruction gets
+ * the opcode of the mutated operator, and a comparison its predicate. The
+ * signedness of a division, remainder, right shift or ordered comparison is
+ * taken from the original instruction (sdiv, lshr, slt, `add nsw`, ...);
+ * when it cannot be told, or the instructions do not match the original
+ * operator (folded constants, pointer arithmetic, ...), the mutant is not
+ * applied and has to be built from the mutated source.
+ */
+class IrMutator {
+ public:
+  /**
+   * @brief Return true if mutants of @p op (AOR, BOR, ROR, SOR) can be applied to IR.
+   */
+  static bool isSupported(const std::string& op);
+
+  /**
+   * @brief Return true if @p m can be applied to @p module (apply() would mutate some instruction).
+   */
+  static bool canApply(const llvm::Module& module, const Mutant& m, const std::string& originalToken);
+
+  /**
+   * @brief Apply @p m to @p module.
+   *
+   * @param module        Unoptimized module with line tables and column info.
+   * @param m             Mutant (its position and its token).
+   * @param originalToken Source text the mutant replaces.
+   * @return number of mutated instructions; 0 if the mutant cannot be applied (@p module is unchanged).
+   */
+  static std::size_t apply(llvm::Module* module, const Mutant& m, const std::string& originalToken);
+
+  /**
+   * @brief Write the object of @p unit with @p m applied, optimized and generated with the unit's options.
+   *
+   * @return false if the mutant cannot be applied (nothing is written).
+   * @throw IOException if the object cannot be generated or written.
+   */
+  static bool writeObject(const BitcodeUnit& unit, const Mutant& m, const std::string& originalToken,
+                          const std::filesystem::path& object);
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_IRMUTATOR_HPP_
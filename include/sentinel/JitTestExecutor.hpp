@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_JITTESTEXECUTOR_HPP_
+#define INCLUDE_SENTINEL_JITTESTEXECUTOR_HPP_
+
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <string>
+#include <vector>
+#include "sentinel/Mutant.hpp"
+
+namespace llvm {
+class LLVMContext;
+class Module;
+}  // namespace llvm
+
+namespace sentinel {
+
+/**
+ * @brief Runs a test program from its LLVM IR in an ORC JIT, with a mutant applied (jit-bitcode).
+ *
+ * The program is read once. Each run applies the mutant with IrMutator,
+ * compiles the program in the JIT, with the symbols of the shared libraries
+ * of the process (libc, libstdc++, ...), runs its static initializers and
+ * calls main(). A run consumes the program, so it is meant to be made in a
+ * child forked for it (see Subprocess), which also keeps a crash or a hang
+ * of the mutant away from sentinel.
+ */
+class JitTestExecutor {
+ public:
+  /**
+   * @brief Read the test program from @p bitcode (bitcode or textual IR of the whole program).
+   *
+   * @throw IOException if the file cannot be read or does not define main().
+   */
+  explicit JitTestExecutor(const std::filesystem::path& bitcode);
+
+  ~JitTestExecutor();
+
+  /**
+   * @brief Return true if @p m can be applied to the program.
+   *
+   * @param m             Mutant.
+   * @param originalToken Source text the mutant replaces.
+   */
+  bool canApply(const Mutant& m, const std::string& originalToken) const;
+
+  /**
+   * @brief Compile the program with @p m applied (the original program if nullptr) and run its main().
+   *
+   * Call it once, in a forked child. The child must not modify the environment or
+   * the file system before the call, so options of the test program are passed
+   * to main() as @p args.
+   *
+   * @param m             Mutant.
+   * @param originalToken Source text the mutant replaces.
+   * @param args          Arguments passed to main() after the program name.
+   * @return the exit code main() returns.
+   * @throw IOException if the mutant cannot be applied, or the program cannot be compiled or linked.
+   */
+  int run(const Mutant* m, const std::string& originalToken, const std::vector<std::string>& args = {});
+
+ private:
+  std::filesystem::path mBitcode;
+  std::unique_ptr<llvm::LLVMContext> mContext;
+  std::unique_ptr<llvm::Module> mModule;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_JITTESTEXECUTOR_HPP_
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_JOBSERVER_HPP_
+#define INCLUDE_SENTINEL_JOBSERVER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <string>
+
+namespace sentinel {
+
+/**
+ * @brief GNU make jobserver shared by every sentinel of a user on this host (--jobserver).
+ *
+ * The job tokens live in a named pipe in a per-user directory. The first
+ * sentinel to open the directory creates the pipe and fills it with the
+ * configured number of tokens; sentinels started while it is in use join the
+ * same pool, whatever number they were given. The pool is recreated once the
+ * last sentinel using it has exited.
+ *
+ * Subprocess takes a token before it starts a command and gives it back when
+ * the command has exited. The command sees the pool in MAKEFLAGS
+ * (`--jobserver-auth=fifo:PATH`), so GNU make 4.4 or later and Ninja 1.13 or
+ * later run one job on that token and take another from the pool for every
+ * additional job. The total number of jobs of all builds and tests is then
+ * capped at the number of tokens. Tokens still held when sentinel is stopped
+ * by a signal are given back by releaseAll(); a token held by a build that is
+ * killed outright is lost until the pool is recreated.
+ */
+class Jobserver {
+ public:
+  /**
+   * @brief Create the token pool in @p dir or join the one in use there.
+   *
+   * @param dir  Directory of the pool; created with mode 0700 if missing.
+   * @param jobs Number of tokens of a new pool.
+   * @throw std::runtime_error if the directory belongs to another user or the pipe cannot be opened.
+   */
+  Jobserver(const std::filesystem::path& dir, std::size_t jobs);
+
+  ~Jobserver();
+
+  Jobserver(const Jobserver&) = delete;
+  Jobserver& operator=(const Jobserver&) = delete;
+
+  /**
+   * @brief Return the default pool directory of the current user (under the system temporary directory).
+   */
+  static std::filesystem::path getDefaultDir();
+
+  /**
+   * @brief Return the number of tokens of the pool (the creator's value when this sentinel joined it).
+   */
+  std::size_t getJobs() const;
+
+  /**
+   * @brief Return true if this sentinel created the pool, false if it joined a pool in use.
+   */
+  bool isCreator() const;
+
+  /**
+   * @brief Return the path of the named pipe holding the tokens.
+   */
+  const std::filesystem::path& getFifo() const;
+
+  /**
+   * @brief Return the MAKEFLAGS value that makes GNU make and Ninja use the pool.
+   */
+  std::string getMakeflags() const;
+
+  /**
+   * @brief Take a token from the pool, waiting until one is available.
+   *
+   * @return the token, to be handed back to release().
+   * @throw std::runtime_error if the pipe cannot be read.
+   */
+  char acquire() const;
+
+  /**
+   * @brief Take a token from the pool if one is available right now.
+   *
+   * @param token Receives the token, to be handed back to release().
+   * @return true if a token was taken.
+   */
+  bool tryAcquire(char* token) const;
+
+  /**
+   * @brief Return a token taken with acquire() to the pool.
+   *
+   * Does nothing once releaseAll() has been called.
+   */
+  void release(char token) const;
+
+  /**
+   * @brief Return every token this process has taken and not released to the pool.
+   *
+   * Meant for the SignalHandler cleanup of a sentinel that is about to exit:
+   * it only uses async-signal-safe calls, and later calls of release() are
+   * ignored so the tokens are not given back twice.
+   */
+  void releaseAll() const;
+
+ private:
+  std::filesystem::path mFifo;
+  std::size_t mJobs;
+  bool mCreator = false;
+  int mFd = -1;
+  int mNonBlockingFd = -1;
+  int mUsersFd = -1;
+  mutable std::atomic<std::size_t> mTaken{0};
+  mutable std::atomic<bool> mReleasedAll{false};
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_JOBSERVER_HPP_
@@ -145,6 +145,46 @@ class Mutant {
    */
   const std::string& getToken() const;
 
+  /**
+   * @brief Record the byte range of the mutant and the file it was generated from.
+   *
+   * With a byte range, the mutant is applied by splicing the token into the
+   * file, after checking that the file still has @p fileHash.
+   *
+   * @param firstOffset byte offset of the first location
+   * @param lastOffset byte offset of the last location
+   * @param fileHash hash of the original file (io::hashContent)
+   */
+  void setOffsets(std::size_t firstOffset, std::size_t lastOffset, const std::string& fileHash);
+
+  /**
+   * @brief Return True if the byte range of the mutant is known.
+   *
+   * @return True if setOffsets() was called
+   */
+  bool hasOffsets() const;
+
+  /**
+   * @brief Return the byte offset of the first location.
+   *
+   * @return byte offset, valid if hasOffsets()
+   */
+  std::size_t getFirstOffset() const;
+
+  /**
+   * @brief Return the byte offset of the last location.
+   *
+   * @return byte offset, valid if hasOffsets()
+   */
+  std::size_t getLastOffset() const;
+
+  /**
+   * @brief Return the hash of the file the mutant was generated from.
+   *
+   * @return hash, empty if not hasOffsets()
+   */
+  const std::string& getFileHash() const;
+
   /**
    * @brief Return information of Mutant
    *
@@ -161,6 +201,9 @@ class Mutant {
   Location mFirst;
   Location mLast;
   std::string mToken;
+  std::size_t mFirstOffset = 0;
+  std::size_t mLastOffset = 0;
+  std::string mFileHash;
 };
 
 std::ostream& operator<<(std::ostream& out, const Mutant& m);
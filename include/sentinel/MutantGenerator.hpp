@@ -11,17 +11,21 @@
 #include <clang/Frontend/CompilerInstance.h>
 #include <clang/Frontend/FrontendActions.h>
 #include <clang/Tooling/Tooling.h>
+#include <llvm/ADT/IntrusiveRefCntPtr.h>
+#include <llvm/Support/VirtualFileSystem.h>
 #include <algorithm>
 #include <filesystem>  // NOLINT
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <random>
 #include <set>
 #include <string>
 #include <utility>
 #include <vector>
 #include "sentinel/Config.hpp"
+#include "sentinel/FileCandidates.hpp"
 #include "sentinel/Mutants.hpp"
 #include "sentinel/SourceLines.hpp"
 #include "sentinel/operators/MutationOperator.hpp"
@@ -71,6 +75,11 @@ struct CandidateIndex {
  * 1. collectAllMutants() — AST traversal to find mutation candidates
  * 2. buildCandidateIndex() — group mutants by file for efficient lookup
  * 3. selectMutants() — subclass-specific selection strategy
+ *
+ * Generators whose selection only depends on lines already visited (see
+ * supportsStreaming()) can also emit mutants incrementally: the streaming
+ * generate() overload parses files lazily and hands each mutant out as soon
+ * as its selection is final.
  */
 class MutantGenerator {
  public:
@@ -82,6 +91,32 @@ class MutantGenerator {
   Mutants generate(const SourceLines& sourceLines, std::size_t maxMutants, unsigned int randomSeed,
                    std::size_t mutantsPerLine = 1);
 
+  /**
+   * @brief Callback invoked for every selected mutant, in final selection order.
+   */
+  using MutantCallback = std::function<void(const Mutant&)>;
+
+  /**
+   * @brief Streaming variant of generate().
+   *
+   * Produces the same mutants in the same order as generate(), but invokes
+   * @p onSelected for each one as soon as it is selected. When the generator
+   * supports streaming, source files are parsed lazily in the order in which
+   * their first line appears in @p sourceLines, and the files being parsed are
+   * read from a snapshot taken up front so that concurrent in-place mutation
+   * of the source tree does not affect parsing. Otherwise all mutants are
+   * generated first and then handed out one by one.
+   *
+   * @param sourceLines list of target source lines (already shuffled)
+   * @param maxMutants limit number of generated mutables
+   * @param randomSeed random seed
+   * @param mutantsPerLine number of mutants to select per source line
+   * @param onSelected callback receiving each selected mutant
+   * @return selected mutants
+   */
+  Mutants generate(const SourceLines& sourceLines, std::size_t maxMutants, unsigned int randomSeed,
+                   std::size_t mutantsPerLine, const MutantCallback& onSelected);
+
   /**
    * @brief Set mutation operators to use. If empty, all operators are used.
    *
@@ -119,6 +154,43 @@ class MutantGenerator {
     return mLinesByPath;
   }
 
+  /**
+   * @brief Parse each source file in a worker process with these limits instead of a thread of sentinel.
+   *
+   * A worker that exceeds its limits does not stop the generation: its file
+   * is skipped (see getSkippedFiles()). Without limits (the default), files
+   * are parsed in threads.
+   *
+   * @param memoryLimit address space limit of a worker in MiB; nullopt = no limit
+   * @param timeout     time limit of a worker in seconds; nullopt = no limit
+   */
+  void setWorkerLimits(std::optional<std::size_t> memoryLimit, std::optional<std::size_t> timeout) {
+    mWorkerMemoryLimit = memoryLimit;
+    mWorkerTimeout = timeout;
+  }
+
+  /**
+   * @brief Keep the candidates of each parsed source file in this directory and reuse them in later runs.
+   *
+   * A file is not parsed again while its compile command, its target lines,
+   * its contents and the contents of every header it includes are unchanged.
+   * The streaming generate() (see supportsStreaming()) does not use the cache.
+   *
+   * @param dir cache directory; empty (the default) disables the cache
+   */
+  void setCandidateCacheDir(const std::filesystem::path& dir) {
+    mCandidateCacheDir = dir;
+  }
+
+  /**
+   * @brief Return the files the last generate() call found no mutants in because their worker failed.
+   *
+   * @return map of source file path to the reason it was skipped
+   */
+  const std::map<std::filesystem::path, std::string>& getSkippedFiles() const {
+    return mSkippedFiles;
+  }
+
   /**
    * @brief Progress callback signature used by the generator while parsing source files.
    *
@@ -157,6 +229,15 @@ class MutantGenerator {
     }
   }
 
+  /**
+   * @brief Return true if selectMutants() visits lines in their given order and only
+   *        depends on the candidates of lines already visited, so that the streaming
+   *        generate() can select mutants before all files are parsed.
+   */
+  virtual bool supportsStreaming() const {
+    return false;
+  }
+
   /**
    * @brief Collect all mutant candidates via Clang AST traversal.
    *        Override to extend AST visitor behavior (e.g., depth tracking).
@@ -166,6 +247,101 @@ class MutantGenerator {
    */
   virtual Mutants collectAllMutants(const SourceLines& sourceLines);
 
+  /**
+   * @brief Collect mutant candidates of a single source file.
+   *
+   * @param compileDb compilation database
+   * @param filename source file to parse
+   * @param lines target line numbers in the file
+   * @return mutant candidates found on the target lines, and the files read while parsing
+   */
+  FileCandidates collectMutantsForFile(const clang::tooling::CompilationDatabase& compileDb,
+                                       const std::filesystem::path& filename,
+                                       const std::vector<std::size_t>& lines) const;
+
+  /**
+   * @brief Run the actions of @p factory on a single source file.
+   *
+   * @param compileDb compilation database
+   * @param filename source file to parse
+   * @param factory creates the action run on the file
+   * @param includes set to the absolute paths of the files the preprocessor read,
+   *                 or cleared if the file could not be parsed without errors
+   */
+  void runTool(const clang::tooling::CompilationDatabase& compileDb, const std::filesystem::path& filename,
+               clang::tooling::FrontendActionFactory* factory, std::vector<std::string>* includes) const;
+
+  /**
+   * @brief Callable parsing the file at @p index of the file list of collectFilesInParallel().
+   */
+  using FileCollector =
+      std::function<FileCandidates(std::size_t index, const clang::tooling::CompilationDatabase& compileDb)>;
+
+  /**
+   * @brief Return the candidates @p collectFile finds in each of @p files, parsed on a pool of threads.
+   *
+   * The compile commands of all files are looked up first, so that each call
+   * gets a database of its own file instead of sharing the loaded one. Files
+   * are handed out largest first, so that a large translation unit does not
+   * start last and keep a single thread busy after the others are done. The
+   * result is in the order of @p files, whatever the scheduling. Progress is
+   * reported after each file. If a call throws, the remaining files are
+   * skipped and the exception is rethrown.
+   *
+   * With a candidate cache (see setCandidateCacheDir()), only the files
+   * missing from the cache are parsed, and their candidates are stored
+   * afterwards. An entry is keyed by the compile commands of its file and
+   * its text in @p cacheKeys, which must cover everything else the result
+   * of @p collectFile depends on.
+   *
+   * With worker limits (see setWorkerLimits()), the files are parsed in
+   * worker processes instead (see collectInWorkers()), as many at a time as
+   * the available memory allows with the memory limit.
+   *
+   * @param files       source files to parse
+   * @param cacheKeys   cache key text of each file
+   * @param collectFile called once per file, from any thread
+   * @return candidates of each file
+   */
+  std::vector<FileCandidates> collectFilesInParallel(const std::vector<std::filesystem::path>& files,
+                                                     const std::vector<std::string>& cacheKeys,
+                                                     const FileCollector& collectFile);
+
+  /**
+   * @brief Parse the files at @p order of @p files in worker processes with the worker limits.
+   *
+   * A file whose worker runs out of time is parsed again once the others are
+   * done, alone and with twice the time, since it may have been slowed down
+   * by the other workers. A file whose worker runs out of time again, runs
+   * out of memory, crashes or fails is added to the skipped files.
+   *
+   * @param files      source files
+   * @param order      indices in @p files of the files to parse, in the order to start them
+   * @param jobs       maximum number of workers running at a time
+   * @param collect    called in the worker of each file
+   * @param results    candidates of each file, by index in @p files
+   * @param onFileDone called after each file parsed or skipped
+   */
+  void collectInWorkers(const std::vector<std::filesystem::path>& files, const std::vector<std::size_t>& order,
+                        std::size_t jobs, const std::function<FileCandidates(std::size_t index)>& collect,
+                        std::vector<FileCandidates>* results, const std::function<void()>& onFileDone);
+
+  /**
+   * @brief Return the file system Clang tools should parse from.
+   *
+   * Always an isolated physical file system, so that a ClangTool changing its
+   * working directory does not change the process working directory. While a
+   * snapshot is active, the snapshotted sources are served from memory.
+   */
+  llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> createFileSystem() const;
+
+  /**
+   * @brief Copy the current contents of all files in @p sourceLines into memory.
+   *
+   * @param sourceLines target source lines whose files are snapshotted
+   */
+  void snapshotSources(const SourceLines& sourceLines);
+
   /**
    * @brief Build index from collected mutants for efficient lookup.
    *
@@ -250,6 +426,35 @@ class MutantGenerator {
   Mutants selectFromRange(const Range& range, std::size_t maxMutants,
                           unsigned int randomSeed, const CandidateIndex& index,
                           LineExtractor getLine, std::size_t mutantsPerLine) {
+    return streamFromRange(range, maxMutants, randomSeed,
+                           [&index](const std::filesystem::path&) -> const CandidateIndex& { return index; },
+                           getLine, mutantsPerLine, MutantCallback{});
+  }
+
+  /**
+   * @brief Generalization of selectFromRange() used by the streaming generate().
+   *
+   * The candidate index is looked up per line through @p getIndex, which may
+   * parse the line's file on first use, and every newly selected mutant is
+   * passed to @p onSelected (if set) before the next line is visited.
+   *
+   * @tparam Range iterable container type
+   * @tparam IndexLookup callable: (const std::filesystem::path& rawPath) -> const CandidateIndex&
+   * @tparam LineExtractor callable: (const element&) -> const SourceLine&
+   * @param range iteration source
+   * @param maxMutants maximum number of mutants to select (0 = unlimited)
+   * @param randomSeed seed for the random number generator
+   * @param getIndex returns the candidate index covering a source file
+   * @param getLine extracts a SourceLine from each range element
+   * @param mutantsPerLine number of mutants to select per source line
+   * @param onSelected optional callback receiving each selected mutant
+   * @return selected mutants
+   */
+  template <typename Range, typename IndexLookup, typename LineExtractor>
+  Mutants streamFromRange(const Range& range, std::size_t maxMutants,
+                          unsigned int randomSeed, IndexLookup getIndex,
+                          LineExtractor getLine, std::size_t mutantsPerLine,
+                          const MutantCallback& onSelected) {
     std::set<Mutant> selectedSet;
     Mutants result;
     std::mt19937 rng(randomSeed);
@@ -260,6 +465,7 @@ class MutantGenerator {
     for (const auto& elem : range) {
       const auto& line = getLine(elem);
       std::filesystem::path rawPath = line.getPath();
+      const CandidateIndex& index = getIndex(rawPath);
       auto emplaceResult = pathCache.emplace(rawPath, std::filesystem::path{});
       if (emplaceResult.second) {
         emplaceResult.first->second = std::filesystem::canonical(rawPath);
@@ -285,7 +491,13 @@ class MutantGenerator {
           effectivePerLine = remaining;
         }
       }
+      const std::size_t selectedBefore = result.size();
       selectUniqueCandidates(&candidates, &rng, &selectedSet, &result, effectivePerLine);
+      if (onSelected) {
+        for (std::size_t i = selectedBefore; i < result.size(); ++i) {
+          onSelected(result[i]);
+        }
+      }
     }
 
     mCandidateCount = candidateLineCount;
@@ -302,6 +514,19 @@ class MutantGenerator {
   std::map<std::filesystem::path, std::size_t> mLinesByPath;
   /// @brief Optional progress callback (no-op when unset).
   ProgressCallback mProgressCallback;
+  /// @brief Address space limit of a worker process in MiB; nullopt = no limit.
+  std::optional<std::size_t> mWorkerMemoryLimit;
+  /// @brief Time limit of a worker process in seconds; nullopt = no limit.
+  std::optional<std::size_t> mWorkerTimeout;
+  /// @brief Directory of the candidate cache; empty = no cache.
+  std::filesystem::path mCandidateCacheDir;
+  /// @brief Files skipped by the last generate() call, with the reason.
+  std::map<std::filesystem::path, std::string> mSkippedFiles;
+  /// @brief In-memory copies of the target sources while a streaming generate() runs.
+  llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> mSnapshot;
+  /// @brief Cached compilation database and the modification time of the file it was loaded from.
+  mutable std::shared_ptr<clang::tooling::CompilationDatabase> mCompileDb;
+  mutable std::filesystem::file_time_type mCompileDbTime;
 
   /**
    * @brief SentinelASTVisitor — shared AST visitor for mutant collection.
@@ -414,10 +639,14 @@ class MutantGenerator {
   /**
    * @brief Load the compilation database from mDbPath.
    *
-   * @return owned compilation database
+   * The database is kept and reused by later calls for as long as
+   * compile_commands.json is not modified, so that repeated generate() calls
+   * (e.g. in --watch mode) do not parse it again.
+   *
+   * @return compilation database
    * @throws IOException when the database cannot be loaded.
    */
-  std::unique_ptr<clang::tooling::CompilationDatabase> loadCompilationDatabase() const;
+  std::shared_ptr<clang::tooling::CompilationDatabase> loadCompilationDatabase() const;
 
   /**
    * @brief Throw a std::runtime_error reporting out-of-memory while generating
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_MUTANTPLAN_HPP_
+#define INCLUDE_SENTINEL_MUTANTPLAN_HPP_
+
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <optional>
+#include <string>
+#include "sentinel/Config.hpp"
+#include "sentinel/Mutants.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Full mutant list of a run, written by --generate-only and read by --plan.
+ *
+ * Holds everything GenerationStage would otherwise compute by parsing the
+ * sources: the selected mutants in selection order, the seed and generation
+ * scope, the candidate count, and the number of mutable lines per file. Each
+ * mutated file is recorded with its git blob hash so that a job importing the
+ * plan into a different checkout fails before building anything.
+ */
+struct MutantPlan {
+  /** @brief Plan file format version; bump when the layout changes. */
+  static constexpr int kFormatVersion = 1;
+
+  /** @brief Recorded state of one mutated source file. */
+  struct SourceFile {
+    std::string hash;         ///< git blob hash of the file contents
+    std::size_t lines = 0;    ///< Mutable lines found in the file
+  };
+
+  std::string programVersion;  ///< Version of sentinel that wrote the plan
+  unsigned int seed = 0;  ///< Seed used for the selection
+  std::size_t candidateCount = 0;  ///< Total candidate lines before selection
+  Generator generator = Generator::UNIFORM;  ///< Generator that selected the mutants
+  std::size_t mutantsPerLine = 1;  ///< --mutants-per-line of the generation
+  std::optional<std::string> from;  ///< Diff base revision of the generation
+  bool uncommitted = false;  ///< Whether uncommitted changes were included
+  std::size_t limit = 0;  ///< Mutant limit of the generation (0 = unlimited)
+  std::map<std::filesystem::path, SourceFile> files;  ///< Mutated files, relative to the source directory
+  Mutants mutants;  ///< Selected mutants, in selection (ID) order
+
+  /**
+   * @brief Record the hash of every file that has a mutant.
+   *
+   * @param sourceDir Source directory the mutant paths are relative to.
+   * @throws std::runtime_error if a mutated file cannot be read.
+   */
+  void hashSources(const std::filesystem::path& sourceDir);
+
+  /**
+   * @brief Throw if a mutated file differs from the one the plan was generated from.
+   *
+   * @param sourceDir Source directory of this checkout.
+   * @throws std::runtime_error listing the files that are missing or changed.
+   */
+  void verify(const std::filesystem::path& sourceDir) const;
+
+  /**
+   * @brief Return the mutable lines per file keyed by canonical path, as MutantGenerator::getLinesByPath() does.
+   */
+  std::map<std::filesystem::path, std::size_t> getLinesByPath(const std::filesystem::path& sourceDir) const;
+
+  /**
+   * @brief Write the plan as YAML.
+   *
+   * @throws std::runtime_error if the file cannot be written.
+   */
+  void save(const std::filesystem::path& path) const;
+
+  /**
+   * @brief Read a plan written by save().
+   *
+   * @throws std::runtime_error if the file is missing, malformed, of another format
+   *         version, or written by another version of sentinel.
+   */
+  static MutantPlan load(const std::filesystem::path& path);
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_MUTANTPLAN_HPP_
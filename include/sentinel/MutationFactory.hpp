@@ -7,6 +7,7 @@
 #define INCLUDE_SENTINEL_MUTATIONFACTORY_HPP_
 
 #include <filesystem>  // NOLINT
+#include <map>
 #include <memory>
 #include "sentinel/MutantGenerator.hpp"
 #include "sentinel/Mutants.hpp"
@@ -41,8 +42,36 @@ class MutationFactory {
   Mutants generate(const std::filesystem::path& gitPath, const SourceLines& sourceLines, std::size_t maxMutants,
                    unsigned int randomSeed, std::size_t mutantsPerLine = 1);
 
+  /**
+   * @brief Generate mutables and hand each one to @p onGenerated as soon as it is selected
+   *
+   * The mutants passed to the callback already carry paths relative to @p gitPath.
+   *
+   * @param gitPath path to git repo
+   * @param sourceLines lines of the source
+   * @param maxMutants maximum number of mutables generated
+   * @param randomSeed random seed
+   * @param mutantsPerLine number of mutants to select per source line
+   * @param onGenerated callback receiving each mutant in final order
+   * @return list of mutables
+   */
+  Mutants generate(const std::filesystem::path& gitPath, const SourceLines& sourceLines, std::size_t maxMutants,
+                   unsigned int randomSeed, std::size_t mutantsPerLine,
+                   const MutantGenerator::MutantCallback& onGenerated);
+
  private:
   std::shared_ptr<MutantGenerator> mGenerator;
+
+  /**
+   * @brief Return the canonical source root, throwing IOException if it cannot be resolved.
+   */
+  static std::filesystem::path canonicalRoot(const std::filesystem::path& gitPath);
+
+  /**
+   * @brief Return a copy of @p m whose path is relative to @p root.
+   */
+  static Mutant toRelative(const Mutant& m, const std::filesystem::path& root,
+                           std::map<std::filesystem::path, std::filesystem::path>* canonCache);
 };
 
 }  // namespace sentinel
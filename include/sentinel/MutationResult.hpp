@@ -121,6 +121,38 @@ class MutationResult {
    */
   void setUncovered(bool uncovered);
 
+  /**
+   * @brief Return true if the verdict was reused from the verdict cache
+   *        instead of building and testing the mutant in this run.
+   *
+   * @return true if cached
+   */
+  bool isCached() const;
+
+  /**
+   * @brief Set the cached flag.
+   *
+   * @param cached true if the verdict was reused from the verdict cache
+   */
+  void setCached(bool cached);
+
+  /**
+   * @brief Return true if the weak-mutation pre-screen found that no test
+   *        ever executed the mutated expression with values where the
+   *        original and the mutant differ (classified as SURVIVED without
+   *        building the mutant).
+   *
+   * @return true if not infected
+   */
+  bool isNotInfected() const;
+
+  /**
+   * @brief Set the not-infected flag.
+   *
+   * @param notInfected true if the pre-screen never saw the mutant's state infected
+   */
+  void setNotInfected(bool notInfected);
+
  private:
   std::string mKillingTest;
   std::string mErrorTest;
@@ -129,6 +161,8 @@ class MutationResult {
   double mBuildSecs = 0.0;
   double mTestSecs = 0.0;
   bool mUncovered = false;
+  bool mCached = false;
+  bool mNotInfected = false;
 };
 
 std::ostream& operator<<(std::ostream& out, const MutationResult& mr);
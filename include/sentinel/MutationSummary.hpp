@@ -9,6 +9,8 @@
 #include <cstddef>
 #include <filesystem>  // NOLINT
 #include <map>
+#include <optional>
+#include <utility>
 #include <vector>
 #include "sentinel/MutationResult.hpp"
 #include "sentinel/MutationResults.hpp"
@@ -71,6 +73,31 @@ struct MutationSummary {
   double totalTestSecs = 0.0;       ///< Cumulative test duration across all states
   std::size_t timedMutantCount = 0;  ///< Number of mutants with timing data
 
+  /// Mutants in the run when the results are a sample of it (--time-budget); 0 = every mutant was evaluated
+  std::size_t plannedMutantCount = 0;
+
+  /** @brief Return true if the results are a sample of the run's mutants. */
+  bool isSampled() const;
+
+  /**
+   * @brief Return the 95% confidence interval of the mutation score, in percent, for a sampled run.
+   *
+   * The killed/valid ratio of the sample estimates the score of all planned mutants;
+   * see getWilsonInterval(). Returns nullopt if the results are not a sample or no
+   * mutant counts towards the score.
+   */
+  std::optional<std::pair<double, double>> getScoreInterval() const;
+
+  /**
+   * @brief Return the 95% Wilson score interval, as fractions, of @p detected out of @p total
+   *        sampled without replacement from @p population.
+   *
+   * The finite population correction narrows the interval as the sample approaches the
+   * population; a sample of the whole population gives the observed ratio.
+   */
+  static std::pair<double, double> getWilsonInterval(std::size_t detected, std::size_t total,
+                                                     std::size_t population);
+
   /**
    * @brief Construct and aggregate from in-memory results.
    *
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_NINJAGRAPH_HPP_
+#define INCLUDE_SENTINEL_NINJAGRAPH_HPP_
+
+#include <filesystem>  // NOLINT
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace sentinel {
+
+/**
+ * @brief Finds the Ninja targets that have to be rebuilt when a source file changes.
+ *
+ * The build graph is read with `ninja -t query`, starting from the source file
+ * and following the outputs of each edge up to the final targets (executables,
+ * libraries) that nothing else is built from. Phony edges (aliases such as
+ * `all`) are not followed, so building the returned targets rebuilds only what
+ * depends on the source file. Query results are cached for the lifetime of the
+ * graph.
+ */
+class NinjaGraph {
+ public:
+  /** @brief Environment variable holding the affected targets while the test command runs. */
+  static constexpr const char* kAffectedTargetsEnv = "SENTINEL_AFFECTED_TARGETS";
+
+  /**
+   * @brief Runs `ninja -t query` for one target.
+   *        Returns the output, or std::nullopt if the target is unknown.
+   */
+  using QueryFunction = std::function<std::optional<std::string>(const std::string& target)>;
+
+  /** @brief One node of the build graph, as printed by `ninja -t query`. */
+  struct Node {
+    std::string rule;  ///< Rule of the edge building the node (empty for source files)
+    std::vector<std::string> outputs;  ///< Nodes built from this node
+  };
+
+  /**
+   * @brief Construct a graph for the Ninja build in @p buildDir.
+   */
+  explicit NinjaGraph(const std::filesystem::path& buildDir);
+
+  /**
+   * @brief Construct a graph that reads nodes through @p query (for tests).
+   */
+  NinjaGraph(const std::filesystem::path& buildDir, QueryFunction query);
+
+  /**
+   * @brief Return true if @p buildDir contains a build.ninja file.
+   */
+  static bool isNinjaBuild(const std::filesystem::path& buildDir);
+
+  /**
+   * @brief Parse the output of `ninja -t query` for a single target.
+   */
+  static Node parseQuery(const std::string& output);
+
+  /**
+   * @brief Return the final targets built from @p source.
+   *
+   * @param source Absolute path of a source file.
+   * @return target paths as known to Ninja, or an empty list if the file is not in the graph.
+   */
+  std::vector<std::string> getAffectedTargets(const std::filesystem::path& source);
+
+  /**
+   * @brief Return the shell command that builds only @p targets.
+   */
+  std::string getBuildCommand(const std::vector<std::string>& targets) const;
+
+ private:
+  bool collectTargets(const std::string& target, std::vector<std::string>* result);
+  const std::optional<Node>& getNode(const std::string& target);
+
+  std::filesystem::path mBuildDir;
+  QueryFunction mQuery;
+  std::map<std::string, std::optional<Node>> mNodes;
+  std::map<std::string, std::vector<std::string>> mTargetsByNode;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_NINJAGRAPH_HPP_
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_OVERLAPPEDSTAGE_HPP_
+#define INCLUDE_SENTINEL_OVERLAPPEDSTAGE_HPP_
+
+#include <memory>
+#include "sentinel/Stage.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Runs an independent stage in the background of another one as one link of the chain.
+ *
+ * The foreground stage executes on the calling thread and owns the status line phase.
+ * The background stage executes on a helper thread with ctx->foregroundResult set; it
+ * must not persist anything before that result is available, and must drop its work
+ * and return false when the result is false. The chain continues only after both
+ * stages have finished.
+ *
+ * If the foreground stage fails, its exception is rethrown once the background stage
+ * has stopped. If the background stage fails, its exception is rethrown after the
+ * foreground stage completes. When either stage is skipped, the other one runs alone,
+ * exactly as it would in a plain chain.
+ */
+class OverlappedStage : public Stage {
+ public:
+  /**
+   * @brief Constructor.
+   * @param foreground Stage run on the calling thread (e.g. the original test run).
+   * @param background Stage run on a helper thread meanwhile (e.g. mutant generation).
+   */
+  OverlappedStage(std::shared_ptr<Stage> foreground, std::shared_ptr<Stage> background);
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override;
+  StatusLine::Phase getPhase() const override;
+  bool execute(PipelineContext* ctx) override;
+
+ private:
+  std::shared_ptr<Stage> mForeground;
+  std::shared_ptr<Stage> mBackground;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_OVERLAPPEDSTAGE_HPP_
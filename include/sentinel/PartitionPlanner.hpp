@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_PARTITIONPLANNER_HPP_
+#define INCLUDE_SENTINEL_PARTITIONPLANNER_HPP_
+
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include "sentinel/Config.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Decides which mutants of the full mutant list belong to each --partition.
+ *
+ * By count, partition N of TOTAL gets the N-th of TOTAL equally sized
+ * contiguous slices. By cost, the mutants of one source file are kept together
+ * and the files are assigned, most expensive first, to the partition with the
+ * lowest total cost so far. A file that costs more than an even share is split
+ * into consecutive chunks. The cost of a mutant is the mean build and test time
+ * of the mutants of its file in a previous run, or one unit if unknown.
+ *
+ * The plan depends only on the mutant list and the cost table, so partitions
+ * generated with the same seed and the same cost table never overlap.
+ */
+class PartitionPlanner {
+ public:
+  /** @brief Value of --partition-by that slices by mutant count. */
+  static constexpr const char* kByCount = "count";
+  /** @brief Value of --partition-by that balances by cost. */
+  static constexpr const char* kByCost = "cost";
+
+  /**
+   * @brief Construct a planner that slices by mutant count.
+   */
+  PartitionPlanner();
+
+  /**
+   * @brief Construct a planner that balances by cost.
+   *
+   * @param fileCosts Cost of one mutant per source file (path relative to the source directory).
+   *                  Files without an entry cost the mean of all entries, or 1 if there are none.
+   */
+  explicit PartitionPlanner(std::map<std::filesystem::path, double> fileCosts);
+
+  /**
+   * @brief Create the planner selected by --partition-by and --partition-costs.
+   *
+   * @throws std::runtime_error if the cost workspace cannot be read.
+   */
+  static PartitionPlanner fromConfig(const Config& config);
+
+  /**
+   * @brief Read the mean build and test time per source file from the mt.done files of a workspace.
+   *
+   * Mutants without timing (uncovered, cached) are ignored.
+   *
+   * @param workspaceDir Workspace of a previous run.
+   * @throws std::runtime_error if @p workspaceDir is not a sentinel workspace.
+   */
+  static std::map<std::filesystem::path, double> loadFileCosts(const std::filesystem::path& workspaceDir);
+
+  /**
+   * @brief Split a mutant list into partitions.
+   *
+   * @param files Source file of each mutant, in list order.
+   * @param count Number of partitions.
+   * @return for each partition, the ascending list positions of its mutants.
+   */
+  std::vector<std::vector<std::size_t>> plan(const std::vector<std::filesystem::path>& files,
+                                             std::size_t count) const;
+
+  /**
+   * @brief Return the strategy recorded in status.yaml: "count", or "cost:" and a fingerprint of the cost table.
+   *
+   * Partitions can only be merged if they were planned with the same strategy.
+   */
+  std::string getStrategy() const;
+
+ private:
+  double getCost(const std::filesystem::path& file) const;
+
+  std::optional<std::map<std::filesystem::path, double>> mFileCosts;
+  double mDefaultCost = 1.0;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_PARTITIONPLANNER_HPP_
@@ -19,6 +19,12 @@ namespace sentinel {
  *
  * Validates source workspaces, checks config compatibility, copies mutant
  * result files, and tracks merge completeness.
+ *
+ * Files are cloned (reflink) when the file system supports it and copied
+ * otherwise; hard links are only made on request, since a resumed or watched
+ * workspace rewrites its files in place. Partitions are merged in parallel. In
+ * index-only mode, the build and test logs of the mutants are not copied but
+ * linked symbolically to the source workspaces, which must then be kept.
  */
 class PartitionedWorkspaceMerger {
  public:
@@ -28,10 +34,12 @@ class PartitionedWorkspaceMerger {
    * @param targetDir  Path to the target (merged) workspace.
    * @param sourceDirs Paths to partitioned source workspaces.
    * @param force      Allow overwriting identical existing files.
+   * @param indexOnly  Reference the mutant logs in the source workspaces instead of copying them.
+   * @param hardLink   Hard-link files that cannot be cloned instead of copying them.
    */
   PartitionedWorkspaceMerger(const std::filesystem::path& targetDir,
                              const std::vector<std::filesystem::path>& sourceDirs,
-                             bool force);
+                             bool force, bool indexOnly = false, bool hardLink = false);
 
   /**
    * @brief Execute the merge operation.
@@ -47,6 +55,8 @@ class PartitionedWorkspaceMerger {
   std::filesystem::path mTargetDir;
   std::vector<std::filesystem::path> mSourceDirs;
   bool mForce;
+  bool mIndexOnly;
+  bool mHardLink;
   mutable std::map<std::filesystem::path, WorkspaceStatus> mStatusCache;
 
   void validateSource(const std::filesystem::path& sourceDir) const;
@@ -56,11 +66,17 @@ class PartitionedWorkspaceMerger {
   void copyMutants(const std::filesystem::path& sourceDir) const;
   void copyFileWithConflictCheck(const std::filesystem::path& src,
                                  const std::filesystem::path& dst) const;
+  void linkFileWithConflictCheck(const std::filesystem::path& src,
+                                 const std::filesystem::path& dst) const;
+  void checkConflict(const std::filesystem::path& src,
+                     const std::filesystem::path& dst) const;
   void updateCompleteness() const;
 
   static std::string loadConfigWithoutExcludedFields(
       const std::filesystem::path& sourceDir);
   static std::string readFileContent(const std::filesystem::path& path);
+  static void cloneOrCopyFile(const std::filesystem::path& src,
+                              const std::filesystem::path& dst, bool hardLink);
 };
 
 }  // namespace sentinel
@@ -6,12 +6,21 @@
 #ifndef INCLUDE_SENTINEL_PIPELINECONTEXT_HPP_
 #define INCLUDE_SENTINEL_PIPELINECONTEXT_HPP_
 
+#include <future>
+#include <utility>
 #include "sentinel/Config.hpp"
+#include "sentinel/Mutant.hpp"
 #include "sentinel/StatusLine.hpp"
 #include "sentinel/Workspace.hpp"
+#include "sentinel/util/BoundedQueue.hpp"
 
 namespace sentinel {
 
+/**
+ * @brief Stream of (mutant ID, mutant) pairs handed from generation to evaluation.
+ */
+using MutantQueue = BoundedQueue<std::pair<int, Mutant>>;
+
 /**
  * @brief Shared pipeline state passed to every stage via execute().
  */
@@ -19,6 +28,11 @@ struct PipelineContext {
   const Config& config;      ///< Fully resolved configuration (read-only).
   StatusLine& statusLine;    ///< Shared status line for phase and progress updates.
   Workspace& workspace;      ///< Shared workspace for persistence.
+  /// Set only while a ConcurrentStage runs: generation pushes mutants, evaluation pops them.
+  MutantQueue* mutantQueue = nullptr;
+  /// Set only for the background stage of an OverlappedStage: becomes true once the
+  /// foreground stage succeeded, or false if it failed and the background work is unwanted.
+  const std::shared_future<bool>* foregroundResult = nullptr;
 };
 
 }  // namespace sentinel
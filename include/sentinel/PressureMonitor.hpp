@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_PRESSUREMONITOR_HPP_
+#define INCLUDE_SENTINEL_PRESSUREMONITOR_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include "sentinel/Config.hpp"
+#include "sentinel/Jobserver.hpp"
+#include "sentinel/util/PeriodicTask.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Adapts the number of jobserver tokens to the pressure of the host (--pressure-target).
+ *
+ * Each update() reads the pressure stall information (the avg10 value of the
+ * `some` line) of every targeted resource. While any of them is above its
+ * target, one more token is held back from the pool, down to a single job.
+ * Once all of them are below kReleaseRatio of their targets, one held token is
+ * given back. A token that is in use when it should be held back is taken as
+ * soon as it is returned. Every change of the job limit is logged, and the
+ * held tokens are given back on destruction.
+ */
+class PressureMonitor {
+ public:
+  /** @brief Time between two updates once start() has been called. */
+  static constexpr std::chrono::milliseconds kInterval{5000};
+  /** @brief Share of its target a resource's pressure must fall below before a token is given back. */
+  static constexpr double kReleaseRatio = 0.8;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param jobserver Pool whose tokens are held back; must outlive the monitor.
+   * @param targets   Pressure targets.
+   * @param files     Pressure file of each resource (see findPressureFiles()).
+   */
+  PressureMonitor(const Jobserver& jobserver, std::vector<PressureTarget> targets,
+                  std::map<std::string, std::filesystem::path> files);
+
+  ~PressureMonitor();
+
+  PressureMonitor(const PressureMonitor&) = delete;
+  PressureMonitor& operator=(const PressureMonitor&) = delete;
+
+  /**
+   * @brief Return the pressure files of this process: those of its cgroup (cgroup v2)
+   *        if they exist, otherwise those of the whole system under /proc/pressure.
+   */
+  static std::map<std::string, std::filesystem::path> findPressureFiles();
+
+  /**
+   * @brief Return the avg10 value of the `some` line of a pressure file, or nullopt if it cannot be read.
+   */
+  static std::optional<double> readPressure(const std::filesystem::path& file);
+
+  /**
+   * @brief Call update() every kInterval on a background thread until destruction.
+   */
+  void start();
+
+  /**
+   * @brief Read the pressures and adjust the number of tokens held back.
+   */
+  void update();
+
+  /**
+   * @brief Return the current job limit (the number of tokens not held back).
+   */
+  std::size_t getLimit() const;
+
+ private:
+  const Jobserver& mJobserver;
+  std::vector<PressureTarget> mTargets;
+  std::map<std::string, std::filesystem::path> mFiles;
+  std::size_t mLimit;
+  std::vector<char> mHeld;
+  std::optional<PeriodicTask> mTask;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_PRESSUREMONITOR_HPP_
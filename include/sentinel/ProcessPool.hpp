@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_PROCESSPOOL_HPP_
+#define INCLUDE_SENTINEL_PROCESSPOOL_HPP_
+
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace sentinel {
+
+/**
+ * @brief Runs jobs in forked child processes, a few at a time, each with a memory and a time limit.
+ *
+ * Each job runs in a child of its own, which returns the string the job
+ * returns through a pipe. The child limits its address space (RLIMIT_AS) and
+ * exits when an allocation fails, instead of running the out-of-memory
+ * handling of sentinel (see installOomHandlers()); a child that exceeds the
+ * time limit is killed. A failing job therefore never takes sentinel down.
+ *
+ * Unlike Subprocess, any number of pools may run at a time, on any thread.
+ */
+class ProcessPool {
+ public:
+  /** @brief Exit code of a child that ran out of memory. */
+  static constexpr int kOutOfMemoryExitCode = 137;
+  /** @brief Exit code of a child whose job threw an exception or hit an LLVM fatal error. */
+  static constexpr int kFailureExitCode = 1;
+
+  /**
+   * @brief How a job ended.
+   */
+  enum class Status {
+    SUCCEEDED,      ///< The job returned; the result holds what it returned.
+    FAILED,         ///< The job threw or hit a fatal error; the result holds the error message.
+    OUT_OF_MEMORY,  ///< An allocation failed, or the child was killed by the kernel (SIGKILL).
+    TIMED_OUT,      ///< The child was killed after the time limit.
+    CRASHED,        ///< The child was killed by another signal; the result holds the signal name.
+  };
+
+  /**
+   * @brief Result of a job.
+   */
+  struct Result {
+    Status status = Status::FAILED;  ///< How the job ended.
+    std::string output;              ///< Output or error message, see Status.
+  };
+
+  /** @brief Job run in a child; returns the output handed to the parent. */
+  using Job = std::function<std::string(std::size_t index)>;
+  /** @brief Called in the parent when a job has ended; may throw to stop the pool. */
+  using Callback = std::function<void(std::size_t index, const Result& result)>;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param jobs        Maximum number of children running at a time (at least 1).
+   * @param memoryLimit Address space limit of each child in bytes; nullopt = no limit.
+   * @param timeout     Time limit of each child in seconds; nullopt = no limit.
+   */
+  ProcessPool(std::size_t jobs, std::optional<std::size_t> memoryLimit, std::optional<std::size_t> timeout);
+
+  /**
+   * @brief Run @p job for each of @p indices, in their order, and wait for all of them.
+   *
+   * @p onDone is called on the calling thread as the jobs end. If it throws,
+   * the running children are killed and the exception is rethrown.
+   *
+   * @throw std::runtime_error if a pipe cannot be created or a child cannot be forked.
+   */
+  void run(const std::vector<std::size_t>& indices, const Job& job, const Callback& onDone) const;
+
+  /**
+   * @brief Return the memory available for new processes (MemAvailable) in bytes, or nullopt if unknown.
+   *
+   * @param meminfo File in the format of /proc/meminfo.
+   */
+  static std::optional<std::size_t> getAvailableMemory(const std::filesystem::path& meminfo = "/proc/meminfo");
+
+ private:
+  std::size_t mJobs;
+  std::optional<std::size_t> mMemoryLimit;
+  std::optional<std::size_t> mTimeout;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_PROCESSPOOL_HPP_
@@ -6,6 +6,7 @@
 #ifndef INCLUDE_SENTINEL_RESULT_HPP_
 #define INCLUDE_SENTINEL_RESULT_HPP_
 
+#include <optional>
 #include <string>
 #include <vector>
 #include "sentinel/MutationState.hpp"
@@ -38,10 +39,12 @@ class Result {
    * @param mutated result
    * @param [out] killingTest
    * @param [out] errorTest
+   * @param selectedTests tests the mutant was run against (nullopt = all); the other tests are not compared
    * @return mutation's Result State
    */
   static MutationState compare(const Result& original, const Result& mutated, std::string* killingTest,
-                               std::string* errorTest);
+                               std::string* errorTest,
+                               const std::optional<std::vector<std::string>>& selectedTests = std::nullopt);
 
  private:
   std::vector<std::string> mPassedTC;
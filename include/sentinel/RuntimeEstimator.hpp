@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_RUNTIMEESTIMATOR_HPP_
+#define INCLUDE_SENTINEL_RUNTIMEESTIMATOR_HPP_
+
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <vector>
+#include "sentinel/PartitionPlanner.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Estimates the evaluation wall time of a mutant list.
+ *
+ * Each evaluated mutant costs one incremental rebuild of its file, one run of
+ * the test command, and one more rebuild of the same file when the next
+ * mutant's build picks up the restored original. The test time is the measured
+ * original test time; rebuild times are measured for a few sampled files, and
+ * every other file is assumed to cost the mean of the samples.
+ */
+class RuntimeEstimator {
+ public:
+  /**
+   * @brief Constructor.
+   *
+   * @param testSeconds    Wall time of one run of the test command.
+   * @param rebuildSeconds Measured incremental rebuild time per sampled file.
+   */
+  RuntimeEstimator(double testSeconds, std::map<std::filesystem::path, double> rebuildSeconds);
+
+  /**
+   * @brief Return the incremental rebuild time assumed for a file.
+   *
+   * @param file Source file of a mutant.
+   * @return the measured time if the file was sampled, otherwise the mean of all samples.
+   */
+  double getRebuildSeconds(const std::filesystem::path& file) const;
+
+  /**
+   * @brief Estimate the wall time of evaluating mutants in one run.
+   *
+   * @param files Source file of each mutant, in evaluation (ID) order.
+   * @return estimated wall time in seconds.
+   */
+  double estimate(const std::vector<std::filesystem::path>& files) const;
+
+  /**
+   * @brief Estimate the wall time of each partition when the list is split the way --partition does.
+   *
+   * @param files   Source file of each mutant, in evaluation (ID) order.
+   * @param count   Number of partitions.
+   * @param planner Assignment of mutants to partitions (--partition-by).
+   * @return estimated wall time in seconds of partitions 1..count.
+   */
+  std::vector<double> estimatePartitions(const std::vector<std::filesystem::path>& files, std::size_t count,
+                                         const PartitionPlanner& planner = PartitionPlanner()) const;
+
+  /**
+   * @brief Choose which files to measure the rebuild time of.
+   *
+   * Files are ranked by mutant count and picked evenly across that ranking,
+   * so that both heavily and lightly mutated files are represented.
+   *
+   * @param files      Source file of each mutant.
+   * @param maxSamples Maximum number of files to return.
+   * @return distinct files to sample.
+   */
+  static std::vector<std::filesystem::path> selectSamples(const std::vector<std::filesystem::path>& files,
+                                                          std::size_t maxSamples);
+
+ private:
+  double mTestSeconds;
+  std::map<std::filesystem::path, double> mRebuildSeconds;
+  double mMeanRebuildSeconds = 0.0;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_RUNTIMEESTIMATOR_HPP_
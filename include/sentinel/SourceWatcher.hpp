@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_SOURCEWATCHER_HPP_
+#define INCLUDE_SENTINEL_SOURCEWATCHER_HPP_
+
+#include <chrono>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <set>
+#include <vector>
+
+namespace sentinel {
+
+/**
+ * @brief Watches a source tree for saved files using inotify.
+ *
+ * Every directory below the root is watched, except hidden directories
+ * (e.g. .git) and the given skip directories (workspace, build tree, ...).
+ * Directories created later are picked up automatically.
+ */
+class SourceWatcher {
+ public:
+  /**
+   * @brief Constructor. Starts watching immediately.
+   *
+   * @param root     Directory to watch recursively.
+   * @param skipDirs Directories not to watch (need not exist).
+   * @throw std::runtime_error if inotify cannot be initialized.
+   */
+  SourceWatcher(const std::filesystem::path& root, const std::vector<std::filesystem::path>& skipDirs);
+
+  SourceWatcher(const SourceWatcher&) = delete;
+  SourceWatcher& operator=(const SourceWatcher&) = delete;
+
+  /**
+   * @brief Destructor. Closes the inotify descriptor.
+   */
+  ~SourceWatcher();
+
+  /**
+   * @brief Block until at least one file is written, then collect further
+   *        writes until none arrive for @p quietPeriod.
+   *
+   * @param quietPeriod Time without new events that ends a batch of changes.
+   * @return absolute paths of the files written or moved into place.
+   */
+  std::set<std::filesystem::path> waitForChanges(std::chrono::milliseconds quietPeriod);
+
+ private:
+  void addWatches(const std::filesystem::path& dir);
+  bool isSkipped(const std::filesystem::path& dir) const;
+  bool readEvents(int timeoutMs, std::set<std::filesystem::path>* changed);
+
+  int mFd = -1;
+  std::map<int, std::filesystem::path> mWatches;
+  std::vector<std::filesystem::path> mSkipDirs;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_SOURCEWATCHER_HPP_
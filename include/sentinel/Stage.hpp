@@ -19,6 +19,9 @@ namespace sentinel {
  * calls next->run() and returns its exit code.
  */
 class Stage {
+  friend class ConcurrentStage;
+  friend class OverlappedStage;
+
  public:
   Stage();
   Stage(const Stage&) = delete;
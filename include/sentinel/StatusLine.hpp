@@ -7,6 +7,7 @@
 #define INCLUDE_SENTINEL_STATUSLINE_HPP_
 
 #include <csignal>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <ftxui/dom/elements.hpp>
@@ -27,6 +28,9 @@ void handleSigwinch(int signum);
  * Uses ANSI scroll region (DECSTBM) to reserve the last terminal row for status display,
  * so normal log output scrolls above it without disturbing the status line.
  * Automatically disabled when stdout is not a TTY (pipe/redirect).
+ *
+ * Updates are serialized by an internal mutex so that a stage running on a
+ * background thread can report its own progress next to the current phase.
  */
 class StatusLine {
   friend void detail::handleSigtstp(int);
@@ -92,6 +96,23 @@ class StatusLine {
    */
   void setProgressCurrent(std::size_t current);
 
+  /**
+   * @brief Show the progress of work running in the background of the current phase and redraw.
+   *
+   * Displayed next to the phase label, e.g. while mutants are generated during
+   * the original test run.
+   *
+   * @param phase   Phase of the background work.
+   * @param current Completed progress steps.
+   * @param total   Total progress steps.
+   */
+  void setBackgroundProgress(Phase phase, std::size_t current, std::size_t total);
+
+  /**
+   * @brief Remove the background progress shown by setBackgroundProgress() and redraw.
+   */
+  void clearBackgroundProgress();
+
   /**
    * @brief Record the result of the last mutant and redraw.
    *
@@ -101,6 +122,11 @@ class StatusLine {
    */
   void recordResult(MutationState state, bool uncovered);
 
+  /**
+   * @brief Reset the progress and the recorded results, e.g. before evaluating the mutants again.
+   */
+  void resetCounters();
+
   /**
    * @brief Set dry-run mode indicator and redraw.
    *
@@ -135,7 +161,7 @@ class StatusLine {
   ftxui::Element buildSummaryElement() const;
   ftxui::Element buildProgressElement(std::size_t current) const;
   std::string renderToString(const ftxui::Element& element) const;
-  std::string phaseLabel() const;
+  static std::string phaseLabel(Phase phase);
   int countWidth() const;
   void installSignalHandlers();
   void uninstallSignalHandlers();
@@ -163,6 +189,14 @@ class StatusLine {
   std::size_t mSurvived = 0;
   std::size_t mAbnormal = 0;  ///< Combined BUILD_FAILURE + TIMEOUT + RUNTIME_ERROR count.
   std::size_t mUncovered = 0;  ///< Subset of mSurvived that were lcov-skipped.
+  bool mHasBackground = false;
+  Phase mBackgroundPhase = Phase::INIT;
+  std::size_t mBackgroundCurrent = 0;
+  std::size_t mBackgroundTotal = 0;
+  /// Guards state and terminal writes of the setters. enable() and disable() do not
+  /// lock: they run while no background stage is active, and disable() is also
+  /// called from signal handlers where locking is not async-signal-safe.
+  mutable std::mutex mMutex;
   Timestamper mTimestamper;
   /// Pre-built ANSI sequence used by deactivate(); cached so signal-context
   /// invocations via SIGTSTP do not allocate through fmt::format.
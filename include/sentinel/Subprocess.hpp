@@ -9,10 +9,13 @@
 #include <unistd.h>
 #include <atomic>
 #include <filesystem>  // NOLINT
+#include <functional>
 #include <string>
 
 namespace sentinel {
 
+class Jobserver;
+
 /**
  * @brief Subprocess class
  *
@@ -41,9 +44,47 @@ class Subprocess {
   explicit Subprocess(const std::string& cmd, std::size_t sec = 0,
                       const std::filesystem::path& logFile = "", bool silent = false);
 
+  /**
+   * @brief Constructor for a function run in a forked child instead of a shell command.
+   *
+   * The child exits with the value @p fn returns. Timeout, output and signals
+   * are handled as for a command.
+   *
+   * @param fn        Function to run in the child.
+   * @param sec       Timeout in seconds (0 = no timeout).
+   * @param logFile   If non-empty, tee stdout/stderr to this file path.
+   * @param silent    If true, suppress stdout/stderr output to terminal (still written to logFile).
+   * @throw runtime_error when another Subprocess already running.
+   */
+  explicit Subprocess(std::function<int()> fn, std::size_t sec = 0,
+                      const std::filesystem::path& logFile = "", bool silent = false);
+
   Subprocess(const Subprocess&) = delete;
   Subprocess& operator=(const Subprocess&) = delete;
 
+  /**
+   * @brief Watch the output of the command line by line.
+   *
+   * The watcher is called for every complete line the command prints. When it
+   * returns true, the command's process group is killed with SIGKILL and the
+   * watcher is not called again; the output still in the pipe is consumed.
+   *
+   * @param watcher Returns true to stop the command.
+   */
+  void setOutputWatcher(std::function<bool(const std::string& line)> watcher);
+
+  /**
+   * @brief Run every command of this process under a jobserver.
+   *
+   * execute() then waits for a token of @p jobserver before it starts the
+   * command, exports the jobserver in MAKEFLAGS and gives the token back when
+   * the command has exited.
+   *
+   * @param jobserver Jobserver to use, or nullptr to run commands as they are.
+   *                  It must outlive every later call to execute().
+   */
+  static void setJobserver(const Jobserver* jobserver);
+
   /**
    * @brief execute cmd
    *
@@ -83,16 +124,27 @@ class Subprocess {
    */
   bool isSignalExit() const;
 
+  /**
+   * @brief check if the command was stopped by the output watcher
+   *
+   * @return true if the output watcher returned true for a line
+   */
+  bool isStoppedByWatcher() const;
+
  private:
   std::string mCmd;
+  std::function<int()> mFunction;
   std::size_t mSec;
   std::filesystem::path mLogFile;
   bool mSilent = false;
   bool mTimedOut = false;
+  std::function<bool(const std::string&)> mWatcher;
+  bool mStoppedByWatcher = false;
   int mStatus = -1;
   static std::atomic<pid_t> childPid;  ///< PID of the running child process.
   static std::atomic<bool> timedOut;  ///< Set to true by the SIGALRM handler.
   static std::atomic<int> pendSig;  ///< Pending signal to forward to child.
+  static const Jobserver* jobserver;  ///< Jobserver the commands run under, if any.
 };
 
 }  // namespace sentinel
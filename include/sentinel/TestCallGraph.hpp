@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_TESTCALLGRAPH_HPP_
+#define INCLUDE_SENTINEL_TESTCALLGRAPH_HPP_
+
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace sentinel {
+
+/**
+ * @brief Static call graph from Google Test cases to the functions they may call (static-test-selection).
+ *
+ * Every file of compile_commands.json is parsed with Clang. A function calls
+ * every function it names: direct and member calls, constructors (and the
+ * destructor of the constructed class), address-of, lambdas, and the
+ * candidates of unresolved calls in templates. A virtual function calls its
+ * overriders (except those of Google Test's own classes, which only the test
+ * runner calls), and a call through a dependent member name calls every
+ * function of that name. Functions are named as Mutant::getQualifiedFunction() names
+ * them; overloads and template instantiations share one node.
+ *
+ * A `TEST` or `TEST_F` body is the root of the test `Suite.Name`, and also
+ * calls every method of its fixture (SetUp, TearDown, ...). Other test bodies
+ * (`TEST_P`, `TYPED_TEST`, ...), `main` and the initializers of global
+ * variables are roots of unknown tests: a function reached from one of them
+ * is run against the whole test suite.
+ */
+class TestCallGraph {
+ public:
+  /** @brief Environment variable Google Test reads its test filter from. */
+  static constexpr const char* kFilterEnv = "GTEST_FILTER";
+
+  /**
+   * @brief Parse every file of the compilation database in @p compileDbDir.
+   *
+   * @throw IOException if compile_commands.json cannot be loaded.
+   */
+  explicit TestCallGraph(const std::filesystem::path& compileDbDir);
+
+  /**
+   * @brief Construct an empty graph, to be filled with addCall() and friends (for tests).
+   */
+  TestCallGraph() = default;
+
+  /**
+   * @brief Return the names (`Suite.Name`) of all TEST and TEST_F cases.
+   */
+  const std::set<std::string>& getTests() const;
+
+  /**
+   * @brief Return the number of files of the compilation database.
+   */
+  std::size_t getFileCount() const;
+
+  /**
+   * @brief Return the files that could not be parsed without errors.
+   */
+  const std::vector<std::string>& getFailedFiles() const;
+
+  /**
+   * @brief Return the tests that may call @p function.
+   *
+   * @param function Qualified function name (Mutant::getQualifiedFunction()).
+   * @return sorted test names; an empty list if no test reaches the function;
+   *         nullopt if the whole suite has to run: the function is not defined
+   *         in any parsed file, an unknown test reaches it, or some file could
+   *         not be parsed without errors.
+   */
+  std::optional<std::vector<std::string>> getReachingTests(const std::string& function);
+
+  /**
+   * @brief Add a call from @p caller to @p callee.
+   */
+  void addCall(const std::string& caller, const std::string& callee);
+
+  /**
+   * @brief Add a call from @p caller to every function named @p name in any scope.
+   */
+  void addCallByName(const std::string& caller, const std::string& name);
+
+  /**
+   * @brief Record that @p function is defined in a parsed file.
+   */
+  void addDefinition(const std::string& function);
+
+  /**
+   * @brief Make @p function the root of the test @p test, or of unknown tests if @p test is empty.
+   */
+  void addRoot(const std::string& function, const std::string& test);
+
+ private:
+  std::map<std::string, std::set<std::string>> mCallers;
+  std::map<std::string, std::set<std::string>> mCallersByName;
+  std::set<std::string> mDefined;
+  std::map<std::string, std::set<std::string>> mRoots;
+  std::set<std::string> mTests;
+  std::map<std::string, std::optional<std::vector<std::string>>> mReachingTests;
+  std::size_t mFileCount = 0;
+  std::vector<std::string> mFailedFiles;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_TESTCALLGRAPH_HPP_
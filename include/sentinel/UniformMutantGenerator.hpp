@@ -24,6 +24,10 @@ class UniformMutantGenerator : public MutantGenerator {
   explicit UniformMutantGenerator(const std::filesystem::path& path);
 
  protected:
+  bool supportsStreaming() const override {
+    return true;
+  }
+
   Mutants selectMutants(const SourceLines& sourceLines, std::size_t maxMutants,
                         unsigned int randomSeed, const CandidateIndex& index,
                         std::size_t mutantsPerLine) override;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_VERDICTCACHE_HPP_
+#define INCLUDE_SENTINEL_VERDICTCACHE_HPP_
+
+#include <filesystem>  // NOLINT
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include "sentinel/Config.hpp"
+#include "sentinel/Mutant.hpp"
+#include "sentinel/MutationResult.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Persistent store of mutant verdicts shared between runs.
+ *
+ * A verdict is keyed by the mutant itself, the content hash of the mutated
+ * file, and a context hash covering everything else the verdict depends on
+ * (build and test commands, sources that are not mutation targets such as
+ * tests and headers). A verdict found under the same key is reused instead
+ * of building and testing the mutant again.
+ *
+ * Each entry is a separate file that is written to a temporary name and
+ * renamed into place, so concurrent runs may share the directory: a reader
+ * sees either no entry or a complete one.
+ */
+class VerdictCache {
+ public:
+  /**
+   * @brief Constructor. Hashes the run context.
+   *
+   * @param config       Run configuration: cache directory, source directory,
+   *                     and the build and test commands.
+   * @param contextFiles Non-target source files (e.g. tests and headers) whose
+   *                     paths and contents every verdict depends on.
+   */
+  VerdictCache(const Config& config, const std::vector<std::filesystem::path>& contextFiles);
+
+  VerdictCache(const VerdictCache&) = delete;
+  VerdictCache& operator=(const VerdictCache&) = delete;
+
+  /**
+   * @brief Return the cached verdict of a mutant, flagged as cached.
+   *
+   * @param m Mutant with a path relative to the source directory.
+   * @return the verdict, or std::nullopt if there is none or the entry is unreadable.
+   */
+  std::optional<MutationResult> find(const Mutant& m);
+
+  /**
+   * @brief Store the verdict of a mutant.
+   *
+   * Failures are logged and otherwise ignored; the cache only saves work.
+   *
+   * @param result Verdict whose mutant has a path relative to the source directory.
+   */
+  void store(const MutationResult& result);
+
+ private:
+  std::filesystem::path entryPath(const Mutant& m);
+
+  std::filesystem::path mDir;
+  std::filesystem::path mSourceRoot;
+  std::string mContextHash;
+  std::map<std::filesystem::path, std::string> mFileHashes;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_VERDICTCACHE_HPP_
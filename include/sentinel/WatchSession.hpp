@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_WATCHSESSION_HPP_
+#define INCLUDE_SENTINEL_WATCHSESSION_HPP_
+
+#include <chrono>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+#include "sentinel/GitRepository.hpp"
+#include "sentinel/MutantGenerator.hpp"
+#include "sentinel/PipelineContext.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Keeps sentinel resident after a run and re-evaluates edited source lines (--watch).
+ *
+ * The source tree is watched for saved C/C++ files. For each batch of saves the
+ * new contents are compared with the last seen contents:
+ *  - in a mutation target file, mutants on unchanged lines follow their line
+ *    and keep their result, mutants on edited lines are dropped, and new
+ *    mutants are generated for the edited lines only;
+ *  - any other source file (tests, headers) may change the outcome of every
+ *    mutant, so all results are cleared.
+ * The original build then runs again (incrementally), the original test only
+ * when a non-target file changed, so edits of target files reuse the baseline
+ * results. The mutants without a result are evaluated and the report is regenerated.
+ * Writes made by the evaluation itself leave the contents unchanged and are ignored.
+ * Saves made while a cycle runs are queued by the watcher and handled by the next cycle.
+ */
+class WatchSession {
+ public:
+  /// @brief Time without further saves that ends a batch of changes.
+  static constexpr std::chrono::milliseconds kQuietPeriod{500};
+
+  /**
+   * @brief Constructor.
+   * @param repo      Git repository of the source tree.
+   * @param generator Mutant generator used for edited lines.
+   */
+  WatchSession(std::shared_ptr<GitRepository> repo, std::shared_ptr<MutantGenerator> generator);
+
+  /**
+   * @brief Watch the source tree and re-evaluate changes until the process is interrupted.
+   *
+   * A failing cycle (e.g. the edited code does not build) is reported and
+   * the next save is awaited; its mutants are picked up by the next cycle.
+   *
+   * @param ctx Pipeline context of the completed initial run.
+   */
+  void run(PipelineContext* ctx);
+
+ private:
+  void takeSnapshot(const std::filesystem::path& root, const std::vector<std::filesystem::path>& skipDirs,
+                    const Config& config);
+  void runCycle(const std::set<std::filesystem::path>& changed, PipelineContext* ctx);
+
+  std::shared_ptr<GitRepository> mRepo;
+  std::shared_ptr<MutantGenerator> mGenerator;
+  std::filesystem::path mRoot;
+  std::map<std::filesystem::path, std::vector<std::string>> mSnapshot;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_WATCHSESSION_HPP_
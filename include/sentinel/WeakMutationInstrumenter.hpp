@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_WEAKMUTATIONINSTRUMENTER_HPP_
+#define INCLUDE_SENTINEL_WEAKMUTATIONINSTRUMENTER_HPP_
+
+#include <filesystem>  // NOLINT
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/Mutant.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Rewrites source files so that the tests reveal which mutants are ever infected.
+ *
+ * A binary expression `L op R` of arithmetic operands that carries operator
+ * mutants (AOR, BOR, ROR, SOR) or true/false mutants (ROR) becomes an
+ * immediately invoked lambda. It evaluates L and R once, returns the original
+ * result, and also computes the result of every mutant of the expression. The
+ * first time a mutant's result differs from the original, its ID is appended
+ * to the file named by kRecordEnv. A mutated division or shift whose result
+ * would be undefined for the operands counts as infected. Each instrumented
+ * file also appends kLoadedMarker and its absolute path when a program holding
+ * it starts, so that mutants are only screened out where the probes ran.
+ *
+ * Sites are looked up with the same positions the mutation operators record,
+ * so only the mutants' own expressions are instrumented. Expressions that must
+ * stay constant (constexpr functions and variables, sizeof, decltype, template
+ * arguments, ...), operands of pointer or class type, logical operators, and
+ * files that are not C++14 or later are left alone. Line numbers are kept.
+ */
+class WeakMutationInstrumenter {
+ public:
+  /** @brief Environment variable naming the file the instrumented code records infected mutants in. */
+  static constexpr const char* kRecordEnv = "SENTINEL_WEAK_MUTATION_FILE";
+
+  /** @brief Prefix of the record line naming an instrumented file whose code was loaded. */
+  static constexpr const char* kLoadedMarker = "loaded ";
+
+  /**
+   * @brief Constructor.
+   * @param compileDbDir Directory containing compile_commands.json.
+   */
+  explicit WeakMutationInstrumenter(const std::filesystem::path& compileDbDir);
+
+  /**
+   * @brief Instrument the files holding @p mutants.
+   *
+   * @param sourceDir Source root the mutant paths are relative to.
+   * @param mutants   Mutants with their workspace IDs.
+   * @param probed    Receives the IDs of the mutants that got a probe.
+   * @return instrumented contents by absolute file path (files without a probe are left out).
+   */
+  std::map<std::filesystem::path, std::string> instrument(const std::filesystem::path& sourceDir,
+                                                          const std::vector<std::pair<int, Mutant>>& mutants,
+                                                          std::set<int>* probed) const;
+
+ private:
+  std::filesystem::path mCompileDbDir;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_WEAKMUTATIONINSTRUMENTER_HPP_
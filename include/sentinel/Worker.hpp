@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_WORKER_HPP_
+#define INCLUDE_SENTINEL_WORKER_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "sentinel/Config.hpp"
+#include "sentinel/Workspace.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Evaluates mutants handed out by a coordinator (--worker).
+ *
+ * Each mutant is built and tested in the worker's own checkout, as described by
+ * the worker's configuration (source directory, build and test commands), and
+ * the result is sent back together with the tails of the build and test logs.
+ * The worker's workspace only holds scratch files and the original test
+ * results received from the coordinator; it must not hold a sentinel run.
+ */
+class Worker {
+ public:
+  /**
+   * @brief Constructor.
+   * @param config    Configuration of the worker's checkout.
+   * @param workspace Scratch workspace of the worker.
+   * @param token     Secret the coordinator expects in HELLO (see protocol::kTokenEnv).
+   */
+  Worker(const Config& config, std::shared_ptr<Workspace> workspace, std::string token);
+
+  Worker(const Worker&) = delete;
+  Worker& operator=(const Worker&) = delete;
+
+  /**
+   * @brief Connect to a coordinator and evaluate mutants until it reports that all are done.
+   *
+   * @param address Coordinator address: "unix:PATH" or "HOST:PORT".
+   * @return Number of mutants evaluated by this worker.
+   * @throws IOException if the coordinator cannot be reached.
+   * @throws std::runtime_error if the workspace holds a sentinel run, the coordinator
+   *         refuses the worker (another protocol version or token), or the connection is lost.
+   */
+  std::size_t run(const std::string& address);
+
+ private:
+  bool send(const std::string& type, const std::string& body = "");
+
+  Config mConfig;
+  std::shared_ptr<Workspace> mWorkspace;
+  std::string mToken;
+  int mFd = -1;
+  std::mutex mSendMutex;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_WORKER_HPP_
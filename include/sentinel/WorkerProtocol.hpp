@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_WORKERPROTOCOL_HPP_
+#define INCLUDE_SENTINEL_WORKERPROTOCOL_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Messages exchanged between a coordinator (--serve) and its workers (--worker).
+ *
+ * Every message is one length-prefixed frame (see net::sendFrame) whose payload
+ * is the message type on the first line followed by the body:
+ *
+ *   HELLO      worker -> coordinator  "<protocol version>\n<token>\n<worker name>"
+ *   SETUP      coordinator -> worker  YAML: timeout, original test result files
+ *   REFUSED    coordinator -> worker  the protocol version or the token does not match
+ *   READY      worker -> coordinator  asks for the next mutant
+ *   MUTANT     coordinator -> worker  "<mutant id>\n<mutant YAML>"
+ *   RESULT     worker -> coordinator  YAML: mutant id, result, build and test log tails
+ *   HEARTBEAT  worker -> coordinator  sent periodically while connected
+ *   DONE       coordinator -> worker  all mutants are evaluated
+ *
+ * The token is a secret shared by the coordinator and its workers through the
+ * kTokenEnv environment variable. Anyone who can reach the coordinator's address
+ * and knows the token receives the original test results and can report results,
+ * and the mutants a worker receives are built and run in its checkout, so the
+ * connection itself is not encrypted and must not cross untrusted networks.
+ */
+namespace sentinel::protocol {
+
+/// @brief Bump when a message changes; a coordinator drops workers of another version.
+inline constexpr int kVersion = 2;
+
+inline constexpr const char* kHello = "HELLO";
+inline constexpr const char* kSetup = "SETUP";
+inline constexpr const char* kRefused = "REFUSED";
+inline constexpr const char* kReady = "READY";
+inline constexpr const char* kMutant = "MUTANT";
+inline constexpr const char* kResult = "RESULT";
+inline constexpr const char* kHeartbeat = "HEARTBEAT";
+inline constexpr const char* kDone = "DONE";
+
+/// @brief Environment variable holding the token of the coordinator and its workers.
+inline constexpr const char* kTokenEnv = "SENTINEL_SERVE_TOKEN";
+
+/// @brief Number of trailing lines of the build and test logs returned with a result.
+inline constexpr std::size_t kLogTailLines = 200;
+
+/// @brief Interval at which a worker sends HEARTBEAT.
+inline constexpr std::chrono::seconds kHeartbeatInterval{5};
+
+/// @brief Silence after which the coordinator drops a worker and hands its mutant out again.
+inline constexpr std::chrono::seconds kHeartbeatTimeout{30};
+
+/// @brief Time a peer may accept no data before the coordinator drops it instead of waiting on the send.
+inline constexpr std::chrono::seconds kSendTimeout{10};
+
+/**
+ * @brief Decoded message.
+ */
+struct Message {
+  std::string type;
+  std::string body;
+};
+
+/**
+ * @brief Build a frame payload from a message type and body.
+ */
+inline std::string encode(const std::string& type, const std::string& body = "") {
+  return type + '\n' + body;
+}
+
+/**
+ * @brief Split a frame payload into message type and body.
+ */
+inline Message decode(const std::string& payload) {
+  const std::size_t newline = payload.find('\n');
+  if (newline == std::string::npos) {
+    return {payload, ""};
+  }
+  return {payload.substr(0, newline), payload.substr(newline + 1)};
+}
+
+/**
+ * @brief Return true if @p actual equals @p expected, in a time that does not
+ *        depend on where the two first differ.
+ */
+inline bool matchesToken(const std::string& expected, const std::string& actual) {
+  if (expected.empty()) {
+    return false;
+  }
+  unsigned char diff = expected.size() == actual.size() ? 0 : 1;
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    diff |= static_cast<unsigned char>(actual[i] ^ expected[i % expected.size()]);
+  }
+  return diff == 0;
+}
+
+}  // namespace sentinel::protocol
+
+#endif  // INCLUDE_SENTINEL_WORKERPROTOCOL_HPP_
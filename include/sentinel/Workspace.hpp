@@ -8,6 +8,7 @@
 
 #include <filesystem>  // NOLINT
 #include <istream>
+#include <map>
 #include <optional>
 #include <ostream>
 #include <string>
@@ -26,14 +27,19 @@ namespace sentinel {
 struct WorkspaceStatus {
   std::optional<std::string> version;  ///< Program version that produced this workspace
   std::optional<std::size_t> originalTime;  ///< Computed timeout seconds (timeout:auto only)
+  std::optional<double> originalTestSeconds;  ///< Measured wall time of the original test run
   std::optional<std::size_t> candidateCount;  ///< Total candidates before partition
   std::optional<std::size_t> partIndex;  ///< Partition index N (0 = no partition)
   std::optional<std::size_t> partCount;  ///< Partition total (0 = no partition)
+  std::optional<std::string> partitionStrategy;  ///< PartitionPlanner::getStrategy() of a partition run
   std::optional<std::vector<std::size_t>> mergedPartitions;  ///< Collected partition indices (merge mode only)
   std::optional<unsigned int> seed;  ///< Random seed used for mutant generation
   std::optional<std::string> from;  ///< Diff base revision used for generation
   std::optional<bool> uncommitted;  ///< Whether uncommitted changes were included
   std::optional<std::size_t> limit;  ///< Mutant limit used for generation
+  std::optional<bool> generationPending;  ///< True while a streamed generation has not finished
+  std::optional<std::vector<int>> notInfected;  ///< Mutants the weak-mutation pre-screen never saw infected
+  std::optional<std::vector<std::size_t>> scopeOriginalTimes;  ///< Computed timeout seconds of each scope
 };
 
 /**
@@ -55,13 +61,19 @@ std::istream& operator>>(std::istream& in, WorkspaceStatus& status);
  *   &lt;root&gt;/original/test.log      — baseline test stdout/stderr
  *   &lt;root&gt;/original/results/      — baseline test result XML files
  *   &lt;root&gt;/backup/                — temporary backup of mutated source files
+ *   &lt;root&gt;/weak/                  — build.log, test.log and infected IDs of the
+ *                                  weak-mutation pre-screen (--weak-mutation)
  *   &lt;root&gt;/actual/                — temporary mutant test result XML files (during evaluation)
  *   &lt;root&gt;/run.done               — present when all evaluation is fully complete
  *   &lt;root&gt;/00001/mt.cfg           — mutant data (Mutant::str() format)
  *   &lt;root&gt;/00001/mt.lock          — present while mutant is being processed
+ *                                  (holds the name of the owning process)
  *   &lt;root&gt;/00001/mt.done          — present (with serialized MutationResult) when complete
  *   &lt;root&gt;/00001/build.log        — mutant build stdout/stderr
  *   &lt;root&gt;/00001/test.log         — mutant test stdout/stderr
+ *   &lt;root&gt;/workers/NAME/         — backup/ and actual/ of one process sharing the
+ *                                  workspace (--shared), in place of &lt;root&gt;/backup/
+ *                                  and &lt;root&gt;/actual/
  */
 class Workspace {
  public:
@@ -77,9 +89,51 @@ class Workspace {
 
   /**
    * @brief Remove all workspace contents and recreate the base directory structure.
+   *
+   * The claim of claimInitialization() is kept if this object made it, so that
+   * no other process of a shared workspace starts initializing it meanwhile.
+   * A claim left by another process is removed.
    */
   void initialize();
 
+  /**
+   * @brief Atomically create &lt;root&gt;/init.lock on behalf of @p owner.
+   *
+   * Of several processes starting a shared workspace at the same time,
+   * exactly one succeeds and initializes it; the others wait for its mutants.
+   * The owner renews the claim with renewInitialization() like a mutant lock.
+   *
+   * @param owner  Name of the claiming process, written into the claim.
+   * @return true if the claim was created, false if it already exists.
+   * @throws std::runtime_error if the claim cannot be created for another reason.
+   */
+  bool claimInitialization(const std::string& owner);
+
+  /**
+   * @brief Update the modification time of &lt;root&gt;/init.lock to show that its owner is alive.
+   */
+  void renewInitialization();
+
+  /**
+   * @brief Return the modification time of &lt;root&gt;/init.lock, or std::nullopt if there is no claim.
+   */
+  std::optional<std::filesystem::file_time_type> getInitializationTime() const;
+
+  /**
+   * @brief Return the owner written into &lt;root&gt;/init.lock, or an empty string if there is no claim.
+   */
+  std::string getInitializationOwner() const;
+
+  /**
+   * @brief Remove a claim whose owner stopped renewing it.
+   *
+   * As breakLock(), but for &lt;root&gt;/init.lock (guarded by init.lock.break).
+   *
+   * @param seen  Modification time observed when the claim was found stale.
+   * @return true if the claim was removed.
+   */
+  bool breakInitialization(std::filesystem::file_time_type seen);
+
   /**
    * @brief Serialize and write resolved run options to &lt;root&gt;/config.yaml.
    *
@@ -108,18 +162,52 @@ class Workspace {
   /** @brief Return &lt;root&gt;/original/results/. */
   std::filesystem::path getOriginalResultsDir() const;
 
-  /** @brief Return &lt;root&gt;/backup/. */
+  /** @brief Return &lt;root&gt;/backup/, or &lt;root&gt;/workers/NAME/backup/ after setWorkerName(). */
   std::filesystem::path getBackupDir() const;
 
-  /** @brief Return &lt;root&gt;/actual/ (temporary mutant test results during evaluation). */
+  /**
+   * @brief Return &lt;root&gt;/objects/ (original objects of the files mutated in IR, ir-mutation),
+   *        or &lt;root&gt;/workers/NAME/objects/ after setWorkerName().
+   */
+  std::filesystem::path getObjectDir() const;
+
+  /**
+   * @brief Return &lt;root&gt;/actual/ (temporary mutant test results during evaluation),
+   *        or &lt;root&gt;/workers/NAME/actual/ after setWorkerName().
+   */
   std::filesystem::path getActualDir() const;
 
+  /**
+   * @brief Give this process its own backup and actual directories.
+   *
+   * Processes sharing the workspace evaluate different mutants at the same
+   * time and must not restore or compare each other's files.
+   *
+   * @param name  Name unique among the processes sharing the workspace.
+   */
+  void setWorkerName(const std::string& name);
+
+  /** @brief Return the name set by setWorkerName(), empty if there is none. */
+  const std::string& getWorkerName() const;
+
   /** @brief Return &lt;root&gt;/original/build.log. */
   std::filesystem::path getOriginalBuildLog() const;
 
   /** @brief Return &lt;root&gt;/original/test.log. */
   std::filesystem::path getOriginalTestLog() const;
 
+  /** @brief Return &lt;root&gt;/original/scopes/&lt;index&gt;/build.log (index into Config::scopes). */
+  std::filesystem::path getOriginalScopeBuildLog(std::size_t index) const;
+
+  /** @brief Return &lt;root&gt;/original/scopes/&lt;index&gt;/test.log (index into Config::scopes). */
+  std::filesystem::path getOriginalScopeTestLog(std::size_t index) const;
+
+  /** @brief Return &lt;root&gt;/original/scopes/&lt;index&gt;/results/ (index into Config::scopes). */
+  std::filesystem::path getOriginalScopeResultsDir(std::size_t index) const;
+
+  /** @brief Return &lt;root&gt;/weak/ (logs and infection record of the weak-mutation pre-screen). */
+  std::filesystem::path getWeakMutationDir() const;
+
   /**
    * @brief Maximum number of mutants supported.
    *
@@ -138,6 +226,9 @@ class Workspace {
   /** @brief Return &lt;root&gt;/NNNNN/test.log for the given 1-based mutant ID. */
   std::filesystem::path getMutantTestLog(int id) const;
 
+  /** @brief Return &lt;root&gt;/NNNNN/results/, where keep-test-results moves the test results of a mutant. */
+  std::filesystem::path getMutantResultsDir(int id) const;
+
   /**
    * @brief Create &lt;root&gt;/NNNNN/ and write mt.cfg with the mutant's data.
    *
@@ -146,6 +237,33 @@ class Workspace {
    */
   void createMutant(int id, const Mutant& m);
 
+  /**
+   * @brief Delete &lt;root&gt;/NNNNN/ together with the mutant's result.
+   *
+   * @param id  1-based mutant index.
+   */
+  void removeMutant(int id);
+
+  /**
+   * @brief Return the ID following the largest existing mutant ID (1 if there are none).
+   */
+  int getNextMutantId() const;
+
+  /**
+   * @brief Follow an edit of a source file in the stored mutants.
+   *
+   * Mutants of @p path whose lines were kept are moved to their new line
+   * numbers, results included; mutants on modified or deleted lines are removed.
+   * Kept mutants lose their byte offsets, which only hold in the file before
+   * the edit, and are applied by line and column instead.
+   *
+   * @param path     Source file as stored in the mutants (relative to the source directory).
+   * @param lineMap  1-based old line -> new line for every kept line.
+   * @return Number of removed mutants.
+   */
+  std::size_t relocateMutants(const std::filesystem::path& path,
+                              const std::map<std::size_t, std::size_t>& lineMap);
+
   /** @brief Return true if &lt;root&gt;/NNNNN/mt.lock exists. */
   bool isLocked(int id) const;
 
@@ -155,6 +273,43 @@ class Workspace {
   /** @brief Remove &lt;root&gt;/NNNNN/mt.lock. */
   void clearLock(int id);
 
+  /**
+   * @brief Atomically create &lt;root&gt;/NNNNN/mt.lock on behalf of @p owner.
+   *
+   * The lock is created exclusively (O_EXCL), so of several processes
+   * claiming the same mutant exactly one succeeds.
+   *
+   * @param id     1-based mutant index.
+   * @param owner  Name of the claiming process, written into the lock.
+   * @return true if the lock was created, false if it already exists.
+   * @throws std::runtime_error if the lock cannot be created for another reason.
+   */
+  bool tryLock(int id, const std::string& owner);
+
+  /**
+   * @brief Update the modification time of &lt;root&gt;/NNNNN/mt.lock to show that
+   *        its owner is still evaluating the mutant. Failures are ignored.
+   */
+  void renewLock(int id);
+
+  /**
+   * @brief Return the modification time of &lt;root&gt;/NNNNN/mt.lock, or std::nullopt if there is no lock.
+   */
+  std::optional<std::filesystem::file_time_type> getLockTime(int id) const;
+
+  /**
+   * @brief Remove a lock whose owner stopped renewing it.
+   *
+   * The lock is removed only if its modification time is still @p seen.
+   * A guard file (mt.lock.break) lets only one of several processes break
+   * the same lock, so a lock re-created in the meantime is never removed.
+   *
+   * @param id    1-based mutant index.
+   * @param seen  Modification time observed when the lock was found stale.
+   * @return true if the lock was removed.
+   */
+  bool breakLock(int id, std::filesystem::file_time_type seen);
+
   /** @brief Return true if &lt;root&gt;/NNNNN/mt.done exists. */
   bool isDone(int id) const;
 
@@ -168,6 +323,25 @@ class Workspace {
    */
   void setComplete();
 
+  /**
+   * @brief Atomically create the run.done marker.
+   *
+   * @return true if the marker was created, false if it already exists
+   *         (another process sharing the workspace completed the run).
+   * @throws std::runtime_error if the marker cannot be created for another reason.
+   */
+  bool trySetComplete();
+
+  /**
+   * @brief Remove the run.done marker so that the next evaluation picks up new mutants.
+   */
+  void clearComplete();
+
+  /**
+   * @brief Delete the results (mt.done) of all mutants so that they are evaluated again.
+   */
+  void clearResults();
+
   /**
    * @brief Serialize @p result to &lt;root&gt;/NNNNN/mt.done.
    *
@@ -191,6 +365,17 @@ class Workspace {
    */
   bool hasMutants() const;
 
+  /**
+   * @brief Check whether the mutant list is final.
+   *
+   * Generation marks the workspace pending before it writes the first mutant
+   * and clears the mark once the last one is written, so a process attaching
+   * meanwhile does not take a partial list.
+   *
+   * @return true if mutants exist and no generation is pending.
+   */
+  bool hasGeneratedMutants() const;
+
   /**
    * @brief Load all mutants from existing NNNNN/mt.cfg files, sorted by ID.
    *
@@ -214,6 +399,8 @@ class Workspace {
 
  private:
   std::filesystem::path mRoot;
+  std::string mWorkerName;
+  bool mClaimedInitialization = false;
 
   /** @brief Return the zero-padded 5-digit directory name for @p id. */
   static std::string mutantDirName(int id);
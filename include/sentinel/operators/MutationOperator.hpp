@@ -152,7 +152,8 @@ class MutationOperator {
 
   /**
    * @brief Append one Mutant to @p mutables describing a replacement of
-   *        the source range [startLoc, endLoc) with @p token.
+   *        the source range [startLoc, endLoc) with @p token, with its
+   *        byte range and the hash of the main file.
    *
    * @param mutables output list to append to
    * @param path     source file path attached to the mutant
@@ -199,6 +200,11 @@ class MutationOperator {
    * @brief Object handles loading and caching of source files into memory
    */
   clang::SourceManager& mSrcMgr;
+
+  /**
+   * @brief Hash of the main file, recorded with the byte range of each mutant
+   */
+  std::string mFileHash;
 };
 
 /**
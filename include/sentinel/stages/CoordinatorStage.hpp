@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_STAGES_COORDINATORSTAGE_HPP_
+#define INCLUDE_SENTINEL_STAGES_COORDINATORSTAGE_HPP_
+
+#include <memory>
+#include <string>
+#include "sentinel/GitRepository.hpp"
+#include "sentinel/Stage.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Hands out mutants to workers connected over a socket (--serve) instead
+ *        of evaluating them locally. Skips if already complete.
+ *
+ * Mutants without coverage and mutants with a cached verdict are resolved here.
+ * Every other mutant without mt.done is sent to the next idle worker, and the
+ * returned result and log tails are stored in the workspace as if the mutant had
+ * been evaluated locally, so an interrupted coordinator resumes where it stopped.
+ * A worker that disconnects or is silent for protocol::kHeartbeatTimeout is
+ * dropped and its mutant is handed out again. A worker that presents another
+ * protocol version or token is refused before it receives anything.
+ */
+class CoordinatorStage : public Stage {
+ public:
+  /**
+   * @brief Constructor.
+   * @param repo    Git repository of the source tree (coverage and verdict cache lookups).
+   * @param address Address to listen on: "unix:PATH" or "HOST:PORT".
+   * @param token   Secret a worker must present in HELLO (see protocol::kTokenEnv).
+   */
+  CoordinatorStage(std::shared_ptr<GitRepository> repo, std::string address, std::string token);
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override;
+  StatusLine::Phase getPhase() const override;
+  bool execute(PipelineContext* ctx) override;
+
+ private:
+  std::shared_ptr<GitRepository> mRepo;
+  std::string mAddress;
+  std::string mToken;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_STAGES_COORDINATORSTAGE_HPP_
@@ -6,40 +6,176 @@
 #ifndef INCLUDE_SENTINEL_STAGES_EVALUATIONSTAGE_HPP_
 #define INCLUDE_SENTINEL_STAGES_EVALUATIONSTAGE_HPP_
 
+#include <chrono>
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <map>
 #include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/BitcodeCompiler.hpp"
 #include "sentinel/Evaluator.hpp"
 #include "sentinel/GitRepository.hpp"
+#include "sentinel/JitTestExecutor.hpp"
 #include "sentinel/Mutant.hpp"
 #include "sentinel/MutationResult.hpp"
+#include "sentinel/NinjaGraph.hpp"
 #include "sentinel/Stage.hpp"
+#include "sentinel/TestCallGraph.hpp"
+#include "sentinel/VerdictCache.hpp"
+#include "sentinel/Workspace.hpp"
 
 namespace sentinel {
 
 /**
  * @brief Evaluates all mutants, recording kill/survive/timeout/build-error results.
  *        Skips if already complete.
+ *
+ * With --shared, several processes evaluate the same workspace: each mutant is
+ * claimed by exclusively creating its lock, the lock is renewed while the
+ * mutant is evaluated, and a lock that stops being renewed is taken over.
+ * Every process waits until all mutants are done; the first one to mark the
+ * run complete continues with the report.
+ *
+ * With --time-budget, the mutants are evaluated in stratified order, and the
+ * stage stops before a mutant that would not finish within the budget. The
+ * run is left incomplete, so the next run resumes it, and the report is a
+ * sampled estimate.
+ *
+ * With static-test-selection and no lcov tracefile, each mutant runs only the
+ * Google Test cases that a static call graph finds able to reach its function
+ * (see TestCallGraph). A mutant that no test can reach is reported as
+ * uncovered without being built.
+ *
+ * With ir-mutation, operator mutants are applied to the LLVM IR of their file
+ * (see IrMutator), and the generated object replaces the one in the build
+ * tree for the build and test of the mutant.
+ *
+ * With jit-bitcode, a mutant outside the scopes that can be applied to the IR
+ * of the test program is not built: the program runs with the mutant in an
+ * ORC JIT, in a child forked for it (see JitTestExecutor).
  */
 class EvaluationStage : public Stage {
  public:
+  /// @brief Interval at which the lock of a mutant under evaluation is renewed (--shared).
+  static constexpr std::chrono::seconds kLockRenewInterval{10};
+  /// @brief Time without renewal after which a lock is taken over from its owner (--shared).
+  static constexpr std::chrono::seconds kStaleLockTimeout{60};
+  /// @brief Interval at which mutants locked by other processes are checked (--shared).
+  static constexpr std::chrono::seconds kPollInterval{1};
+
   /**
    * @brief Constructor.
    * @param repo Git repository for applying/reverting source patches.
    */
   explicit EvaluationStage(std::shared_ptr<GitRepository> repo);
 
+  /**
+   * @brief Apply a mutant, run build/test, compare results, then restore backup.
+   *
+   * With targeted-build, only the Ninja targets depending on the mutated file
+   * (and those built for the previous mutant) are built. With fail-fast-build,
+   * the build is stopped at the first compiler error in the mutated file.
+   * With static-test-selection, only the tests reaching the mutated function
+   * are run and compared. With ir-mutation, the object of the mutated file is
+   * replaced instead of the source when the mutant can be applied to its IR.
+   * With jit-bitcode, the test program is run in the JIT instead of the build
+   * and test commands when the mutant can be applied to it. The test results
+   * are read from the test result directory, and moved to the directory of
+   * the mutant in the workspace with keep-test-results.
+   */
+  MutationResult evaluateMutant(const Mutant& m, int id, std::size_t timeLimit,
+                                Evaluator* evaluator, PipelineContext* ctx);
+
+  /**
+   * @brief Return @p mutants in stratified order for --time-budget.
+   *
+   * Takes one mutant from each file in turn, and within a file one mutant of
+   * each operator in turn, so that any prefix of the result is spread over the
+   * files and operators. The relative order within a file and operator is kept.
+   */
+  static std::vector<std::pair<int, Mutant>> stratify(const std::vector<std::pair<int, Mutant>>& mutants);
+
+  /**
+   * @brief Return the per-mutant test time limit in seconds: --timeout, or the
+   *        automatic limit derived from the original test (0 = no limit).
+   */
+  static std::size_t getTimeLimit(const PipelineContext& ctx);
+
+  /**
+   * @brief Return true if @p line is a compiler error reported in @p file (fail-fast-build).
+   *
+   * Recognizes GCC/Clang diagnostics (`file:line:col: error:`, `fatal error:`) and
+   * MSVC diagnostics (`file(line): error`), with or without color codes. The file
+   * matches when the trailing components of the reported path and of @p file agree,
+   * since compilers print the path as it was passed on the command line.
+   */
+  static bool isCompilerErrorIn(const std::string& line, const std::filesystem::path& file);
+
+  /**
+   * @brief Open the verdict cache configured by cache-dir, or return nullptr if there is none.
+   *
+   * Every source file that is not a mutation target (tests, headers, ...) is part of
+   * the context of every verdict; build and output directories are left out.
+   */
+  static std::unique_ptr<VerdictCache> openVerdictCache(const PipelineContext& ctx, GitRepository* repo);
+
+  /**
+   * @brief Print the result line of an evaluated mutant, with killing tests and log hints.
+   *
+   * @param position  1-based position of the mutant in the evaluation order.
+   * @param total     Number of mutants.
+   * @param id        Mutant ID (locates the build and test logs in @p workspace).
+   * @param result    Evaluation result.
+   * @param workspace Workspace holding the logs.
+   */
+  static void printResult(std::size_t position, std::size_t total, int id, const MutationResult& result,
+                          const Workspace& workspace);
+
  protected:
   bool shouldSkip(const PipelineContext& ctx) const override;
   StatusLine::Phase getPhase() const override;
   bool execute(PipelineContext* ctx) override;
 
  private:
-  std::shared_ptr<GitRepository> mRepo;
+  /** @brief Return the build and test commands for @p m, narrowed to its Ninja targets with targeted-build. */
+  std::pair<std::string, std::string> getCommands(const Mutant& m, const PipelineContext& ctx);
 
   /**
-   * @brief Apply a mutant, run build/test, compare results, then restore backup.
+   * @brief Record the outcome of the build getCommands() narrowed to Ninja targets.
+   *
+   * Only a successful build relinks the targets it covered; after a failed or
+   * stopped one, the targets of its mutant join those still stale.
    */
-  MutationResult evaluateMutant(const Mutant& m, int id, std::size_t timeLimit,
-                                Evaluator* evaluator, PipelineContext* ctx);
+  void finishTargetedBuild(bool succeeded);
+
+  /**
+   * @brief Replace the object of the file of @p m with one generated from its mutated IR (ir-mutation).
+   *
+   * The original object is backed up like a mutated source, so it is restored after the mutant.
+   *
+   * @return false if the mutant has to be built from the mutated source.
+   */
+  bool patchObject(const Mutant& m, PipelineContext* ctx);
+
+  std::shared_ptr<GitRepository> mRepo;
+  bool mNinjaResolved = false;
+  std::unique_ptr<NinjaGraph> mNinja;
+  /** @brief Targets that may still hold the code of earlier mutants; nullopt = unknown (full build). */
+  std::optional<std::vector<std::string>> mStaleTargets;
+  /** @brief Targets of the mutant being built, until finishTargetedBuild() is called. */
+  std::optional<std::vector<std::string>> mBuildingTargets;
+  std::unique_ptr<TestCallGraph> mCallGraph;
+  std::unique_ptr<BitcodeCompiler> mBitcodeCompiler;
+  /** @brief IR of each mutated file (nullopt if its mutants are built from source), compiled once per run. */
+  std::map<std::filesystem::path, std::optional<BitcodeUnit>> mBitcodeUnits;
+  /** @brief Files whose original object has been saved under Workspace::getObjectDir() in this run. */
+  std::set<std::filesystem::path> mSavedObjects;
+  /** @brief Test program run in the JIT (jit-bitcode), or nullptr. */
+  std::unique_ptr<JitTestExecutor> mJit;
 };
 
 }  // namespace sentinel
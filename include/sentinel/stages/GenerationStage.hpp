@@ -7,14 +7,20 @@
 #define INCLUDE_SENTINEL_STAGES_GENERATIONSTAGE_HPP_
 
 #include <memory>
+#include <optional>
 #include "sentinel/GitRepository.hpp"
 #include "sentinel/MutantGenerator.hpp"
+#include "sentinel/MutantPlan.hpp"
 #include "sentinel/Stage.hpp"
 
 namespace sentinel {
 
 /**
  * @brief Generates and stores mutants in the workspace. Skips if mutants are already generated.
+ *
+ * With --plan, the mutant list is read from a plan file instead of parsing the
+ * sources. With --generate-only, the full mutant list is written to a plan file
+ * and the pipeline stops.
  */
 class GenerationStage : public Stage {
  public:
@@ -25,14 +31,27 @@ class GenerationStage : public Stage {
    */
   GenerationStage(std::shared_ptr<GitRepository> repo, std::shared_ptr<MutantGenerator> generator);
 
+  /**
+   * @brief Use @p plan, already loaded from --plan and verified against the
+   *        source tree, instead of reading the plan file again.
+   */
+  void setPlan(MutantPlan plan);
+
  protected:
   bool shouldSkip(const PipelineContext& ctx) const override;
   StatusLine::Phase getPhase() const override;
   bool execute(PipelineContext* ctx) override;
 
  private:
+  /**
+   * @brief Parse the sources and select mutants into @p plan (without source hashes).
+   * @return false if generation was cancelled because the overlapped original test failed.
+   */
+  bool generate(PipelineContext* ctx, MutantPlan* plan);
+
   std::shared_ptr<GitRepository> mRepo;
   std::shared_ptr<MutantGenerator> mGenerator;
+  std::optional<MutantPlan> mPlan;
 };
 
 }  // namespace sentinel
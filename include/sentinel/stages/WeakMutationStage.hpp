@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_STAGES_WEAKMUTATIONSTAGE_HPP_
+#define INCLUDE_SENTINEL_STAGES_WEAKMUTATIONSTAGE_HPP_
+
+#include <filesystem>  // NOLINT
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/Mutant.hpp"
+#include "sentinel/Stage.hpp"
+
+namespace sentinel {
+
+/**
+ * @brief Weak-mutation pre-screen (--weak-mutation).
+ *
+ * Rewrites the mutated files so that every probed expression also computes the
+ * value of each of its mutants, builds them, and runs the test command once.
+ * The instrumented code appends the ID of a mutant to the file named by
+ * WeakMutationInstrumenter::kRecordEnv the first time its value differs from
+ * the original, and the path of each instrumented file once its code is loaded.
+ * Probed mutants of loaded files that never show up there are stored in the
+ * workspace status and reported by EvaluationStage as SURVIVED without a build.
+ *
+ * The sources are restored before the stage returns. If the instrumented build
+ * fails, the test run times out or crashes, no instrumented code was loaded, or
+ * the test results differ from the original ones, no mutant is screened out.
+ * Skipped unless weak-mutation is set, with --shared, and once the pre-screen
+ * has run for the workspace.
+ */
+class WeakMutationStage : public Stage {
+ public:
+  /**
+   * @brief Rewrites the files holding @p mutants.
+   *        Returns the instrumented contents by absolute path and fills @p probed
+   *        with the IDs of the mutants that received a probe.
+   */
+  using InstrumentFunction = std::function<std::map<std::filesystem::path, std::string>(
+      const std::vector<std::pair<int, Mutant>>& mutants, std::set<int>* probed)>;
+
+  /**
+   * @brief Constructor.
+   * @param instrument Instruments the sources (WeakMutationInstrumenter outside of tests).
+   */
+  explicit WeakMutationStage(InstrumentFunction instrument);
+
+  /**
+   * @brief Contents of an infection record.
+   */
+  struct Record {
+    std::set<int> infected;       ///< IDs of the mutants whose value differed from the original.
+    std::set<std::string> loaded;  ///< Absolute paths of the instrumented files whose code was loaded.
+  };
+
+  /**
+   * @brief Read an infection record: one mutant ID or loaded marker per line.
+   *        Other lines, such as a line cut short by a crash, are ignored.
+   *        A missing record is empty.
+   */
+  static Record readRecord(const std::filesystem::path& path);
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override;
+  StatusLine::Phase getPhase() const override;
+  bool execute(PipelineContext* ctx) override;
+
+ private:
+  InstrumentFunction mInstrument;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_STAGES_WEAKMUTATIONSTAGE_HPP_
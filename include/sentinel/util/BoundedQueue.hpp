@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_UTIL_BOUNDEDQUEUE_HPP_
+#define INCLUDE_SENTINEL_UTIL_BOUNDEDQUEUE_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace sentinel {
+
+/**
+ * @brief Blocking FIFO queue with a fixed capacity, shared by one producer and one consumer.
+ *
+ * push() blocks while the queue is full and pop() blocks while it is empty.
+ * The producer calls close() once it has pushed the last item; the consumer then
+ * drains the remaining items and pop() returns std::nullopt. Either side may call
+ * abort() to stop the other one early: pending items are discarded, push() returns
+ * false and pop() returns std::nullopt.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+class BoundedQueue {
+ public:
+  /**
+   * @brief Constructor.
+   *
+   * @param capacity maximum number of queued items (at least 1)
+   */
+  explicit BoundedQueue(std::size_t capacity) : mCapacity(capacity > 0 ? capacity : 1) {}
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  /**
+   * @brief Append an item, waiting for free space if the queue is full.
+   *
+   * @param item item to append
+   * @return true if the item was queued, false if the queue was closed or aborted
+   */
+  bool push(T item) {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mNotFull.wait(lock, [this] { return mItems.size() < mCapacity || mClosed || mAborted; });
+    if (mClosed || mAborted) {
+      return false;
+    }
+    mItems.push_back(std::move(item));
+    ++mPushed;
+    mNotEmpty.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Remove the oldest item, waiting until one is available.
+   *
+   * @return the item, or std::nullopt once the queue is closed and drained or aborted
+   */
+  std::optional<T> pop() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mNotEmpty.wait(lock, [this] { return !mItems.empty() || mClosed || mAborted; });
+    if (mAborted || mItems.empty()) {
+      return std::nullopt;
+    }
+    T item = std::move(mItems.front());
+    mItems.pop_front();
+    mNotFull.notify_one();
+    return item;
+  }
+
+  /**
+   * @brief Mark the end of the stream. Items already queued can still be popped.
+   */
+  void close() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mClosed = true;
+    mNotEmpty.notify_all();
+    mNotFull.notify_all();
+  }
+
+  /**
+   * @brief Stop both sides immediately, discarding any queued items.
+   */
+  void abort() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mAborted = true;
+    mItems.clear();
+    mNotEmpty.notify_all();
+    mNotFull.notify_all();
+  }
+
+  /**
+   * @brief Check whether abort() was called.
+   *
+   * @return true if the stream was aborted
+   */
+  bool isAborted() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mAborted;
+  }
+
+  /**
+   * @brief Return the number of items pushed so far.
+   *
+   * @return running count of successful push() calls
+   */
+  std::size_t getPushedCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mPushed;
+  }
+
+ private:
+  const std::size_t mCapacity;
+  mutable std::mutex mMutex;
+  std::condition_variable mNotEmpty;
+  std::condition_variable mNotFull;
+  std::deque<T> mItems;
+  std::size_t mPushed = 0;
+  bool mClosed = false;
+  bool mAborted = false;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_UTIL_BOUNDEDQUEUE_HPP_
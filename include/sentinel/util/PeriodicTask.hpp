@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef INCLUDE_SENTINEL_UTIL_PERIODICTASK_HPP_
+#define INCLUDE_SENTINEL_UTIL_PERIODICTASK_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "sentinel/util/signal.hpp"
+
+namespace sentinel {
+
+/// RAII background thread that invokes fn every interval until destruction.
+/// The first call happens one interval after construction; signals are left
+/// to the main thread.
+class PeriodicTask {
+ public:
+  /// @param interval time between two calls
+  /// @param fn callable invoked on the background thread
+  PeriodicTask(std::chrono::milliseconds interval, std::function<void()> fn) :
+      mThread([this, interval, fn = std::move(fn)] {
+        signal::blockSignalsInThread();
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (!mCv.wait_for(lock, interval, [this] { return mStopped; })) {
+          lock.unlock();
+          fn();
+          lock.lock();
+        }
+      }) {
+  }
+
+  ~PeriodicTask() {
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStopped = true;
+    }
+    mCv.notify_all();
+    mThread.join();
+  }
+
+  PeriodicTask(const PeriodicTask&) = delete;
+  PeriodicTask& operator=(const PeriodicTask&) = delete;
+  PeriodicTask(PeriodicTask&&) = delete;
+  PeriodicTask& operator=(PeriodicTask&&) = delete;
+
+ private:
+  std::mutex mMutex;
+  std::condition_variable mCv;
+  bool mStopped = false;
+  std::thread mThread;
+};
+
+}  // namespace sentinel
+
+#endif  // INCLUDE_SENTINEL_UTIL_PERIODICTASK_HPP_
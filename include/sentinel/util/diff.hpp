@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_UTIL_DIFF_HPP_
+#define INCLUDE_SENTINEL_UTIL_DIFF_HPP_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sentinel::diff {
+
+/**
+ * @brief Result of comparing two versions of a text file line by line.
+ */
+struct LineChanges {
+  std::vector<std::size_t> changedLines;  ///< 1-based lines of the new version that were added or modified
+  std::map<std::size_t, std::size_t> lineMap;  ///< 1-based old line -> new line, for lines kept unchanged
+};
+
+/**
+ * @brief Compare two versions of a file line by line.
+ *
+ * The common prefix and suffix are matched directly and the remaining middle
+ * part with a longest-common-subsequence match. If the middle part is too
+ * large for that, all of its lines are reported as changed.
+ *
+ * @param before lines of the old version
+ * @param after  lines of the new version
+ * @return changed lines of the new version and the mapping of kept lines
+ */
+LineChanges compareLines(const std::vector<std::string>& before, const std::vector<std::string>& after);
+
+}  // namespace sentinel::diff
+
+#endif  // INCLUDE_SENTINEL_UTIL_DIFF_HPP_
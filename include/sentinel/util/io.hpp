@@ -11,6 +11,7 @@
 #include <filesystem>  // NOLINT
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include "sentinel/exceptions/InvalidArgumentException.hpp"
 #include "sentinel/util/formatter.hpp"
 #include "sentinel/util/string.hpp"
@@ -72,6 +73,17 @@ inline void syncXmlFiles(const std::filesystem::path& from, const std::filesyste
   }
 }
 
+/**
+ * @brief Move a directory, replacing @p to.
+ *
+ * The directory is renamed, which is atomic when both paths are on the same
+ * filesystem; otherwise it is copied and removed.
+ *
+ * @param from Directory to move.
+ * @param to   Destination directory (removed first if it exists).
+ */
+void moveDirectory(const std::filesystem::path& from, const std::filesystem::path& to);
+
 /**
  * @brief Read the last N lines from a file.
  *
@@ -81,6 +93,58 @@ inline void syncXmlFiles(const std::filesystem::path& from, const std::filesyste
  */
 std::string readLastLines(const std::filesystem::path& path, std::size_t n);
 
+/**
+ * @brief Check whether a path is a C/C++ source or header file.
+ *
+ * @param path Path to check.
+ * @param extensions Source extensions without the dot; common header extensions are always accepted.
+ * @return true if the extension of @p path is one of them.
+ */
+bool isSourceFile(const std::filesystem::path& path, const std::vector<std::string>& extensions);
+
+/**
+ * @brief List the C/C++ source and header files below a directory, sorted by path.
+ *
+ * Hidden directories (e.g. .git) and @p skipDirs are not descended into.
+ *
+ * @param root Directory to scan.
+ * @param skipDirs Directories to leave out, as canonical paths.
+ * @param extensions Source extensions, see isSourceFile().
+ * @return Paths of the files found, below @p root.
+ */
+std::vector<std::filesystem::path> listSourceFiles(const std::filesystem::path& root,
+                                                   const std::vector<std::filesystem::path>& skipDirs,
+                                                   const std::vector<std::string>& extensions);
+
+/**
+ * @brief Return the object ID `git hash-object` gives a file with @p content.
+ *
+ * @param content File content.
+ * @return Hexadecimal object ID.
+ */
+std::string hashContent(const std::string& content);
+
+/**
+ * @brief Return the object ID `git hash-object` gives a file.
+ *
+ * @param path File to hash.
+ * @return Hexadecimal object ID, or an empty string if the file cannot be read.
+ */
+std::string hashFile(const std::filesystem::path& path);
+
+/**
+ * @brief Replace a file so that readers see either its old or its new content.
+ *
+ * The content goes to a temporary file next to @p path, named uniquely per
+ * process and call so that concurrent writers never share one, which is then
+ * renamed into place. Missing parent directories are created.
+ *
+ * @param path    File to write.
+ * @param content New content.
+ * @throws std::filesystem::filesystem_error if the file cannot be written or renamed.
+ */
+void writeFileAtomically(const std::filesystem::path& path, const std::string& content);
+
 /**
  * @brief Append the last N lines of a log file to a message string.
  *
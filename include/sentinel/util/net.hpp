@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef INCLUDE_SENTINEL_UTIL_NET_HPP_
+#define INCLUDE_SENTINEL_UTIL_NET_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace sentinel::net {
+
+/**
+ * @brief Largest accepted frame payload. Larger length prefixes are treated as
+ *        a protocol error instead of allocating the announced size.
+ */
+inline constexpr std::uint32_t kMaxFrameSize = 64U * 1024U * 1024U;
+
+/**
+ * @brief Open a listening stream socket.
+ *
+ * @param address "unix:PATH" for a Unix domain socket, or "HOST:PORT" for TCP
+ *                (an empty HOST listens on the loopback interface only, 0.0.0.0 or
+ *                [::] on all interfaces; PORT 0 picks a free port).
+ *                A stale socket file at PATH is replaced; the new one is accessible
+ *                to the owner only.
+ * @return listening socket descriptor.
+ * @throws IOException if the address is invalid or the socket cannot be bound.
+ */
+int listen(const std::string& address);
+
+/**
+ * @brief Connect a stream socket.
+ *
+ * @param address "unix:PATH" or "HOST:PORT" (an empty HOST connects to the local host).
+ * @return connected socket descriptor.
+ * @throws IOException if the address is invalid or the connection fails.
+ */
+int connect(const std::string& address);
+
+/**
+ * @brief Return the address a socket is bound to, in the format accepted by connect().
+ */
+std::string getLocalAddress(int fd);
+
+/**
+ * @brief Make writes to @p fd fail once the peer has accepted no data for @p timeout,
+ *        so that sendFrame() returns false instead of blocking on a stalled peer.
+ */
+void setSendTimeout(int fd, std::chrono::milliseconds timeout);
+
+/**
+ * @brief Write one frame: a 4-byte big-endian payload length followed by the payload.
+ *
+ * @return false if the peer has gone away or the write failed.
+ */
+bool sendFrame(int fd, const std::string& payload);
+
+/**
+ * @brief Read one frame, blocking until it is complete.
+ *
+ * @return the payload, or std::nullopt on end of stream, error or oversized frame.
+ */
+std::optional<std::string> receiveFrame(int fd);
+
+/**
+ * @brief Splits bytes read from a non-blocking socket into frames.
+ */
+class FrameReader {
+ public:
+  /**
+   * @brief Append received bytes.
+   */
+  void append(const char* data, std::size_t size);
+
+  /**
+   * @brief Return the next complete frame payload, or std::nullopt if more bytes are needed.
+   */
+  std::optional<std::string> next();
+
+  /**
+   * @brief Return true if a length prefix exceeded kMaxFrameSize; the stream cannot be resynchronized.
+   */
+  bool isMalformed() const;
+
+ private:
+  std::string mBuffer;
+  bool mMalformed = false;
+};
+
+}  // namespace sentinel::net
+
+#endif  // INCLUDE_SENTINEL_UTIL_NET_HPP_
@@ -58,6 +58,23 @@ inline void setSigaction(int signum, struct sigaction* newSigaction) {
   ::sigaction(signum, newSigaction, nullptr);
 }
 
+/**
+ * @brief block all asynchronous signals in the calling thread
+ *
+ * Helper threads call this first so that signals such as SIGINT, SIGCHLD and
+ * SIGALRM are always delivered to the main thread, which owns the Subprocess handlers.
+ * Fault signals (SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT) stay unblocked: they are
+ * raised in the faulting thread, and its handler must still restore the backups.
+ */
+inline void blockSignalsInThread() {
+  sigset_t async;
+  sigemptyset(&async);
+  for (int signum : {SIGINT, SIGTERM, SIGHUP, SIGQUIT, SIGUSR1, SIGUSR2, SIGALRM, SIGCHLD, SIGWINCH}) {
+    sigaddset(&async, signum);
+  }
+  pthread_sigmask(SIG_BLOCK, &async, nullptr);
+}
+
 /**
  * @brief Sigaction Container
  */
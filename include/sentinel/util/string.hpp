@@ -328,6 +328,16 @@ inline std::string toUpper(std::string s) {
   return s;
 }
 
+/**
+ * @brief Quote a string for use as one word of a POSIX shell command
+ *
+ * @param s input string
+ * @return s enclosed in single quotes, with embedded single quotes escaped
+ */
+inline std::string shellQuote(const std::string& s) {
+  return "'" + replaceAll(s, "'", "'\\''") + "'";
+}
+
 }  // namespace sentinel::string
 
 #endif  // INCLUDE_SENTINEL_UTIL_STRING_HPP_
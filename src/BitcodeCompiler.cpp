@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <clang/Basic/CodeGenOptions.h>
+#include <clang/Basic/Diagnostic.h>
+#include <clang/Basic/TargetOptions.h>
+#include <clang/CodeGen/CodeGenAction.h>
+#include <clang/Frontend/CompilerInstance.h>
+#include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Tooling/Tooling.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/raw_ostream.h>
+#include <cerrno>
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "sentinel/BitcodeCompiler.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/util/string.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+#if LLVM_VERSION_MAJOR >= 17
+namespace codegenoptions = llvm::codegenoptions;
+#else
+namespace codegenoptions = clang::codegenoptions;
+#endif
+
+struct CompileState {
+  explicit CompileState(BitcodeUnit* compiled) : unit(compiled) {
+  }
+
+  llvm::LLVMContext context;
+  BitcodeUnit* unit;
+  bool started = false;
+};
+
+// Emits the unoptimized module of the first command of a file and records how the build generates its code.
+class BitcodeAction : public clang::EmitLLVMOnlyAction {
+ public:
+  explicit BitcodeAction(CompileState* state) : clang::EmitLLVMOnlyAction(&state->context), mState(state) {
+  }
+
+ protected:
+  bool BeginInvocation(clang::CompilerInstance& ci) override {
+    if (mState->started) {
+      return false;
+    }
+    mState->started = true;
+    clang::CodeGenOptions& codeGen = ci.getCodeGenOpts();
+    // Instrumentation is added by LLVM passes that only clang runs, and the
+    // target machine is created with the default code model.
+    const auto reloc = codeGen.getRelocationModel();
+    if (!ci.getLangOpts().Sanitize.empty() || codeGen.hasProfileInstr() || codeGen.EmitGcovArcs ||
+        codeGen.EmitGcovNotes || (reloc != llvm::Reloc::PIC_ && reloc != llvm::Reloc::Static) ||
+        codeGen.CodeModel != "default") {
+      return false;
+    }
+    const clang::TargetOptions& target = ci.getTargetOpts();
+    BitcodeUnit* unit = mState->unit;
+    unit->optLevel = codeGen.OptimizationLevel;
+    unit->sizeLevel = codeGen.OptimizeSize;
+    unit->pic = reloc == llvm::Reloc::PIC_;
+    unit->cpu = target.CPU;
+    unit->features = llvm::join(target.FeaturesAsWritten, ",");
+    unit->abi = target.ABI;
+    unit->floatAbi = codeGen.FloatABI;
+    unit->functionSections = codeGen.FunctionSections;
+    unit->dataSections = codeGen.DataSections;
+    unit->debugInfo = codeGen.getDebugInfo() != codegenoptions::NoDebugInfo;
+    if (!unit->debugInfo) {
+      codeGen.setDebugInfo(codegenoptions::DebugLineTablesOnly);
+    }
+    codeGen.DebugColumnInfo = 1;
+    codeGen.DisableLLVMPasses = 1;
+    return clang::EmitLLVMOnlyAction::BeginInvocation(ci);
+  }
+
+  void EndSourceFileAction() override {
+    clang::EmitLLVMOnlyAction::EndSourceFileAction();
+    // No module is left when the file has errors.
+    if (std::unique_ptr<llvm::Module> module = takeModule()) {
+      llvm::raw_string_ostream out(mState->unit->bitcode);
+      llvm::WriteBitcodeToFile(*module, out);
+      out.flush();
+    }
+  }
+
+ private:
+  CompileState* mState;
+};
+
+class BitcodeActionFactory : public clang::tooling::FrontendActionFactory {
+ public:
+  explicit BitcodeActionFactory(CompileState* state) : mState(state) {
+  }
+
+  std::unique_ptr<clang::FrontendAction> create() override {
+    return std::make_unique<BitcodeAction>(mState);
+  }
+
+ private:
+  CompileState* mState;
+};
+
+// Object written by @p command: its output, or the argument of -o, relative to its directory.
+fs::path getObject(const clang::tooling::CompileCommand& command) {
+  std::string output = command.Output;
+  for (std::size_t i = 0; output.empty() && i < command.CommandLine.size(); i++) {
+    const std::string& arg = command.CommandLine[i];
+    if (arg == "-o" && i + 1 < command.CommandLine.size()) {
+      output = command.CommandLine[i + 1];
+    } else if (arg.size() > 2 && string::startsWith(arg, "-o")) {
+      output = arg.substr(2);
+    }
+  }
+  if (output.empty()) {
+    return {};
+  }
+  return (fs::path(command.Directory) / output).lexically_normal();
+}
+
+}  // namespace
+
+BitcodeCompiler::BitcodeCompiler(const fs::path& compileDbDir) {
+  std::string errorMsg;
+  mCompileDb = clang::tooling::CompilationDatabase::loadFromDirectory(compileDbDir.string(), errorMsg);
+  if (mCompileDb == nullptr) {
+    throw IOException(EINVAL, errorMsg);
+  }
+}
+
+BitcodeCompiler::~BitcodeCompiler() = default;
+
+std::optional<BitcodeUnit> BitcodeCompiler::compile(const fs::path& source) {
+  const std::vector<clang::tooling::CompileCommand> commands = mCompileDb->getCompileCommands(source.string());
+  if (commands.empty()) {
+    return std::nullopt;
+  }
+  BitcodeUnit unit;
+  unit.object = getObject(commands.front());
+  std::error_code ec;
+  if (unit.object.empty() || !fs::is_regular_file(unit.object, ec)) {
+    return std::nullopt;
+  }
+
+  CompileState state(&unit);
+  BitcodeActionFactory factory(&state);
+  clang::IgnoringDiagConsumer ignoring;
+  clang::tooling::ClangTool tool(*mCompileDb, {source.string()});
+  tool.setDiagnosticConsumer(&ignoring);
+  // Later commands of the file are refused, so the result of the run does not tell.
+  tool.run(&factory);
+  if (unit.bitcode.empty()) {
+    return std::nullopt;
+  }
+  return unit;
+}
+
+}  // namespace sentinel
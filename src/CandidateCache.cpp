@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "sentinel/CandidateCache.hpp"
+#include "sentinel/Logger.hpp"
+#include "sentinel/util/io.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+/// Bump when the key or entry format changes so that old entries are no longer matched.
+static constexpr const char* kKeyVersion = "sentinel-candidates-1";
+
+CandidateCache::CandidateCache(const fs::path& dir, const std::string& context) : mDir(dir) {
+  mContextHash = io::hashContent(fmt::format("{}\n{}", kKeyVersion, context));
+}
+
+const std::string& CandidateCache::hashFile(const fs::path& path) {
+  auto [it, inserted] = mFileHashes.emplace(path, std::string{});
+  if (inserted) {
+    it->second = io::hashFile(path);
+  }
+  return it->second;
+}
+
+fs::path CandidateCache::entryPath(const fs::path& file, const std::string& key) {
+  const fs::path absolute = fs::absolute(file).lexically_normal();
+  const std::string& fileHash = hashFile(absolute);
+  if (fileHash.empty()) {
+    return {};
+  }
+  const std::string hash = io::hashContent(fmt::format("{}\n{}\n{}\n{}", mContextHash, absolute.string(), fileHash, key));
+  return mDir / hash.substr(0, 2) / hash.substr(2);
+}
+
+std::optional<FileCandidates> CandidateCache::find(const fs::path& file, const std::string& key) {
+  const fs::path path = entryPath(file, key);
+  if (path.empty()) {
+    return std::nullopt;
+  }
+  std::ifstream in(path);
+  if (!in) {
+    return std::nullopt;
+  }
+  // One "<hash> <path>" line per file read while parsing, an empty line, then the candidates.
+  std::string line;
+  while (std::getline(in, line) && !line.empty()) {
+    const std::size_t space = line.find(' ');
+    if (space == std::string::npos || hashFile(line.substr(space + 1)) != line.substr(0, space)) {
+      return std::nullopt;
+    }
+  }
+  if (!in) {
+    return std::nullopt;
+  }
+  try {
+    return FileCandidates::deserialize(std::string(std::istreambuf_iterator<char>(in), {}));
+  } catch (const std::runtime_error& e) {
+    Logger::verbose("Ignoring candidate cache entry '{}': {}", path.string(), e.what());
+    return std::nullopt;
+  }
+}
+
+void CandidateCache::store(const fs::path& file, const std::string& key, const FileCandidates& candidates) {
+  if (candidates.includes.empty()) {
+    return;
+  }
+  const fs::path path = entryPath(file, key);
+  if (path.empty()) {
+    return;
+  }
+  std::ostringstream entry;
+  for (const auto& include : candidates.includes) {
+    const std::string& hash = hashFile(include);
+    if (hash.empty()) {
+      return;
+    }
+    entry << hash << ' ' << include << '\n';
+  }
+  entry << '\n' << candidates.serialize();
+
+  try {
+    io::writeFileAtomically(path, entry.str());
+  } catch (const fs::filesystem_error& e) {
+    Logger::verbose("Failed to store candidate cache entry: {}", e.what());
+  }
+}
+
+}  // namespace sentinel
@@ -35,6 +35,20 @@ CliConfigParser::CliConfigParser(args::ArgumentParser& parser) :
     mTestResultDir(mGroupBuildTest, "PATH", "Path to the test report directory", {"test-result-dir"}),
     mTimeout(mGroupBuildTest, "SEC", "Test time limit in seconds; 0 = no limit (default: ceil(baseline x 1.5) + 5s)",
              {"timeout"}),
+    mTargetedBuild(mGroupBuildTest, "targeted-build",
+                   "Build only the Ninja targets that depend on the mutated file instead of running the build "
+                   "command",
+                   {"targeted-build"}),
+    mFailFastBuild(mGroupBuildTest, "fail-fast-build",
+                   "Stop a mutant's build at the first compiler error in the mutated file", {"fail-fast-build"}),
+    mJobserver(mGroupBuildTest, "N",
+               "Share N job tokens between the builds and tests of every sentinel on this host through a GNU make "
+               "jobserver; 0 = number of CPU cores",
+               {"jobserver"}),
+    mPressureTargets(mGroupBuildTest, "RESOURCE:PCT",
+                     "Hold back jobserver tokens while the cpu, memory or io pressure (PSI avg10) exceeds PCT "
+                     "(repeatable; implies --jobserver=0 if it is not set)",
+                     {"pressure-target"}),
     mFrom(mGroupMutation, "REV",
           "Diff base revision (e.g., HEAD~1, main, v1.0). "
           "Mutates only lines changed between the merge-base of REV and HEAD.",
@@ -59,13 +73,88 @@ CliConfigParser::CliConfigParser(args::ArgumentParser& parser) :
               "Restrict mutant generation to lines covered by --lcov-tracefile "
               "(otherwise uncovered mutants are kept in the report as SURVIVED*).",
               {"restrict"}),
+    mCacheDir(mGroupAdvanced, "PATH",
+              "Reuse verdicts of unchanged mutants from earlier runs stored in this directory", {"cache-dir"}),
+    mWeakMutation(mGroupAdvanced, "weak-mutation",
+                  "Skip the evaluation of mutants whose value never differs from the original while the tests "
+                  "run against an instrumented build",
+                  {"weak-mutation"}),
+    mStaticTestSelection(mGroupAdvanced, "static-test-selection",
+                         "Without --lcov-tracefile, run only the Google Test cases a static call graph finds able "
+                         "to reach the mutated function",
+                         {"static-test-selection"}),
+    mIrMutation(mGroupAdvanced, "ir-mutation",
+                "Apply arithmetic, bitwise, relational and shift mutants to the LLVM IR of their file and replace "
+                "its object, so the build only relinks",
+                {"ir-mutation"}),
+    mJitBitcode(mGroupAdvanced, "PATH",
+                "Experimental: test operator mutants by running this LLVM IR of the whole Google Test program in a "
+                "JIT, without building",
+                {"jit-bitcode"}),
+    mKeepTestResults(mGroupAdvanced, "keep-test-results",
+                     "Move the test results of each mutant to its directory in the workspace",
+                     {"keep-test-results"}),
+    mGenerationMemoryLimit(mGroupAdvanced, "MIB",
+                           "Parse each source file in a worker process limited to MIB of memory; "
+                           "files whose worker exceeds it are skipped",
+                           {"generation-memory-limit"}),
+    mGenerationTimeout(mGroupAdvanced, "SEC",
+                       "Parse each source file in a worker process limited to SEC seconds; "
+                       "files whose worker exceeds it twice are skipped",
+                       {"generation-timeout"}),
+    mCandidateCacheDir(mGroupAdvanced, "PATH",
+                       "Reuse the mutant candidates of unchanged source files from earlier runs stored in this "
+                       "directory",
+                       {"candidate-cache-dir"}),
     mPartition(mGroupAdvanced, "N/TOTAL", "Evaluate only the N-th slice of the full mutant list out of TOTAL",
                {"partition"}),
+    mPartitionBy(mGroupAdvanced, "MODE",
+                 "Assign mutants to partitions by 'count' (equal slices) or 'cost' (balanced build and test time, "
+                 "mutants of one file kept together)",
+                 {"partition-by"}),
+    mPartitionCosts(mGroupAdvanced, "PATH",
+                    "Workspace of a previous run whose build and test times weight --partition-by=cost",
+                    {"partition-costs"}),
+    mGenerateOnly(mGroupAdvanced, "FILE",
+                  "Build, test, and generate mutants, then write the full mutant list to FILE and exit",
+                  {"generate-only"}),
+    mPlan(mGroupAdvanced, "FILE",
+          "Evaluate the mutants of a plan written by --generate-only instead of generating them",
+          {"plan"}),
     mMergePartitions(mGroupAdvanced, "PATH",
                      "Merge a partitioned workspace result into the target workspace (repeatable)",
                      {"merge-partition"}),
+    mMergeIndexOnly(mGroupAdvanced, "merge-index-only",
+                    "With --merge-partition, merge only the mutant results and link the build and test logs "
+                    "to the partition workspaces instead of copying them",
+                    {"merge-index-only"}),
+    mMergeHardLink(mGroupAdvanced, "merge-hard-link",
+                   "With --merge-partition, hard-link files that cannot be cloned instead of copying them; "
+                   "neither workspace may be resumed afterwards",
+                   {"merge-hard-link"}),
     mThreshold(mGroupAdvanced, "PCT", "Fail with exit code 3 if mutation score is below this percentage (0.0-100.0)",
-               {"threshold"}) {
+               {"threshold"}),
+    mTimeBudget(mGroupAdvanced, "SEC",
+                "Stop evaluating when the next mutant would exceed SEC seconds of evaluation time (the original "
+                "build, test and mutant generation are not counted) and report a sampled estimate; "
+                "the workspace can be resumed",
+                {"time-budget"}),
+    mStream(mGroupAdvanced, "stream",
+            "Start evaluating mutants while generation is still running (ignored with --partition and --dry-run)",
+            {"stream"}),
+    mWatch(mGroupAdvanced, "watch",
+           "Keep running and re-evaluate mutants of edited lines whenever a source file is saved "
+           "(ignored with --partition and --dry-run)",
+           {"watch"}),
+    mShared(mGroupAdvanced, "shared",
+            "Evaluate the mutants of the workspace together with other sentinel processes using the same "
+            "--workspace, each in its own checkout (ignored with --dry-run)",
+            {"shared"}),
+    mServe(mGroupAdvanced, "ADDR",
+           "Hand out mutants to workers connecting to ADDR (HOST:PORT or unix:PATH) instead of evaluating them",
+           {"serve"}),
+    mWorker(mGroupAdvanced, "ADDR",
+            "Evaluate mutants handed out by the coordinator at ADDR in this checkout", {"worker"}) {
 }
 
 void CliConfigParser::applyTo(Config* cfg) {
@@ -80,6 +169,10 @@ void CliConfigParser::applyTo(Config* cfg) {
   if (mBuildCmd) cfg->buildCmd = mBuildCmd.Get();
   if (mTestCmd) cfg->testCmd = mTestCmd.Get();
   if (mTimeout) cfg->timeout = mTimeout.Get();
+  if (mTargetedBuild) cfg->targetedBuild = true;
+  if (mFailFastBuild) cfg->failFastBuild = true;
+  if (mJobserver) cfg->jobserver = mJobserver.Get();
+  if (mPressureTargets) cfg->pressureTargets = mPressureTargets.Get();
 
   if (mFrom) cfg->from = mFrom.Get();
   cfg->uncommitted = mUncommitted;
@@ -95,17 +188,39 @@ void CliConfigParser::applyTo(Config* cfg) {
     }
   }
   if (mRestrict) cfg->restrictGeneration = true;
+  if (mCacheDir) cfg->cacheDir = fs::absolute(mCacheDir.Get()).lexically_normal();
+  if (mWeakMutation) cfg->weakMutation = true;
+  if (mStaticTestSelection) cfg->staticTestSelection = true;
+  if (mIrMutation) cfg->irMutation = true;
+  if (mJitBitcode) cfg->jitBitcode = fs::absolute(mJitBitcode.Get()).lexically_normal();
+  if (mKeepTestResults) cfg->keepTestResults = true;
+  if (mGenerationMemoryLimit) cfg->generationMemoryLimit = mGenerationMemoryLimit.Get();
+  if (mGenerationTimeout) cfg->generationTimeout = mGenerationTimeout.Get();
+  if (mCandidateCacheDir) cfg->candidateCacheDir = fs::absolute(mCandidateCacheDir.Get()).lexically_normal();
 
   if (mLimit) cfg->limit = mLimit.Get();
   if (mSeed) cfg->seed = mSeed.Get();
   if (mThreshold) cfg->threshold = mThreshold.Get();
+  if (mTimeBudget) cfg->timeBudget = mTimeBudget.Get();
   if (mPartition) cfg->partition = mPartition.Get();
+  if (mPartitionBy) cfg->partitionBy = mPartitionBy.Get();
+  if (mPartitionCosts) cfg->partitionCosts = fs::absolute(mPartitionCosts.Get()).lexically_normal();
+  if (mGenerateOnly) cfg->generateOnly = fs::absolute(mGenerateOnly.Get()).lexically_normal();
+  if (mPlan) cfg->planFile = fs::absolute(mPlan.Get()).lexically_normal();
   if (mMergePartitions) {
     cfg->mergeWorkspaces.clear();
     for (const auto& p : mMergePartitions.Get()) {
       cfg->mergeWorkspaces.push_back(fs::absolute(p).lexically_normal());
     }
   }
+  cfg->mergeIndexOnly = mMergeIndexOnly;
+  cfg->mergeHardLink = mMergeHardLink;
+
+  cfg->stream = mStream;
+  cfg->watch = mWatch;
+  cfg->shared = mShared;
+  if (mServe) cfg->serveAddress = mServe.Get();
+  if (mWorker) cfg->workerAddress = mWorker.Get();
 
   cfg->init = mInit;
   cfg->dryRun = mDryRun;
@@ -116,12 +231,18 @@ void CliConfigParser::applyTo(Config* cfg) {
 
 std::vector<std::string> CliConfigParser::getEffectiveCliOptions() const {
   std::vector<std::string> opts;
-  if (mSourceDir) opts.push_back("--source-dir");
-  if (mBuildCmd) opts.push_back("--build-command");
-  if (mCompileDbDir) opts.push_back("--compiledb-dir");
-  if (mTestCmd) opts.push_back("--test-command");
-  if (mTestResultDir) opts.push_back("--test-result-dir");
+  if (!mShared) {
+    if (mSourceDir) opts.push_back("--source-dir");
+    if (mBuildCmd) opts.push_back("--build-command");
+    if (mCompileDbDir) opts.push_back("--compiledb-dir");
+    if (mTestCmd) opts.push_back("--test-command");
+    if (mTestResultDir) opts.push_back("--test-result-dir");
+  }
   if (mTimeout) opts.push_back("--timeout");
+  if (mTargetedBuild) opts.push_back("--targeted-build");
+  if (mFailFastBuild) opts.push_back("--fail-fast-build");
+  if (mJobserver) opts.push_back("--jobserver");
+  if (mPressureTargets) opts.push_back("--pressure-target");
   if (mFrom) opts.push_back("--from");
   if (mUncommitted) opts.push_back("--uncommitted");
   if (mPatterns) opts.push_back("--pattern");
@@ -132,8 +253,20 @@ std::vector<std::string> CliConfigParser::getEffectiveCliOptions() const {
   if (mOperators) opts.push_back("--operator");
   if (mLcovTracefiles) opts.push_back("--lcov-tracefile");
   if (mRestrict) opts.push_back("--restrict");
+  if (mCacheDir) opts.push_back("--cache-dir");
+  if (mWeakMutation) opts.push_back("--weak-mutation");
+  if (mStaticTestSelection) opts.push_back("--static-test-selection");
+  if (mIrMutation) opts.push_back("--ir-mutation");
+  if (mJitBitcode) opts.push_back("--jit-bitcode");
+  if (mKeepTestResults) opts.push_back("--keep-test-results");
+  if (mGenerationMemoryLimit) opts.push_back("--generation-memory-limit");
+  if (mGenerationTimeout) opts.push_back("--generation-timeout");
+  if (mCandidateCacheDir) opts.push_back("--candidate-cache-dir");
   if (mLimit) opts.push_back("--limit");
   if (mPartition) opts.push_back("--partition");
+  if (mPartitionBy) opts.push_back("--partition-by");
+  if (mPartitionCosts) opts.push_back("--partition-costs");
+  if (mPlan) opts.push_back("--plan");
   return opts;
 }
 
@@ -141,6 +274,18 @@ void CliConfigParser::applyReportOnlyTo(Config* cfg) {
   namespace fs = std::filesystem;
   if (mOutputDir) cfg->outputDir = fs::absolute(mOutputDir.Get()).lexically_normal();
   if (mThreshold) cfg->threshold = mThreshold.Get();
+  if (mTimeBudget) cfg->timeBudget = mTimeBudget.Get();
+  if (mShared) {
+    if (mSourceDir) cfg->sourceDir = fs::absolute(mSourceDir.Get()).lexically_normal();
+    if (mCompileDbDir) cfg->compileDbDir = fs::absolute(mCompileDbDir.Get()).lexically_normal();
+    if (mTestResultDir) cfg->testResultDir = fs::absolute(mTestResultDir.Get()).lexically_normal();
+    if (mBuildCmd) cfg->buildCmd = mBuildCmd.Get();
+    if (mTestCmd) cfg->testCmd = mTestCmd.Get();
+  }
+  cfg->stream = mStream;
+  cfg->watch = mWatch;
+  cfg->shared = mShared;
+  if (mServe) cfg->serveAddress = mServe.Get();
   cfg->verbose = mVerbose;
   cfg->force = mForce;
   cfg->clean = mClean;
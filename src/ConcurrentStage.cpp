@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <exception>
+#include <memory>
+#include <thread>
+#include <utility>
+#include "sentinel/ConcurrentStage.hpp"
+#include "sentinel/util/signal.hpp"
+
+namespace sentinel {
+
+ConcurrentStage::ConcurrentStage(std::shared_ptr<Stage> producer, std::shared_ptr<Stage> consumer,
+                                 std::size_t capacity) :
+    mProducer(std::move(producer)), mConsumer(std::move(consumer)), mCapacity(capacity) {
+}
+
+bool ConcurrentStage::shouldSkip(const PipelineContext& ctx) const {
+  return mProducer->shouldSkip(ctx) && mConsumer->shouldSkip(ctx);
+}
+
+StatusLine::Phase ConcurrentStage::getPhase() const {
+  return mConsumer->getPhase();
+}
+
+bool ConcurrentStage::execute(PipelineContext* ctx) {
+  if (mProducer->shouldSkip(*ctx)) {
+    return mConsumer->shouldSkip(*ctx) || mConsumer->execute(ctx);
+  }
+
+  MutantQueue queue(mCapacity);
+  PipelineContext streamCtx{ctx->config, ctx->statusLine, ctx->workspace, &queue};
+
+  std::exception_ptr producerError;
+  std::thread producer([&] {
+    signal::blockSignalsInThread();
+    try {
+      mProducer->execute(&streamCtx);
+      queue.close();
+    } catch (...) {
+      producerError = std::current_exception();
+      queue.abort();
+    }
+  });
+
+  bool proceed = false;
+  try {
+    proceed = mConsumer->execute(&streamCtx);
+  } catch (...) {
+    queue.abort();
+    producer.join();
+    throw;
+  }
+  producer.join();
+
+  if (producerError) {
+    std::rethrow_exception(producerError);
+  }
+  return proceed;
+}
+
+}  // namespace sentinel
@@ -4,11 +4,14 @@
  */
 
 #include <fmt/core.h>
+#include <fnmatch.h>
 #include <yaml-cpp/yaml.h>
+#include <algorithm>
 #include <charconv>
 #include <filesystem>  // NOLINT
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include "sentinel/Config.hpp"
 #include "sentinel/util/string.hpp"
 
@@ -56,6 +59,50 @@ Partition Partition::parse(const std::string& s) {
   return {idx, cnt};
 }
 
+std::optional<std::size_t> Scope::find(const std::vector<Scope>& scopes, const fs::path& path) {
+  const std::string relPath = path.string();
+  std::optional<std::size_t> best;
+  std::pair<std::size_t, std::size_t> bestRank;
+  for (std::size_t i = 0; i < scopes.size(); i++) {
+    const std::string& glob = scopes[i].path;
+    if (fnmatch(glob.c_str(), relPath.c_str(), 0) != 0) {
+      continue;
+    }
+    const std::size_t literal = std::min(glob.find_first_of("*?["), glob.size());
+    const std::pair<std::size_t, std::size_t> rank{literal, glob.size()};
+    if (!best || rank > bestRank) {
+      best = i;
+      bestRank = rank;
+    }
+  }
+  return best;
+}
+
+PressureTarget PressureTarget::parse(const std::string& s) {
+  auto colon = s.find(':');
+  if (colon == std::string::npos) {
+    throw std::invalid_argument(fmt::format("Invalid pressure target: '{}'. Expected format: RESOURCE:PCT.", s));
+  }
+  std::string resource = string::toLower(s.substr(0, colon));
+  if (resource != "cpu" && resource != "memory" && resource != "io") {
+    throw std::invalid_argument(
+        fmt::format("Invalid pressure target: '{}'. RESOURCE must be 'cpu', 'memory', or 'io'.", s));
+  }
+  const std::string value = s.substr(colon + 1);
+  double percent = 0.0;
+  std::size_t end = 0;
+  try {
+    percent = std::stod(value, &end);
+  } catch (const std::exception&) {
+    end = std::string::npos;
+  }
+  if (value.empty() || end != value.size() || !(percent > 0.0 && percent <= 100.0)) {
+    throw std::invalid_argument(
+        fmt::format("Invalid pressure target: '{}'. PCT must be a number greater than 0 and at most 100.", s));
+  }
+  return {resource, percent};
+}
+
 Config Config::withDefaults() {
   Config cfg;
   cfg.sourceDir = fs::absolute(".").lexically_normal();
@@ -94,6 +141,33 @@ std::ostream& operator<<(std::ostream& out, const Config& cfg) {
   if (cfg.restrictGeneration) {
     emitter << YAML::Key << "restrict" << YAML::Value << true;
   }
+  if (!cfg.cacheDir.empty()) {
+    emitter << YAML::Key << "cache-dir" << YAML::Value << cfg.cacheDir.string();
+  }
+  if (cfg.weakMutation) {
+    emitter << YAML::Key << "weak-mutation" << YAML::Value << true;
+  }
+  if (cfg.staticTestSelection) {
+    emitter << YAML::Key << "static-test-selection" << YAML::Value << true;
+  }
+  if (cfg.irMutation) {
+    emitter << YAML::Key << "ir-mutation" << YAML::Value << true;
+  }
+  if (!cfg.jitBitcode.empty()) {
+    emitter << YAML::Key << "jit-bitcode" << YAML::Value << cfg.jitBitcode.string();
+  }
+  if (cfg.keepTestResults) {
+    emitter << YAML::Key << "keep-test-results" << YAML::Value << true;
+  }
+  if (cfg.generationMemoryLimit) {
+    emitter << YAML::Key << "generation-memory-limit" << YAML::Value << *cfg.generationMemoryLimit;
+  }
+  if (cfg.generationTimeout) {
+    emitter << YAML::Key << "generation-timeout" << YAML::Value << *cfg.generationTimeout;
+  }
+  if (!cfg.candidateCacheDir.empty()) {
+    emitter << YAML::Key << "candidate-cache-dir" << YAML::Value << cfg.candidateCacheDir.string();
+  }
   emitter << YAML::Key << "generator" << YAML::Value << generatorToString(cfg.generator);
   if (cfg.mutantsPerLine != 1) {
     emitter << YAML::Key << "mutants-per-line" << YAML::Value << cfg.mutantsPerLine;
@@ -101,6 +175,32 @@ std::ostream& operator<<(std::ostream& out, const Config& cfg) {
   if (cfg.timeout) {
     emitter << YAML::Key << "timeout" << YAML::Value << *cfg.timeout;
   }
+  if (cfg.targetedBuild) {
+    emitter << YAML::Key << "targeted-build" << YAML::Value << true;
+  }
+  if (cfg.failFastBuild) {
+    emitter << YAML::Key << "fail-fast-build" << YAML::Value << true;
+  }
+  if (cfg.jobserver) {
+    emitter << YAML::Key << "jobserver" << YAML::Value << *cfg.jobserver;
+  }
+  if (!cfg.pressureTargets.empty()) {
+    emitter << YAML::Key << "pressure-target" << YAML::Value << YAML::BeginSeq;
+    for (const auto& target : cfg.pressureTargets) emitter << target;
+    emitter << YAML::EndSeq;
+  }
+  if (!cfg.scopes.empty()) {
+    emitter << YAML::Key << "scopes" << YAML::Value << YAML::BeginSeq;
+    for (const auto& scope : cfg.scopes) {
+      emitter << YAML::BeginMap;
+      emitter << YAML::Key << "path" << YAML::Value << scope.path;
+      emitter << YAML::Key << "build-command" << YAML::Value << scope.buildCmd;
+      emitter << YAML::Key << "test-command" << YAML::Value << scope.testCmd;
+      emitter << YAML::Key << "test-result-dir" << YAML::Value << scope.testResultDir.string();
+      emitter << YAML::EndMap;
+    }
+    emitter << YAML::EndSeq;
+  }
   emitter << YAML::Key << "operator" << YAML::Value << YAML::BeginSeq;
   for (const auto& op : cfg.operators) emitter << op;
   emitter << YAML::EndSeq;
@@ -8,10 +8,13 @@
 #include <algorithm>
 #include <filesystem>  // NOLINT
 #include <string>
+#include <utility>
 #include <vector>
 #include "sentinel/Config.hpp"
 #include "sentinel/ConfigValidator.hpp"
 #include "sentinel/Logger.hpp"
+#include "sentinel/NinjaGraph.hpp"
+#include "sentinel/PartitionPlanner.hpp"
 #include "sentinel/exceptions/InvalidArgumentException.hpp"
 #include "sentinel/operators/MutationOperatorExpansion.hpp"
 #include "sentinel/util/string.hpp"
@@ -60,6 +63,33 @@ void ConfigValidator::validate(const Config& config) {
     }
   }
 
+  for (const auto& target : config.pressureTargets) {
+    try {
+      PressureTarget::parse(target);
+    } catch (const std::invalid_argument& e) {
+      throw InvalidArgumentException(e.what());
+    }
+  }
+
+  if (config.partitionBy != PartitionPlanner::kByCount && config.partitionBy != PartitionPlanner::kByCost) {
+    throw InvalidArgumentException(fmt::format("--partition-by: '{}' is not valid. Expected '{}' or '{}'.",
+                                               config.partitionBy, PartitionPlanner::kByCount,
+                                               PartitionPlanner::kByCost));
+  }
+
+  if (!config.partitionCosts.empty() && !fs::exists(config.partitionCosts / "config.yaml")) {
+    throw InvalidArgumentException(
+        fmt::format("--partition-costs: '{}' is not a sentinel workspace.", config.partitionCosts.string()));
+  }
+
+  if (!config.planFile.empty() && !config.generateOnly.empty()) {
+    throw InvalidArgumentException("--plan cannot be combined with --generate-only.");
+  }
+
+  if (!config.planFile.empty() && !fs::is_regular_file(config.planFile)) {
+    throw InvalidArgumentException(fmt::format("--plan: '{}' not found.", config.planFile.string()));
+  }
+
   if (config.from) {
     const auto& rev = *config.from;
     if (rev.empty()) {
@@ -74,6 +104,22 @@ void ConfigValidator::validate(const Config& config) {
     }
   }
 
+  if (config.timeBudget && *config.timeBudget == 0) {
+    throw InvalidArgumentException("--time-budget: must be at least 1 second.");
+  }
+  if (config.generationMemoryLimit && *config.generationMemoryLimit == 0) {
+    throw InvalidArgumentException("--generation-memory-limit: must be at least 1 MiB.");
+  }
+  if (config.generationTimeout && *config.generationTimeout == 0) {
+    throw InvalidArgumentException("--generation-timeout: must be at least 1 second.");
+  }
+
+  if (!config.jitBitcode.empty() && config.stream) {
+    throw InvalidArgumentException(
+        "--jit-bitcode cannot be combined with --stream: the JIT test runs are forked "
+        "while the generation threads are running.");
+  }
+
   if (config.restrictGeneration && config.lcovTracefiles.empty()) {
     throw InvalidArgumentException(
         "--restrict requires --lcov-tracefile to be set.");
@@ -105,6 +151,118 @@ void ConfigValidator::checkWarnings(const Config& config) {
                         "so each run may evaluate a different subset of mutants.");
   }
 
+  if (!config.partitionCosts.empty() && config.partitionBy != PartitionPlanner::kByCost) {
+    warnings.push_back("--partition-costs: ignored without --partition-by=cost.");
+  } else if (config.partitionBy != PartitionPlanner::kByCount && !config.partition && !config.dryRun) {
+    warnings.push_back("--partition-by: ignored without --partition.");
+  }
+
+  if (!config.planFile.empty()) {
+    std::vector<std::string> ignored;
+    if (config.seed) ignored.emplace_back("--seed");
+    if (config.from) ignored.emplace_back("--from");
+    if (config.uncommitted) ignored.emplace_back("--uncommitted");
+    if (config.limit > 0) ignored.emplace_back("--limit");
+    if (config.restrictGeneration) ignored.emplace_back("--restrict");
+    if (!ignored.empty()) {
+      warnings.push_back(fmt::format("{}: ignored with --plan. The mutants are taken from the plan.",
+                                     fmt::join(ignored, ", ")));
+    }
+    if (config.stream) {
+      warnings.push_back("--stream: ignored with --plan. All mutants are known before evaluation starts.");
+    }
+  }
+
+  if (!config.generateOnly.empty()) {
+    for (const auto& [enabled, option] :
+         {std::pair{config.partition.has_value(), "--partition"}, std::pair{config.dryRun, "--dry-run"},
+          std::pair{config.stream, "--stream"}, std::pair{config.watch, "--watch"},
+          std::pair{config.shared, "--shared"}, std::pair{config.serveAddress.has_value(), "--serve"},
+          std::pair{config.weakMutation, "--weak-mutation"},
+          std::pair{config.staticTestSelection, "--static-test-selection"},
+          std::pair{config.irMutation, "--ir-mutation"},
+          std::pair{!config.jitBitcode.empty(), "--jit-bitcode"},
+          std::pair{config.keepTestResults, "--keep-test-results"},
+          std::pair{config.timeBudget.has_value(), "--time-budget"}}) {
+      if (enabled) {
+        warnings.push_back(fmt::format("{}: ignored with --generate-only. No mutant is evaluated.", option));
+      }
+    }
+  }
+
+  if (config.mergeIndexOnly) {
+    warnings.push_back("--merge-index-only: ignored without --merge-partition.");
+  }
+  if (config.mergeHardLink) {
+    warnings.push_back("--merge-hard-link: ignored without --merge-partition.");
+  }
+
+  if (config.stream && config.partition) {
+    warnings.push_back("--stream: ignored with --partition. The partition slice is known only "
+                       "after all mutants are generated.");
+  } else if (config.stream && config.dryRun) {
+    warnings.push_back("--stream: ignored with --dry-run. No mutant is evaluated.");
+  }
+
+  if (config.watch && config.partition) {
+    warnings.push_back("--watch: ignored with --partition. Edited lines cannot be assigned to a partition.");
+  } else if (config.watch && config.dryRun) {
+    warnings.push_back("--watch: ignored with --dry-run. No mutant is evaluated.");
+  } else if (config.watch && config.shared) {
+    warnings.push_back("--watch: ignored with --shared. Other processes may still be evaluating the mutants.");
+  }
+
+  if (config.shared && config.dryRun) {
+    warnings.push_back("--shared: ignored with --dry-run. No mutant is evaluated.");
+  }
+
+  if (config.serveAddress && config.dryRun) {
+    warnings.push_back("--serve: ignored with --dry-run. No mutant is evaluated.");
+  } else if (config.serveAddress) {
+    for (const auto& [enabled, option] : {std::pair{config.stream, "--stream"}, std::pair{config.watch, "--watch"},
+                                          std::pair{config.shared, "--shared"}}) {
+      if (enabled) {
+        warnings.push_back(fmt::format("{}: ignored with --serve. Mutants are evaluated by the workers.", option));
+      }
+    }
+  }
+
+  if (config.weakMutation && config.serveAddress && !config.dryRun) {
+    warnings.push_back("--weak-mutation: ignored with --serve. Mutants are evaluated by the workers.");
+  } else if (config.weakMutation && config.stream && !config.dryRun && !config.partition && config.planFile.empty()) {
+    warnings.push_back("--weak-mutation: ignored with --stream. Mutants are evaluated while they are generated.");
+  } else if (config.weakMutation && config.shared) {
+    warnings.push_back("--weak-mutation: ignored with --shared. Other processes may be building the sources.");
+  }
+
+  if (config.timeBudget && config.serveAddress && !config.dryRun) {
+    warnings.push_back("--time-budget: ignored with --serve. Mutants are evaluated by the workers.");
+  } else if (config.timeBudget && config.shared && !config.dryRun) {
+    warnings.push_back("--time-budget: ignored with --shared. Other processes keep evaluating the mutants.");
+  } else if (config.timeBudget && config.stream && !config.dryRun && !config.partition && config.planFile.empty()) {
+    warnings.push_back("--time-budget: ignored with --stream. The mutants are evaluated in generation order.");
+  }
+
+  if (config.staticTestSelection && !config.lcovTracefiles.empty()) {
+    warnings.push_back("--static-test-selection: ignored with --lcov-tracefile. The coverage data selects "
+                       "the mutants to evaluate.");
+  } else if (config.staticTestSelection && config.serveAddress && !config.dryRun) {
+    warnings.push_back("--static-test-selection: ignored with --serve. Workers run the whole test suite.");
+  } else if (config.staticTestSelection && config.workerAddress) {
+    warnings.push_back("--static-test-selection: ignored with --worker. Every mutant runs the whole test suite.");
+  }
+
+  if (!config.scopes.empty() && config.serveAddress && !config.dryRun) {
+    warnings.push_back("scopes: ignored with --serve. Workers evaluate every mutant with the build command.");
+  } else if (!config.scopes.empty() && config.workerAddress) {
+    warnings.push_back("scopes: ignored with --worker. Every mutant is evaluated with the build command.");
+  }
+
+  if (config.targetedBuild && !NinjaGraph::isNinjaBuild(config.compileDbDir)) {
+    warnings.push_back(fmt::format("--targeted-build: no build.ninja in '{}'. The build command is used for "
+                                   "every mutant.", config.compileDbDir.string()));
+  }
+
   if (config.timeout && *config.timeout == 0) {
     warnings.push_back("--timeout: 0 - no per-mutant test time limit. A hanging test will block the run indefinitely.");
   }
@@ -139,6 +297,12 @@ void ConfigValidator::checkWarnings(const Config& config) {
     }
   }
 
+  if (!config.jitBitcode.empty() && !fs::exists(config.jitBitcode)) {
+    warnings.push_back(fmt::format("--jit-bitcode: '{}' does not exist at this stage. Continuing; the file is "
+                                   "expected to be generated by the build command.",
+                                   config.jitBitcode.string()));
+  }
+
   for (const auto& f : config.lcovTracefiles) {
     if (!fs::exists(f)) {
       warnings.push_back(fmt::format(
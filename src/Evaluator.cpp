@@ -5,7 +5,9 @@
 
 #include <fmt/core.h>
 #include <filesystem>  // NOLINT
+#include <optional>
 #include <string>
+#include <vector>
 #include "sentinel/Evaluator.hpp"
 #include "sentinel/Mutant.hpp"
 #include "sentinel/exceptions/InvalidArgumentException.hpp"
@@ -24,7 +26,8 @@ Evaluator::Evaluator(const std::filesystem::path& expectedResultDir) :
 }
 
 MutationResult Evaluator::compare(const Mutant& mut, const std::filesystem::path& actualResultDir,
-                                  TestExecutionState testState) {
+                                  TestExecutionState testState,
+                                  const std::optional<std::vector<std::string>>& selectedTests) {
   std::string killingTC;
   std::string errorTC;
   MutationState state = MutationState::RUNTIME_ERROR;
@@ -37,6 +40,7 @@ MutationResult Evaluator::compare(const Mutant& mut, const std::filesystem::path
       state = MutationState::TIMEOUT;
       break;
     case TestExecutionState::UNCOVERED:
+    case TestExecutionState::NOT_INFECTED:
       state = MutationState::SURVIVED;
       break;
     case TestExecutionState::RUNTIME_ERROR:
@@ -44,7 +48,7 @@ MutationResult Evaluator::compare(const Mutant& mut, const std::filesystem::path
       break;
     case TestExecutionState::SUCCESS: {
       Result actualResult(actualResultDir.string());
-      state = Result::compare(mExpectedResult, actualResult, &killingTC, &errorTC);
+      state = Result::compare(mExpectedResult, actualResult, &killingTC, &errorTC, selectedTests);
       break;
     }
   }
@@ -52,6 +56,8 @@ MutationResult Evaluator::compare(const Mutant& mut, const std::filesystem::path
   MutationResult result(mut, killingTC, errorTC, state);
   if (testState == TestExecutionState::UNCOVERED) {
     result.setUncovered(true);
+  } else if (testState == TestExecutionState::NOT_INFECTED) {
+    result.setNotInfected(true);
   }
   return result;
 }
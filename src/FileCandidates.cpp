@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <yaml-cpp/yaml.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "sentinel/FileCandidates.hpp"
+
+namespace sentinel {
+
+std::string FileCandidates::serialize() const {
+  YAML::Emitter emitter;
+  emitter << YAML::BeginMap;
+  emitter << YAML::Key << "depths" << YAML::Value << YAML::Flow << YAML::BeginMap;
+  for (const auto& [line, depth] : depths) {
+    emitter << YAML::Key << line << YAML::Value << depth;
+  }
+  emitter << YAML::EndMap;
+  emitter << YAML::Key << "includes" << YAML::Value << YAML::BeginSeq;
+  for (const auto& include : includes) {
+    emitter << include;
+  }
+  emitter << YAML::EndSeq << YAML::EndMap;
+
+  std::ostringstream out;
+  out << "---\n" << emitter.c_str() << "\n";
+  for (const auto& m : mutants) {
+    out << "---\n" << m << "\n";
+  }
+  return out.str();
+}
+
+FileCandidates FileCandidates::deserialize(const std::string& data) {
+  FileCandidates candidates;
+  try {
+    std::vector<YAML::Node> docs = YAML::LoadAll(data);
+    if (docs.empty() || !docs[0].IsMap() || !docs[0]["depths"].IsMap()) {
+      throw std::runtime_error("Invalid mutant candidates: missing depths");
+    }
+    for (const auto& entry : docs[0]["depths"]) {
+      candidates.depths[entry.first.as<std::size_t>()] = entry.second.as<int>();
+    }
+    if (const YAML::Node includes = docs[0]["includes"]) {
+      candidates.includes = includes.as<std::vector<std::string>>();
+    }
+    for (std::size_t i = 1; i < docs.size(); ++i) {
+      std::ostringstream oss;
+      oss << docs[i];
+      std::istringstream iss(oss.str());
+      Mutant m;
+      if (!(iss >> m)) {
+        throw std::runtime_error("Invalid mutant candidates: malformed mutant");
+      }
+      candidates.mutants.push_back(m);
+    }
+  } catch (const YAML::Exception& e) {
+    throw std::runtime_error(fmt::format("Invalid mutant candidates: {}", e.what()));
+  }
+  return candidates;
+}
+
+}  // namespace sentinel
@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <filesystem>  // NOLINT
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <string>
 #include <system_error>
@@ -16,11 +17,63 @@
 #include "sentinel/Mutant.hpp"
 #include "sentinel/exceptions/IOException.hpp"
 #include "sentinel/util/ScopeGuard.hpp"
+#include "sentinel/util/io.hpp"
 
 namespace sentinel {
 
 namespace fs = std::filesystem;
 
+namespace {
+
+// Splice the token of @p info into @p originalContent by (line, column), for mutants without byte offsets.
+void writeLineByLine(const Mutant& info, const std::string& originalContent, std::ofstream* mutatedFile) {
+  // Detect whether the original file ends with a newline so the same property
+  // can be preserved on the mutated file. Sources without a trailing newline
+  // are valid in C/C++ and altering this can affect build-system behaviour.
+  const bool originalEndsWithNewline = !originalContent.empty() && originalContent.back() == '\n';
+  std::istringstream buffer(originalContent);
+  // If code line is out of target range, just write to mutant file.
+  // If code line is in target range (start_line < code_line < end_line), skip.
+  // If code line is on start_line, write the code appearing before start_col,
+  // and write mutated token.
+  // If code line is on end_line, write the code appearing after end_col.
+  std::string line;
+  std::size_t lineIdx = 0;
+  std::size_t totalLines = std::count(originalContent.begin(), originalContent.end(), '\n');
+  // A non-empty file without a trailing newline still has one final line that
+  // std::count of '\n' does not include, so account for it here.
+  if (!originalContent.empty() && !originalEndsWithNewline) {
+    totalLines += 1;
+  }
+
+  while (std::getline(buffer, line)) {
+    lineIdx += 1;
+    const bool isLastLine = (lineIdx == totalLines);
+    const bool emitTrailingNewline = !isLastLine || originalEndsWithNewline;
+
+    if (lineIdx < info.getFirst().line || lineIdx > info.getLast().line) {
+      *mutatedFile << line;
+      if (emitTrailingNewline) {
+        *mutatedFile << '\n';
+      }
+    }
+
+    if (lineIdx == info.getFirst().line) {
+      *mutatedFile << line.substr(0, info.getFirst().column - 1);
+      *mutatedFile << info.getToken();
+    }
+
+    if (lineIdx == info.getLast().line) {
+      *mutatedFile << line.substr(info.getLast().column - 1);
+      if (emitTrailingNewline) {
+        *mutatedFile << '\n';
+      }
+    }
+  }
+}
+
+}  // namespace
+
 GitSourceTree::GitSourceTree(const std::filesystem::path& baseDirectory) : SourceTree(baseDirectory) {
 }
 
@@ -45,20 +98,12 @@ void GitSourceTree::modify(const Mutant& info, const std::filesystem::path& back
   fs::copy(targetFilename, newBackupPath, fs::copy_options::overwrite_existing);
 
   // Apply mutation
-  std::ifstream originalFile(targetFilename.string());
-  std::stringstream buffer;
-  if (originalFile) {
-    buffer << originalFile.rdbuf();
-    originalFile.close();
-  } else {
+  std::ifstream originalFile(targetFilename.string(), std::ios::binary);
+  if (!originalFile) {
     throw IOException(EINVAL, fmt::format("Failed to open {}", targetFilename.string()));
   }
-
-  // Detect whether the original file ends with a newline so the same property
-  // can be preserved on the mutated file. Sources without a trailing newline
-  // are valid in C/C++ and altering this can affect build-system behaviour.
-  const std::string originalContent = buffer.str();
-  const bool originalEndsWithNewline = !originalContent.empty() && originalContent.back() == '\n';
+  const std::string originalContent{std::istreambuf_iterator<char>(originalFile), std::istreambuf_iterator<char>()};
+  originalFile.close();
 
   // Write to a sibling temp file, then atomically rename onto the target.
   // If anything below throws, the original file is untouched and the temp
@@ -72,48 +117,28 @@ void GitSourceTree::modify(const Mutant& info, const std::filesystem::path& back
     fs::remove(tempPath, ec);
   }};
 
-  std::ofstream mutatedFile(tempPath.string(), std::ios::trunc);
+  std::ofstream mutatedFile(tempPath.string(), std::ios::trunc | std::ios::binary);
   if (!mutatedFile) {
     throw IOException(errno, fmt::format("Failed to open temporary file {}", tempPath.string()));
   }
 
-  // If code line is out of target range, just write to mutant file.
-  // If code line is in target range (start_line < code_line < end_line), skip.
-  // If code line is on start_line, write the code appearing before start_col,
-  // and write mutated token.
-  // If code line is on end_line, write the code appearing after end_col.
-  std::string line;
-  std::size_t lineIdx = 0;
-  std::size_t totalLines = std::count(originalContent.begin(), originalContent.end(), '\n');
-  // A non-empty file without a trailing newline still has one final line that
-  // std::count of '\n' does not include, so account for it here.
-  if (!originalContent.empty() && !originalEndsWithNewline) {
-    totalLines += 1;
-  }
-
-  while (std::getline(buffer, line)) {
-    lineIdx += 1;
-    const bool isLastLine = (lineIdx == totalLines);
-    const bool emitTrailingNewline = !isLastLine || originalEndsWithNewline;
-
-    if (lineIdx < info.getFirst().line || lineIdx > info.getLast().line) {
-      mutatedFile << line;
-      if (emitTrailingNewline) {
-        mutatedFile << '\n';
-      }
+  if (info.hasOffsets()) {
+    // The offsets are only meaningful in the file the mutant was generated
+    // from; splicing them into an edited file would corrupt it.
+    if (io::hashContent(originalContent) != info.getFileHash()) {
+      throw IOException(EINVAL, fmt::format("{} has changed since its mutants were generated",
+                                            targetFilename.string()));
     }
-
-    if (lineIdx == info.getFirst().line) {
-      mutatedFile << line.substr(0, info.getFirst().column - 1);
-      mutatedFile << info.getToken();
-    }
-
-    if (lineIdx == info.getLast().line) {
-      mutatedFile << line.substr(info.getLast().column - 1);
-      if (emitTrailingNewline) {
-        mutatedFile << '\n';
-      }
+    if (info.getFirstOffset() > info.getLastOffset() || info.getLastOffset() > originalContent.size()) {
+      throw IOException(EINVAL, fmt::format("Mutant range {}-{} is outside {}", info.getFirstOffset(),
+                                            info.getLastOffset(), targetFilename.string()));
     }
+    mutatedFile.write(originalContent.data(), static_cast<std::streamsize>(info.getFirstOffset()));
+    mutatedFile << info.getToken();
+    mutatedFile.write(originalContent.data() + info.getLastOffset(),
+                      static_cast<std::streamsize>(originalContent.size() - info.getLastOffset()));
+  } else {
+    writeLineByLine(info, originalContent, &mutatedFile);
   }
 
   mutatedFile.close();
@@ -186,6 +186,11 @@ std::string HtmlReport::buildJsonData() const {
     << ",";
 
   o << "\"survivedUncovered\":" << mSummary.totNumberOfSurvivedUncovered << ",";
+  if (const auto interval = mSummary.getScoreInterval()) {
+    o << "\"plannedMutants\":" << mSummary.plannedMutantCount << ",";
+    o << "\"scoreLow\":" << fmt::format("{:.1f}", interval->first) << ",";
+    o << "\"scoreHigh\":" << fmt::format("{:.1f}", interval->second) << ",";
+  }
 
   // byOperator: [killed, survived, skipped, uncovered]
   const std::vector<std::string> kOperatorOrder =
@@ -380,6 +385,8 @@ std::string HtmlReport::buildJsonData() const {
       o << "\"state\":\"" << mutationStateToStr(mr->getMutationState())
         << "\",";
       o << "\"uncovered\":" << (mr->isUncovered() ? "true" : "false") << ",";
+      o << "\"cached\":" << (mr->isCached() ? "true" : "false") << ",";
+      o << "\"notInfected\":" << (mr->isNotInfected() ? "true" : "false") << ",";
       o << "\"killingTest\":\"" << jsonEscape(mr->getKillingTest()) << "\",";
       o << "\"oriCode\":\"" << jsonEscape(oriCode) << "\",";
       o << "\"mutCode\":\"" << jsonEscape(mutCode) << "\"";
@@ -760,6 +767,7 @@ body { font-family: var(--font); background: var(--bg); color: var(--text); line
 .chip--uncov {
   background: #f2dad2; color: #a04220; border: 1px solid #e6b8a0;
 }
+.chip--cached { background: var(--bg-muted); color: var(--text-sec); border: 1px solid var(--border); }
 
 .tags { display: flex; flex-wrap: wrap; gap: 5px; margin-top: 6px; }
 .tag {
@@ -871,15 +879,17 @@ function formatSkippedDetail(to, bf, re) {
   return parts.join(' \u00b7 ');
 }
 
-function buildCards(score, killed, survived, skipped, valid, skippedDetail, survUncov) {
+function buildCards(score, killed, survived, skipped, valid, skippedDetail, survUncov, estimate) {
   var survSub = 'Not detected';
   if (survUncov > 0) {
     survSub += ' \u00b7 ' + survUncov + ' uncovered';
   }
   return '<section class="cards cards--4">' +
-    '<div class="card card--score"><div class="card__lbl">Mutation Score</div>' +
+    '<div class="card card--score"><div class="card__lbl">' +
+    (estimate ? 'Estimated Mutation Score' : 'Mutation Score') + '</div>' +
     '<div class="card__val">' + score + '%</div>' +
     '<div class="card__sub">' + killed + ' / ' + valid + ' valid mutants</div>' +
+    (estimate ? '<div class="card__sub">' + estimate + '</div>' : '') +
     '<div class="mini-bar"><div class="mini-bar__fill" style="width:' + score + '%"></div></div></div>' +
     '<div class="card card--killed"><div class="card__lbl">Killed</div>' +
     '<div class="card__val">' + killed + '</div><div class="card__sub">Detected by tests</div></div>' +
@@ -1001,18 +1011,23 @@ function barRow(name, cntHtml, barSegments) {
     '<div class="bar-track">' + bars + '</div></div>';
 }
 
-function statusChips(state, isUncov) {
+function statusChips(state, isUncov, isCached, isNotInfected) {
+  var cached = isCached ? '<span class="chip chip--cached">Cached</span>' : '';
   if (state === 'KILLED') {
-    return '<span class="chips"><span class="chip chip--killed">Killed</span></span>';
+    return '<span class="chips"><span class="chip chip--killed">Killed</span>' + cached + '</span>';
   }
   if (state === 'SURVIVED') {
     var s = '<span class="chips"><span class="chip chip--surv">Survived</span>';
     if (isUncov) {
       s += '<span class="chip chip--uncov">Uncovered</span>';
     }
-    return s + '</span>';
+    if (isNotInfected) {
+      s += '<span class="chip chip--uncov">Not infected</span>';
+    }
+    return s + cached + '</span>';
   }
-  return '<span class="ment__st b-s">' + state.replace('_', ' ') + '</span>';
+  var st = '<span class="ment__st b-s">' + state.replace('_', ' ') + '</span>';
+  return cached ? '<span class="chips">' + st + cached + '</span>' : st;
 }
 
 var opOrder = ['AOR','BOR','LCR','ROR','SDL','SOR','UOI'];
@@ -1051,8 +1066,11 @@ function renderRoot() {
     '<h1>Mutation Testing Report</h1></div><div class="hdr__right">' +
     '<span class="badge">Generated: ' + h(D.timestamp) + '</span></div></header>';
 
+  // Evaluation stopped at the time budget: the score is estimated from a sample.
+  var estimate = sm.plannedMutants ? 'Sample of ' + total + ' / ' + sm.plannedMutants + ' mutants \u00b7 95% CI ' +
+    sm.scoreLow + '\u2013' + sm.scoreHigh + '%' : '';
   out += buildCards(score, killed, survived, skipped, sm.totalMutations, skippedDetail,
-    sm.survivedUncovered || 0);
+    sm.survivedUncovered || 0, estimate);
 
   // Panels row
   // Left: mutants donut + operator bars
@@ -1403,7 +1421,7 @@ function renderFile(filePath) {
     for (var slmi = 0; slmi < slMuts.length; slmi++) {
       var sm2 = slMuts[slmi];
       var tDisp2 = sm2.killingTest || 'none';
-      var stHtml = statusChips(sm2.state, sm2.uncovered);
+      var stHtml = statusChips(sm2.state, sm2.uncovered, sm2.cached, sm2.notInfected);
       out += '<div class="ment"><a class="ment__ln" href="#/file/' +
           encodedPath + '/L' + sln + '">:' + sln + '</a>' +
         '<span class="ment__op">' + h(sm2.opFull) + '</span>' +
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/IR/DebugInfo.h>
+#include <llvm/IR/DebugInfoMetadata.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/InstrTypes.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+#if LLVM_VERSION_MAJOR >= 14
+#include <llvm/MC/TargetRegistry.h>
+#else
+#include <llvm/Support/TargetRegistry.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/IrMutator.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+#if LLVM_VERSION_MAJOR >= 14
+using OptimizationLevel = llvm::OptimizationLevel;
+#else
+using OptimizationLevel = llvm::PassBuilder::OptimizationLevel;
+#endif
+
+enum class Signedness { UNKNOWN, SIGNED, UNSIGNED };
+
+// Opcodes of an operator token: integer (signed, unsigned) and floating point.
+struct BinaryOpcodes {
+  llvm::Instruction::BinaryOps signedOp;
+  llvm::Instruction::BinaryOps unsignedOp;
+  std::optional<llvm::Instruction::BinaryOps> floatOp;
+};
+
+const std::map<std::string, BinaryOpcodes>& getBinaryOpcodes() {
+  using I = llvm::Instruction;
+  static const std::map<std::string, BinaryOpcodes> kOpcodes = {
+      {"+", {I::Add, I::Add, I::FAdd}},       {"-", {I::Sub, I::Sub, I::FSub}},
+      {"*", {I::Mul, I::Mul, I::FMul}},       {"/", {I::SDiv, I::UDiv, I::FDiv}},
+      {"%", {I::SRem, I::URem, std::nullopt}}, {"&", {I::And, I::And, std::nullopt}},
+      {"|", {I::Or, I::Or, std::nullopt}},     {"^", {I::Xor, I::Xor, std::nullopt}},
+      {"<<", {I::Shl, I::Shl, std::nullopt}},  {">>", {I::AShr, I::LShr, std::nullopt}},
+  };
+  return kOpcodes;
+}
+
+// Predicates of a relational token: integer (signed, unsigned) and floating point.
+struct Predicates {
+  llvm::CmpInst::Predicate signedPred;
+  llvm::CmpInst::Predicate unsignedPred;
+  llvm::CmpInst::Predicate floatPred;
+};
+
+const std::map<std::string, Predicates>& getPredicates() {
+  using P = llvm::CmpInst;
+  static const std::map<std::string, Predicates> kPredicates = {
+      {"==", {P::ICMP_EQ, P::ICMP_EQ, P::FCMP_OEQ}},    {"!=", {P::ICMP_NE, P::ICMP_NE, P::FCMP_UNE}},
+      {"<", {P::ICMP_SLT, P::ICMP_ULT, P::FCMP_OLT}},   {"<=", {P::ICMP_SLE, P::ICMP_ULE, P::FCMP_OLE}},
+      {">", {P::ICMP_SGT, P::ICMP_UGT, P::FCMP_OGT}},   {">=", {P::ICMP_SGE, P::ICMP_UGE, P::FCMP_OGE}},
+  };
+  return kPredicates;
+}
+
+// True if the trailing components of the debug location's file are those of the mutant's path.
+bool isMutantFile(const llvm::DILocation& loc, const fs::path& path) {
+  fs::path file(loc.getFilename().str());
+  if (file.is_relative()) {
+    file = fs::path(loc.getDirectory().str()) / file;
+  }
+  const fs::path actualPath = file.lexically_normal();
+  const fs::path expectedPath = path.lexically_normal();
+  const std::vector<fs::path> actual(actualPath.begin(), actualPath.end());
+  const std::vector<fs::path> expected(expectedPath.begin(), expectedPath.end());
+  return !expected.empty() && actual.size() >= expected.size() &&
+         std::equal(expected.begin(), expected.end(), actual.end() - expected.size());
+}
+
+// The replacement of one instruction: a new binary opcode or a new predicate.
+struct Replacement {
+  llvm::Instruction* inst;
+  std::optional<llvm::Instruction::BinaryOps> opcode;
+  std::optional<llvm::CmpInst::Predicate> predicate;
+  bool nsw = false;
+};
+
+std::optional<Replacement> replaceBinary(llvm::BinaryOperator* bo, const std::string& originalToken,
+                                         const std::string& token) {
+  const auto& opcodes = getBinaryOpcodes();
+  const auto original = opcodes.find(originalToken);
+  const auto mutated = opcodes.find(token);
+  if (original == opcodes.end() || mutated == opcodes.end()) {
+    return std::nullopt;
+  }
+  const auto op = bo->getOpcode();
+  if (bo->getType()->isFPOrFPVectorTy()) {
+    if (original->second.floatOp != op || !mutated->second.floatOp) {
+      return std::nullopt;
+    }
+    return Replacement{bo, *mutated->second.floatOp, std::nullopt};
+  }
+  if (op != original->second.signedOp && op != original->second.unsignedOp) {
+    return std::nullopt;
+  }
+  Signedness signedness = Signedness::UNKNOWN;
+  if (original->second.signedOp != original->second.unsignedOp) {
+    signedness = op == original->second.signedOp ? Signedness::SIGNED : Signedness::UNSIGNED;
+  } else if (llvm::isa<llvm::OverflowingBinaryOperator>(bo) && bo->hasNoSignedWrap()) {
+    signedness = Signedness::SIGNED;
+  }
+  const bool needsSign = mutated->second.signedOp != mutated->second.unsignedOp;
+  if (needsSign && signedness == Signedness::UNKNOWN) {
+    return std::nullopt;
+  }
+  const auto newOp =
+      signedness == Signedness::UNSIGNED ? mutated->second.unsignedOp : mutated->second.signedOp;
+  // Signed arithmetic that overflows is undefined, as clang marks it for the mutated source.
+  const bool nsw = signedness == Signedness::SIGNED &&
+                   (newOp == llvm::Instruction::Add || newOp == llvm::Instruction::Sub ||
+                    newOp == llvm::Instruction::Mul);
+  return Replacement{bo, newOp, std::nullopt, nsw};
+}
+
+std::optional<Replacement> replaceCompare(llvm::CmpInst* cmp, const std::string& originalToken,
+                                          const std::string& token) {
+  const auto& predicates = getPredicates();
+  const auto original = predicates.find(originalToken);
+  const auto mutated = predicates.find(token);
+  if (original == predicates.end() || mutated == predicates.end()) {
+    return std::nullopt;
+  }
+  const auto pred = cmp->getPredicate();
+  if (llvm::isa<llvm::FCmpInst>(cmp)) {
+    if (pred != original->second.floatPred) {
+      return std::nullopt;
+    }
+    return Replacement{cmp, std::nullopt, mutated->second.floatPred};
+  }
+  if (pred != original->second.signedPred && pred != original->second.unsignedPred) {
+    return std::nullopt;
+  }
+  Signedness signedness = Signedness::UNKNOWN;
+  if (original->second.signedPred != original->second.unsignedPred) {
+    signedness = pred == original->second.signedPred ? Signedness::SIGNED : Signedness::UNSIGNED;
+  }
+  if (mutated->second.signedPred != mutated->second.unsignedPred && signedness == Signedness::UNKNOWN) {
+    return std::nullopt;
+  }
+  return Replacement{cmp, std::nullopt,
+                     signedness == Signedness::UNSIGNED ? mutated->second.unsignedPred : mutated->second.signedPred};
+}
+
+void initializeTargets() {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    llvm::InitializeAllTargetInfos();
+    llvm::InitializeAllTargets();
+    llvm::InitializeAllTargetMCs();
+    llvm::InitializeAllAsmPrinters();
+  });
+}
+
+OptimizationLevel getOptimizationLevel(const BitcodeUnit& unit) {
+  if (unit.sizeLevel == 1) {
+    return OptimizationLevel::Os;
+  }
+  if (unit.sizeLevel >= 2) {
+    return OptimizationLevel::Oz;
+  }
+  switch (unit.optLevel) {
+    case 0:
+      return OptimizationLevel::O0;
+    case 1:
+      return OptimizationLevel::O1;
+    case 2:
+      return OptimizationLevel::O2;
+    default:
+      return OptimizationLevel::O3;
+  }
+}
+
+// Replacements of every instruction of @p m; empty if any of them does not match.
+std::vector<Replacement> findReplacements(llvm::Module* module, const Mutant& m, const std::string& originalToken) {
+  if (!IrMutator::isSupported(m.getOperator())) {
+    return {};
+  }
+  std::vector<Replacement> replacements;
+  for (llvm::Function& fn : *module) {
+    for (llvm::Instruction& inst : llvm::instructions(fn)) {
+      const llvm::DILocation* loc = inst.getDebugLoc().get();
+      if (loc == nullptr || loc->getLine() != m.getFirst().line || loc->getColumn() != m.getFirst().column ||
+          !isMutantFile(*loc, m.getPath())) {
+        continue;
+      }
+      std::optional<Replacement> replacement;
+      if (auto* bo = llvm::dyn_cast<llvm::BinaryOperator>(&inst)) {
+        replacement = replaceBinary(bo, originalToken, m.getToken());
+      } else if (auto* cmp = llvm::dyn_cast<llvm::CmpInst>(&inst)) {
+        replacement = replaceCompare(cmp, originalToken, m.getToken());
+      } else {
+        // Loads, stores, casts, ... of the operands share the position.
+        continue;
+      }
+      if (!replacement) {
+        return {};
+      }
+      replacements.push_back(*replacement);
+    }
+  }
+  return replacements;
+}
+
+}  // namespace
+
+bool IrMutator::isSupported(const std::string& op) {
+  return op == "AOR" || op == "BOR" || op == "ROR" || op == "SOR";
+}
+
+bool IrMutator::canApply(const llvm::Module& module, const Mutant& m, const std::string& originalToken) {
+  // The module is only looked at.
+  return !findReplacements(const_cast<llvm::Module*>(&module), m, originalToken).empty();
+}
+
+std::size_t IrMutator::apply(llvm::Module* module, const Mutant& m, const std::string& originalToken) {
+  const std::vector<Replacement> replacements = findReplacements(module, m, originalToken);
+  for (const auto& replacement : replacements) {
+    if (replacement.predicate) {
+      llvm::cast<llvm::CmpInst>(replacement.inst)->setPredicate(*replacement.predicate);
+      continue;
+    }
+    auto* bo = llvm::cast<llvm::BinaryOperator>(replacement.inst);
+    auto* mutated = llvm::BinaryOperator::Create(*replacement.opcode, bo->getOperand(0), bo->getOperand(1),
+                                                 bo->getName(), bo);
+    mutated->setDebugLoc(bo->getDebugLoc());
+    if (replacement.nsw) {
+      mutated->setHasNoSignedWrap(true);
+    }
+    bo->replaceAllUsesWith(mutated);
+    bo->eraseFromParent();
+  }
+  return replacements.size();
+}
+
+bool IrMutator::writeObject(const BitcodeUnit& unit, const Mutant& m, const std::string& originalToken,
+                            const fs::path& object) {
+  llvm::LLVMContext context;
+  auto buffer = llvm::MemoryBuffer::getMemBuffer(unit.bitcode, unit.object.string(), false);
+  auto parsed = llvm::parseBitcodeFile(buffer->getMemBufferRef(), context);
+  if (!parsed) {
+    throw IOException(EINVAL, fmt::format("Failed to read the bitcode of '{}': {}", unit.object.string(),
+                                          llvm::toString(parsed.takeError())));
+  }
+  std::unique_ptr<llvm::Module> module = std::move(*parsed);
+  if (apply(module.get(), m, originalToken) == 0) {
+    return false;
+  }
+  if (llvm::verifyModule(*module)) {
+    return false;
+  }
+  if (!unit.debugInfo) {
+    llvm::StripDebugInfo(*module);
+  }
+
+  initializeTargets();
+  std::string error;
+#if LLVM_VERSION_MAJOR >= 21
+  const llvm::Triple& triple = module->getTargetTriple();
+  const std::string tripleName = triple.str();
+#else
+  const std::string triple = module->getTargetTriple();
+  const std::string& tripleName = triple;
+#endif
+  const llvm::Target* target = llvm::TargetRegistry::lookupTarget(triple, error);
+  if (target == nullptr) {
+    throw IOException(EINVAL, fmt::format("No code generator for '{}': {}", tripleName, error));
+  }
+  llvm::TargetOptions options;
+  options.FunctionSections = unit.functionSections;
+  options.DataSections = unit.dataSections;
+  options.MCOptions.ABIName = unit.abi;
+  if (unit.floatAbi == "soft" || unit.floatAbi == "softfp") {
+    options.FloatABIType = llvm::FloatABI::Soft;
+  } else if (unit.floatAbi == "hard") {
+    options.FloatABIType = llvm::FloatABI::Hard;
+  }
+  const OptimizationLevel level = getOptimizationLevel(unit);
+#if LLVM_VERSION_MAJOR >= 18
+  const auto codeGenLevel = unit.optLevel == 0 ? llvm::CodeGenOptLevel::None : llvm::CodeGenOptLevel::Default;
+#else
+  const auto codeGenLevel = unit.optLevel == 0 ? llvm::CodeGenOpt::None : llvm::CodeGenOpt::Default;
+#endif
+  std::unique_ptr<llvm::TargetMachine> machine(target->createTargetMachine(
+      triple, unit.cpu, unit.features, options, unit.pic ? llvm::Reloc::PIC_ : llvm::Reloc::Static, {},
+      codeGenLevel));
+  module->setDataLayout(machine->createDataLayout());
+
+  llvm::LoopAnalysisManager lam;
+  llvm::FunctionAnalysisManager fam;
+  llvm::CGSCCAnalysisManager cgam;
+  llvm::ModuleAnalysisManager mam;
+#if LLVM_VERSION_MAJOR == 12
+  llvm::PassBuilder builder(false, machine.get());
+#else
+  llvm::PassBuilder builder(machine.get());
+#endif
+  builder.registerModuleAnalyses(mam);
+  builder.registerCGSCCAnalyses(cgam);
+  builder.registerFunctionAnalyses(fam);
+  builder.registerLoopAnalyses(lam);
+  builder.crossRegisterProxies(lam, fam, cgam, mam);
+#if LLVM_VERSION_MAJOR >= 13
+  llvm::ModulePassManager passes = level == OptimizationLevel::O0 ? builder.buildO0DefaultPipeline(level)
+                                                                  : builder.buildPerModuleDefaultPipeline(level);
+#else
+  llvm::ModulePassManager passes =
+      level == OptimizationLevel::O0 ? llvm::ModulePassManager() : builder.buildPerModuleDefaultPipeline(level);
+#endif
+  passes.run(*module, mam);
+
+  std::error_code ec;
+  llvm::raw_fd_ostream out(object.string(), ec, llvm::sys::fs::OF_None);
+  if (ec) {
+    throw IOException(ec.value(), fmt::format("Failed to write '{}': {}", object.string(), ec.message()));
+  }
+  llvm::legacy::PassManager codeGen;
+#if LLVM_VERSION_MAJOR >= 18
+  const auto fileType = llvm::CodeGenFileType::ObjectFile;
+#else
+  const auto fileType = llvm::CGFT_ObjectFile;
+#endif
+  if (machine->addPassesToEmitFile(codeGen, out, nullptr, fileType)) {
+    throw IOException(EINVAL, fmt::format("'{}' cannot emit object files", tripleName));
+  }
+  codeGen.run(*module);
+  out.flush();
+  if (out.has_error()) {
+    throw IOException(out.error().value(), fmt::format("Failed to write '{}'", object.string()));
+  }
+  return true;
+}
+
+}  // namespace sentinel
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/TargetSelect.h>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/IrMutator.hpp"
+#include "sentinel/JitTestExecutor.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+void throwIfFailed(llvm::Error error, const std::string& what) {
+  if (error) {
+    throw IOException(EINVAL, fmt::format("{}: {}", what, llvm::toString(std::move(error))));
+  }
+}
+
+template <typename T>
+T takeOrThrow(llvm::Expected<T> value, const std::string& what) {
+  throwIfFailed(value.takeError(), what);
+  return std::move(*value);
+}
+
+}  // namespace
+
+JitTestExecutor::JitTestExecutor(const fs::path& bitcode) :
+    mBitcode(bitcode), mContext(std::make_unique<llvm::LLVMContext>()) {
+  llvm::SMDiagnostic error;
+  mModule = llvm::parseIRFile(bitcode.string(), error, *mContext);
+  if (!mModule) {
+    throw IOException(EINVAL, fmt::format("Failed to read '{}': {}", bitcode.string(), error.getMessage().str()));
+  }
+  const llvm::Function* main = mModule->getFunction("main");
+  if (main == nullptr || main->isDeclaration()) {
+    throw IOException(EINVAL, fmt::format("'{}' does not define main()", bitcode.string()));
+  }
+}
+
+JitTestExecutor::~JitTestExecutor() = default;
+
+bool JitTestExecutor::canApply(const Mutant& m, const std::string& originalToken) const {
+  return mModule && IrMutator::canApply(*mModule, m, originalToken);
+}
+
+int JitTestExecutor::run(const Mutant* m, const std::string& originalToken, const std::vector<std::string>& args) {
+  if (!mModule) {
+    throw IOException(EINVAL, fmt::format("'{}' has already been run", mBitcode.string()));
+  }
+  if (m != nullptr && IrMutator::apply(mModule.get(), *m, originalToken) == 0) {
+    throw IOException(EINVAL, fmt::format("The mutant cannot be applied to '{}'", mBitcode.string()));
+  }
+
+  llvm::InitializeNativeTarget();
+  llvm::InitializeNativeTargetAsmPrinter();
+  std::unique_ptr<llvm::orc::LLJIT> jit = takeOrThrow(llvm::orc::LLJITBuilder().create(), "Failed to create the JIT");
+  llvm::orc::JITDylib& dylib = jit->getMainJITDylib();
+  dylib.addGenerator(takeOrThrow(
+      llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(jit->getDataLayout().getGlobalPrefix()),
+      "Failed to look up the symbols of the process"));
+  throwIfFailed(jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(mModule), std::move(mContext))),
+                fmt::format("Failed to add '{}'", mBitcode.string()));
+  throwIfFailed(jit->initialize(dylib), "Failed to run the static initializers");
+  auto symbol = takeOrThrow(jit->lookup("main"), "Failed to link main()");
+#if LLVM_VERSION_MAJOR >= 15
+  auto* main = symbol.toPtr<int (*)(int, char**)>();
+#else
+  auto* main = reinterpret_cast<int (*)(int, char**)>(static_cast<std::uintptr_t>(symbol.getAddress()));
+#endif
+
+  std::string program = mBitcode.stem().string();
+  std::vector<std::string> arguments(args);
+  std::vector<char*> argv = {program.data()};
+  for (std::string& arg : arguments) {
+    argv.push_back(arg.data());
+  }
+  argv.push_back(nullptr);
+  const int code = main(static_cast<int>(argv.size() - 1), argv.data());
+  throwIfFailed(jit->deinitialize(dylib), "Failed to run the static destructors");
+  return code;
+}
+
+}  // namespace sentinel
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fcntl.h>
+#include <fmt/core.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "sentinel/Jobserver.hpp"
+#include "sentinel/util/ScopeGuard.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+/** @brief Byte written to the pipe for each token (GNU make treats '-' as an error marker). */
+static constexpr char kToken = '+';
+
+static int openOrThrow(const fs::path& path, int flags) {
+  const int fd = ::open(path.c_str(), flags | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    throw std::runtime_error(fmt::format("Failed to open '{}': {}", path.string(), std::strerror(errno)));
+  }
+  return fd;
+}
+
+Jobserver::Jobserver(const fs::path& dir, std::size_t jobs) : mFifo(dir / "fifo"), mJobs(jobs) {
+  fs::create_directories(dir);
+  struct stat st {};
+  if (::stat(dir.c_str(), &st) != 0 || st.st_uid != ::getuid()) {
+    throw std::runtime_error(fmt::format("Jobserver directory '{}' does not belong to the current user.",
+                                         dir.string()));
+  }
+  fs::permissions(dir, fs::perms::owner_all, fs::perm_options::replace);
+
+  // Setting up is serialized by setup.lock. Every sentinel using the pool
+  // holds a shared lock on users.lock, so an exclusive lock on it means
+  // that nobody is using the pool and that it may be recreated.
+  const int setupFd = openOrThrow(dir / "setup.lock", O_RDWR | O_CREAT);
+  ScopeGuard closeSetup{[setupFd] { ::close(setupFd); }};
+  while (::flock(setupFd, LOCK_EX) != 0 && errno == EINTR) {
+  }
+  mUsersFd = openOrThrow(dir / "users.lock", O_RDWR | O_CREAT);
+  const fs::path jobsFile = dir / "jobs";
+  if (::flock(mUsersFd, LOCK_EX | LOCK_NB) == 0) {
+    std::error_code ec;
+    fs::remove(mFifo, ec);
+    if (::mkfifo(mFifo.c_str(), 0600) != 0) {
+      ::close(mUsersFd);
+      throw std::runtime_error(fmt::format("Failed to create '{}': {}", mFifo.string(), std::strerror(errno)));
+    }
+    mFd = openOrThrow(mFifo, O_RDWR);
+    const std::string tokens(mJobs, kToken);
+    if (::write(mFd, tokens.data(), tokens.size()) != static_cast<ssize_t>(tokens.size())) {
+      ::close(mFd);
+      ::close(mUsersFd);
+      throw std::runtime_error(fmt::format("Failed to fill '{}': {}", mFifo.string(), std::strerror(errno)));
+    }
+    std::ofstream(jobsFile, std::ios::trunc) << mJobs << '\n';
+    mCreator = true;
+  } else {
+    mFd = openOrThrow(mFifo, O_RDWR);
+    std::ifstream(jobsFile) >> mJobs;
+  }
+  ::flock(mUsersFd, LOCK_SH);
+  mNonBlockingFd = openOrThrow(mFifo, O_RDONLY | O_NONBLOCK);
+}
+
+Jobserver::~Jobserver() {
+  ::close(mNonBlockingFd);
+  ::close(mFd);
+  ::close(mUsersFd);
+}
+
+fs::path Jobserver::getDefaultDir() {
+  return fs::temp_directory_path() / fmt::format("sentinel-jobserver-{}", ::getuid());
+}
+
+std::size_t Jobserver::getJobs() const {
+  return mJobs;
+}
+
+bool Jobserver::isCreator() const {
+  return mCreator;
+}
+
+const fs::path& Jobserver::getFifo() const {
+  return mFifo;
+}
+
+std::string Jobserver::getMakeflags() const {
+  return fmt::format("-j{} --jobserver-auth=fifo:{}", mJobs, mFifo.string());
+}
+
+char Jobserver::acquire() const {
+  char token = kToken;
+  ssize_t nb;
+  while ((nb = ::read(mFd, &token, 1)) < 0 && errno == EINTR) {
+  }
+  if (nb != 1) {
+    throw std::runtime_error(fmt::format("Failed to take a job token from '{}': {}", mFifo.string(),
+                                         nb < 0 ? std::strerror(errno) : "end of file"));
+  }
+  mTaken++;
+  return token;
+}
+
+bool Jobserver::tryAcquire(char* token) const {
+  ssize_t nb;
+  while ((nb = ::read(mNonBlockingFd, token, 1)) < 0 && errno == EINTR) {
+  }
+  if (nb != 1) {
+    return false;
+  }
+  mTaken++;
+  return true;
+}
+
+void Jobserver::release(char token) const {
+  if (mReleasedAll) {
+    return;
+  }
+  std::size_t taken = mTaken.load();
+  while (taken > 0 && !mTaken.compare_exchange_weak(taken, taken - 1)) {
+  }
+  while (::write(mFd, &token, 1) < 0 && errno == EINTR) {
+  }
+}
+
+void Jobserver::releaseAll() const {
+  mReleasedAll = true;
+  for (std::size_t n = mTaken.exchange(0); n > 0; n--) {
+    while (::write(mFd, &kToken, 1) < 0 && errno == EINTR) {
+    }
+  }
+}
+
+}  // namespace sentinel
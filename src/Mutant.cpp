@@ -90,6 +90,28 @@ const std::string& Mutant::getToken() const {
   return mToken;
 }
 
+void Mutant::setOffsets(std::size_t firstOffset, std::size_t lastOffset, const std::string& fileHash) {
+  mFirstOffset = firstOffset;
+  mLastOffset = lastOffset;
+  mFileHash = fileHash;
+}
+
+bool Mutant::hasOffsets() const {
+  return !mFileHash.empty();
+}
+
+std::size_t Mutant::getFirstOffset() const {
+  return mFirstOffset;
+}
+
+std::size_t Mutant::getLastOffset() const {
+  return mLastOffset;
+}
+
+const std::string& Mutant::getFileHash() const {
+  return mFileHash;
+}
+
 std::string Mutant::str() const {
   return fmt::format("{},{},{},{},{},{},{},{}", getOperator(), getPath().string(), getQualifiedFunction(),
                      getFirst().line, getFirst().column, getLast().line, getLast().column, getToken());
@@ -112,6 +134,14 @@ std::ostream& operator<<(std::ostream& out, const Mutant& m) {
           << YAML::Key << "column" << YAML::Value << m.getLast().column
           << YAML::EndMap;
   emitter << YAML::Key << "token" << YAML::Value << m.getToken();
+  if (m.hasOffsets()) {
+    emitter << YAML::Key << "offsets" << YAML::Value << YAML::Flow
+            << YAML::BeginMap
+            << YAML::Key << "first" << YAML::Value << m.getFirstOffset()
+            << YAML::Key << "last" << YAML::Value << m.getLastOffset()
+            << YAML::Key << "hash" << YAML::Value << m.getFileHash()
+            << YAML::EndMap;
+  }
   emitter << YAML::EndMap;
   out << emitter.c_str();
   return out;
@@ -137,6 +167,11 @@ std::istream& operator>>(std::istream& in, Mutant& m) {
                node["last"]["line"].as<std::size_t>(),
                node["last"]["column"].as<std::size_t>(),
                node["token"].as<std::string>());
+    // Mutants written before byte offsets were recorded are applied line by line.
+    if (const YAML::Node offsets = node["offsets"]) {
+      m.setOffsets(offsets["first"].as<std::size_t>(), offsets["last"].as<std::size_t>(),
+                   offsets["hash"].as<std::string>());
+    }
   } catch (const YAML::Exception&) {
     in.setstate(std::ios::failbit);
   }
@@ -4,30 +4,141 @@
  */
 
 #include <clang/Frontend/CompilerInstance.h>
+#include <clang/Frontend/FrontendAction.h>
+#include <clang/Frontend/Utils.h>
 #include <clang/Tooling/CompilationDatabase.h>
 #include <clang/Tooling/Tooling.h>
 #include <fmt/core.h>
+#include <llvm/Support/Chrono.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
 #include <filesystem>  // NOLINT
+#include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <new>
+#include <optional>
+#include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <utility>
 #include <vector>
+#include "sentinel/CandidateCache.hpp"
 #include "sentinel/MutantGenerator.hpp"
+#include "sentinel/ProcessPool.hpp"
 #include "sentinel/operators/MutationOperator.hpp"
 #include "sentinel/RandomMutantGenerator.hpp"
 #include "sentinel/UniformMutantGenerator.hpp"
 #include "sentinel/WeightedMutantGenerator.hpp"
 #include "sentinel/exceptions/InvalidArgumentException.hpp"
 #include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/util/ScopeGuard.hpp"
+#include "sentinel/version.hpp"
 
 namespace sentinel {
 
 namespace fs = std::filesystem;
 
+namespace {
+
+constexpr std::size_t kBytesPerMiB = 1024 * 1024;
+
+/**
+ * @brief Compilation database holding the commands of a single file, looked up in advance.
+ */
+class PrefetchedCompilationDatabase : public clang::tooling::CompilationDatabase {
+ public:
+  explicit PrefetchedCompilationDatabase(std::vector<clang::tooling::CompileCommand> commands) :
+      mCommands(std::move(commands)) {
+  }
+
+  std::vector<clang::tooling::CompileCommand> getCompileCommands(llvm::StringRef /* filePath */) const override {
+    return mCommands;
+  }
+
+ private:
+  std::vector<clang::tooling::CompileCommand> mCommands;
+};
+
+/**
+ * @brief Frontend action recording the files the preprocessor reads while running another action.
+ *
+ * @p failed is set if the file has errors. The diagnostics of sentinel's
+ * actions are ignored, so ClangTool::run() does not report them.
+ */
+class IncludeRecordingAction : public clang::WrapperFrontendAction {
+ public:
+  IncludeRecordingAction(std::unique_ptr<clang::FrontendAction> action, std::vector<std::string>* includes,
+                         bool* failed) :
+      clang::WrapperFrontendAction(std::move(action)), mIncludes(includes), mFailed(failed) {
+  }
+
+ protected:
+  bool BeginSourceFileAction(clang::CompilerInstance& ci) override {
+    mCollector->attachToPreprocessor(ci.getPreprocessor());
+    return clang::WrapperFrontendAction::BeginSourceFileAction(ci);
+  }
+
+  void EndSourceFileAction() override {
+    clang::WrapperFrontendAction::EndSourceFileAction();
+    if (getCompilerInstance().getDiagnostics().hasErrorOccurred()) {
+      *mFailed = true;
+    }
+    const auto& dependencies = mCollector->getDependencies();
+    mIncludes->insert(mIncludes->end(), dependencies.begin(), dependencies.end());
+  }
+
+ private:
+  // System headers change with the toolchain, so they are recorded too.
+  class Collector : public clang::DependencyCollector {
+   public:
+    bool needSystemDependencies() override {
+      return true;
+    }
+  };
+
+  std::shared_ptr<Collector> mCollector = std::make_shared<Collector>();
+  std::vector<std::string>* mIncludes;
+  bool* mFailed;
+};
+
+/**
+ * @brief Factory wrapping the actions of another factory in an IncludeRecordingAction.
+ */
+class IncludeRecordingActionFactory : public clang::tooling::FrontendActionFactory {
+ public:
+  IncludeRecordingActionFactory(clang::tooling::FrontendActionFactory* factory, std::vector<std::string>* includes,
+                                bool* failed) :
+      mFactory(factory), mIncludes(includes), mFailed(failed) {
+  }
+
+#if LLVM_VERSION_MAJOR >= 10
+  std::unique_ptr<clang::FrontendAction> create() override {
+    return std::make_unique<IncludeRecordingAction>(mFactory->create(), mIncludes, mFailed);
+  }
+#else
+  clang::FrontendAction* create() override {
+    return new IncludeRecordingAction(std::unique_ptr<clang::FrontendAction>(mFactory->create()), mIncludes,
+                                      mFailed);
+  }
+#endif
+
+ private:
+  clang::tooling::FrontendActionFactory* mFactory;
+  std::vector<std::string>* mIncludes;
+  bool* mFailed;
+};
+
+}  // namespace
+
 MutantGenerator::~MutantGenerator() = default;
 
 // ---------------------------------------------------------------------------
@@ -54,22 +165,133 @@ Mutants MutantGenerator::generate(const SourceLines& sourceLines, std::size_t ma
                                   unsigned int randomSeed, std::size_t mutantsPerLine) {
   mCandidateCount = 0;
   mLinesByPath.clear();
+  mSkippedFiles.clear();
 
   Mutants allMutants = collectAllMutants(sourceLines);
   CandidateIndex index = buildCandidateIndex(std::move(allMutants));
   return selectMutants(sourceLines, maxMutants, randomSeed, index, mutantsPerLine);
 }
 
+// ---------------------------------------------------------------------------
+// Streaming generate()
+// ---------------------------------------------------------------------------
+Mutants MutantGenerator::generate(const SourceLines& sourceLines, std::size_t maxMutants,
+                                  unsigned int randomSeed, std::size_t mutantsPerLine,
+                                  const MutantCallback& onSelected) {
+  if (!supportsStreaming()) {
+    Mutants selected = generate(sourceLines, maxMutants, randomSeed, mutantsPerLine);
+    for (const auto& m : selected) {
+      onSelected(m);
+    }
+    return selected;
+  }
+
+  mCandidateCount = 0;
+  mLinesByPath.clear();
+  mSkippedFiles.clear();
+
+  // Selected mutants may be applied to the source tree while later files are
+  // still being parsed, so parse every target file from its original contents.
+  snapshotSources(sourceLines);
+  ScopeGuard releaseSnapshot{[this] { mSnapshot = nullptr; }};
+  auto compileDb = loadCompilationDatabase();
+
+  std::map<fs::path, std::vector<std::size_t>> targetLines;
+  for (const auto& sourceLine : sourceLines) {
+    targetLines[sourceLine.getPath()].push_back(sourceLine.getLineNumber());
+  }
+
+  const std::size_t totalFiles = targetLines.size();
+  std::size_t doneFiles = 0;
+  notifyProgress(doneFiles, totalFiles);
+
+  // Each file gets its own index, built the first time one of its lines is
+  // visited. Operators only emit mutants located in the main file, so the
+  // per-file index holds exactly the candidates the batch index would.
+  std::map<fs::path, CandidateIndex> indexByPath;
+  auto getIndex = [&](const fs::path& rawPath) -> const CandidateIndex& {
+    auto [it, inserted] = indexByPath.try_emplace(rawPath);
+    if (inserted) {
+      auto collect = [&](std::size_t /* index */) {
+        return collectMutantsForFile(*compileDb, rawPath, targetLines[rawPath]);
+      };
+      std::vector<FileCandidates> results(1);
+      if (mWorkerMemoryLimit || mWorkerTimeout) {
+        collectInWorkers({rawPath}, {0}, 1, collect, &results, [] {});
+      } else {
+        results[0] = collect(0);
+      }
+      it->second = buildCandidateIndex(std::move(results[0].mutants));
+      ++doneFiles;
+      notifyProgress(doneFiles, totalFiles);
+    }
+    return it->second;
+  };
+
+  return streamFromRange(sourceLines, maxMutants, randomSeed, getIndex,
+                         [](const SourceLine& line) -> const SourceLine& { return line; },
+                         mutantsPerLine, onSelected);
+}
+
+// ---------------------------------------------------------------------------
+// createFileSystem / snapshotSources
+// ---------------------------------------------------------------------------
+llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> MutantGenerator::createFileSystem() const {
+  llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> physical(llvm::vfs::createPhysicalFileSystem().release());
+  if (mSnapshot == nullptr) {
+    return physical;
+  }
+  llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> overlay(
+      new llvm::vfs::OverlayFileSystem(std::move(physical)));
+  overlay->pushOverlay(mSnapshot);
+  return overlay;
+}
+
+void MutantGenerator::snapshotSources(const SourceLines& sourceLines) {
+  mSnapshot = llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem>(new llvm::vfs::InMemoryFileSystem());
+  std::set<fs::path> files;
+  for (const auto& sourceLine : sourceLines) {
+    files.insert(fs::absolute(sourceLine.getPath()).lexically_normal());
+  }
+  for (const auto& file : files) {
+    auto buffer = llvm::MemoryBuffer::getFile(file.string());
+    llvm::sys::fs::file_status status;
+    if (!buffer || llvm::sys::fs::status(file.string(), status)) {
+      continue;
+    }
+    const auto mtime = llvm::sys::toTimeT(status.getLastModificationTime());
+    const llvm::StringRef contents = (*buffer)->getBuffer();
+    mSnapshot->addFile(file.string(), mtime, llvm::MemoryBuffer::getMemBufferCopy(contents, file.string()));
+    // Compile commands may name the file through a symlinked path.
+    std::error_code ec;
+    const fs::path canonPath = fs::canonical(file, ec);
+    if (!ec && canonPath != file) {
+      mSnapshot->addFile(canonPath.string(), mtime,
+                         llvm::MemoryBuffer::getMemBufferCopy(contents, canonPath.string()));
+    }
+  }
+}
+
 // ---------------------------------------------------------------------------
 // loadCompilationDatabase — single source of truth for DB loading
 // ---------------------------------------------------------------------------
-std::unique_ptr<clang::tooling::CompilationDatabase>
+std::shared_ptr<clang::tooling::CompilationDatabase>
 MutantGenerator::loadCompilationDatabase() const {
+  std::error_code ec;
+  const auto mtime = fs::last_write_time(mDbPath / "compile_commands.json", ec);
+  if (mCompileDb != nullptr && !ec && mtime == mCompileDbTime) {
+    return mCompileDb;
+  }
   std::string errorMsg;
-  auto compileDb = clang::tooling::CompilationDatabase::loadFromDirectory(mDbPath.string(), errorMsg);
+  std::shared_ptr<clang::tooling::CompilationDatabase> compileDb =
+      clang::tooling::CompilationDatabase::loadFromDirectory(mDbPath.string(), errorMsg);
   if (compileDb == nullptr) {
     throw IOException(EINVAL, errorMsg);
   }
+  if (!ec) {
+    mCompileDb = compileDb;
+    mCompileDbTime = mtime;
+  }
   return compileDb;
 }
 
@@ -77,34 +299,248 @@ MutantGenerator::loadCompilationDatabase() const {
 // collectAllMutants — default implementation using shared AST visitor
 // ---------------------------------------------------------------------------
 Mutants MutantGenerator::collectAllMutants(const SourceLines& sourceLines) {
-  Mutants mutables;
-  auto compileDb = loadCompilationDatabase();
-
   std::map<fs::path, std::vector<std::size_t>> targetLines;
   for (const auto& sourceLine : sourceLines) {
     fs::path filename = sourceLine.getPath();
     targetLines[filename].push_back(sourceLine.getLineNumber());
   }
 
-  const std::size_t totalFiles = targetLines.size();
+  std::vector<fs::path> files;
+  std::vector<std::string> cacheKeys;
+  files.reserve(targetLines.size());
+  cacheKeys.reserve(targetLines.size());
+  for (const auto& [filename, lines] : targetLines) {
+    files.push_back(filename);
+    std::ostringstream key;
+    key << "lines";
+    for (std::size_t line : std::set<std::size_t>(lines.begin(), lines.end())) {
+      key << ' ' << line;
+    }
+    cacheKeys.push_back(key.str());
+  }
+
+  std::vector<FileCandidates> candidatesByFile = collectFilesInParallel(
+      files, cacheKeys, [&](std::size_t i, const clang::tooling::CompilationDatabase& compileDb) {
+        return collectMutantsForFile(compileDb, files[i], targetLines.at(files[i]));
+      });
+
+  Mutants mutables;
+  for (auto& candidates : candidatesByFile) {
+    std::move(candidates.mutants.begin(), candidates.mutants.end(), std::back_inserter(mutables));
+  }
+  return mutables;
+}
+
+// ---------------------------------------------------------------------------
+// collectFilesInParallel / collectInWorkers
+// ---------------------------------------------------------------------------
+std::vector<FileCandidates> MutantGenerator::collectFilesInParallel(const std::vector<fs::path>& files,
+                                                                    const std::vector<std::string>& cacheKeys,
+                                                                    const FileCollector& collectFile) {
+  auto compileDb = loadCompilationDatabase();
+  std::vector<PrefetchedCompilationDatabase> compileDbByFile;
+  std::vector<std::uintmax_t> sizes;
+  compileDbByFile.reserve(files.size());
+  sizes.reserve(files.size());
+  for (const auto& filename : files) {
+    compileDbByFile.emplace_back(
+        compileDb->getCompileCommands(clang::tooling::getAbsolutePath(filename.string())));
+    std::error_code ec;
+    const std::uintmax_t size = fs::file_size(filename, ec);
+    sizes.push_back(ec ? 0 : size);
+  }
+
+  const std::size_t totalFiles = files.size();
   std::size_t doneFiles = 0;
   notifyProgress(doneFiles, totalFiles);
 
-  for (const auto& [filename, lines] : targetLines) {
-    try {
-      auto factory = createActionFactory(&mutables, lines, mSelectedOperators);
-      clang::IgnoringDiagConsumer ignoring;
-      clang::tooling::ClangTool tool(*compileDb, {filename.string()});
-      tool.setDiagnosticConsumer(&ignoring);
-      tool.run(factory.get());
-    } catch (const std::bad_alloc&) {
-      rethrowAsOomError(filename);
+  std::vector<FileCandidates> results(files.size());
+  std::vector<std::size_t> order;
+  std::unique_ptr<CandidateCache> cache;
+  std::vector<std::string> keys;
+  if (!mCandidateCacheDir.empty()) {
+    std::ostringstream context;
+    context << PROGRAM_VERSION;
+    for (const auto& op : mSelectedOperators) {
+      context << ' ' << op;
     }
-    ++doneFiles;
-    notifyProgress(doneFiles, totalFiles);
+    cache = std::make_unique<CandidateCache>(mCandidateCacheDir, context.str());
+    keys.reserve(files.size());
+    for (std::size_t i = 0; i < files.size(); ++i) {
+      std::ostringstream key;
+      for (const auto& command : compileDbByFile[i].getCompileCommands(files[i].string())) {
+        key << command.Directory << '\n' << command.Filename << '\n';
+        for (const auto& arg : command.CommandLine) {
+          key << arg << '\n';
+        }
+      }
+      key << cacheKeys[i];
+      keys.push_back(key.str());
+      if (auto cached = cache->find(files[i], keys[i])) {
+        results[i] = std::move(*cached);
+        notifyProgress(++doneFiles, totalFiles);
+      } else {
+        order.push_back(i);
+      }
+    }
+  } else {
+    for (std::size_t i = 0; i < files.size(); ++i) {
+      order.push_back(i);
+    }
+  }
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+    return sizes[lhs] > sizes[rhs];
+  });
+  // Skipped files are not stored, so that they are parsed again next time.
+  auto storeParsed = [&] {
+    if (cache != nullptr) {
+      for (std::size_t i : order) {
+        if (mSkippedFiles.count(files[i]) == 0) {
+          cache->store(files[i], keys[i], results[i]);
+        }
+      }
+    }
+  };
+
+  std::size_t jobs = std::max<std::size_t>(
+      1, std::min<std::size_t>(order.size(), std::thread::hardware_concurrency()));
+  if (mWorkerMemoryLimit || mWorkerTimeout) {
+    if (mWorkerMemoryLimit) {
+      if (auto available = ProcessPool::getAvailableMemory()) {
+        jobs = std::max<std::size_t>(1, std::min(jobs, *available / (*mWorkerMemoryLimit * kBytesPerMiB)));
+      }
+    }
+    collectInWorkers(
+        files, order, jobs,
+        [&](std::size_t i) { return collectFile(i, compileDbByFile[i]); },
+        &results, [&] { notifyProgress(++doneFiles, totalFiles); });
+    storeParsed();
+    return results;
   }
 
-  return mutables;
+  std::atomic<std::size_t> next{0};
+  std::mutex mutex;
+  std::exception_ptr error;
+  auto worker = [&] {
+    for (std::size_t n = next++; n < order.size(); n = next++) {
+      const std::size_t i = order[n];
+      // The progress callback may throw too (e.g. to cancel generation).
+      try {
+        results[i] = collectFile(i, compileDbByFile[i]);
+        std::lock_guard<std::mutex> lock(mutex);
+        notifyProgress(++doneFiles, totalFiles);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = order.size();
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < jobs; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& t : threads) {
+    t.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  storeParsed();
+  return results;
+}
+
+void MutantGenerator::collectInWorkers(const std::vector<fs::path>& files, const std::vector<std::size_t>& order,
+                                       std::size_t jobs,
+                                       const std::function<FileCandidates(std::size_t index)>& collect,
+                                       std::vector<FileCandidates>* results,
+                                       const std::function<void()>& onFileDone) {
+  std::optional<std::size_t> memoryLimit;
+  if (mWorkerMemoryLimit) {
+    memoryLimit = *mWorkerMemoryLimit * kBytesPerMiB;
+  }
+  auto job = [&collect](std::size_t i) { return collect(i).serialize(); };
+
+  std::vector<std::size_t> timedOut;
+  auto onDone = [&](std::size_t i, const ProcessPool::Result& result, bool retried) {
+    std::string reason;
+    switch (result.status) {
+      case ProcessPool::Status::SUCCEEDED:
+        (*results)[i] = FileCandidates::deserialize(result.output);
+        break;
+      case ProcessPool::Status::TIMED_OUT:
+        if (!retried) {
+          timedOut.push_back(i);
+          return;
+        }
+        reason = fmt::format("parsing took more than {} seconds", *mWorkerTimeout * 2);
+        break;
+      case ProcessPool::Status::OUT_OF_MEMORY:
+        reason = mWorkerMemoryLimit ? fmt::format("parsing needed more than {} MiB", *mWorkerMemoryLimit)
+                                    : std::string("parsing ran out of memory");
+        break;
+      case ProcessPool::Status::CRASHED:
+        reason = fmt::format("parsing crashed ({})", result.output);
+        break;
+      case ProcessPool::Status::FAILED:
+        reason = fmt::format("parsing failed: {}", result.output);
+        break;
+    }
+    if (!reason.empty()) {
+      mSkippedFiles.emplace(files[i], reason);
+    }
+    onFileDone();
+  };
+
+  ProcessPool(jobs, memoryLimit, mWorkerTimeout)
+      .run(order, job, [&](std::size_t i, const ProcessPool::Result& result) { onDone(i, result, false); });
+  if (!timedOut.empty()) {
+    ProcessPool(1, memoryLimit, *mWorkerTimeout * 2)
+        .run(timedOut, job, [&](std::size_t i, const ProcessPool::Result& result) { onDone(i, result, true); });
+  }
+}
+
+FileCandidates MutantGenerator::collectMutantsForFile(const clang::tooling::CompilationDatabase& compileDb,
+                                                      const std::filesystem::path& filename,
+                                                      const std::vector<std::size_t>& lines) const {
+  FileCandidates candidates;
+  auto factory = createActionFactory(&candidates.mutants, lines, mSelectedOperators);
+  runTool(compileDb, filename, factory.get(), &candidates.includes);
+  return candidates;
+}
+
+void MutantGenerator::runTool(const clang::tooling::CompilationDatabase& compileDb, const fs::path& filename,
+                              clang::tooling::FrontendActionFactory* factory,
+                              std::vector<std::string>* includes) const {
+  std::vector<std::string> recorded;
+  bool failed = false;
+  int status = 0;
+  try {
+    IncludeRecordingActionFactory recordingFactory(factory, &recorded, &failed);
+    clang::IgnoringDiagConsumer ignoring;
+    clang::tooling::ClangTool tool(compileDb, {filename.string()},
+                                   std::make_shared<clang::PCHContainerOperations>(), createFileSystem());
+    tool.setDiagnosticConsumer(&ignoring);
+    status = tool.run(&recordingFactory);
+  } catch (const std::bad_alloc&) {
+    rethrowAsOomError(filename);
+  }
+
+  // A missing header is an error, so a file parsed with errors may depend on files not recorded.
+  includes->clear();
+  const auto commands = compileDb.getCompileCommands(clang::tooling::getAbsolutePath(filename.string()));
+  if (status != 0 || failed || commands.empty()) {
+    return;
+  }
+  // Relative paths are relative to the directory the command runs in.
+  std::set<std::string> absolute;
+  for (const auto& include : recorded) {
+    absolute.insert((fs::path(commands.front().Directory) / include).lexically_normal().string());
+  }
+  includes->assign(absolute.begin(), absolute.end());
 }
 
 // ---------------------------------------------------------------------------
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <fmt/ranges.h>
+#include <yaml-cpp/yaml.h>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "sentinel/MutantPlan.hpp"
+#include "sentinel/util/io.hpp"
+#include "sentinel/version.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+void MutantPlan::hashSources(const fs::path& sourceDir) {
+  for (const auto& m : mutants) {
+    files[m.getPath()];
+  }
+  for (auto& [path, file] : files) {
+    file.hash = io::hashFile(sourceDir / path);
+    if (file.hash.empty()) {
+      throw std::runtime_error(fmt::format("Cannot read mutated file '{}'.", (sourceDir / path).string()));
+    }
+  }
+}
+
+void MutantPlan::verify(const fs::path& sourceDir) const {
+  std::vector<std::string> changed;
+  for (const auto& [path, file] : files) {
+    if (io::hashFile(sourceDir / path) != file.hash) {
+      changed.push_back(path.string());
+    }
+  }
+  if (!changed.empty()) {
+    throw std::runtime_error(
+        fmt::format("The mutant plan does not match the sources in '{}'. Missing or changed: {}.\n"
+                    "       Check out the revision the plan was generated from.",
+                    sourceDir.string(), fmt::join(changed, ", ")));
+  }
+}
+
+std::map<fs::path, std::size_t> MutantPlan::getLinesByPath(const fs::path& sourceDir) const {
+  const fs::path root = fs::canonical(sourceDir);
+  std::map<fs::path, std::size_t> result;
+  for (const auto& [path, file] : files) {
+    result.emplace(root / path, file.lines);
+  }
+  return result;
+}
+
+void MutantPlan::save(const fs::path& path) const {
+  YAML::Emitter out;
+  out << YAML::BeginMap;
+  out << YAML::Key << "plan-version" << YAML::Value << kFormatVersion;
+  out << YAML::Key << "version" << YAML::Value << programVersion;
+  out << YAML::Key << "seed" << YAML::Value << seed;
+  out << YAML::Key << "candidate-count" << YAML::Value << candidateCount;
+  out << YAML::Key << "generator" << YAML::Value << generatorToString(generator);
+  out << YAML::Key << "mutants-per-line" << YAML::Value << mutantsPerLine;
+  if (from) {
+    out << YAML::Key << "from" << YAML::Value << *from;
+  }
+  out << YAML::Key << "uncommitted" << YAML::Value << uncommitted;
+  out << YAML::Key << "limit" << YAML::Value << limit;
+  out << YAML::Key << "files" << YAML::Value << YAML::BeginMap;
+  for (const auto& [file, state] : files) {
+    out << YAML::Key << file.string() << YAML::Value << YAML::Flow << YAML::BeginMap;
+    out << YAML::Key << "hash" << YAML::Value << state.hash;
+    out << YAML::Key << "lines" << YAML::Value << state.lines;
+    out << YAML::EndMap;
+  }
+  out << YAML::EndMap;
+  out << YAML::Key << "mutants" << YAML::Value << YAML::BeginSeq;
+  for (const auto& m : mutants) {
+    std::ostringstream text;
+    text << m;
+    out << YAML::Load(text.str());
+  }
+  out << YAML::EndSeq;
+  out << YAML::EndMap;
+
+  std::ofstream file(path);
+  if (!file || !(file << out.c_str() << '\n')) {
+    throw std::runtime_error(
+        fmt::format("Failed to write mutant plan '{}': {}", path.string(), std::strerror(errno)));
+  }
+}
+
+MutantPlan MutantPlan::load(const fs::path& path) {
+  if (!fs::is_regular_file(path)) {
+    throw std::runtime_error(fmt::format("Mutant plan '{}' not found.", path.string()));
+  }
+  MutantPlan plan;
+  try {
+    const YAML::Node node = YAML::LoadFile(path.string());
+    const int format = node["plan-version"].as<int>(0);
+    if (format != kFormatVersion) {
+      throw std::runtime_error(fmt::format("Mutant plan '{}' has format version {}, expected {}.", path.string(),
+                                           format, kFormatVersion));
+    }
+    plan.programVersion = node["version"].as<std::string>("");
+    if (plan.programVersion != PROGRAM_VERSION) {
+      throw std::runtime_error(fmt::format("Mutant plan '{}' was generated by sentinel {}, this is {}.",
+                                           path.string(), plan.programVersion, PROGRAM_VERSION));
+    }
+    plan.seed = node["seed"].as<unsigned int>();
+    plan.candidateCount = node["candidate-count"].as<std::size_t>();
+    plan.generator = parseGenerator(node["generator"].as<std::string>());
+    plan.mutantsPerLine = node["mutants-per-line"].as<std::size_t>(1);
+    if (node["from"]) {
+      plan.from = node["from"].as<std::string>();
+    }
+    plan.uncommitted = node["uncommitted"].as<bool>(false);
+    plan.limit = node["limit"].as<std::size_t>(0);
+    for (const auto& entry : node["files"]) {
+      plan.files.emplace(entry.first.as<std::string>(),
+                         SourceFile{entry.second["hash"].as<std::string>(), entry.second["lines"].as<std::size_t>(0)});
+    }
+    for (const auto& entry : node["mutants"]) {
+      YAML::Emitter text;
+      text << entry;
+      std::istringstream in(text.c_str());
+      Mutant m;
+      if (!(in >> m)) {
+        throw std::runtime_error(fmt::format("Mutant plan '{}' holds an invalid mutant.", path.string()));
+      }
+      plan.mutants.push_back(m);
+    }
+  } catch (const YAML::Exception& e) {
+    throw std::runtime_error(fmt::format("Failed to parse mutant plan '{}': {}", path.string(), e.what()));
+  } catch (const std::invalid_argument& e) {
+    throw std::runtime_error(fmt::format("Failed to parse mutant plan '{}': {}", path.string(), e.what()));
+  }
+  return plan;
+}
+
+}  // namespace sentinel
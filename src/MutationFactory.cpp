@@ -22,6 +22,29 @@ MutationFactory::MutationFactory(const std::shared_ptr<MutantGenerator>& generat
 Mutants MutationFactory::generate(const std::filesystem::path& gitPath, const SourceLines& sourceLines,
                                   std::size_t maxMutants, unsigned int randomSeed, std::size_t mutantsPerLine) {
   auto mutants = mGenerator->generate(sourceLines, maxMutants, randomSeed, mutantsPerLine);
+  const auto root = canonicalRoot(gitPath);
+  std::map<fs::path, fs::path> canonCache;
+  for (auto& m : mutants) {
+    m = toRelative(m, root, &canonCache);
+  }
+  return mutants;
+}
+
+Mutants MutationFactory::generate(const std::filesystem::path& gitPath, const SourceLines& sourceLines,
+                                  std::size_t maxMutants, unsigned int randomSeed, std::size_t mutantsPerLine,
+                                  const MutantGenerator::MutantCallback& onGenerated) {
+  const auto root = canonicalRoot(gitPath);
+  std::map<fs::path, fs::path> canonCache;
+  Mutants relMutants;
+  mGenerator->generate(sourceLines, maxMutants, randomSeed, mutantsPerLine,
+                       [&](const Mutant& m) {
+                         relMutants.push_back(toRelative(m, root, &canonCache));
+                         onGenerated(relMutants.back());
+                       });
+  return relMutants;
+}
+
+fs::path MutationFactory::canonicalRoot(const std::filesystem::path& gitPath) {
   // gitPath is the project's source root; failing to canonicalize it is
   // structural and should surface with a clear message rather than the raw
   // std::filesystem error.
@@ -32,26 +55,31 @@ Mutants MutationFactory::generate(const std::filesystem::path& gitPath, const So
         "Cannot canonicalize source root '{}': {}",
         gitPath.string(), rootEc.message()));
   }
-  std::map<fs::path, fs::path> canonCache;
-  for (auto& m : mutants) {
-    auto [it, inserted] = canonCache.emplace(m.getPath(), fs::path{});
-    if (inserted) {
-      // Per-mutant canonical fall-back: if a source file was removed between
-      // AST collection and this loop (rare race), keep the original path so
-      // the run can continue with that mutant's relative path still derived
-      // from the unresolved input.
-      std::error_code ec;
-      it->second = fs::canonical(m.getPath(), ec);
-      if (ec) {
-        it->second = m.getPath();
-      }
+  return root;
+}
+
+Mutant MutationFactory::toRelative(const Mutant& m, const std::filesystem::path& root,
+                                   std::map<std::filesystem::path, std::filesystem::path>* canonCache) {
+  auto [it, inserted] = canonCache->emplace(m.getPath(), fs::path{});
+  if (inserted) {
+    // Per-mutant canonical fall-back: if a source file was removed between
+    // AST collection and this loop (rare race), keep the original path so
+    // the run can continue with that mutant's relative path still derived
+    // from the unresolved input.
+    std::error_code ec;
+    it->second = fs::canonical(m.getPath(), ec);
+    if (ec) {
+      it->second = m.getPath();
     }
-    const auto& absPath = it->second;
-    m = Mutant(m.getOperator(), absPath.lexically_relative(root), m.getQualifiedFunction(),
-               m.getFirst().line, m.getFirst().column,
-               m.getLast().line, m.getLast().column, m.getToken());
   }
-  return mutants;
+  const auto& absPath = it->second;
+  Mutant relative(m.getOperator(), absPath.lexically_relative(root), m.getQualifiedFunction(),
+                  m.getFirst().line, m.getFirst().column,
+                  m.getLast().line, m.getLast().column, m.getToken());
+  if (m.hasOffsets()) {
+    relative.setOffsets(m.getFirstOffset(), m.getLastOffset(), m.getFileHash());
+  }
+  return relative;
 }
 
 }  // namespace sentinel
@@ -61,10 +61,26 @@ void MutationResult::setUncovered(bool uncovered) {
   mUncovered = uncovered;
 }
 
+bool MutationResult::isCached() const {
+  return mCached;
+}
+
+void MutationResult::setCached(bool cached) {
+  mCached = cached;
+}
+
+bool MutationResult::isNotInfected() const {
+  return mNotInfected;
+}
+
+void MutationResult::setNotInfected(bool notInfected) {
+  mNotInfected = notInfected;
+}
+
 bool MutationResult::compare(const MutationResult& other) const {
   return mMutant == other.mMutant && mKillingTest == other.mKillingTest && mErrorTest == other.mErrorTest &&
          mState == other.mState && mBuildSecs == other.mBuildSecs && mTestSecs == other.mTestSecs &&
-         mUncovered == other.mUncovered;
+         mUncovered == other.mUncovered && mCached == other.mCached && mNotInfected == other.mNotInfected;
 }
 
 std::ostream& operator<<(std::ostream& out, const MutationResult& mr) {
@@ -79,6 +95,8 @@ std::ostream& operator<<(std::ostream& out, const MutationResult& mr) {
   emitter << YAML::Key << "build-time" << YAML::Value << mr.getBuildSecs();
   emitter << YAML::Key << "test-time" << YAML::Value << mr.getTestSecs();
   emitter << YAML::Key << "uncovered" << YAML::Value << mr.isUncovered();
+  emitter << YAML::Key << "cached" << YAML::Value << mr.isCached();
+  emitter << YAML::Key << "not-infected" << YAML::Value << mr.isNotInfected();
   emitter << YAML::Key << "mutant" << YAML::Value << YAML::Load(mutantYaml.str());
   emitter << YAML::EndMap;
   out << emitter.c_str();
@@ -120,6 +138,12 @@ std::istream& operator>>(std::istream& in, MutationResult& mr) {
     if (node["uncovered"]) {
       mr.setUncovered(node["uncovered"].as<bool>());
     }
+    if (node["cached"]) {
+      mr.setCached(node["cached"].as<bool>());
+    }
+    if (node["not-infected"]) {
+      mr.setNotInfected(node["not-infected"].as<bool>());
+    }
   } catch (const YAML::Exception&) {
     in.setstate(std::ios::failbit);
   } catch (const std::invalid_argument&) {
@@ -3,7 +3,10 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <algorithm>
+#include <cmath>
 #include <filesystem>  // NOLINT
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
@@ -48,7 +51,8 @@ MutationSummary::MutationSummary(const MutationSummary& other) :
     timeByState(other.timeByState),
     totalBuildSecs(other.totalBuildSecs),
     totalTestSecs(other.totalTestSecs),
-    timedMutantCount(other.timedMutantCount) {
+    timedMutantCount(other.timedMutantCount),
+    plannedMutantCount(other.plannedMutantCount) {
   if (other.results.empty()) {
     return;
   }
@@ -90,9 +94,48 @@ MutationSummary& MutationSummary::operator=(MutationSummary other) {
   std::swap(totalBuildSecs, other.totalBuildSecs);
   std::swap(totalTestSecs, other.totalTestSecs);
   std::swap(timedMutantCount, other.timedMutantCount);
+  std::swap(plannedMutantCount, other.plannedMutantCount);
   return *this;
 }
 
+bool MutationSummary::isSampled() const {
+  return plannedMutantCount > results.size();
+}
+
+std::optional<std::pair<double, double>> MutationSummary::getScoreInterval() const {
+  if (!isSampled() || totNumberOfMutation == 0) {
+    return std::nullopt;
+  }
+  // Build failures, runtime errors and timeouts do not count towards the score;
+  // the unevaluated mutants are assumed to have the same share of them.
+  const auto population = static_cast<std::size_t>(std::llround(
+      static_cast<double>(plannedMutantCount) * static_cast<double>(totNumberOfMutation) /
+      static_cast<double>(results.size())));
+  const auto [low, high] = getWilsonInterval(totNumberOfDetectedMutation, totNumberOfMutation,
+                                             std::max(population, totNumberOfMutation));
+  return std::make_pair(100.0 * low, 100.0 * high);
+}
+
+std::pair<double, double> MutationSummary::getWilsonInterval(std::size_t detected, std::size_t total,
+                                                             std::size_t population) {
+  if (total == 0) {
+    return {0.0, 1.0};
+  }
+  static constexpr double kZ = 1.959964;  // two-sided 95%
+  const double p = static_cast<double>(detected) / static_cast<double>(total);
+  const double fpc = population > total
+      ? static_cast<double>(population - total) / static_cast<double>(population - 1) : 0.0;
+  if (fpc <= 0.0) {
+    return {p, p};
+  }
+  const double n = static_cast<double>(total) / fpc;
+  const double z2 = kZ * kZ;
+  const double denominator = 1.0 + z2 / n;
+  const double center = (p + z2 / (2.0 * n)) / denominator;
+  const double half = kZ * std::sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denominator;
+  return {std::max(0.0, center - half), std::min(1.0, center + half)};
+}
+
 void MutationSummary::aggregate() {
   for (const MutationResult& mr : results) {
     auto currentState = mr.getMutationState();
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <sys/wait.h>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <filesystem>  // NOLINT
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/NinjaGraph.hpp"
+#include "sentinel/util/string.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::optional<std::string> runQuery(const fs::path& buildDir, const std::string& target) {
+  const std::string cmd = "ninja -C " + string::shellQuote(buildDir.string()) + " -t query " +
+                          string::shellQuote(target) + " 2>/dev/null";
+  FILE* pipe = ::popen(cmd.c_str(), "r");
+  if (pipe == nullptr) {
+    return std::nullopt;
+  }
+  std::string output;
+  std::array<char, 4096> buf{};
+  std::size_t n = 0;
+  while ((n = std::fread(buf.data(), 1, buf.size(), pipe)) > 0) {
+    output.append(buf.data(), n);
+  }
+  const int status = ::pclose(pipe);
+  if (status == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    return std::nullopt;
+  }
+  return output;
+}
+
+}  // namespace
+
+NinjaGraph::NinjaGraph(const fs::path& buildDir) :
+    NinjaGraph(buildDir, [buildDir](const std::string& target) { return runQuery(buildDir, target); }) {
+}
+
+NinjaGraph::NinjaGraph(const fs::path& buildDir, QueryFunction query) :
+    mBuildDir(buildDir), mQuery(std::move(query)) {
+}
+
+bool NinjaGraph::isNinjaBuild(const fs::path& buildDir) {
+  return fs::is_regular_file(buildDir / "build.ninja");
+}
+
+NinjaGraph::Node NinjaGraph::parseQuery(const std::string& output) {
+  // <target>:
+  //   input: <rule>
+  //     <inputs>
+  //   outputs:
+  //     <outputs>
+  Node node;
+  bool inOutputs = false;
+  std::istringstream in(output);
+  std::string line;
+  while (std::getline(in, line)) {
+    const std::size_t indent = line.find_first_not_of(' ');
+    if (indent == std::string::npos || indent == 0) {
+      continue;
+    }
+    const std::string text = string::trim(line);
+    if (indent <= 2) {
+      inOutputs = text == "outputs:";
+      if (string::startsWith(text, "input:")) {
+        node.rule = string::trim(text.substr(6));
+      }
+    } else if (inOutputs) {
+      node.outputs.push_back(text);
+    }
+  }
+  return node;
+}
+
+const std::optional<NinjaGraph::Node>& NinjaGraph::getNode(const std::string& target) {
+  auto it = mNodes.find(target);
+  if (it == mNodes.end()) {
+    std::optional<Node> node;
+    if (auto output = mQuery(target)) {
+      node = parseQuery(*output);
+    }
+    it = mNodes.emplace(target, std::move(node)).first;
+  }
+  return it->second;
+}
+
+bool NinjaGraph::collectTargets(const std::string& target, std::vector<std::string>* result) {
+  auto it = mTargetsByNode.find(target);
+  if (it == mTargetsByNode.end()) {
+    std::vector<std::string> targets;
+    const auto& node = getNode(target);
+    if (node && node->rule != "phony") {
+      for (const auto& output : node->outputs) {
+        collectTargets(output, &targets);
+      }
+      if (targets.empty()) {
+        targets.push_back(target);
+      }
+    }
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+    it = mTargetsByNode.emplace(target, std::move(targets)).first;
+  }
+  result->insert(result->end(), it->second.begin(), it->second.end());
+  return !it->second.empty();
+}
+
+std::vector<std::string> NinjaGraph::getAffectedTargets(const fs::path& source) {
+  // CMake refers to sources by absolute path, hand-written files often relative to the build directory.
+  for (const auto& name : {source.string(), source.lexically_relative(mBuildDir).string()}) {
+    if (name.empty()) {
+      continue;
+    }
+    const auto& node = getNode(name);
+    if (!node || node->outputs.empty()) {
+      continue;
+    }
+    std::vector<std::string> targets;
+    for (const auto& output : node->outputs) {
+      collectTargets(output, &targets);
+    }
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+    return targets;
+  }
+  return {};
+}
+
+std::string NinjaGraph::getBuildCommand(const std::vector<std::string>& targets) const {
+  std::string cmd = "ninja -C " + string::shellQuote(mBuildDir.string());
+  for (const auto& target : targets) {
+    cmd += " " + string::shellQuote(target);
+  }
+  return cmd;
+}
+
+}  // namespace sentinel
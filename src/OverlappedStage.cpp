@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <exception>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+#include "sentinel/OverlappedStage.hpp"
+#include "sentinel/util/signal.hpp"
+
+namespace sentinel {
+
+OverlappedStage::OverlappedStage(std::shared_ptr<Stage> foreground, std::shared_ptr<Stage> background) :
+    mForeground(std::move(foreground)), mBackground(std::move(background)) {
+}
+
+bool OverlappedStage::shouldSkip(const PipelineContext& ctx) const {
+  return mForeground->shouldSkip(ctx) && mBackground->shouldSkip(ctx);
+}
+
+StatusLine::Phase OverlappedStage::getPhase() const {
+  return mForeground->getPhase();
+}
+
+bool OverlappedStage::execute(PipelineContext* ctx) {
+  if (mBackground->shouldSkip(*ctx)) {
+    return mForeground->execute(ctx);
+  }
+  if (mForeground->shouldSkip(*ctx)) {
+    ctx->statusLine.setPhase(mBackground->getPhase());
+    return mBackground->execute(ctx);
+  }
+
+  std::promise<bool> foregroundDone;
+  const std::shared_future<bool> foregroundResult = foregroundDone.get_future().share();
+  PipelineContext backgroundCtx{ctx->config, ctx->statusLine, ctx->workspace, ctx->mutantQueue, &foregroundResult};
+
+  std::exception_ptr backgroundError;
+  bool backgroundProceed = false;
+  std::thread background([&] {
+    signal::blockSignalsInThread();
+    try {
+      backgroundProceed = mBackground->execute(&backgroundCtx);
+    } catch (...) {
+      backgroundError = std::current_exception();
+    }
+  });
+
+  bool proceed = false;
+  try {
+    proceed = mForeground->execute(ctx);
+  } catch (...) {
+    foregroundDone.set_value(false);
+    background.join();
+    throw;
+  }
+  foregroundDone.set_value(proceed);
+  background.join();
+
+  if (backgroundError) {
+    std::rethrow_exception(backgroundError);
+  }
+  return proceed && backgroundProceed;
+}
+
+}  // namespace sentinel
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/PartitionPlanner.hpp"
+#include "sentinel/Workspace.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Consecutive mutants of one file that go to the same partition.
+struct Chunk {
+  std::vector<std::size_t> positions;
+  double cost = 0.0;
+};
+
+}  // namespace
+
+PartitionPlanner::PartitionPlanner() = default;
+
+PartitionPlanner::PartitionPlanner(std::map<fs::path, double> fileCosts) : mFileCosts(std::move(fileCosts)) {
+  if (!mFileCosts->empty()) {
+    double sum = 0.0;
+    for (const auto& [file, cost] : *mFileCosts) {
+      sum += cost;
+    }
+    mDefaultCost = sum / static_cast<double>(mFileCosts->size());
+  }
+}
+
+PartitionPlanner PartitionPlanner::fromConfig(const Config& config) {
+  if (config.partitionBy != kByCost) {
+    return PartitionPlanner();
+  }
+  if (config.partitionCosts.empty()) {
+    return PartitionPlanner(std::map<fs::path, double>{});
+  }
+  return PartitionPlanner(loadFileCosts(config.partitionCosts));
+}
+
+std::map<fs::path, double> PartitionPlanner::loadFileCosts(const fs::path& workspaceDir) {
+  const Workspace workspace(workspaceDir);
+  if (!workspace.hasPreviousRun()) {
+    throw std::runtime_error(
+        fmt::format("--partition-costs: '{}' is not a sentinel workspace.", workspaceDir.string()));
+  }
+  std::map<fs::path, std::pair<double, std::size_t>> totals;
+  for (const auto& [id, m] : workspace.loadMutants()) {
+    if (!workspace.isDone(id)) {
+      continue;
+    }
+    const MutationResult result = workspace.getDoneResult(id);
+    const double seconds = result.getBuildSecs() + result.getTestSecs();
+    if (seconds <= 0.0) {
+      continue;
+    }
+    auto& [sum, count] = totals[m.getPath()];
+    sum += seconds;
+    count++;
+  }
+  std::map<fs::path, double> costs;
+  for (const auto& [file, total] : totals) {
+    costs.emplace(file, total.first / static_cast<double>(total.second));
+  }
+  return costs;
+}
+
+double PartitionPlanner::getCost(const fs::path& file) const {
+  if (!mFileCosts) {
+    return 1.0;
+  }
+  auto it = mFileCosts->find(file);
+  return it != mFileCosts->end() ? it->second : mDefaultCost;
+}
+
+std::vector<std::vector<std::size_t>> PartitionPlanner::plan(const std::vector<fs::path>& files,
+                                                             std::size_t count) const {
+  std::vector<std::vector<std::size_t>> parts(count);
+  if (count == 0) {
+    return parts;
+  }
+  const std::size_t total = files.size();
+  if (!mFileCosts) {
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      for (std::size_t pos = idx * total / count; pos < (idx + 1) * total / count; ++pos) {
+        parts[idx].push_back(pos);
+      }
+    }
+    return parts;
+  }
+
+  // Group by file, in order of first appearance so ties resolve the same way everywhere.
+  std::map<fs::path, std::size_t> groupOf;
+  std::vector<Chunk> groups;
+  double totalCost = 0.0;
+  for (std::size_t pos = 0; pos < total; ++pos) {
+    auto [it, inserted] = groupOf.emplace(files[pos], groups.size());
+    if (inserted) {
+      groups.emplace_back();
+    }
+    const double cost = getCost(files[pos]);
+    groups[it->second].positions.push_back(pos);
+    groups[it->second].cost += cost;
+    totalCost += cost;
+  }
+
+  // A file larger than an even share could not be balanced as a whole.
+  const double share = totalCost / static_cast<double>(count);
+  std::vector<Chunk> chunks;
+  for (auto& group : groups) {
+    if (group.cost <= share) {
+      chunks.push_back(std::move(group));
+      continue;
+    }
+    Chunk chunk;
+    for (std::size_t pos : group.positions) {
+      const double cost = getCost(files[pos]);
+      if (!chunk.positions.empty() && chunk.cost + cost > share) {
+        chunks.push_back(std::move(chunk));
+        chunk = Chunk();
+      }
+      chunk.positions.push_back(pos);
+      chunk.cost += cost;
+    }
+    chunks.push_back(std::move(chunk));
+  }
+
+  // Longest processing time first: each chunk goes to the least loaded partition.
+  std::stable_sort(chunks.begin(), chunks.end(), [](const Chunk& a, const Chunk& b) { return a.cost > b.cost; });
+  std::vector<double> loads(count, 0.0);
+  for (const auto& chunk : chunks) {
+    const auto target = static_cast<std::size_t>(std::min_element(loads.begin(), loads.end()) - loads.begin());
+    loads[target] += chunk.cost;
+    parts[target].insert(parts[target].end(), chunk.positions.begin(), chunk.positions.end());
+  }
+  for (auto& part : parts) {
+    std::sort(part.begin(), part.end());
+  }
+  return parts;
+}
+
+std::string PartitionPlanner::getStrategy() const {
+  if (!mFileCosts) {
+    return kByCount;
+  }
+  // FNV-1a over the cost table; identical tables yield identical plans.
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const auto& [file, cost] : *mFileCosts) {
+    for (char c : fmt::format("{}={:.6f}\n", file.string(), cost)) {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= 1099511628211ULL;
+    }
+  }
+  return fmt::format("{}:{:016x}", kByCost, hash);
+}
+
+}  // namespace sentinel
@@ -3,19 +3,28 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <fcntl.h>
 #include <fmt/core.h>
 #include <fmt/ranges.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
 #include <yaml-cpp/yaml.h>
 #include <algorithm>
+#include <atomic>
+#include <exception>
 #include <filesystem>  // NOLINT
 #include <fstream>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include "sentinel/Config.hpp"
 #include "sentinel/Logger.hpp"
+#include "sentinel/PartitionPlanner.hpp"
 #include "sentinel/PartitionedWorkspaceMerger.hpp"
 #include "sentinel/Workspace.hpp"
 #include "sentinel/version.hpp"
@@ -25,13 +34,16 @@ namespace sentinel {
 namespace fs = std::filesystem;
 
 static const std::vector<std::string> kMutantFiles = {
-    "mt.cfg", "mt.done", "build.log", "test.log"};
+    "mt.cfg", "mt.done"};
+static const std::vector<std::string> kMutantLogFiles = {
+    "build.log", "test.log"};
 
 PartitionedWorkspaceMerger::PartitionedWorkspaceMerger(
     const std::filesystem::path& targetDir,
     const std::vector<std::filesystem::path>& sourceDirs,
-    bool force)
-    : mTargetDir(targetDir), mSourceDirs(sourceDirs), mForce(force) {
+    bool force, bool indexOnly, bool hardLink)
+    : mTargetDir(targetDir), mSourceDirs(sourceDirs), mForce(force),
+      mIndexOnly(indexOnly), mHardLink(hardLink) {
 }
 
 void PartitionedWorkspaceMerger::merge() {
@@ -41,22 +53,47 @@ void PartitionedWorkspaceMerger::merge() {
   validateCompatibility();
   prepareTargetWorkspace();
 
-  bool baselineCopied = fs::exists(mTargetDir / "config.yaml");
+  if (!fs::exists(mTargetDir / "config.yaml")) {
+    copyBaseline(mSourceDirs[0]);
+  }
+
+  // Partitions hold disjoint mutant IDs, so they are merged independently.
   const bool showProgress = mSourceDirs.size() > 1;
-  std::size_t current = 0;
-  for (const auto& source : mSourceDirs) {
-    ++current;
-    if (showProgress) {
-      const auto& status = mStatusCache.at(source);
-      Logger::info("Merging [{}/{}] partition {} from '{}'...",
-                   current, mSourceDirs.size(),
-                   *status.partIndex, source.string());
-    }
-    if (!baselineCopied) {
-      copyBaseline(source);
-      baselineCopied = true;
+  const std::size_t jobs = std::max<std::size_t>(
+      1, std::min<std::size_t>(mSourceDirs.size(), std::thread::hardware_concurrency()));
+  std::atomic<std::size_t> next{0};
+  std::mutex errorMutex;
+  std::exception_ptr error;
+  auto worker = [&] {
+    for (std::size_t i = next++; i < mSourceDirs.size(); i = next++) {
+      const auto& source = mSourceDirs[i];
+      if (showProgress) {
+        const auto& status = mStatusCache.at(source);
+        Logger::info("Merging [{}/{}] partition {} from '{}'...",
+                     i + 1, mSourceDirs.size(),
+                     *status.partIndex, source.string());
+      }
+      try {
+        copyMutants(source);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        next = mSourceDirs.size();
+      }
     }
-    copyMutants(source);
+  };
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < jobs; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& t : threads) {
+    t.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
   }
 
   updateCompleteness();
@@ -168,6 +205,15 @@ void PartitionedWorkspaceMerger::validateCompatibility() const {
                       mSourceDirs[0].string(),
                       *firstStatus.candidateCount));
     }
+    if (targetStatus.partitionStrategy.value_or(PartitionPlanner::kByCount) !=
+        firstStatus.partitionStrategy.value_or(PartitionPlanner::kByCount)) {
+      throw std::runtime_error(
+          fmt::format("partition-strategy mismatch: target has {} but "
+                      "source '{}' has {}.",
+                      targetStatus.partitionStrategy.value_or(PartitionPlanner::kByCount),
+                      mSourceDirs[0].string(),
+                      firstStatus.partitionStrategy.value_or(PartitionPlanner::kByCount)));
+    }
     if (targetStatus.seed.has_value() &&
         *targetStatus.seed != *firstStatus.seed) {
       throw std::runtime_error(
@@ -210,6 +256,16 @@ void PartitionedWorkspaceMerger::validateCompatibility() const {
                       mSourceDirs[i].string(), *status.candidateCount));
     }
 
+    if (status.partitionStrategy.value_or(PartitionPlanner::kByCount) !=
+        firstStatus.partitionStrategy.value_or(PartitionPlanner::kByCount)) {
+      throw std::runtime_error(
+          fmt::format("partition-strategy mismatch: '{}' has {} but '{}' has {}.",
+                      mSourceDirs[0].string(),
+                      firstStatus.partitionStrategy.value_or(PartitionPlanner::kByCount),
+                      mSourceDirs[i].string(),
+                      status.partitionStrategy.value_or(PartitionPlanner::kByCount)));
+    }
+
     if (*status.seed != *firstStatus.seed) {
       throw std::runtime_error(
           fmt::format("seed mismatch: '{}' has {} but '{}' has {}.",
@@ -279,6 +335,17 @@ void PartitionedWorkspaceMerger::copyMutants(
         copyFileWithConflictCheck(srcFile, dstDir / name);
       }
     }
+    for (const auto& name : kMutantLogFiles) {
+      const fs::path srcFile = srcDir / name;
+      if (!fs::exists(srcFile)) {
+        continue;
+      }
+      if (mIndexOnly) {
+        linkFileWithConflictCheck(fs::absolute(srcFile), dstDir / name);
+      } else {
+        copyFileWithConflictCheck(srcFile, dstDir / name);
+      }
+    }
   }
 }
 
@@ -293,14 +360,61 @@ std::string PartitionedWorkspaceMerger::readFileContent(
                      std::istreambuf_iterator<char>());
 }
 
+void PartitionedWorkspaceMerger::cloneOrCopyFile(
+    const std::filesystem::path& src,
+    const std::filesystem::path& dst, bool hardLink) {
+  // A clone shares the data blocks copy-on-write and is a separate file.
+  const int in = ::open(src.c_str(), O_RDONLY | O_CLOEXEC);
+  if (in >= 0) {
+    const int out = ::open(dst.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (out >= 0) {
+      const bool cloned = ::ioctl(out, FICLONE, in) == 0;
+      ::close(out);
+      ::close(in);
+      if (cloned) {
+        return;
+      }
+      fs::remove(dst);
+    } else {
+      ::close(in);
+    }
+  }
+
+  // A hard link shares the inode: resuming or watching either workspace
+  // rewrites files such as mt.done and mt.cfg in place, which changes both.
+  if (hardLink) {
+    std::error_code ec;
+    fs::create_hard_link(src, dst, ec);
+    if (!ec) {
+      return;
+    }
+  }
+  fs::copy_file(src, dst);
+}
+
 void PartitionedWorkspaceMerger::copyFileWithConflictCheck(
     const std::filesystem::path& src,
     const std::filesystem::path& dst) const {
   if (!fs::exists(dst)) {
-    fs::copy_file(src, dst);
+    cloneOrCopyFile(src, dst, mHardLink);
     return;
   }
+  checkConflict(src, dst);
+}
+
+void PartitionedWorkspaceMerger::linkFileWithConflictCheck(
+    const std::filesystem::path& src,
+    const std::filesystem::path& dst) const {
+  if (!fs::exists(dst)) {
+    fs::create_symlink(src, dst);
+    return;
+  }
+  checkConflict(src, dst);
+}
 
+void PartitionedWorkspaceMerger::checkConflict(
+    const std::filesystem::path& src,
+    const std::filesystem::path& dst) const {
   if (fs::file_size(src) != fs::file_size(dst)) {
     throw std::runtime_error(
         fmt::format("Conflict: '{}' exists with different content. "
@@ -352,6 +466,7 @@ void PartitionedWorkspaceMerger::updateCompleteness() const {
   newStatus.seed = firstStatus.seed;
   newStatus.candidateCount = firstStatus.candidateCount;
   newStatus.partCount = partCount;
+  newStatus.partitionStrategy = firstStatus.partitionStrategy;
   newStatus.mergedPartitions = merged;
   targetWs.saveStatus(newStatus);
 
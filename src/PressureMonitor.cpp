@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/Logger.hpp"
+#include "sentinel/PressureMonitor.hpp"
+#include "sentinel/util/string.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+PressureMonitor::PressureMonitor(const Jobserver& jobserver, std::vector<PressureTarget> targets,
+                                 std::map<std::string, fs::path> files) :
+    mJobserver(jobserver), mTargets(std::move(targets)), mFiles(std::move(files)), mLimit(jobserver.getJobs()) {
+  for (const auto& target : mTargets) {
+    const auto it = mFiles.find(target.resource);
+    if (it == mFiles.end() || !readPressure(it->second)) {
+      Logger::warn("The {} pressure cannot be read{}; its target is ignored.", target.resource,
+                   it == mFiles.end() ? "" : fmt::format(" from '{}'", it->second.string()));
+      mFiles.erase(target.resource);
+    }
+  }
+}
+
+PressureMonitor::~PressureMonitor() {
+  mTask.reset();
+  for (char token : mHeld) {
+    mJobserver.release(token);
+  }
+}
+
+std::map<std::string, fs::path> PressureMonitor::findPressureFiles() {
+  static const std::vector<std::string> kResources = {"cpu", "memory", "io"};
+  std::map<std::string, fs::path> files;
+
+  // cgroup v2 has a single hierarchy, listed as "0::/path".
+  std::ifstream cgroup("/proc/self/cgroup");
+  std::string line;
+  while (std::getline(cgroup, line)) {
+    if (string::startsWith(line, "0::")) {
+      const fs::path dir = fs::path("/sys/fs/cgroup") / fs::path(line.substr(3)).relative_path();
+      if (fs::exists(dir / "cpu.pressure")) {
+        for (const auto& resource : kResources) {
+          files[resource] = dir / (resource + ".pressure");
+        }
+        return files;
+      }
+    }
+  }
+  for (const auto& resource : kResources) {
+    files[resource] = fs::path("/proc/pressure") / resource;
+  }
+  return files;
+}
+
+std::optional<double> PressureMonitor::readPressure(const fs::path& file) {
+  // some avg10=1.23 avg60=0.45 avg300=0.10 total=123456
+  std::ifstream in(file);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::string kind;
+    std::string field;
+    if (!(fields >> kind) || kind != "some") {
+      continue;
+    }
+    while (fields >> field) {
+      if (string::startsWith(field, "avg10=")) {
+        try {
+          return std::stod(field.substr(6));
+        } catch (const std::exception&) {
+          return std::nullopt;
+        }
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+void PressureMonitor::start() {
+  mTask.emplace(kInterval, [this] { update(); });
+}
+
+void PressureMonitor::update() {
+  const PressureTarget* over = nullptr;
+  double overPressure = 0.0;
+  bool allBelow = true;
+  bool anyRead = false;
+  for (const auto& target : mTargets) {
+    const auto it = mFiles.find(target.resource);
+    const auto pressure = it == mFiles.end() ? std::nullopt : readPressure(it->second);
+    if (!pressure) {
+      continue;
+    }
+    anyRead = true;
+    if (*pressure > target.percent && over == nullptr) {
+      over = &target;
+      overPressure = *pressure;
+    }
+    if (*pressure >= target.percent * kReleaseRatio) {
+      allBelow = false;
+    }
+  }
+  if (!anyRead) {
+    return;
+  }
+
+  const std::size_t jobs = mJobserver.getJobs();
+  std::size_t limit = mLimit;
+  if (over != nullptr && limit > 1) {
+    limit--;
+    Logger::info("Job limit {} of {}: {} pressure {:.1f}% is above its target of {}%.", limit, jobs,
+                 over->resource, overPressure, over->percent);
+  } else if (allBelow && limit < jobs) {
+    limit++;
+    Logger::info("Job limit {} of {}: pressure is below the targets.", limit, jobs);
+  }
+  mLimit = limit;
+
+  const std::size_t hold = jobs - limit;
+  while (mHeld.size() > hold) {
+    mJobserver.release(mHeld.back());
+    mHeld.pop_back();
+  }
+  char token = 0;
+  while (mHeld.size() < hold && mJobserver.tryAcquire(&token)) {
+    mHeld.push_back(token);
+  }
+}
+
+std::size_t PressureMonitor::getLimit() const {
+  return mLimit;
+}
+
+}  // namespace sentinel
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fcntl.h>
+#include <fmt/core.h>
+#include <llvm/Support/ErrorHandling.h>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "sentinel/ProcessPool.hpp"
+#include "sentinel/util/signal.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Write end of the pipe of a child, for the LLVM fatal error handler.
+int sResultFd = -1;
+
+void writeAll(int fd, const char* buf, std::size_t len) noexcept {
+  while (len > 0) {
+    ssize_t n = ::write(fd, buf, len);
+    if (n > 0) {
+      buf += n;
+      len -= static_cast<std::size_t>(n);
+      continue;
+    }
+    if (n == -1 && errno == EINTR) {
+      continue;
+    }
+    break;
+  }
+}
+
+extern "C" void onChildBadAlloc(void* /*userData*/, const char* /*reason*/, bool /*genCrashDiag*/) {
+  ::_exit(ProcessPool::kOutOfMemoryExitCode);
+}
+
+extern "C" void onChildFatal(void* /*userData*/, const char* reason, bool /*genCrashDiag*/) {
+  if (reason != nullptr) {
+    writeAll(sResultFd, reason, std::strlen(reason));
+  }
+  ::_exit(ProcessPool::kFailureExitCode);
+}
+
+[[noreturn]] void runChild(int fd, std::optional<std::size_t> memoryLimit, const ProcessPool::Job& job,
+                           std::size_t index) {
+  sResultFd = fd;
+#ifdef __linux__
+  // A child must not outlive sentinel when it is interrupted.
+  ::prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+  // The cleanup callbacks of sentinel (backup restore, ...) must not run in the child.
+  signal::setMultipleSignalHandlers({SIGINT, SIGTERM, SIGQUIT, SIGHUP, SIGUSR1, SIGALRM, SIGCHLD}, SIG_DFL);
+  sigset_t none;
+  sigemptyset(&none);
+  pthread_sigmask(SIG_SETMASK, &none, nullptr);
+
+  if (memoryLimit) {
+    struct rlimit limit {};
+    limit.rlim_cur = *memoryLimit;
+    limit.rlim_max = *memoryLimit;
+    ::setrlimit(RLIMIT_AS, &limit);
+  }
+  llvm::remove_bad_alloc_error_handler();
+  llvm::install_bad_alloc_error_handler(onChildBadAlloc);
+  llvm::remove_fatal_error_handler();
+  llvm::install_fatal_error_handler(onChildFatal);
+  std::set_new_handler([] { ::_exit(ProcessPool::kOutOfMemoryExitCode); });
+
+  int code = 0;
+  std::string output;
+  try {
+    output = job(index);
+  } catch (const std::bad_alloc&) {
+    ::_exit(ProcessPool::kOutOfMemoryExitCode);
+  } catch (const std::exception& e) {
+    output = e.what();
+    code = ProcessPool::kFailureExitCode;
+  } catch (...) {
+    output = "unknown error";
+    code = ProcessPool::kFailureExitCode;
+  }
+  writeAll(fd, output.data(), output.size());
+  // _exit skips the static destructors and atexit handlers of sentinel.
+  ::_exit(code);
+}
+
+struct Child {
+  std::size_t index;
+  pid_t pid;
+  int fd;
+  std::string output;
+  Clock::time_point deadline;
+};
+
+ProcessPool::Result reap(Child* child, bool timedOut) {
+  int status = 0;
+  while (::waitpid(child->pid, &status, 0) < 0 && errno == EINTR) {
+  }
+  ::close(child->fd);
+
+  ProcessPool::Result result;
+  result.output = std::move(child->output);
+  if (timedOut) {
+    result.status = ProcessPool::Status::TIMED_OUT;
+    result.output.clear();
+  } else if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+    result.status = ProcessPool::Status::SUCCEEDED;
+  } else if (WIFEXITED(status) && WEXITSTATUS(status) == ProcessPool::kOutOfMemoryExitCode) {
+    result.status = ProcessPool::Status::OUT_OF_MEMORY;
+    result.output.clear();
+  } else if (WIFEXITED(status)) {
+    result.status = ProcessPool::Status::FAILED;
+    if (result.output.empty()) {
+      result.output = fmt::format("exited with code {}", WEXITSTATUS(status));
+    }
+  } else if (WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL) {
+    // Nothing but the kernel's OOM killer kills a child with SIGKILL before its time limit.
+    result.status = ProcessPool::Status::OUT_OF_MEMORY;
+    result.output.clear();
+  } else {
+    result.status = ProcessPool::Status::CRASHED;
+    result.output = WIFSIGNALED(status) ? strsignal(WTERMSIG(status)) : "stopped";
+  }
+  return result;
+}
+
+}  // namespace
+
+ProcessPool::ProcessPool(std::size_t jobs, std::optional<std::size_t> memoryLimit,
+                         std::optional<std::size_t> timeout) :
+    mJobs(std::max<std::size_t>(1, jobs)), mMemoryLimit(memoryLimit), mTimeout(timeout) {
+}
+
+void ProcessPool::run(const std::vector<std::size_t>& indices, const Job& job, const Callback& onDone) const {
+  std::vector<Child> running;
+  auto start = [&](std::size_t index) {
+    int pfd[2];
+    // Close-on-exec, so that a command another thread starts meanwhile does not keep the pipe open.
+    if (::pipe2(static_cast<int*>(pfd), O_CLOEXEC) != 0) {
+      throw std::runtime_error(fmt::format("Failed to open pipe: {}", std::strerror(errno)));
+    }
+    const pid_t pid = ::fork();
+    if (pid < 0) {
+      const int error = errno;
+      ::close(pfd[0]);
+      ::close(pfd[1]);
+      throw std::runtime_error(fmt::format("Failed to fork: {}", std::strerror(error)));
+    }
+    if (pid == 0) {
+      ::close(pfd[0]);
+      runChild(pfd[1], mMemoryLimit, job, index);
+    }
+    ::close(pfd[1]);
+    running.push_back({index, pid, pfd[0], "", Clock::now() + std::chrono::seconds(mTimeout.value_or(0))});
+  };
+
+  try {
+    std::size_t next = 0;
+    while (next < indices.size() || !running.empty()) {
+      while (running.size() < mJobs && next < indices.size()) {
+        start(indices[next++]);
+      }
+
+      std::vector<pollfd> fds;
+      fds.reserve(running.size());
+      int waitMs = -1;
+      const auto now = Clock::now();
+      for (const auto& child : running) {
+        fds.push_back({child.fd, POLLIN, 0});
+        if (mTimeout) {
+          const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(child.deadline - now);
+          const int ms = static_cast<int>(std::max<std::chrono::milliseconds::rep>(0, remaining.count()) + 1);
+          waitMs = waitMs < 0 ? ms : std::min(waitMs, ms);
+        }
+      }
+      if (::poll(fds.data(), fds.size(), waitMs) < 0 && errno != EINTR) {
+        throw std::runtime_error(fmt::format("Failed to wait for the workers: {}", std::strerror(errno)));
+      }
+
+      // Backwards, so that removing a child does not move the pollfd of those not checked yet.
+      for (std::size_t i = running.size(); i-- > 0;) {
+        Child& child = running[i];
+        std::optional<Result> result;
+        if (fds[i].revents != 0) {
+          char buf[65536];
+          const ssize_t n = ::read(child.fd, static_cast<char*>(buf), sizeof(buf));
+          if (n > 0) {
+            child.output.append(static_cast<char*>(buf), static_cast<std::size_t>(n));
+          } else if (n == 0 || (errno != EINTR && errno != EAGAIN)) {
+            result = reap(&child, false);
+          }
+        }
+        if (!result && mTimeout && Clock::now() >= child.deadline) {
+          ::kill(child.pid, SIGKILL);
+          result = reap(&child, true);
+        }
+        if (result) {
+          const std::size_t index = child.index;
+          running.erase(running.begin() + static_cast<std::ptrdiff_t>(i));
+          onDone(index, *result);
+        }
+      }
+    }
+  } catch (...) {
+    for (auto& child : running) {
+      ::kill(child.pid, SIGKILL);
+      reap(&child, true);
+    }
+    throw;
+  }
+}
+
+std::optional<std::size_t> ProcessPool::getAvailableMemory(const fs::path& meminfo) {
+  std::ifstream in(meminfo);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::string key;
+    std::size_t kib = 0;
+    if (fields >> key >> kib && key == "MemAvailable:") {
+      return kib * 1024;
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace sentinel
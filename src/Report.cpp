@@ -86,6 +86,17 @@ void Report::printSummary() const {
   Console::out(rowFmt, "TOTAL", flen, mSummary.totNumberOfDetectedMutation, klen, totalSurvived, slen,
                mSummary.totNumberOfMutation, mlen, finalScoreStr, clen);
 
+  // Sampled estimate (--time-budget)
+  if (mSummary.isSampled()) {
+    Console::out("{}", thin);
+    Console::out("  Sampled estimate: {} of {} mutants evaluated within the time budget.", mSummary.results.size(),
+                 mSummary.plannedMutantCount);
+    if (const auto interval = mSummary.getScoreInterval()) {
+      Console::out("  Estimated score: {} (95% CI {:.1f}% - {:.1f}%)", finalScoreStr, interval->first,
+                   interval->second);
+    }
+  }
+
   // Skipped
   std::size_t totalSkipped =
       mSummary.totNumberOfBuildFailure + mSummary.totNumberOfRuntimeError + mSummary.totNumberOfTimeout;
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <filesystem>  // NOLINT
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -48,12 +49,19 @@ bool Result::checkPassedTCEmpty() const {
 }
 
 MutationState Result::compare(const Result& original, const Result& mutated, std::string* killingTest,
-                              std::string* errorTest) {
+                              std::string* errorTest, const std::optional<std::vector<std::string>>& selectedTests) {
   const std::unordered_set<std::string> mutatedPassed(mutated.mPassedTC.begin(), mutated.mPassedTC.end());
   const std::unordered_set<std::string> mutatedFailed(mutated.mFailedTC.begin(), mutated.mFailedTC.end());
+  std::unordered_set<std::string> selected;
+  if (selectedTests) {
+    selected.insert(selectedTests->begin(), selectedTests->end());
+  }
   std::vector<std::string> killingTests;
   std::vector<std::string> errorTests;
   for (const std::string& tc : original.mPassedTC) {
+    if (selectedTests && selected.count(tc) == 0) {
+      continue;
+    }
     if (mutatedPassed.count(tc) == 0) {
       if (mutatedFailed.count(tc) == 0) {
         errorTests.push_back(tc);
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <utility>
+#include <vector>
+#include "sentinel/PartitionPlanner.hpp"
+#include "sentinel/RuntimeEstimator.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+RuntimeEstimator::RuntimeEstimator(double testSeconds, std::map<fs::path, double> rebuildSeconds) :
+    mTestSeconds(testSeconds), mRebuildSeconds(std::move(rebuildSeconds)) {
+  if (!mRebuildSeconds.empty()) {
+    double sum = 0.0;
+    for (const auto& [file, seconds] : mRebuildSeconds) {
+      sum += seconds;
+    }
+    mMeanRebuildSeconds = sum / static_cast<double>(mRebuildSeconds.size());
+  }
+}
+
+double RuntimeEstimator::getRebuildSeconds(const fs::path& file) const {
+  auto it = mRebuildSeconds.find(file);
+  return it != mRebuildSeconds.end() ? it->second : mMeanRebuildSeconds;
+}
+
+double RuntimeEstimator::estimate(const std::vector<fs::path>& files) const {
+  if (files.empty()) {
+    return 0.0;
+  }
+  double total = 0.0;
+  for (const auto& file : files) {
+    total += 2 * getRebuildSeconds(file) + mTestSeconds;
+  }
+  // The original of the last mutant is restored but never rebuilt.
+  return total - getRebuildSeconds(files.back());
+}
+
+std::vector<double> RuntimeEstimator::estimatePartitions(const std::vector<fs::path>& files, std::size_t count,
+                                                         const PartitionPlanner& planner) const {
+  std::vector<double> result;
+  result.reserve(count);
+  for (const auto& positions : planner.plan(files, count)) {
+    std::vector<fs::path> partFiles;
+    partFiles.reserve(positions.size());
+    for (std::size_t pos : positions) {
+      partFiles.push_back(files[pos]);
+    }
+    result.push_back(estimate(partFiles));
+  }
+  return result;
+}
+
+std::vector<fs::path> RuntimeEstimator::selectSamples(const std::vector<fs::path>& files, std::size_t maxSamples) {
+  std::map<fs::path, std::size_t> countByFile;
+  for (const auto& file : files) {
+    countByFile[file]++;
+  }
+  std::vector<std::pair<fs::path, std::size_t>> ranked(countByFile.begin(), countByFile.end());
+  std::stable_sort(ranked.begin(), ranked.end(),
+                   [](const auto& a, const auto& b) { return a.second > b.second; });
+
+  std::vector<fs::path> samples;
+  const std::size_t n = std::min(maxSamples, ranked.size());
+  if (n == 0) {
+    return samples;
+  }
+  samples.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    // Spread picks over the ranking: first, ..., last.
+    const std::size_t pos = n == 1 ? 0 : i * (ranked.size() - 1) / (n - 1);
+    samples.push_back(ranked[pos].first);
+  }
+  return samples;
+}
+
+}  // namespace sentinel
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>  // NOLINT
+#include <set>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+#include "sentinel/Logger.hpp"
+#include "sentinel/SourceWatcher.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+static constexpr uint32_t kFileEvents = IN_CLOSE_WRITE | IN_MOVED_TO;
+static constexpr uint32_t kDirEvents = IN_CREATE | IN_MOVED_TO;
+
+SourceWatcher::SourceWatcher(const fs::path& root, const std::vector<fs::path>& skipDirs) {
+  for (const auto& dir : skipDirs) {
+    std::error_code ec;
+    fs::path canon = fs::weakly_canonical(dir, ec);
+    mSkipDirs.push_back(ec ? dir : canon);
+  }
+  mFd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+  if (mFd < 0) {
+    throw std::runtime_error(fmt::format("Failed to initialize inotify: {}", std::strerror(errno)));
+  }
+  addWatches(fs::canonical(root));
+}
+
+SourceWatcher::~SourceWatcher() {
+  if (mFd >= 0) {
+    close(mFd);
+  }
+}
+
+bool SourceWatcher::isSkipped(const fs::path& dir) const {
+  const std::string name = dir.filename().string();
+  if (!name.empty() && name[0] == '.') {
+    return true;
+  }
+  for (const auto& skip : mSkipDirs) {
+    if (dir == skip) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void SourceWatcher::addWatches(const fs::path& dir) {
+  if (isSkipped(dir)) {
+    return;
+  }
+  int wd = inotify_add_watch(mFd, dir.c_str(), kFileEvents | kDirEvents);
+  if (wd < 0) {
+    if (errno == ENOSPC) {
+      throw std::runtime_error(
+          fmt::format("Too many directories to watch under '{}'.\n"
+                      "       Hint: raise fs.inotify.max_user_watches or exclude build directories.",
+                      dir.string()));
+    }
+    Logger::verbose("Cannot watch '{}': {}", dir.string(), std::strerror(errno));
+    return;
+  }
+  mWatches[wd] = dir;
+  std::error_code ec;
+  for (const auto& entry : fs::directory_iterator(dir, ec)) {
+    if (entry.is_directory(ec) && !entry.is_symlink(ec)) {
+      addWatches(entry.path());
+    }
+  }
+}
+
+bool SourceWatcher::readEvents(int timeoutMs, std::set<fs::path>* changed) {
+  struct pollfd pfd {};
+  pfd.fd = mFd;
+  pfd.events = POLLIN;
+  int ready = poll(&pfd, 1, timeoutMs);
+  if (ready < 0 && errno != EINTR) {
+    throw std::runtime_error(fmt::format("Failed to wait for file changes: {}", std::strerror(errno)));
+  }
+  if (ready <= 0) {
+    return false;
+  }
+
+  alignas(struct inotify_event) char buffer[16 * 1024];
+  bool any = false;
+  while (true) {
+    ssize_t len = read(mFd, buffer, sizeof(buffer));
+    if (len <= 0) {
+      break;
+    }
+    for (char* ptr = buffer; ptr < buffer + len;) {
+      auto* event = reinterpret_cast<struct inotify_event*>(ptr);
+      ptr += sizeof(struct inotify_event) + event->len;
+      auto it = mWatches.find(event->wd);
+      if (it == mWatches.end() || event->len == 0) {
+        continue;
+      }
+      const fs::path path = it->second / event->name;
+      if ((event->mask & IN_ISDIR) != 0) {
+        addWatches(path);
+      } else if ((event->mask & kFileEvents) != 0) {
+        changed->insert(path);
+        any = true;
+      }
+    }
+  }
+  return any;
+}
+
+std::set<fs::path> SourceWatcher::waitForChanges(std::chrono::milliseconds quietPeriod) {
+  std::set<fs::path> changed;
+  while (!readEvents(-1, &changed)) {
+  }
+  while (readEvents(static_cast<int>(quietPeriod.count()), &changed)) {
+  }
+  return changed;
+}
+
+}  // namespace sentinel
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cerrno>
 #include <csignal>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <ftxui/dom/elements.hpp>
@@ -60,6 +61,7 @@ void handleSigwinch(int /*signum*/) {
 StatusLine::StatusLine() = default;
 
 std::string StatusLine::getStatusText() const {
+  std::lock_guard<std::mutex> lock(mMutex);
   return renderToString(buildElement());
 }
 
@@ -143,11 +145,13 @@ void StatusLine::disable() {
 }
 
 void StatusLine::setPhase(Phase phase) {
+  std::lock_guard<std::mutex> lock(mMutex);
   mPhase = phase;
   redraw();
 }
 
 void StatusLine::setProgressTotal(size_t total) {
+  std::lock_guard<std::mutex> lock(mMutex);
   if (mTotal == total) {
     return;
   }
@@ -156,6 +160,7 @@ void StatusLine::setProgressTotal(size_t total) {
 }
 
 void StatusLine::setProgressCurrent(size_t current) {
+  std::lock_guard<std::mutex> lock(mMutex);
   if (mCurrent == current) {
     return;
   }
@@ -164,11 +169,34 @@ void StatusLine::setProgressCurrent(size_t current) {
 }
 
 void StatusLine::setDryRun(bool dryRun) {
+  std::lock_guard<std::mutex> lock(mMutex);
   mDryRun = dryRun;
   redraw();
 }
 
+void StatusLine::setBackgroundProgress(Phase phase, size_t current, size_t total) {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mHasBackground && mBackgroundPhase == phase && mBackgroundCurrent == current && mBackgroundTotal == total) {
+    return;
+  }
+  mHasBackground = true;
+  mBackgroundPhase = phase;
+  mBackgroundCurrent = current;
+  mBackgroundTotal = total;
+  redraw();
+}
+
+void StatusLine::clearBackgroundProgress() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (!mHasBackground) {
+    return;
+  }
+  mHasBackground = false;
+  redraw();
+}
+
 void StatusLine::recordResult(MutationState state, bool uncovered) {
+  std::lock_guard<std::mutex> lock(mMutex);
   switch (state) {
     case MutationState::KILLED:
       mKilled++;
@@ -190,6 +218,17 @@ void StatusLine::recordResult(MutationState state, bool uncovered) {
   }
 }
 
+void StatusLine::resetCounters() {
+  std::lock_guard<std::mutex> lock(mMutex);
+  mCurrent = 0;
+  mTotal = 0;
+  mKilled = 0;
+  mSurvived = 0;
+  mAbnormal = 0;
+  mUncovered = 0;
+  redraw();
+}
+
 void StatusLine::installSignalHandlers() {
   sActiveInstance = this;
   signal::getSigaction(SIGTSTP, &sPrevTstp);
@@ -257,8 +296,8 @@ void StatusLine::redraw() {
   writeTty(fmt::format("\0337\033[{};1H\033[2K{}\0338", mTermRows, rendered));
 }
 
-std::string StatusLine::phaseLabel() const {
-  switch (mPhase) {
+std::string StatusLine::phaseLabel(Phase phase) {
+  switch (phase) {
     case Phase::INIT:
       return "INIT";
     case Phase::BUILD_ORIG:
@@ -329,7 +368,13 @@ ftxui::Element StatusLine::buildElement() const {
     elements.push_back(ftxui::text(" "));
     elements.push_back(ftxui::spinner(kSpinnerCharset, mCurrent));
   }
-  elements.push_back(ftxui::text(fmt::format(" {:<{}}", phaseLabel(), kPhaseLabelWidth)));
+  elements.push_back(ftxui::text(fmt::format(" {:<{}}", phaseLabel(mPhase), kPhaseLabelWidth)));
+  if (mHasBackground) {
+    elements.push_back(ftxui::text(" "));
+    elements.push_back(ftxui::separatorLight());
+    elements.push_back(ftxui::text(fmt::format(" {} [{}/{}]", phaseLabel(mBackgroundPhase),
+                                               mBackgroundCurrent, mBackgroundTotal)));
+  }
   elements.push_back(ftxui::text(" "));
   elements.push_back(ftxui::separatorLight());
   elements.push_back(ftxui::text(" "));
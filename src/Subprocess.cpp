@@ -8,18 +8,23 @@
 #include <unistd.h>
 #include <chrono>
 #include <cerrno>
+#include <cstdio>
 #include <cstring>
 #include <exception>
 #include <filesystem>  // NOLINT
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 #include "sentinel/Console.hpp"
+#include "sentinel/Jobserver.hpp"
 #include "sentinel/Subprocess.hpp"
 #include "sentinel/util/signal.hpp"
+#include "sentinel/util/string.hpp"
 
 namespace sentinel {
 
@@ -38,6 +43,7 @@ static_assert(std::atomic<int>::is_always_lock_free,
 std::atomic<pid_t> Subprocess::childPid{0};
 std::atomic<bool> Subprocess::timedOut{false};
 std::atomic<int> Subprocess::pendSig{0};
+const Jobserver* Subprocess::jobserver = nullptr;
 
 Subprocess::Subprocess(const std::string& cmd, std::size_t sec,
                        const std::filesystem::path& logFile, bool silent) :
@@ -47,19 +53,56 @@ Subprocess::Subprocess(const std::string& cmd, std::size_t sec,
   }
 }
 
+Subprocess::Subprocess(std::function<int()> fn, std::size_t sec, const std::filesystem::path& logFile,
+                       bool silent) :
+    mFunction(std::move(fn)), mSec(sec), mLogFile(logFile), mSilent(silent) {
+  if (Subprocess::childPid != 0) {
+    throw std::runtime_error("Another subprocess is running. (Problem with sentinel logic)");
+  }
+}
+
+void Subprocess::setOutputWatcher(std::function<bool(const std::string& line)> watcher) {
+  mWatcher = std::move(watcher);
+}
+
+void Subprocess::setJobserver(const Jobserver* js) {
+  jobserver = js;
+}
+
 int Subprocess::execute() {
-  // Check for existence of /bin/sh
-  if (access("/bin/sh", X_OK) != 0) {
+  if (mFunction) {
+    // Output still buffered would otherwise be written again by the child.
+    std::cout.flush();
+    std::fflush(nullptr);
+  } else if (access("/bin/sh", X_OK) != 0) {
+    // Check for existence of /bin/sh
     throw std::runtime_error("/bin/sh is not an executable file.");
   }
 
-  if (mCmd.empty()) {
+  if (mCmd.empty() && !mFunction) {
     return -1;
   }
 
+  // The token taken here is the one the command's first job runs on.
+  // The command is prefixed rather than setenv() called after fork(),
+  // which is not async-signal-safe while other threads are running.
+  std::string cmd = mCmd;
+  char token = 0;
+  if (jobserver != nullptr) {
+    token = jobserver->acquire();
+    cmd = fmt::format("MAKEFLAGS={}; export MAKEFLAGS; {}", string::shellQuote(jobserver->getMakeflags()), mCmd);
+  }
+  auto releaseToken = [&token] {
+    if (jobserver != nullptr && token != 0) {
+      jobserver->release(token);
+      token = 0;
+    }
+  };
+
   // Open pipe
   int pfd[2];
   if (pipe(static_cast<int*>(pfd)) != 0) {
+    releaseToken();
     throw std::runtime_error(fmt::format("Failed to open pipe: {}", std::strerror(errno)));
   }
 
@@ -90,7 +133,21 @@ int Subprocess::execute() {
     // New process inherits SIG_IGN, so we need to restore signal handler.
     signal::setMultipleSignalHandlers(usingSignals, SIG_DFL);
 
-    execlp("/bin/sh", "sh", "-c", mCmd.c_str(), nullptr);
+    if (mFunction) {
+      // An exception must not unwind into the parent's code in the child.
+      int code = 1;
+      try {
+        code = mFunction();
+      } catch (const std::exception& e) {
+        Console::err("{}", e.what());
+      } catch (...) {
+        Console::err("Unknown exception in the child process");
+      }
+      std::cout.flush();
+      std::fflush(nullptr);
+      _exit(code);
+    }
+    execlp("/bin/sh", "sh", "-c", cmd.c_str(), nullptr);
     Console::err("Failed to execute command: {}", std::strerror(errno));
     _exit(1);
   } else if (pid > 0) {
@@ -101,6 +158,7 @@ int Subprocess::execute() {
     Subprocess::childPid = pid;
     Subprocess::timedOut = false;
     Subprocess::pendSig = 0;
+    mStoppedByWatcher = false;
 
     int status = 0;
 
@@ -147,6 +205,7 @@ int Subprocess::execute() {
     static constexpr int kMaxBufSize = 4096;
     char buffer[kMaxBufSize];
 
+    std::string partialLine;
     auto consumeOutput = [&](ssize_t nb) {
       if (!mSilent) {
         std::cout << std::string(buffer, nb);
@@ -154,6 +213,19 @@ int Subprocess::execute() {
       if (logStream.is_open()) {
         logStream.write(buffer, nb);
       }
+      if (!mWatcher || mStoppedByWatcher) {
+        return;
+      }
+      partialLine.append(buffer, nb);
+      std::size_t begin = 0;
+      for (std::size_t end; (end = partialLine.find('\n', begin)) != std::string::npos; begin = end + 1) {
+        if (mWatcher(partialLine.substr(begin, end - begin))) {
+          mStoppedByWatcher = true;
+          kill(-pid, SIGKILL);
+          break;
+        }
+      }
+      partialLine.erase(0, begin);
     };
 
     int wret;
@@ -180,6 +252,9 @@ int Subprocess::execute() {
     // Close pipe
     close(pfd[0]);
 
+    // Before a pending signal may end sentinel.
+    releaseToken();
+
     mStatus = status;
     if (Subprocess::timedOut && WIFSIGNALED(status) && (WTERMSIG(status) == SIGKILL || WTERMSIG(status) == SIGTERM)) {
       mTimedOut = true;
@@ -205,6 +280,7 @@ int Subprocess::execute() {
     sc.reset();
     close(pfd[0]);
     close(pfd[1]);
+    releaseToken();
     throw std::runtime_error(fmt::format("Failed to fork '{}': {}", mCmd, std::strerror(errno)));
   }
 }
@@ -231,4 +307,8 @@ bool Subprocess::isSignalExit() const {
   return code >= kSignalExitBase && code <= kSignalExitMax;
 }
 
+bool Subprocess::isStoppedByWatcher() const {
+  return mStoppedByWatcher;
+}
+
 }  // namespace sentinel
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <clang/AST/ASTConsumer.h>
+#include <clang/AST/ASTContext.h>
+#include <clang/AST/DeclCXX.h>
+#include <clang/AST/ExprCXX.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#include <clang/Basic/Diagnostic.h>
+#include <clang/Lex/Lexer.h>
+#include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Tooling/Tooling.h>
+#include <cerrno>
+#include <deque>
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <optional>
+#include <regex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sentinel/TestCallGraph.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/util/string.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Caller of the functions named in the initializers of global variables.
+constexpr const char* kGlobalInitializer = "<global initializer>";
+
+// Name under which Mutant::getQualifiedFunction() knows a function: the
+// template pattern for instantiations, so that they share one node.
+std::string getFunctionName(const clang::FunctionDecl* fd) {
+  if (const clang::FunctionDecl* pattern = fd->getTemplateInstantiationPattern()) {
+    fd = pattern;
+  }
+  return fd->getQualifiedNameAsString();
+}
+
+// Record of a base class, or the pattern of a dependent base (Fixture<T>).
+const clang::CXXRecordDecl* getBaseRecord(const clang::CXXBaseSpecifier& base) {
+  const clang::Type* type = base.getType().getTypePtr();
+  if (const clang::CXXRecordDecl* record = type->getAsCXXRecordDecl()) {
+    return record;
+  }
+  if (const auto* specialization = type->getAs<clang::TemplateSpecializationType>()) {
+    if (const clang::TemplateDecl* decl = specialization->getTemplateName().getAsTemplateDecl()) {
+      return clang::dyn_cast_or_null<clang::CXXRecordDecl>(decl->getTemplatedDecl());
+    }
+  }
+  return nullptr;
+}
+
+// Adds a call from one function to every function its body names.
+class CalleeCollector : public clang::RecursiveASTVisitor<CalleeCollector> {
+ public:
+  CalleeCollector(TestCallGraph* graph, std::string caller) : mGraph(graph), mCaller(std::move(caller)) {
+  }
+
+  bool shouldVisitTemplateInstantiations() const {
+    return true;
+  }
+
+  bool VisitDeclRefExpr(clang::DeclRefExpr* e) {
+    if (const auto* fd = clang::dyn_cast<clang::FunctionDecl>(e->getDecl())) {
+      addCall(fd);
+    }
+    return true;
+  }
+
+  bool VisitMemberExpr(clang::MemberExpr* e) {
+    if (const auto* fd = clang::dyn_cast<clang::FunctionDecl>(e->getMemberDecl())) {
+      addCall(fd);
+    }
+    return true;
+  }
+
+  bool VisitCallExpr(clang::CallExpr* e) {
+    if (const clang::FunctionDecl* fd = e->getDirectCallee()) {
+      addCall(fd);
+    }
+    return true;
+  }
+
+  bool VisitCXXConstructExpr(clang::CXXConstructExpr* e) {
+    addCall(e->getConstructor());
+    addDestructor(e->getConstructor()->getParent());
+    return true;
+  }
+
+  bool VisitCXXDeleteExpr(clang::CXXDeleteExpr* e) {
+    if (const clang::FunctionDecl* fd = e->getOperatorDelete()) {
+      addCall(fd);
+    }
+    addDestructor(e->getDestroyedType()->getAsCXXRecordDecl());
+    return true;
+  }
+
+  bool VisitCXXNewExpr(clang::CXXNewExpr* e) {
+    if (const clang::FunctionDecl* fd = e->getOperatorNew()) {
+      addCall(fd);
+    }
+    return true;
+  }
+
+  bool VisitOverloadExpr(clang::OverloadExpr* e) {
+    // Unresolved calls in templates may end up at any of the candidates.
+    for (const clang::NamedDecl* decl : e->decls()) {
+      decl = decl->getUnderlyingDecl();
+      if (const auto* ftd = clang::dyn_cast<clang::FunctionTemplateDecl>(decl)) {
+        decl = ftd->getTemplatedDecl();
+      }
+      if (const auto* fd = clang::dyn_cast<clang::FunctionDecl>(decl)) {
+        addCall(fd);
+      }
+    }
+    mGraph->addCallByName(mCaller, e->getName().getAsString());
+    return true;
+  }
+
+  bool VisitCXXDependentScopeMemberExpr(clang::CXXDependentScopeMemberExpr* e) {
+    mGraph->addCallByName(mCaller, e->getMember().getAsString());
+    return true;
+  }
+
+  bool VisitDependentScopeDeclRefExpr(clang::DependentScopeDeclRefExpr* e) {
+    mGraph->addCallByName(mCaller, e->getDeclName().getAsString());
+    return true;
+  }
+
+  bool VisitLambdaExpr(clang::LambdaExpr* e) {
+    addCall(e->getCallOperator());
+    return true;
+  }
+
+  bool VisitCXXDefaultArgExpr(clang::CXXDefaultArgExpr* e) {
+    TraverseStmt(e->getExpr());
+    return true;
+  }
+
+  bool VisitCXXDefaultInitExpr(clang::CXXDefaultInitExpr* e) {
+    TraverseStmt(e->getExpr());
+    return true;
+  }
+
+  void addDestructor(const clang::CXXRecordDecl* record) {
+    if (record != nullptr && record->hasDefinition()) {
+      if (const clang::CXXDestructorDecl* dtor = record->getDefinition()->getDestructor()) {
+        addCall(dtor);
+      }
+    }
+  }
+
+ private:
+  void addCall(const clang::FunctionDecl* fd) {
+    mGraph->addCall(mCaller, getFunctionName(fd));
+  }
+
+  TestCallGraph* mGraph;
+  std::string mCaller;
+};
+
+class GraphVisitor : public clang::RecursiveASTVisitor<GraphVisitor> {
+ public:
+  GraphVisitor(clang::ASTContext* context, TestCallGraph* graph, std::set<std::string>* seen) :
+      mContext(context), mSrcMgr(context->getSourceManager()), mGraph(graph), mSeen(seen) {
+  }
+
+  bool shouldVisitTemplateInstantiations() const {
+    return true;
+  }
+
+  bool shouldVisitImplicitCode() const {
+    return true;
+  }
+
+  bool VisitFunctionDecl(clang::FunctionDecl* fd) {
+    if (!fd->doesThisDeclarationHaveABody() || isSeen(fd)) {
+      return true;
+    }
+    const std::string name = getFunctionName(fd);
+    mGraph->addDefinition(name);
+    CalleeCollector collector(mGraph, name);
+    collector.TraverseStmt(fd->getBody());
+    if (const auto* ctor = clang::dyn_cast<clang::CXXConstructorDecl>(fd)) {
+      for (const clang::CXXCtorInitializer* init : ctor->inits()) {
+        collector.TraverseStmt(init->getInit());
+      }
+    }
+    if (const auto* dtor = clang::dyn_cast<clang::CXXDestructorDecl>(fd)) {
+      const clang::CXXRecordDecl* record = dtor->getParent();
+      for (const clang::CXXBaseSpecifier& base : record->bases()) {
+        collector.addDestructor(getBaseRecord(base));
+      }
+      for (const clang::FieldDecl* field : record->fields()) {
+        collector.addDestructor(field->getType()->getAsCXXRecordDecl());
+      }
+    }
+    if (fd->isMain()) {
+      mGraph->addRoot(name, "");
+    }
+    const auto* md = clang::dyn_cast<clang::CXXMethodDecl>(fd);
+    if (md != nullptr && md->getNameAsString() == "TestBody") {
+      addTest(md, name);
+    }
+    return true;
+  }
+
+  bool VisitCXXMethodDecl(clang::CXXMethodDecl* md) {
+    // A call to a virtual function may end up at any of its overriders. The
+    // virtual functions of Google Test (SetUp, TestBody, ...) are called by the
+    // test runner, which addTest() models for each test.
+    for (const clang::CXXMethodDecl* overridden : md->overridden_methods()) {
+      const std::string name = getFunctionName(overridden);
+      if (!string::startsWith(name, "testing::")) {
+        mGraph->addCall(name, getFunctionName(md));
+      }
+    }
+    return true;
+  }
+
+  bool VisitVarDecl(clang::VarDecl* vd) {
+    if (vd->hasGlobalStorage() && !vd->isStaticLocal() && vd->hasInit() && !clang::isa<clang::ParmVarDecl>(vd) &&
+        !isSeen(vd)) {
+      CalleeCollector collector(mGraph, kGlobalInitializer);
+      collector.TraverseStmt(vd->getInit());
+      mGraph->addRoot(kGlobalInitializer, "");
+    }
+    return true;
+  }
+
+ private:
+  // Declarations in headers are visited once for all translation units.
+  // Templates are visited every time, since each file may instantiate them differently.
+  bool isSeen(const clang::Decl* decl) {
+    if (decl->isTemplated() || decl->getDeclContext()->isDependentContext()) {
+      return false;
+    }
+    if (const auto* fd = clang::dyn_cast<clang::FunctionDecl>(decl)) {
+      if (fd->getTemplateInstantiationPattern() != nullptr) {
+        return false;
+      }
+    }
+    const clang::PresumedLoc loc = mSrcMgr.getPresumedLoc(mSrcMgr.getExpansionLoc(decl->getLocation()));
+    if (loc.isInvalid()) {
+      return false;
+    }
+    return !mSeen->insert(std::string(loc.getFilename()) + ':' + std::to_string(loc.getLine()) + ':' +
+                          std::to_string(loc.getColumn()) + ':' + decl->getDeclKindName()).second;
+  }
+
+  // TEST(Suite, Name) and TEST_F(Suite, Name) are named tests; the body of any
+  // other kind of test is a root of unknown tests.
+  void addTest(const clang::CXXMethodDecl* md, const std::string& name) {
+    static const std::regex kTestMacro(R"(^\s*(TEST|TEST_F|GTEST_TEST)\s*\(\s*(\w+)\s*,\s*(\w+)\s*\)\s*$)");
+    std::string test;
+    const clang::SourceLocation loc = md->getLocation();
+    if (loc.isMacroID()) {
+      const std::string text = clang::Lexer::getSourceText(mSrcMgr.getExpansionRange(loc), mSrcMgr,
+                                                           mContext->getLangOpts()).str();
+      std::smatch match;
+      if (std::regex_match(text, match, kTestMacro)) {
+        test = match[2].str() + '.' + match[3].str();
+      }
+    }
+    mGraph->addRoot(name, test);
+    // The fixture's constructor, SetUp(), TearDown(), ... run along with the
+    // body. Derived classes are visited first, so that a virtual function
+    // overridden by the test's class is left out.
+    std::set<const clang::CXXRecordDecl*> visited;
+    std::set<const clang::CXXMethodDecl*> overridden;
+    std::deque<const clang::CXXRecordDecl*> records = {md->getParent()};
+    while (!records.empty()) {
+      const clang::CXXRecordDecl* record = records.front();
+      records.pop_front();
+      if (record == nullptr || !record->hasDefinition() || !visited.insert(record->getDefinition()).second) {
+        continue;
+      }
+      record = record->getDefinition();
+      for (const clang::CXXMethodDecl* method : record->methods()) {
+        if (overridden.count(method->getCanonicalDecl()) == 0) {
+          if (method != md) {
+            mGraph->addCall(name, getFunctionName(method));
+          }
+          for (const clang::CXXMethodDecl* base : method->overridden_methods()) {
+            overridden.insert(base->getCanonicalDecl());
+          }
+        }
+      }
+      for (const clang::CXXBaseSpecifier& base : record->bases()) {
+        records.push_back(getBaseRecord(base));
+      }
+    }
+  }
+
+  clang::ASTContext* mContext;
+  clang::SourceManager& mSrcMgr;
+  TestCallGraph* mGraph;
+  std::set<std::string>* mSeen;
+};
+
+struct ParseState {
+  TestCallGraph* graph;
+  std::set<std::string> seen;
+  std::set<std::string> parsed;
+  std::set<std::string> failed;
+};
+
+class GraphConsumer : public clang::ASTConsumer {
+ public:
+  explicit GraphConsumer(ParseState* state) : mState(state) {
+  }
+
+  void HandleTranslationUnit(clang::ASTContext& context) override {
+    const clang::SourceManager& srcMgr = context.getSourceManager();
+    const clang::FileEntry* entry = srcMgr.getFileEntryForID(srcMgr.getMainFileID());
+    const std::string file = entry != nullptr ? fs::path(entry->getName().str()).lexically_normal().string() : "";
+    mState->parsed.insert(file);
+    if (context.getDiagnostics().hasErrorOccurred()) {
+      mState->failed.insert(file);
+    }
+    GraphVisitor visitor(&context, mState->graph, &mState->seen);
+    visitor.TraverseDecl(context.getTranslationUnitDecl());
+  }
+
+ private:
+  ParseState* mState;
+};
+
+class GraphConsumerFactory {
+ public:
+  explicit GraphConsumerFactory(ParseState* state) : mState(state) {
+  }
+
+  std::unique_ptr<clang::ASTConsumer> newASTConsumer() {
+    return std::make_unique<GraphConsumer>(mState);
+  }
+
+ private:
+  ParseState* mState;
+};
+
+}  // namespace
+
+TestCallGraph::TestCallGraph(const fs::path& compileDbDir) {
+  std::string errorMsg;
+  std::unique_ptr<clang::tooling::CompilationDatabase> compileDb =
+      clang::tooling::CompilationDatabase::loadFromDirectory(compileDbDir.string(), errorMsg);
+  if (compileDb == nullptr) {
+    throw IOException(EINVAL, errorMsg);
+  }
+  const std::vector<std::string> files = compileDb->getAllFiles();
+  ParseState state{this, {}, {}, {}};
+  GraphConsumerFactory consumerFactory(&state);
+  auto actionFactory = clang::tooling::newFrontendActionFactory(&consumerFactory);
+  clang::IgnoringDiagConsumer ignoring;
+  clang::tooling::ClangTool tool(*compileDb, files);
+  tool.setDiagnosticConsumer(&ignoring);
+  tool.run(actionFactory.get());
+
+  mFileCount = files.size();
+  for (const auto& file : files) {
+    const std::string normal = fs::path(file).lexically_normal().string();
+    if (state.parsed.count(normal) == 0 || state.failed.count(normal) != 0) {
+      mFailedFiles.push_back(file);
+    }
+  }
+}
+
+const std::set<std::string>& TestCallGraph::getTests() const {
+  return mTests;
+}
+
+std::size_t TestCallGraph::getFileCount() const {
+  return mFileCount;
+}
+
+const std::vector<std::string>& TestCallGraph::getFailedFiles() const {
+  return mFailedFiles;
+}
+
+std::optional<std::vector<std::string>> TestCallGraph::getReachingTests(const std::string& function) {
+  if (function.empty() || !mFailedFiles.empty() || mDefined.count(function) == 0) {
+    return std::nullopt;
+  }
+  if (const auto it = mReachingTests.find(function); it != mReachingTests.end()) {
+    return it->second;
+  }
+
+  std::set<std::string> tests;
+  std::set<std::string> visited = {function};
+  std::deque<std::string> pending = {function};
+  auto visit = [&](const std::set<std::string>& callers) {
+    for (const auto& caller : callers) {
+      if (visited.insert(caller).second) {
+        pending.push_back(caller);
+      }
+    }
+  };
+  while (!pending.empty()) {
+    const std::string node = pending.front();
+    pending.pop_front();
+    if (const auto root = mRoots.find(node); root != mRoots.end()) {
+      if (root->second.count("") != 0) {
+        return mReachingTests[function] = std::nullopt;
+      }
+      tests.insert(root->second.begin(), root->second.end());
+    }
+    if (const auto callers = mCallers.find(node); callers != mCallers.end()) {
+      visit(callers->second);
+    }
+    const std::size_t colon = node.rfind("::");
+    const std::string unqualified = colon == std::string::npos ? node : node.substr(colon + 2);
+    if (const auto callers = mCallersByName.find(unqualified); callers != mCallersByName.end()) {
+      visit(callers->second);
+    }
+  }
+  return mReachingTests[function] = std::vector<std::string>(tests.begin(), tests.end());
+}
+
+void TestCallGraph::addCall(const std::string& caller, const std::string& callee) {
+  if (caller != callee) {
+    mCallers[callee].insert(caller);
+  }
+}
+
+void TestCallGraph::addCallByName(const std::string& caller, const std::string& name) {
+  mCallersByName[name].insert(caller);
+}
+
+void TestCallGraph::addDefinition(const std::string& function) {
+  mDefined.insert(function);
+}
+
+void TestCallGraph::addRoot(const std::string& function, const std::string& test) {
+  mRoots[function].insert(test);
+  if (!test.empty()) {
+    mTests.insert(test);
+  }
+}
+
+}  // namespace sentinel
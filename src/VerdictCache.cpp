@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "sentinel/Logger.hpp"
+#include "sentinel/VerdictCache.hpp"
+#include "sentinel/util/io.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+/// Bump when the key or entry format changes so that old entries are no longer matched.
+static constexpr const char* kKeyVersion = "sentinel-verdict-1";
+
+VerdictCache::VerdictCache(const Config& config, const std::vector<fs::path>& contextFiles) :
+    mDir(config.cacheDir), mSourceRoot(config.sourceDir) {
+  std::ostringstream context;
+  context << kKeyVersion << '\n' << config.buildCmd << '\n' << config.testCmd << '\n';
+  // Without scopes the context stays as it was, so existing verdicts remain valid.
+  for (const auto& scope : config.scopes) {
+    context << "scope " << scope.path << '\n' << scope.buildCmd << '\n' << scope.testCmd << '\n';
+  }
+  // A mutant run against a selection of the tests may survive where the whole suite kills it.
+  if (config.staticTestSelection && config.lcovTracefiles.empty()) {
+    context << "static-test-selection\n";
+  }
+  for (const auto& file : contextFiles) {
+    context << file.lexically_relative(mSourceRoot).string() << ' ' << io::hashFile(file) << '\n';
+  }
+  mContextHash = io::hashContent(context.str());
+}
+
+fs::path VerdictCache::entryPath(const Mutant& m) {
+  auto [it, inserted] = mFileHashes.emplace(m.getPath(), std::string{});
+  if (inserted) {
+    it->second = io::hashFile(mSourceRoot / m.getPath());
+  }
+  if (it->second.empty()) {
+    return {};
+  }
+  std::ostringstream key;
+  key << mContextHash << '\n' << it->second << '\n' << m;
+  const std::string hash = io::hashContent(key.str());
+  return mDir / hash.substr(0, 2) / hash.substr(2);
+}
+
+std::optional<MutationResult> VerdictCache::find(const Mutant& m) {
+  const fs::path path = entryPath(m);
+  if (path.empty()) {
+    return std::nullopt;
+  }
+  std::ifstream in(path);
+  MutationResult cached;
+  if (!in || !(in >> cached) || !(cached.getMutant() == m)) {
+    return std::nullopt;
+  }
+  cached.setCached(true);
+  return cached;
+}
+
+void VerdictCache::store(const MutationResult& result) {
+  const fs::path path = entryPath(result.getMutant());
+  if (path.empty()) {
+    return;
+  }
+  MutationResult entry = result;
+  entry.setCached(false);
+  std::ostringstream out;
+  out << entry;
+  try {
+    io::writeFileAtomically(path, out.str());
+  } catch (const fs::filesystem_error& e) {
+    Logger::verbose("Failed to store verdict cache entry: {}", e.what());
+  }
+}
+
+}  // namespace sentinel
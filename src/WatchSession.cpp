@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <fmt/ranges.h>
+#include <exception>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#include "sentinel/Logger.hpp"
+#include "sentinel/MutationFactory.hpp"
+#include "sentinel/SourceWatcher.hpp"
+#include "sentinel/WatchSession.hpp"
+#include "sentinel/exceptions/ThresholdError.hpp"
+#include "sentinel/stages/EvaluationStage.hpp"
+#include "sentinel/stages/OriginalBuildStage.hpp"
+#include "sentinel/stages/OriginalTestStage.hpp"
+#include "sentinel/stages/ReportStage.hpp"
+#include "sentinel/util/diff.hpp"
+#include "sentinel/util/formatter.hpp"
+#include "sentinel/util/io.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+static bool readLines(const fs::path& path, std::vector<std::string>* lines) {
+  std::ifstream in(path);
+  if (!in) {
+    return false;
+  }
+  lines->clear();
+  std::string line;
+  while (std::getline(in, line)) {
+    lines->push_back(line);
+  }
+  return true;
+}
+
+WatchSession::WatchSession(std::shared_ptr<GitRepository> repo, std::shared_ptr<MutantGenerator> generator) :
+    mRepo(std::move(repo)), mGenerator(std::move(generator)) {
+}
+
+void WatchSession::takeSnapshot(const fs::path& root, const std::vector<fs::path>& skipDirs, const Config& config) {
+  mSnapshot.clear();
+  for (const auto& path : io::listSourceFiles(root, skipDirs, config.extensions)) {
+    readLines(path, &mSnapshot[path]);
+  }
+}
+
+void WatchSession::run(PipelineContext* ctx) {
+  const Config& config = ctx->config;
+  mRoot = fs::canonical(config.sourceDir);
+
+  // Build trees below the source directory produce files of their own;
+  // skipping the root itself (in-source build) would watch nothing.
+  std::vector<fs::path> skipDirs;
+  for (const auto& dir : {ctx->workspace.getRoot(), config.compileDbDir, config.testResultDir,
+                          config.outputDir}) {
+    std::error_code ec;
+    fs::path canon = fs::weakly_canonical(dir, ec);
+    if (!dir.empty() && !ec && canon != mRoot) {
+      skipDirs.push_back(canon);
+    }
+  }
+
+  SourceWatcher watcher(mRoot, skipDirs);
+  takeSnapshot(mRoot, skipDirs, config);
+
+  while (true) {
+    Logger::info("Watching '{}' for changes. Press Ctrl+C to stop.", mRoot);
+    runCycle(watcher.waitForChanges(kQuietPeriod), ctx);
+  }
+}
+
+void WatchSession::runCycle(const std::set<fs::path>& changed, PipelineContext* ctx) {
+  const Config& config = ctx->config;
+  Workspace& workspace = ctx->workspace;
+
+  std::vector<fs::path> edited;
+  SourceLines editedLines;
+  std::size_t removed = 0;
+  bool resetResults = false;
+  for (const auto& path : changed) {
+    if (!io::isSourceFile(path, config.extensions)) {
+      continue;
+    }
+    std::vector<std::string> after;
+    if (!readLines(path, &after)) {
+      continue;
+    }
+    std::vector<std::string>& before = mSnapshot[path];
+    if (before == after) {
+      continue;
+    }
+    const diff::LineChanges changes = diff::compareLines(before, after);
+    before = std::move(after);
+
+    const fs::path relPath = path.lexically_relative(mRoot);
+    edited.push_back(relPath);
+    if (mRepo->isTargetPath(path)) {
+      removed += workspace.relocateMutants(relPath, changes.lineMap);
+      for (std::size_t line : changes.changedLines) {
+        editedLines.emplace_back(path, line);
+      }
+    } else {
+      resetResults = true;
+    }
+  }
+  if (edited.empty()) {
+    return;
+  }
+  Logger::info("Changed: {}", fmt::join(edited, ", "));
+
+  try {
+    if (!editedLines.empty()) {
+      mGenerator->setOperators(config.operators);
+      mGenerator->setWorkerLimits(config.generationMemoryLimit, config.generationTimeout);
+      mGenerator->setCandidateCacheDir(config.candidateCacheDir);
+      mGenerator->setProgressCallback(nullptr);
+      MutationFactory factory(mGenerator);
+      // --limit applies to the initial run only; every edited line gets its mutants.
+      const unsigned int seed = workspace.loadStatus().seed.value_or(0);
+      Mutants mutants = factory.generate(config.sourceDir, editedLines, 0, seed, config.mutantsPerLine);
+      int id = workspace.getNextMutantId();
+      if (id - 1 + static_cast<int>(mutants.size()) > Workspace::kMaxMutantCount) {
+        throw std::runtime_error(
+            fmt::format("Too many mutants: more than {} in the workspace. Restart with --clean.",
+                        Workspace::kMaxMutantCount));
+      }
+      for (const auto& m : mutants) {
+        workspace.createMutant(id++, m);
+      }
+      for (const auto& [path, reason] : mGenerator->getSkippedFiles()) {
+        Logger::warn("No mutants were generated for {}: {}", path.string(), reason);
+      }
+      Logger::info("{} mutant{} removed, {} generated for {} edited line{}.", removed, removed == 1 ? "" : "s",
+                   mutants.size(), editedLines.size(), editedLines.size() == 1 ? "" : "s");
+    } else if (removed > 0) {
+      Logger::info("{} mutant{} removed.", removed, removed == 1 ? "" : "s");
+    }
+
+    // The build always catches up with the edits (incrementally); the original
+    // test only runs again when the baseline results may have changed.
+    fs::remove(workspace.getOriginalBuildLog());
+    if (resetResults) {
+      Logger::info("Non-target sources changed; all mutants will be evaluated again.");
+      workspace.clearResults();
+      fs::remove(workspace.getOriginalTestLog());
+    } else {
+      workspace.clearComplete();
+    }
+
+    auto originalBuild = std::make_shared<OriginalBuildStage>();
+    originalBuild->setNext(std::make_shared<OriginalTestStage>())
+        ->setNext(std::make_shared<EvaluationStage>(mRepo))
+        ->setNext(std::make_shared<ReportStage>());
+    ctx->statusLine.resetCounters();
+    ctx->statusLine.enable();
+    originalBuild->run(ctx);
+  } catch (const ThresholdError&) {
+    // Already reported; keep watching.
+  } catch (const std::exception& e) {
+    Logger::error("{}", e.what());
+  }
+}
+
+}  // namespace sentinel
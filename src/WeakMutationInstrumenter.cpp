@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <clang/AST/ASTConsumer.h>
+#include <clang/AST/ASTContext.h>
+#if LLVM_VERSION_MAJOR >= 11
+#include <clang/AST/ParentMapContext.h>
+#endif
+#include <clang/AST/Expr.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#include <clang/Basic/Diagnostic.h>
+#include <clang/Lex/Lexer.h>
+#include <clang/Rewrite/Core/Rewriter.h>
+#include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Tooling/Tooling.h>
+#include <fmt/core.h>
+#include <cerrno>
+#include <filesystem>  // NOLINT
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "sentinel/WeakMutationInstrumenter.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Operators whose original and mutated values can be computed side by side.
+// Logical operators are left out: evaluating both operands would defeat short-circuiting.
+const std::set<std::string> kProbedOperators = {"+", "-", "*", "/", "%", "&", "|", "^", "<<", ">>",
+                                                "<", "<=", ">", ">=", "==", "!="};
+
+// Operators that do not compile with a floating-point operand.
+const std::set<std::string> kIntegerOperators = {"%", "&", "|", "^", "<<", ">>"};
+
+struct Site {
+  int id;
+  std::string token;
+};
+
+// first line, first column, last line, last column, as recorded by MutationOperator::emitMutant().
+using Position = std::tuple<std::size_t, std::size_t, std::size_t, std::size_t>;
+using SiteMap = std::map<Position, std::vector<Site>>;
+
+class ProbeVisitor : public clang::RecursiveASTVisitor<ProbeVisitor> {
+ public:
+  ProbeVisitor(clang::ASTContext* context, clang::Rewriter* rewriter, const SiteMap& sites, std::string suffix,
+               std::set<int>* probed) :
+      mContext(context), mSrcMgr(context->getSourceManager()), mRewriter(rewriter), mSites(sites),
+      mSuffix(std::move(suffix)), mProbed(probed) {
+  }
+
+  // Parents are visited before their operands, so a probe wrapping another
+  // probe inserts its opening text first.
+  bool VisitBinaryOperator(clang::BinaryOperator* bo) {
+    const std::string op{bo->getOpcodeStr()};
+    if (kProbedOperators.count(op) == 0 || !isProbeable(bo)) {
+      return true;
+    }
+    const clang::SourceLocation opLoc = bo->getOperatorLoc();
+    const clang::SourceLocation exprEnd =
+        clang::Lexer::getLocForEndOfToken(bo->getEndLoc(), 0, mSrcMgr, mContext->getLangOpts());
+
+    const bool isFloating = bo->getLHS()->IgnoreImpCasts()->getType()->isRealFloatingType() ||
+                            bo->getRHS()->IgnoreImpCasts()->getType()->isRealFloatingType();
+    std::vector<Site> sites;
+    auto collect = [&](clang::SourceLocation begin, clang::SourceLocation end, bool wholeExpression) {
+      auto it = mSites.find(getPosition(begin, end));
+      if (it == mSites.end()) {
+        return;
+      }
+      for (const auto& site : it->second) {
+        const bool isConstant = site.token == "1" || site.token == "0";
+        if (isFloating && kIntegerOperators.count(site.token) != 0) {
+          continue;
+        }
+        if (wholeExpression ? isConstant && bo->isComparisonOp() : !isConstant) {
+          sites.push_back(site);
+        }
+      }
+    };
+    collect(opLoc, opLoc.getLocWithOffset(static_cast<int>(op.size())), false);
+    collect(bo->getBeginLoc(), exprEnd, true);
+    if (sites.empty()) {
+      return true;
+    }
+
+    std::string probe = fmt::format(
+        "[](auto sentinel_l, auto sentinel_r) {{ const auto sentinel_o = sentinel_l {} sentinel_r; ", op);
+    for (const auto& site : sites) {
+      probe += fmt::format("if ({}) {{ sentinel_weak_hit_{}({}, {}); }} ", getDivergence(site.token), mSuffix,
+                           mProbeCount++, site.id);
+      mProbed->insert(site.id);
+    }
+    probe += "return sentinel_o; }(";
+    mRewriter->InsertTextAfter(bo->getBeginLoc(), probe);
+    mRewriter->ReplaceText(opLoc, op.size(), ",");
+    mRewriter->InsertTextAfterToken(bo->getEndLoc(), ")");
+    return true;
+  }
+
+  std::size_t getProbeCount() const {
+    return mProbeCount;
+  }
+
+ private:
+  Position getPosition(clang::SourceLocation begin, clang::SourceLocation end) const {
+    return {mSrcMgr.getExpansionLineNumber(begin), mSrcMgr.getExpansionColumnNumber(begin),
+            mSrcMgr.getExpansionLineNumber(end), mSrcMgr.getExpansionColumnNumber(end)};
+  }
+
+  std::string getDivergence(const std::string& token) const {
+    if (token == "1") {
+      return "!static_cast<bool>(sentinel_o)";
+    }
+    if (token == "0") {
+      return "static_cast<bool>(sentinel_o)";
+    }
+    const std::string differs = fmt::format("(sentinel_l {} sentinel_r) != sentinel_o", token);
+    if (token == "/" || token == "%") {
+      return fmt::format("sentinel_weak_unsafe_divisor_{}(sentinel_r) || {}", mSuffix, differs);
+    }
+    if (token == "<<" || token == ">>") {
+      return fmt::format("sentinel_weak_unsafe_shift_{}(sentinel_l, sentinel_r) || {}", mSuffix, differs);
+    }
+    return differs;
+  }
+
+  bool isProbeable(clang::BinaryOperator* bo) const {
+    if (bo->isTypeDependent() || bo->isValueDependent()) {
+      return false;
+    }
+    const clang::FileID mainFile = mSrcMgr.getMainFileID();
+    for (clang::SourceLocation loc : {bo->getBeginLoc(), bo->getOperatorLoc(), bo->getEndLoc()}) {
+      if (loc.isInvalid() || loc.isMacroID() || mSrcMgr.getFileID(loc) != mainFile) {
+        return false;
+      }
+    }
+    auto isArithmetic = [](const clang::Expr* e) {
+      const clang::QualType type = e->IgnoreImpCasts()->getType().getCanonicalType();
+      return type->isIntegralOrUnscopedEnumerationType() || type->isRealFloatingType();
+    };
+    if (!isArithmetic(bo->getLHS()) || !isArithmetic(bo->getRHS())) {
+      return false;
+    }
+    // Constant expressions may appear where a lambda may not (case labels, array bounds).
+    if (bo->isEvaluatable(*mContext)) {
+      return false;
+    }
+    return !isInConstantContext(bo);
+  }
+
+  bool isInConstantContext(const clang::Stmt* s) const {
+    auto parents = mContext->getParents(*s);
+    while (!parents.empty()) {
+      if (const auto* stmt = parents[0].get<clang::Stmt>()) {
+        if (clang::isa<clang::UnaryExprOrTypeTraitExpr>(stmt) || clang::isa<clang::CXXNoexceptExpr>(stmt) ||
+            clang::isa<clang::CXXTypeidExpr>(stmt) || clang::isa<clang::ConstantExpr>(stmt)) {
+          return true;
+        }
+        parents = mContext->getParents(*stmt);
+      } else if (const auto* decl = parents[0].get<clang::Decl>()) {
+        if (const auto* fd = clang::dyn_cast<clang::FunctionDecl>(decl)) {
+          return fd->isConstexpr();
+        }
+        if (const auto* vd = clang::dyn_cast<clang::VarDecl>(decl)) {
+          if (vd->isConstexpr()) {
+            return true;
+          }
+        }
+        if (clang::isa<clang::FieldDecl>(decl) || clang::isa<clang::EnumConstantDecl>(decl) ||
+            clang::isa<clang::StaticAssertDecl>(decl) || clang::isa<clang::NonTypeTemplateParmDecl>(decl)) {
+          return true;
+        }
+        parents = mContext->getParents(*decl);
+      } else {
+        // Type locations: decltype, array bounds, template arguments.
+        return true;
+      }
+    }
+    return false;
+  }
+
+  clang::ASTContext* mContext;
+  clang::SourceManager& mSrcMgr;
+  clang::Rewriter* mRewriter;
+  const SiteMap& mSites;
+  std::string mSuffix;
+  std::set<int>* mProbed;
+  std::size_t mProbeCount = 0;
+};
+
+// Declarations placed in front of the file. The #line directive keeps the
+// line numbers of the original, so diagnostics and __LINE__ are unchanged.
+std::string getPrologue(const std::string& suffix) {
+  return fmt::format(
+      "#ifndef SENTINEL_WEAK_DECLARED_{0}\n"
+      "#define SENTINEL_WEAK_DECLARED_{0}\n"
+      "extern \"C++\" {{ namespace {{\n"
+      "void sentinel_weak_hit_{0}(int probe, int id);\n"
+      "template <typename T> bool sentinel_weak_unsafe_divisor_{0}(const T& r) {{\n"
+      "  return r == T(0) || r == T(-1);\n"
+      "}}\n"
+      "template <typename L, typename R> bool sentinel_weak_unsafe_shift_{0}(const L& l, const R& r) {{\n"
+      "  return r < R(0) || r >= R((sizeof(L) < sizeof(int) ? sizeof(int) : sizeof(L)) * 8) || l < L(0);\n"
+      "}}\n"
+      "}} }}\n"
+      "#endif\n"
+      "#line 1\n",
+      suffix);
+}
+
+// Spells @p text as a C string literal. Quotes, backslashes, question marks
+// (trigraphs) and bytes outside printable ASCII become octal escapes.
+std::string toStringLiteral(const std::string& text) {
+  std::string literal = "\"";
+  for (const unsigned char c : text) {
+    if (c == '"' || c == '\\' || c == '?' || c < 0x20 || c >= 0x7f) {
+      literal += fmt::format("\\{:03o}", c);
+    } else {
+      literal += static_cast<char>(c);
+    }
+  }
+  return literal + "\"";
+}
+
+// The recorder is defined after the original code, so the standard headers it
+// needs cannot change how the file itself is compiled. The static object
+// records that the file's probes were loaded, which tells a file whose mutants
+// were never infected from one whose code never ran instrumented.
+std::string getEpilogue(const std::string& suffix, std::size_t probeCount, const fs::path& path) {
+  return fmt::format(
+      "\n"
+      "#ifndef SENTINEL_WEAK_DEFINED_{0}\n"
+      "#define SENTINEL_WEAK_DEFINED_{0}\n"
+      "#include <cstdio>\n"
+      "#include <cstdlib>\n"
+      "extern \"C++\" {{ namespace {{\n"
+      "void sentinel_weak_hit_{0}(int probe, int id) {{\n"
+      "  static bool seen[{1}] = {{}};\n"
+      "  if (seen[probe]) {{\n"
+      "    return;\n"
+      "  }}\n"
+      "  seen[probe] = true;\n"
+      "  if (const char* path = std::getenv(\"{2}\")) {{\n"
+      "    if (std::FILE* out = std::fopen(path, \"a\")) {{\n"
+      "      std::fprintf(out, \"%d\\n\", id);\n"
+      "      std::fclose(out);\n"
+      "    }}\n"
+      "  }}\n"
+      "}}\n"
+      "struct sentinel_weak_loaded_{0} {{\n"
+      "  sentinel_weak_loaded_{0}() {{\n"
+      "    if (const char* path = std::getenv(\"{2}\")) {{\n"
+      "      if (std::FILE* out = std::fopen(path, \"a\")) {{\n"
+      "        std::fputs({3}, out);\n"
+      "        std::fclose(out);\n"
+      "      }}\n"
+      "    }}\n"
+      "  }}\n"
+      "}} sentinel_weak_loaded_instance_{0};\n"
+      "}} }}\n"
+      "#endif\n",
+      suffix, probeCount, WeakMutationInstrumenter::kRecordEnv,
+      toStringLiteral(fmt::format("{}{}\n", WeakMutationInstrumenter::kLoadedMarker, path.string())));
+}
+
+class ProbeConsumer : public clang::ASTConsumer {
+ public:
+  ProbeConsumer(const SiteMap& sites, fs::path path, std::string suffix, std::set<int>* probed,
+                std::string* output) :
+      mSites(sites), mPath(std::move(path)), mSuffix(std::move(suffix)), mProbed(probed), mOutput(output) {
+  }
+
+  void HandleTranslationUnit(clang::ASTContext& context) override {
+    // A file with several compile commands is instrumented for the first one.
+    if (!mOutput->empty() || context.getDiagnostics().hasErrorOccurred() || !context.getLangOpts().CPlusPlus14) {
+      return;
+    }
+    clang::SourceManager& srcMgr = context.getSourceManager();
+    clang::Rewriter rewriter(srcMgr, context.getLangOpts());
+    std::set<int> probed;
+    ProbeVisitor visitor(&context, &rewriter, mSites, mSuffix, &probed);
+    visitor.TraverseDecl(context.getTranslationUnitDecl());
+    if (visitor.getProbeCount() == 0) {
+      return;
+    }
+    const clang::FileID mainFile = srcMgr.getMainFileID();
+    rewriter.InsertTextBefore(srcMgr.getLocForStartOfFile(mainFile), getPrologue(mSuffix));
+    rewriter.InsertTextAfter(srcMgr.getLocForEndOfFile(mainFile),
+                             getEpilogue(mSuffix, visitor.getProbeCount(), mPath));
+    const clang::RewriteBuffer* buffer = rewriter.getRewriteBufferFor(mainFile);
+    if (buffer == nullptr) {
+      return;
+    }
+    *mOutput = std::string(buffer->begin(), buffer->end());
+    mProbed->insert(probed.begin(), probed.end());
+  }
+
+ private:
+  const SiteMap& mSites;
+  fs::path mPath;
+  std::string mSuffix;
+  std::set<int>* mProbed;
+  std::string* mOutput;
+};
+
+class ProbeConsumerFactory {
+ public:
+  ProbeConsumerFactory(const SiteMap& sites, fs::path path, std::string suffix, std::set<int>* probed,
+                       std::string* output) :
+      mSites(sites), mPath(std::move(path)), mSuffix(std::move(suffix)), mProbed(probed), mOutput(output) {
+  }
+
+  std::unique_ptr<clang::ASTConsumer> newASTConsumer() {
+    return std::make_unique<ProbeConsumer>(mSites, mPath, mSuffix, mProbed, mOutput);
+  }
+
+ private:
+  const SiteMap& mSites;
+  fs::path mPath;
+  std::string mSuffix;
+  std::set<int>* mProbed;
+  std::string* mOutput;
+};
+
+}  // namespace
+
+WeakMutationInstrumenter::WeakMutationInstrumenter(const fs::path& compileDbDir) : mCompileDbDir(compileDbDir) {
+}
+
+std::map<fs::path, std::string> WeakMutationInstrumenter::instrument(
+    const fs::path& sourceDir, const std::vector<std::pair<int, Mutant>>& mutants, std::set<int>* probed) const {
+  const fs::path root = fs::canonical(sourceDir);
+  std::map<fs::path, SiteMap> sitesByFile;
+  for (const auto& [id, m] : mutants) {
+    const std::string& token = m.getToken();
+    if (kProbedOperators.count(token) == 0 && token != "1" && token != "0") {
+      continue;
+    }
+    std::error_code ec;
+    const fs::path path = fs::canonical(root / m.getPath(), ec);
+    if (ec) {
+      continue;
+    }
+    sitesByFile[path][{m.getFirst().line, m.getFirst().column, m.getLast().line, m.getLast().column}].push_back(
+        {id, token});
+  }
+  if (sitesByFile.empty()) {
+    return {};
+  }
+
+  std::string errorMsg;
+  std::unique_ptr<clang::tooling::CompilationDatabase> compileDb =
+      clang::tooling::CompilationDatabase::loadFromDirectory(mCompileDbDir.string(), errorMsg);
+  if (compileDb == nullptr) {
+    throw IOException(EINVAL, errorMsg);
+  }
+
+  std::map<fs::path, std::string> result;
+  for (const auto& [path, sites] : sitesByFile) {
+    // Headers may be instrumented along with the files including them, so
+    // every file gets its own names.
+    const std::string suffix = fmt::format("{:x}", std::hash<std::string>{}(path.string()));
+    std::string output;
+    ProbeConsumerFactory consumerFactory(sites, path, suffix, probed, &output);
+    auto actionFactory = clang::tooling::newFrontendActionFactory(&consumerFactory);
+    clang::IgnoringDiagConsumer ignoring;
+    clang::tooling::ClangTool tool(*compileDb, {path.string()});
+    tool.setDiagnosticConsumer(&ignoring);
+    tool.run(actionFactory.get());
+    if (!output.empty()) {
+      result.emplace(path, std::move(output));
+    }
+  }
+  return result;
+}
+
+}  // namespace sentinel
@@ -14,10 +14,12 @@
 #include <iterator>
 #include <map>
 #include <memory>
-#include <new>
+#include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
+#include "sentinel/FileCandidates.hpp"
 #include "sentinel/Mutants.hpp"
 #include "sentinel/SourceLines.hpp"
 #include "sentinel/WeightedMutantGenerator.hpp"
@@ -35,9 +37,7 @@ WeightedMutantGenerator::WeightedMutantGenerator(const std::filesystem::path& pa
 // collectAllMutants — overridden to use DepthAware AST visitor
 // ---------------------------------------------------------------------------
 Mutants WeightedMutantGenerator::collectAllMutants(const SourceLines& sourceLines) {
-  Mutants mutables;
   mDepthMap.clear();
-  auto compileDb = loadCompilationDatabase();
 
   std::map<fs::path, SourceLines> targetLines;
   for (const auto& sourceLine : sourceLines) {
@@ -45,27 +45,46 @@ Mutants WeightedMutantGenerator::collectAllMutants(const SourceLines& sourceLine
     targetLines[filename].push_back(sourceLine);
   }
 
-  const std::size_t totalFiles = targetLines.size();
-  std::size_t doneFiles = 0;
-  notifyProgress(doneFiles, totalFiles);
-
-  for (const auto& [filename, fileLines] : targetLines) {
-    for (const auto& sl : fileLines) {
-      mDepthMap[sl] = -1;
-    }
-    try {
-      auto factory = createDepthAwareActionFactory(&mutables, fileLines, &mDepthMap, mSelectedOperators);
-      clang::IgnoringDiagConsumer ignoring;
-      clang::tooling::ClangTool tool(*compileDb, {filename.string()});
-      tool.setDiagnosticConsumer(&ignoring);
-      tool.run(factory.get());
-    } catch (const std::bad_alloc&) {
-      rethrowAsOomError(filename);
+  std::vector<fs::path> files;
+  std::vector<std::string> cacheKeys;
+  files.reserve(targetLines.size());
+  cacheKeys.reserve(targetLines.size());
+  for (const auto& [filename, lines] : targetLines) {
+    files.push_back(filename);
+    std::ostringstream key;
+    key << "depths";
+    for (const auto& line : std::set<SourceLine>(lines.begin(), lines.end())) {
+      key << ' ' << line.getLineNumber();
     }
-    ++doneFiles;
-    notifyProgress(doneFiles, totalFiles);
+    cacheKeys.push_back(key.str());
   }
 
+  std::vector<FileCandidates> candidatesByFile = collectFilesInParallel(
+      files, cacheKeys, [&](std::size_t i, const clang::tooling::CompilationDatabase& compileDb) {
+        const SourceLines& fileLines = targetLines.at(files[i]);
+        FileCandidates candidates;
+        DepthMap depthMap;
+        for (const auto& sl : fileLines) {
+          depthMap[sl] = -1;
+        }
+        auto factory = createDepthAwareActionFactory(&candidates.mutants, fileLines, &depthMap,
+                                                     mSelectedOperators);
+        runTool(compileDb, files[i], factory.get(), &candidates.includes);
+        for (const auto& [sl, depth] : depthMap) {
+          candidates.depths[sl.getLineNumber()] = depth;
+        }
+        return candidates;
+      });
+
+  // The depths of a file only cover its own lines, so merging them loses nothing.
+  Mutants mutables;
+  for (std::size_t i = 0; i < files.size(); ++i) {
+    auto& candidates = candidatesByFile[i];
+    std::move(candidates.mutants.begin(), candidates.mutants.end(), std::back_inserter(mutables));
+    for (const auto& [line, depth] : candidates.depths) {
+      mDepthMap[SourceLine(files[i], line)] = depth;
+    }
+  }
   return mutables;
 }
 
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <unistd.h>
+#include <yaml-cpp/yaml.h>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "sentinel/Evaluator.hpp"
+#include "sentinel/GitRepository.hpp"
+#include "sentinel/Logger.hpp"
+#include "sentinel/PipelineContext.hpp"
+#include "sentinel/StatusLine.hpp"
+#include "sentinel/Worker.hpp"
+#include "sentinel/WorkerProtocol.hpp"
+#include "sentinel/stages/EvaluationStage.hpp"
+#include "sentinel/util/PeriodicTask.hpp"
+#include "sentinel/util/ScopeGuard.hpp"
+#include "sentinel/util/io.hpp"
+#include "sentinel/util/net.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+Worker::Worker(const Config& config, std::shared_ptr<Workspace> workspace, std::string token) :
+    mConfig(config), mWorkspace(std::move(workspace)), mToken(std::move(token)) {
+}
+
+bool Worker::send(const std::string& type, const std::string& body) {
+  std::lock_guard<std::mutex> lock(mSendMutex);
+  return net::sendFrame(mFd, protocol::encode(type, body));
+}
+
+std::size_t Worker::run(const std::string& address) {
+  if (mWorkspace->hasPreviousRun()) {
+    throw std::runtime_error(fmt::format(
+        "Workspace '{}' holds a sentinel run. Give the worker a workspace of its own with --workspace.",
+        mWorkspace->getRoot().string()));
+  }
+  mWorkspace->initialize();
+
+  mFd = net::connect(address);
+  ScopeGuard closeSocket{[this] {
+    ::close(mFd);
+    mFd = -1;
+  }};
+  auto receive = [this, &address]() {
+    auto frame = net::receiveFrame(mFd);
+    if (!frame) {
+      throw std::runtime_error(fmt::format("Lost the connection to coordinator '{}'.", address));
+    }
+    return protocol::decode(*frame);
+  };
+
+  char host[256] = {};
+  gethostname(host, sizeof(host) - 1);
+  const std::string name = fmt::format("{}.{}", host, getpid());
+  send(protocol::kHello, fmt::format("{}\n{}\n{}", protocol::kVersion, mToken, name));
+  const protocol::Message setup = receive();
+  if (setup.type == protocol::kRefused) {
+    throw std::runtime_error(fmt::format(
+        "Coordinator '{}' refused worker '{}': the sentinel version or {} does not match.", address, name,
+        protocol::kTokenEnv));
+  }
+  if (setup.type != protocol::kSetup) {
+    throw std::runtime_error(fmt::format("Coordinator '{}' refused worker '{}'.", address, name));
+  }
+  const YAML::Node setupNode = YAML::Load(setup.body);
+  const auto timeLimit = setupNode["timeout"].as<std::size_t>(0);
+  const fs::path resultsDir = mWorkspace->getOriginalResultsDir();
+  for (const auto& file : setupNode["results"]) {
+    const fs::path path = resultsDir / file.first.as<std::string>();
+    fs::create_directories(path.parent_path());
+    std::ofstream out(path);
+    out << file.second.as<std::string>();
+  }
+  Logger::info("Connected to coordinator '{}' as '{}'.", address, name);
+
+  // Started after the handshake: HELLO must be the first message the coordinator receives.
+  PeriodicTask heartbeat(protocol::kHeartbeatInterval, [this] { send(protocol::kHeartbeat); });
+
+  auto repo = std::make_shared<GitRepository>(mConfig.sourceDir, mConfig.extensions, mConfig.patterns);
+  EvaluationStage stage(repo);
+  Evaluator evaluator(resultsDir);
+  StatusLine statusLine;
+  PipelineContext ctx{mConfig, statusLine, *mWorkspace};
+
+  std::size_t evaluated = 0;
+  while (true) {
+    // Once the last result is in, the coordinator sends DONE and closes the connection,
+    // so READY may fail while DONE is still waiting to be read.
+    send(protocol::kReady);
+    const protocol::Message msg = receive();
+    if (msg.type == protocol::kDone) {
+      break;
+    }
+    if (msg.type != protocol::kMutant) {
+      throw std::runtime_error(fmt::format("Unexpected message '{}' from coordinator '{}'.", msg.type, address));
+    }
+    const protocol::Message assignment = protocol::decode(msg.body);
+    const int id = std::stoi(assignment.type);
+    std::istringstream in(assignment.body);
+    Mutant m;
+    if (!(in >> m)) {
+      throw std::runtime_error(fmt::format("Failed to parse mutant {} from coordinator '{}'.", id, address));
+    }
+
+    mWorkspace->createMutant(id, m);
+    const MutationResult result = stage.evaluateMutant(m, id, timeLimit, &evaluator, &ctx);
+    Logger::info("Mutant {}: {} {}:{} -> {}", id, m.getOperator(), m.getPath(), m.getFirst().line,
+                 mutationStateToStr(result.getMutationState()));
+
+    std::ostringstream resultText;
+    resultText << result;
+    YAML::Emitter out;
+    out << YAML::BeginMap;
+    out << YAML::Key << "id" << YAML::Value << id;
+    out << YAML::Key << "result" << YAML::Value << resultText.str();
+    out << YAML::Key << "build-log" << YAML::Value
+        << io::readLastLines(mWorkspace->getMutantBuildLog(id), protocol::kLogTailLines);
+    out << YAML::Key << "test-log" << YAML::Value
+        << io::readLastLines(mWorkspace->getMutantTestLog(id), protocol::kLogTailLines);
+    out << YAML::EndMap;
+    if (!send(protocol::kResult, out.c_str())) {
+      throw std::runtime_error(fmt::format("Lost the connection to coordinator '{}'.", address));
+    }
+    mWorkspace->removeMutant(id);
+    ++evaluated;
+  }
+  Logger::info("Coordinator '{}' reports that all mutants are evaluated ({} evaluated by this worker).",
+               address, evaluated);
+  return evaluated;
+}
+
+}  // namespace sentinel
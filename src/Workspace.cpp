@@ -3,7 +3,9 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <fcntl.h>
 #include <fmt/core.h>
+#include <unistd.h>
 #include <yaml-cpp/yaml.h>
 #include <algorithm>
 #include <cctype>
@@ -12,9 +14,11 @@
 #include <filesystem>  // NOLINT
 #include <fstream>
 #include <iterator>
+#include <map>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 #include "sentinel/Logger.hpp"
@@ -29,6 +33,9 @@ namespace fs = std::filesystem;
 
 namespace {
 
+// Created by the process of a shared workspace that initializes it.
+constexpr const char* kInitClaim = "init.lock";
+
 bool isAllDigits(const std::string& name) {
   if (name.empty()) return false;
   return std::all_of(name.begin(), name.end(),
@@ -45,6 +52,19 @@ std::optional<int> parseMutantId(const std::string& name) {
   }
 }
 
+// Create a file that must not exist yet. Returns false with errno set on failure
+// (EEXIST if the file exists).
+bool createExclusive(const fs::path& path, const std::string& content) {
+  const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  // The content is informational; the existence of the file is what counts.
+  [[maybe_unused]] const ssize_t written = ::write(fd, content.data(), content.size());
+  ::close(fd);
+  return true;
+}
+
 }  // namespace
 
 Workspace::Workspace(const fs::path& root) : mRoot(root) {
@@ -65,11 +85,66 @@ bool Workspace::hasPreviousRun() const {
 }
 
 void Workspace::initialize() {
-  fs::remove_all(mRoot);
+  if (fs::is_directory(mRoot)) {
+    for (const auto& entry : fs::directory_iterator(mRoot)) {
+      if (!mClaimedInitialization || entry.path().filename() != kInitClaim) {
+        fs::remove_all(entry.path());
+      }
+    }
+  }
   fs::create_directories(getOriginalResultsDir());
   fs::create_directories(getBackupDir());
 }
 
+bool Workspace::claimInitialization(const std::string& owner) {
+  fs::create_directories(mRoot);
+  if (createExclusive(mRoot / kInitClaim, owner + "\n")) {
+    mClaimedInitialization = true;
+    return true;
+  }
+  if (errno == EEXIST) {
+    return false;
+  }
+  throw std::runtime_error(fmt::format("Failed to claim the initialization of '{}': {}", mRoot.string(),
+                                       std::strerror(errno)));
+}
+
+void Workspace::renewInitialization() {
+  std::error_code ec;
+  fs::last_write_time(mRoot / kInitClaim, fs::file_time_type::clock::now(), ec);
+}
+
+std::optional<fs::file_time_type> Workspace::getInitializationTime() const {
+  std::error_code ec;
+  const auto time = fs::last_write_time(mRoot / kInitClaim, ec);
+  if (ec) {
+    return std::nullopt;
+  }
+  return time;
+}
+
+std::string Workspace::getInitializationOwner() const {
+  std::ifstream in(mRoot / kInitClaim);
+  std::string owner;
+  std::getline(in, owner);
+  return owner;
+}
+
+bool Workspace::breakInitialization(fs::file_time_type seen) {
+  fs::path guard = mRoot / kInitClaim;
+  guard += ".break";
+  if (!createExclusive(guard, mWorkerName + "\n")) {
+    return false;
+  }
+  std::error_code ec;
+  bool removed = false;
+  if (getInitializationTime() == seen) {
+    removed = fs::remove(mRoot / kInitClaim, ec);
+  }
+  fs::remove(guard, ec);
+  return removed;
+}
+
 void Workspace::saveConfig(const Config& cfg) {
   std::ofstream out(mRoot / "config.yaml");
   if (!out) {
@@ -89,6 +164,9 @@ std::ostream& operator<<(std::ostream& out, const WorkspaceStatus& status) {
   if (status.originalTime.has_value()) {
     emitter << YAML::Key << "original-time" << YAML::Value << *status.originalTime;
   }
+  if (status.originalTestSeconds.has_value()) {
+    emitter << YAML::Key << "original-test-seconds" << YAML::Value << *status.originalTestSeconds;
+  }
   if (status.candidateCount.has_value()) {
     emitter << YAML::Key << "candidate-count" << YAML::Value << *status.candidateCount;
   }
@@ -98,6 +176,9 @@ std::ostream& operator<<(std::ostream& out, const WorkspaceStatus& status) {
   if (status.partCount.has_value()) {
     emitter << YAML::Key << "part-count" << YAML::Value << *status.partCount;
   }
+  if (status.partitionStrategy.has_value()) {
+    emitter << YAML::Key << "partition-strategy" << YAML::Value << *status.partitionStrategy;
+  }
   if (status.seed.has_value()) {
     emitter << YAML::Key << "seed" << YAML::Value << *status.seed;
   }
@@ -110,6 +191,9 @@ std::ostream& operator<<(std::ostream& out, const WorkspaceStatus& status) {
   if (status.limit.has_value()) {
     emitter << YAML::Key << "limit" << YAML::Value << *status.limit;
   }
+  if (status.generationPending.has_value()) {
+    emitter << YAML::Key << "generation-pending" << YAML::Value << *status.generationPending;
+  }
   if (status.mergedPartitions.has_value()) {
     emitter << YAML::Key << "merged-partitions" << YAML::Value << YAML::BeginSeq;
     for (auto idx : *status.mergedPartitions) {
@@ -117,6 +201,20 @@ std::ostream& operator<<(std::ostream& out, const WorkspaceStatus& status) {
     }
     emitter << YAML::EndSeq;
   }
+  if (status.notInfected.has_value()) {
+    emitter << YAML::Key << "not-infected" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+    for (auto id : *status.notInfected) {
+      emitter << id;
+    }
+    emitter << YAML::EndSeq;
+  }
+  if (status.scopeOriginalTimes.has_value()) {
+    emitter << YAML::Key << "scope-original-times" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+    for (auto secs : *status.scopeOriginalTimes) {
+      emitter << secs;
+    }
+    emitter << YAML::EndSeq;
+  }
   emitter << YAML::EndMap;
   out << emitter.c_str();
   return out;
@@ -132,13 +230,16 @@ std::istream& operator>>(std::istream& in, WorkspaceStatus& status) {
     YAML::Node node = YAML::Load(content);
     if (node["version"]) status.version = node["version"].as<std::string>();
     if (node["original-time"]) status.originalTime = node["original-time"].as<std::size_t>();
+    if (node["original-test-seconds"]) status.originalTestSeconds = node["original-test-seconds"].as<double>();
     if (node["candidate-count"]) status.candidateCount = node["candidate-count"].as<std::size_t>();
     if (node["part-index"]) status.partIndex = node["part-index"].as<std::size_t>();
     if (node["part-count"]) status.partCount = node["part-count"].as<std::size_t>();
+    if (node["partition-strategy"]) status.partitionStrategy = node["partition-strategy"].as<std::string>();
     if (node["seed"]) status.seed = node["seed"].as<unsigned int>();
     if (node["from"]) status.from = node["from"].as<std::string>();
     if (node["uncommitted"]) status.uncommitted = node["uncommitted"].as<bool>();
     if (node["limit"]) status.limit = node["limit"].as<std::size_t>();
+    if (node["generation-pending"]) status.generationPending = node["generation-pending"].as<bool>();
     if (node["merged-partitions"]) {
       const auto& seq = node["merged-partitions"];
       std::vector<std::size_t> parts(seq.size());
@@ -146,6 +247,19 @@ std::istream& operator>>(std::istream& in, WorkspaceStatus& status) {
                      [](const YAML::Node& n) { return n.as<std::size_t>(); });
       status.mergedPartitions = parts;
     }
+    if (node["not-infected"]) {
+      const auto& seq = node["not-infected"];
+      std::vector<int> ids(seq.size());
+      std::transform(seq.begin(), seq.end(), ids.begin(), [](const YAML::Node& n) { return n.as<int>(); });
+      status.notInfected = ids;
+    }
+    if (node["scope-original-times"]) {
+      const auto& seq = node["scope-original-times"];
+      std::vector<std::size_t> times(seq.size());
+      std::transform(seq.begin(), seq.end(), times.begin(),
+                     [](const YAML::Node& n) { return n.as<std::size_t>(); });
+      status.scopeOriginalTimes = times;
+    }
   } catch (const YAML::Exception&) {
     in.setstate(std::ios::failbit);
   }
@@ -160,14 +274,19 @@ void Workspace::saveStatus(const WorkspaceStatus& status) {
   }
   if (status.version.has_value()) current.version = status.version;
   if (status.originalTime.has_value()) current.originalTime = status.originalTime;
+  if (status.originalTestSeconds.has_value()) current.originalTestSeconds = status.originalTestSeconds;
   if (status.candidateCount.has_value()) current.candidateCount = status.candidateCount;
   if (status.partIndex.has_value()) current.partIndex = status.partIndex;
   if (status.partCount.has_value()) current.partCount = status.partCount;
+  if (status.partitionStrategy.has_value()) current.partitionStrategy = status.partitionStrategy;
   if (status.mergedPartitions.has_value()) current.mergedPartitions = status.mergedPartitions;
   if (status.seed.has_value()) current.seed = status.seed;
   if (status.from.has_value()) current.from = status.from;
   if (status.uncommitted.has_value()) current.uncommitted = status.uncommitted;
   if (status.limit.has_value()) current.limit = status.limit;
+  if (status.generationPending.has_value()) current.generationPending = status.generationPending;
+  if (status.notInfected.has_value()) current.notInfected = status.notInfected;
+  if (status.scopeOriginalTimes.has_value()) current.scopeOriginalTimes = status.scopeOriginalTimes;
 
   // Write to a sibling temp file then rename atomically (POSIX rename(2))
   // so an interrupted write does not leave a truncated status.yaml that
@@ -217,11 +336,23 @@ fs::path Workspace::getOriginalResultsDir() const {
 }
 
 fs::path Workspace::getBackupDir() const {
-  return mRoot / "backup";
+  return mWorkerName.empty() ? mRoot / "backup" : mRoot / "workers" / mWorkerName / "backup";
+}
+
+fs::path Workspace::getObjectDir() const {
+  return mWorkerName.empty() ? mRoot / "objects" : mRoot / "workers" / mWorkerName / "objects";
 }
 
 fs::path Workspace::getActualDir() const {
-  return mRoot / "actual";
+  return mWorkerName.empty() ? mRoot / "actual" : mRoot / "workers" / mWorkerName / "actual";
+}
+
+void Workspace::setWorkerName(const std::string& name) {
+  mWorkerName = name;
+}
+
+const std::string& Workspace::getWorkerName() const {
+  return mWorkerName;
 }
 
 fs::path Workspace::getOriginalBuildLog() const {
@@ -232,6 +363,22 @@ fs::path Workspace::getOriginalTestLog() const {
   return mRoot / "original" / "test.log";
 }
 
+fs::path Workspace::getOriginalScopeBuildLog(std::size_t index) const {
+  return mRoot / "original" / "scopes" / std::to_string(index) / "build.log";
+}
+
+fs::path Workspace::getOriginalScopeTestLog(std::size_t index) const {
+  return mRoot / "original" / "scopes" / std::to_string(index) / "test.log";
+}
+
+fs::path Workspace::getOriginalScopeResultsDir(std::size_t index) const {
+  return mRoot / "original" / "scopes" / std::to_string(index) / "results";
+}
+
+fs::path Workspace::getWeakMutationDir() const {
+  return mRoot / "weak";
+}
+
 fs::path Workspace::getMutantDir(int id) const {
   return mRoot / mutantDirName(id);
 }
@@ -244,6 +391,10 @@ fs::path Workspace::getMutantTestLog(int id) const {
   return mutantFile(id, "test.log");
 }
 
+fs::path Workspace::getMutantResultsDir(int id) const {
+  return mutantFile(id, "results");
+}
+
 void Workspace::createMutant(int id, const Mutant& m) {
   fs::path dir = getMutantDir(id);
   fs::create_directories(dir);
@@ -254,6 +405,50 @@ void Workspace::createMutant(int id, const Mutant& m) {
   out << m;
 }
 
+void Workspace::removeMutant(int id) {
+  fs::remove_all(getMutantDir(id));
+}
+
+int Workspace::getNextMutantId() const {
+  auto mutants = loadMutants();
+  return mutants.empty() ? 1 : mutants.back().first + 1;
+}
+
+std::size_t Workspace::relocateMutants(const fs::path& path, const std::map<std::size_t, std::size_t>& lineMap) {
+  std::size_t removed = 0;
+  for (const auto& [id, m] : loadMutants()) {
+    if (m.getPath() != path) {
+      continue;
+    }
+    const Location first = m.getFirst();
+    const Location last = m.getLast();
+    auto newFirst = lineMap.find(first.line);
+    auto newLast = lineMap.find(last.line);
+    if (newFirst == lineMap.end() || newLast == lineMap.end() ||
+        newLast->second - newFirst->second != last.line - first.line) {
+      removeMutant(id);
+      removed++;
+      continue;
+    }
+    // Rebuilt even if its lines did not move: the byte offsets and hash of the
+    // mutant belong to the file before the edit, so it would no longer apply.
+    Mutant moved(m.getOperator(), m.getPath(), m.getQualifiedFunction(), newFirst->second, first.column,
+                 newLast->second, last.column, m.getToken());
+    createMutant(id, moved);
+    if (isDone(id)) {
+      MutationResult done = getDoneResult(id);
+      MutationResult result(moved, done.getKillingTest(), done.getErrorTest(), done.getMutationState());
+      result.setBuildSecs(done.getBuildSecs());
+      result.setTestSecs(done.getTestSecs());
+      result.setUncovered(done.isUncovered());
+      result.setCached(done.isCached());
+      result.setNotInfected(done.isNotInfected());
+      setDone(id, result);
+    }
+  }
+  return removed;
+}
+
 bool Workspace::isLocked(int id) const {
   return fs::exists(mutantFile(id, "mt.lock"));
 }
@@ -269,6 +464,44 @@ void Workspace::clearLock(int id) {
   fs::remove(mutantFile(id, "mt.lock"));
 }
 
+bool Workspace::tryLock(int id, const std::string& owner) {
+  if (createExclusive(mutantFile(id, "mt.lock"), owner + "\n")) {
+    return true;
+  }
+  if (errno == EEXIST) {
+    return false;
+  }
+  throw std::runtime_error(fmt::format("Failed to create lock for mutant {}: {}", id, std::strerror(errno)));
+}
+
+void Workspace::renewLock(int id) {
+  std::error_code ec;
+  fs::last_write_time(mutantFile(id, "mt.lock"), fs::file_time_type::clock::now(), ec);
+}
+
+std::optional<fs::file_time_type> Workspace::getLockTime(int id) const {
+  std::error_code ec;
+  const auto time = fs::last_write_time(mutantFile(id, "mt.lock"), ec);
+  if (ec) {
+    return std::nullopt;
+  }
+  return time;
+}
+
+bool Workspace::breakLock(int id, fs::file_time_type seen) {
+  const fs::path guard = mutantFile(id, "mt.lock.break");
+  if (!createExclusive(guard, mWorkerName + "\n")) {
+    return false;
+  }
+  std::error_code ec;
+  bool removed = false;
+  if (getLockTime(id) == seen) {
+    removed = fs::remove(mutantFile(id, "mt.lock"), ec);
+  }
+  fs::remove(guard, ec);
+  return removed;
+}
+
 bool Workspace::isDone(int id) const {
   return fs::exists(mutantFile(id, "mt.done"));
 }
@@ -286,12 +519,49 @@ void Workspace::setComplete() {
   }
 }
 
+bool Workspace::trySetComplete() {
+  if (createExclusive(getCompleteMarker(), "")) {
+    return true;
+  }
+  if (errno == EEXIST) {
+    return false;
+  }
+  throw std::runtime_error(fmt::format(
+      "Failed to create run.done in '{}': {}",
+      mRoot.string(), std::strerror(errno)));
+}
+
+void Workspace::clearComplete() {
+  fs::remove(getCompleteMarker());
+}
+
+void Workspace::clearResults() {
+  for (const auto& [id, m] : loadMutants()) {
+    fs::remove(mutantFile(id, "mt.done"));
+  }
+  clearComplete();
+}
+
 void Workspace::setDone(int id, const MutationResult& result) {
-  std::ofstream out(mutantFile(id, "mt.done"));
-  if (!out) {
-    throw std::runtime_error(fmt::format("Failed to write mt.done for mutant {}: {}", id, std::strerror(errno)));
+  // Renamed into place so that processes sharing the workspace never read a
+  // partially written result; only the lock owner writes the temp file.
+  const fs::path done = mutantFile(id, "mt.done");
+  fs::path tmp = done;
+  tmp += ".tmp";
+  {
+    std::ofstream out(tmp);
+    if (!out) {
+      throw std::runtime_error(fmt::format("Failed to write mt.done for mutant {}: {}", id, std::strerror(errno)));
+    }
+    out << result;
+  }
+  std::error_code ec;
+  fs::rename(tmp, done, ec);
+  if (ec) {
+    std::error_code rmEc;
+    fs::remove(tmp, rmEc);
+    throw std::runtime_error(fmt::format("Failed to write mt.done for mutant {}: {}", id, ec.message()));
   }
-  out << result;
 }
 
 MutationResult Workspace::getDoneResult(int id) const {
@@ -306,6 +576,10 @@ MutationResult Workspace::getDoneResult(int id) const {
   return result;
 }
 
+bool Workspace::hasGeneratedMutants() const {
+  return hasMutants() && !loadStatus().generationPending.value_or(false);
+}
+
 bool Workspace::hasMutants() const {
   if (!fs::is_directory(mRoot)) {
     return false;
@@ -47,6 +47,12 @@ void XmlReport::save(const std::filesystem::path& dirPath) {
     if (state == MutationState::SURVIVED && r.isUncovered()) {
       pMutation->SetAttribute("uncovered", "true");
     }
+    if (r.isCached()) {
+      pMutation->SetAttribute("cached", "true");
+    }
+    if (state == MutationState::SURVIVED && r.isNotInfected()) {
+      pMutation->SetAttribute("notInfected", "true");
+    }
 
     addChildToParent(doc.get(), pMutation, "sourceFile", r.getMutant().getPath().filename().string());
     addChildToParent(doc.get(), pMutation, "sourceFilePath", r.getMutant().getPath().string());
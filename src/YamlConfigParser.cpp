@@ -39,6 +39,35 @@ static fs::path resolvePath(const fs::path& base, const std::string& value) {
   return p.lexically_normal();
 }
 
+static std::vector<Scope> toScopes(const YAML::Node& node, const fs::path& base) {
+  if (!node.IsSequence()) {
+    throw std::runtime_error("Config key 'scopes' must be a list");
+  }
+  static const std::vector<std::string> kScopeKeys = {"path", "build-command", "test-command", "test-result-dir"};
+  std::vector<Scope> scopes;
+  for (const auto& item : node) {
+    if (!item.IsMap()) {
+      throw std::runtime_error("Each entry of 'scopes' must be a mapping");
+    }
+    for (const auto& kv : item) {
+      const auto key = kv.first.as<std::string>();
+      if (std::find(kScopeKeys.begin(), kScopeKeys.end(), key) == kScopeKeys.end()) {
+        throw std::runtime_error(fmt::format("Unknown key '{}' in 'scopes'. Valid keys: [{}]", key,
+                                             fmt::join(kScopeKeys, ", ")));
+      }
+    }
+    for (const auto& key : kScopeKeys) {
+      if (!item[key]) {
+        throw std::runtime_error(fmt::format("Each entry of 'scopes' needs '{}'", key));
+      }
+    }
+    scopes.push_back({item["path"].as<std::string>(), item["build-command"].as<std::string>(),
+                      item["test-command"].as<std::string>(),
+                      resolvePath(base, item["test-result-dir"].as<std::string>())});
+  }
+  return scopes;
+}
+
 void YamlConfigParser::applyTo(Config* cfg, const std::filesystem::path& path) {
   YAML::Node root;
   try {
@@ -92,6 +121,10 @@ void YamlConfigParser::applyTo(Config* cfg, const std::filesystem::path& path) {
         "version", "source-dir", "output-dir", "compiledb-dir", "test-result-dir",
         "build-command", "test-command", "timeout", "extension", "pattern",
         "generator", "mutants-per-line", "operator", "lcov-tracefile", "restrict",
+        "cache-dir", "targeted-build", "fail-fast-build", "jobserver",
+        "pressure-target", "scopes", "weak-mutation", "static-test-selection",
+        "ir-mutation", "jit-bitcode", "keep-test-results", "generation-memory-limit",
+        "generation-timeout", "candidate-cache-dir",
     };
     // CLI-only keys are accepted in the file (so older configs still parse)
     // but warned about, since they have no effect from YAML — the user
@@ -128,6 +161,13 @@ void YamlConfigParser::applyTo(Config* cfg, const std::filesystem::path& path) {
     if (root["build-command"]) cfg->buildCmd = root["build-command"].as<std::string>();
     if (root["test-command"]) cfg->testCmd = root["test-command"].as<std::string>();
     if (root["timeout"]) cfg->timeout = root["timeout"].as<size_t>();
+    if (root["targeted-build"]) cfg->targetedBuild = root["targeted-build"].as<bool>();
+    if (root["fail-fast-build"]) cfg->failFastBuild = root["fail-fast-build"].as<bool>();
+    if (root["jobserver"]) cfg->jobserver = root["jobserver"].as<size_t>();
+    if (root["pressure-target"]) {
+      cfg->pressureTargets = toVector<std::string>(root["pressure-target"], "pressure-target");
+    }
+    if (root["scopes"]) cfg->scopes = toScopes(root["scopes"], base);
 
     if (root["extension"]) cfg->extensions = toVector<std::string>(root["extension"], "extension");
     if (root["pattern"]) cfg->patterns = toVector<std::string>(root["pattern"], "pattern");
@@ -142,6 +182,19 @@ void YamlConfigParser::applyTo(Config* cfg, const std::filesystem::path& path) {
       }
     }
     if (root["restrict"]) cfg->restrictGeneration = root["restrict"].as<bool>();
+    if (root["cache-dir"]) cfg->cacheDir = resolvePath(base, root["cache-dir"].as<std::string>());
+    if (root["weak-mutation"]) cfg->weakMutation = root["weak-mutation"].as<bool>();
+    if (root["static-test-selection"]) cfg->staticTestSelection = root["static-test-selection"].as<bool>();
+    if (root["ir-mutation"]) cfg->irMutation = root["ir-mutation"].as<bool>();
+    if (root["jit-bitcode"]) cfg->jitBitcode = resolvePath(base, root["jit-bitcode"].as<std::string>());
+    if (root["keep-test-results"]) cfg->keepTestResults = root["keep-test-results"].as<bool>();
+    if (root["generation-memory-limit"]) {
+      cfg->generationMemoryLimit = root["generation-memory-limit"].as<size_t>();
+    }
+    if (root["generation-timeout"]) cfg->generationTimeout = root["generation-timeout"].as<size_t>();
+    if (root["candidate-cache-dir"]) {
+      cfg->candidateCacheDir = resolvePath(base, root["candidate-cache-dir"].as<std::string>());
+    }
   } catch (const YAML::Exception& e) {
     throw std::runtime_error(fmt::format("Config file '{}': {}", path, e.what()));
   }
@@ -47,6 +47,38 @@ static const char* const kYamlTemplate =
     "## Test time limit in seconds (default: ceil(baseline x 1.5) + 5s; 0 = no limit)\n"
     "# timeout: 60\n"
     "\n"
+    "## For Ninja builds in compiledb-dir, build only the targets that depend on\n"
+    "## the mutated file (ninja -t query) instead of running build-command.\n"
+    "## The targets are passed to test-command in $SENTINEL_AFFECTED_TARGETS.\n"
+    "# targeted-build: false\n"
+    "\n"
+    "## Stop a mutant's build at the first compiler error in the mutated file\n"
+    "## instead of waiting for the other build jobs (make -k, parallel builds).\n"
+    "# fail-fast-build: false\n"
+    "\n"
+    "## Share this many job tokens between the builds and tests of every sentinel\n"
+    "## on this host through a GNU make jobserver (0 = number of CPU cores).\n"
+    "## Works with GNU make 4.4+ and Ninja 1.13+; leave -j out of the build command.\n"
+    "# jobserver: 0\n"
+    "\n"
+    "## Hold back jobserver tokens while the pressure (PSI avg10, in percent) of a\n"
+    "## resource exceeds its target, and give them back once it has dropped.\n"
+    "## Implies jobserver: 0 if jobserver is not set.\n"
+    "# pressure-target:\n"
+    "#   - memory:10\n"
+    "#   - io:40\n"
+    "\n"
+    "## Build and test commands for parts of the source tree (default: none)\n"
+    "## A mutant in a file matching a scope's path glob ('*' also matches '/')\n"
+    "## is built and tested with that scope's commands; the most specific\n"
+    "## match wins. Other mutants use build-command and test-command. The\n"
+    "## original build and test run once per scope. Ignored with --serve.\n"
+    "# scopes:\n"
+    "#   - path: services/billing/*\n"
+    "#     build-command: make -C services/billing\n"
+    "#     test-command: make -C services/billing test\n"
+    "#     test-result-dir: ./services/billing/test-results\n"
+    "\n"
     "# --- Mutation options ---\n"
     "\n"
     "## Source file extensions to mutate (default: cxx cpp cc c c++ cu)\n"
@@ -94,7 +126,50 @@ static const char* const kYamlTemplate =
     "## When true, restrict mutant generation to lines covered by lcov-tracefile.\n"
     "## Without this, uncovered mutants are kept in the report as SURVIVED*\n"
     "## and only their evaluation is skipped. Requires lcov-tracefile to be set.\n"
-    "# restrict: false\n";
+    "# restrict: false\n"
+    "\n"
+    "## Directory of mutant verdicts reused across runs (default: none)\n"
+    "##\n"
+    "## A mutant whose source file, build/test commands, and other sources\n"
+    "## (tests, headers) are unchanged since a cached run is not evaluated\n"
+    "## again. The directory can be shared by concurrent runs.\n"
+    "# cache-dir: ./.sentinel_cache\n"
+    "\n"
+    "## Before evaluating, build once with a probe at every operator mutant\n"
+    "## and run the tests. Mutants whose value never differs from the\n"
+    "## original are reported as SURVIVED (not infected) without a build.\n"
+    "# weak-mutation: false\n"
+    "\n"
+    "## Without lcov-tracefile, run for each mutant only the Google Test cases\n"
+    "## that a static call graph of the compilation database finds able to\n"
+    "## call the mutated function. Mutants no test can reach are reported as\n"
+    "## SURVIVED* without a build.\n"
+    "# static-test-selection: false\n"
+    "\n"
+    "## Apply AOR, BOR, ROR and SOR mutants to the LLVM IR of their file and\n"
+    "## replace its object in the build tree, so the build command only\n"
+    "## relinks. Other mutants are built from the mutated source.\n"
+    "# ir-mutation: false\n"
+    "\n"
+    "## Experimental: LLVM IR of the whole Google Test program (e.g. linked\n"
+    "## with llvm-link). AOR, BOR, ROR and SOR mutants found in it are tested\n"
+    "## by running it in a JIT, without building.\n"
+    "# jit-bitcode: ./build/unittest.bc\n"
+    "\n"
+    "## Move the test results of each mutant to its directory in the\n"
+    "## workspace (NNNNN/results/) instead of discarding them.\n"
+    "# keep-test-results: false\n"
+    "\n"
+    "## Parse each source file in a worker process limited to this much memory\n"
+    "## (MiB) and time (seconds). A file whose worker exceeds a limit is\n"
+    "## skipped with a warning instead of stopping the run (default: no limits).\n"
+    "# generation-memory-limit: 4096\n"
+    "# generation-timeout: 600\n"
+    "\n"
+    "## Keep the mutant candidates of each parsed source file in this directory\n"
+    "## and reuse them while the file, its headers, its compile command and its\n"
+    "## target lines are unchanged (default: disabled).\n"
+    "# candidate-cache-dir: ./.sentinel_candidates\n";
 
 void YamlConfigWriter::writeTemplate(const std::filesystem::path& path) {
   std::ofstream out(path);
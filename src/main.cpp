@@ -5,36 +5,206 @@
 
 #include <fmt/core.h>
 #include <fmt/ranges.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
 #include <csignal>
+#include <cstdlib>
 #include <filesystem>  // NOLINT
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include "sentinel/CliConfigParser.hpp"
+#include "sentinel/ConcurrentStage.hpp"
 #include "sentinel/ConfigValidator.hpp"
 #include "sentinel/GitRepository.hpp"
+#include "sentinel/Jobserver.hpp"
 #include "sentinel/Logger.hpp"
 #include "sentinel/MutantGenerator.hpp"
+#include "sentinel/MutantPlan.hpp"
 #include "sentinel/OomHandler.hpp"
+#include "sentinel/OverlappedStage.hpp"
 #include "sentinel/PartitionedWorkspaceMerger.hpp"
 #include "sentinel/PipelineContext.hpp"
+#include "sentinel/PressureMonitor.hpp"
 #include "sentinel/SignalHandler.hpp"
 #include "sentinel/StatusLine.hpp"
+#include "sentinel/Subprocess.hpp"
+#include "sentinel/WatchSession.hpp"
+#include "sentinel/WeakMutationInstrumenter.hpp"
+#include "sentinel/Worker.hpp"
+#include "sentinel/WorkerProtocol.hpp"
 #include "sentinel/Workspace.hpp"
 #include "sentinel/YamlConfigParser.hpp"
 #include "sentinel/YamlConfigWriter.hpp"
+#include "sentinel/exceptions/InvalidArgumentException.hpp"
 #include "sentinel/exceptions/ThresholdError.hpp"
+#include "sentinel/stages/CoordinatorStage.hpp"
 #include "sentinel/stages/OriginalBuildStage.hpp"
 #include "sentinel/stages/OriginalTestStage.hpp"
 #include "sentinel/stages/DryRunStage.hpp"
 #include "sentinel/stages/EvaluationStage.hpp"
 #include "sentinel/stages/GenerationStage.hpp"
 #include "sentinel/stages/ReportStage.hpp"
+#include "sentinel/stages/WeakMutationStage.hpp"
+#include "sentinel/util/PeriodicTask.hpp"
 #include "sentinel/version.hpp"
 
 namespace fs = std::filesystem;
 
+/**
+ * @brief Return the name of this process in a shared workspace: host name and PID.
+ */
+static std::string getProcessName() {
+  char host[256] = {};
+  gethostname(host, sizeof(host) - 1);
+  return fmt::format("{}.{}", host, getpid());
+}
+
+/**
+ * @brief Return the secret shared by a coordinator and its workers.
+ *
+ * It is read from the environment rather than the command line, where other
+ * users of the host could read it.
+ *
+ * @throw InvalidArgumentException if protocol::kTokenEnv is unset or empty.
+ */
+static std::string getServeToken() {
+  const char* token = std::getenv(sentinel::protocol::kTokenEnv);
+  if (token == nullptr || *token == '\0') {
+    throw sentinel::InvalidArgumentException(
+        fmt::format("--serve and --worker require a secret shared by the coordinator and its workers. "
+                    "Set {} to the same value for both.",
+                    sentinel::protocol::kTokenEnv));
+  }
+  return token;
+}
+
+/**
+ * @brief Return true if @p owner, named by getProcessName(), is a process of this host that has exited.
+ */
+static bool isDeadLocalProcess(const std::string& owner) {
+  const std::size_t dot = owner.rfind('.');
+  char host[256] = {};
+  gethostname(host, sizeof(host) - 1);
+  if (dot == std::string::npos || owner.compare(0, dot, host) != 0) {
+    return false;
+  }
+  char* end = nullptr;
+  const long pid = std::strtol(owner.c_str() + dot + 1, &end, 10);
+  if (pid <= 0 || *end != '\0') {
+    return false;
+  }
+  return ::kill(static_cast<pid_t>(pid), 0) != 0 && errno == ESRCH;
+}
+
+/**
+ * @brief Wait until the process that initialized a shared workspace has generated its mutants.
+ *
+ * A process attaching to the workspace with --shared must not initialize it again
+ * or generate mutants of its own; it resumes the run once the mutant list is final.
+ * If the initializing process exits or stops renewing its claim before that, as
+ * a mutant lock (see EvaluationStage::kStaleLockTimeout), one waiting process
+ * takes the claim over and initializes the workspace from scratch.
+ *
+ * @param ws Workspace that another process is initializing.
+ * @return true if this process took the initialization over.
+ */
+static bool waitForSharedWorkspace(sentinel::Workspace* ws) {
+  auto isReady = [ws] {
+    if (ws->isComplete()) {
+      return true;
+    }
+    return ws->hasPreviousRun() && ws->hasGeneratedMutants();
+  };
+  if (isReady()) {
+    return false;
+  }
+  sentinel::Logger::info("Waiting for the mutants of shared workspace '{}' to be generated...", ws->getRoot());
+  // Staleness is measured with the local clock from the last observed renewal.
+  std::optional<std::pair<fs::file_time_type, std::chrono::steady_clock::time_point>> lastRenewal;
+  while (!isReady()) {
+    std::this_thread::sleep_for(sentinel::EvaluationStage::kPollInterval);
+    const auto claimTime = ws->getInitializationTime();
+    if (!claimTime) {
+      lastRenewal.reset();
+      continue;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (!lastRenewal || lastRenewal->first != *claimTime) {
+      lastRenewal.emplace(*claimTime, now);
+    }
+    const std::string owner = ws->getInitializationOwner();
+    if (!isDeadLocalProcess(owner) && now - lastRenewal->second < sentinel::EvaluationStage::kStaleLockTimeout) {
+      continue;
+    }
+    if (isReady() || !ws->breakInitialization(*claimTime) || !ws->claimInitialization(getProcessName())) {
+      continue;
+    }
+    sentinel::Logger::warn("Process '{}' stopped before generating the mutants of shared workspace '{}'; "
+                           "initializing it here.", owner, ws->getRoot());
+    ws->initialize();
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Create or join the jobserver of this host if the configuration asks for one.
+ *
+ * Every Subprocess started afterwards runs under the returned jobserver.
+ *
+ * @param cfg Resolved configuration.
+ * @return the jobserver, or nullptr if neither jobserver nor pressure-target is set.
+ */
+static std::unique_ptr<sentinel::Jobserver> startJobserver(const sentinel::Config& cfg) {
+  if (!cfg.jobserver && cfg.pressureTargets.empty()) {
+    return nullptr;
+  }
+  const std::size_t jobs = cfg.jobserver.value_or(0) != 0 ? *cfg.jobserver
+                                                          : std::max(1U, std::thread::hardware_concurrency());
+  auto jobserver = std::make_unique<sentinel::Jobserver>(sentinel::Jobserver::getDefaultDir(), jobs);
+  sentinel::Subprocess::setJobserver(jobserver.get());
+  sentinel::Logger::info("Sharing {} job token{} through '{}'.", jobserver->getJobs(),
+                         jobserver->getJobs() == 1 ? "" : "s", jobserver->getFifo());
+  return jobserver;
+}
+
+/**
+ * @brief Start adapting the tokens of the jobserver to the pressure targets.
+ *
+ * Only the sentinel that created the pool adjusts it, so that the tokens of a
+ * shared pool are not held back once per process.
+ *
+ * @param cfg       Resolved configuration.
+ * @param jobserver Jobserver started by startJobserver() (may be nullptr).
+ * @return the running monitor, or nullptr if there is nothing to monitor.
+ */
+static std::unique_ptr<sentinel::PressureMonitor> startPressureMonitor(const sentinel::Config& cfg,
+                                                                       const sentinel::Jobserver* jobserver) {
+  if (jobserver == nullptr || cfg.pressureTargets.empty()) {
+    return nullptr;
+  }
+  if (!jobserver->isCreator()) {
+    sentinel::Logger::info("The jobserver was created by another sentinel, which applies its pressure targets.");
+    return nullptr;
+  }
+  std::vector<sentinel::PressureTarget> targets;
+  for (const auto& target : cfg.pressureTargets) {
+    targets.push_back(sentinel::PressureTarget::parse(target));
+  }
+  auto monitor = std::make_unique<sentinel::PressureMonitor>(*jobserver, std::move(targets),
+                                                             sentinel::PressureMonitor::findPressureFiles());
+  monitor->start();
+  return monitor;
+}
+
 /**
  * @brief Runs the sentinel application after CLI arguments have been parsed.
  *
@@ -71,7 +241,7 @@ static int runApplication(sentinel::CliConfigParser* cliParser) {
       }
       sentinel::Logger::info("Merging partitions into '{}'...", workDirPath);
       sentinel::PartitionedWorkspaceMerger merger(
-          workDirPath, mergeCfg.mergeWorkspaces, mergeCfg.force);
+          workDirPath, mergeCfg.mergeWorkspaces, mergeCfg.force, mergeCfg.mergeIndexOnly, mergeCfg.mergeHardLink);
       merger.merge();
 
       sentinel::Workspace targetWs(workDirPath);
@@ -90,12 +260,63 @@ static int runApplication(sentinel::CliConfigParser* cliParser) {
     }
   }
 
+  // 4. Handle --worker (evaluate mutants handed out by a coordinator)
+  {
+    sentinel::Config workerCfg = sentinel::Config::withDefaults();
+    cliParser->applyTo(&workerCfg);
+    if (workerCfg.workerAddress) {
+      // The worker's own checkout: defaults -> YAML -> CLI, as for a fresh run.
+      workerCfg = sentinel::Config::withDefaults();
+      fs::path configPath = cliParser->getConfigFile();
+      if (configPath.empty() && fs::exists("sentinel.yaml")) {
+        configPath = "sentinel.yaml";
+      }
+      if (!configPath.empty()) {
+        sentinel::YamlConfigParser::applyTo(&workerCfg, configPath);
+      }
+      cliParser->applyTo(&workerCfg);
+      if (workerCfg.verbose) {
+        sentinel::Logger::setLevel(sentinel::Logger::Level::VERBOSE);
+      }
+      sentinel::ConfigValidator::validate(workerCfg);
+      const std::string token = getServeToken();
+      // The coordinator sends the original results of the build command only.
+      workerCfg.scopes.clear();
+      // The default workspace would be the coordinator's when both run in the same directory.
+      const fs::path workerDir = cliParser->getWorkDir().empty()
+          ? fs::absolute(".sentinel_worker") : cliParser->getWorkDir();
+      auto workerWs = std::make_shared<sentinel::Workspace>(workerDir);
+      const std::vector<int> signals = {SIGABRT, SIGINT, SIGFPE, SIGILL, SIGSEGV, SIGTERM, SIGQUIT, SIGHUP,
+                                        SIGUSR1};
+      sentinel::SignalHandler::add(signals, [workerWs, src = workerCfg.sourceDir]() {
+        workerWs->restoreBackup(src);
+      });
+      const std::shared_ptr<sentinel::Jobserver> jobserver = startJobserver(workerCfg);
+      if (jobserver) {
+        sentinel::SignalHandler::add(signals, [jobserver]() { jobserver->releaseAll(); });
+      }
+      const auto pressureMonitor = startPressureMonitor(workerCfg, jobserver.get());
+      sentinel::Worker(workerCfg, workerWs, token).run(*workerCfg.workerAddress);
+      return 0;
+    }
+  }
+
   auto ws = std::make_shared<sentinel::Workspace>(workDirPath);
+  // Of the processes starting a new shared workspace together, only the one
+  // claiming it initializes it; the others would remove its files. The claim
+  // is renewed for as long as this process runs.
+  std::optional<sentinel::PeriodicTask> claimRenewal;
+  if (cliParser->isShared() && !cliParser->isClean() && !cliParser->isDryRun()) {
+    const bool claimed = !ws->loadStatus().version.has_value() && ws->claimInitialization(getProcessName());
+    if (claimed || waitForSharedWorkspace(ws.get())) {
+      claimRenewal.emplace(sentinel::EvaluationStage::kLockRenewInterval, [ws] { ws->renewInitialization(); });
+    }
+  }
 
-  // 4. Detect run mode
+  // 5. Detect run mode
   bool alreadyComplete = false;
   bool resuming = false;
-  if (!cliParser->isClean() && !cliParser->isDryRun() && ws->hasPreviousRun()) {
+  if (!cliParser->isClean() && !cliParser->isDryRun() && !cliParser->isGenerateOnly() && ws->hasPreviousRun()) {
     alreadyComplete = ws->isComplete();
     resuming = !alreadyComplete;
     if (resuming) {
@@ -105,7 +326,7 @@ static int runApplication(sentinel::CliConfigParser* cliParser) {
     }
   }
 
-  // 5. Build config: defaults -> YAML -> CLI
+  // 6. Build config: defaults -> YAML -> CLI
   sentinel::Config cfg = sentinel::Config::withDefaults();
 
   if (alreadyComplete || resuming) {
@@ -128,23 +349,41 @@ static int runApplication(sentinel::CliConfigParser* cliParser) {
     cliParser->applyTo(&cfg);
   }
 
-  // 6. Configure logger
+  // 7. Configure logger
   if (cfg.verbose) {
     sentinel::Logger::setLevel(sentinel::Logger::Level::VERBOSE);
   }
 
   sentinel::ConfigValidator::validate(cfg);
+  // Checked before building, so a coordinator does not fail once the mutants are ready.
+  const std::string serveToken = cfg.serveAddress && !cfg.dryRun ? getServeToken() : "";
 
-  if ((cfg.dryRun || cfg.clean) && ws->hasPreviousRun()) {
+  if ((cfg.dryRun || cfg.clean || !cfg.generateOnly.empty()) && ws->hasPreviousRun()) {
     sentinel::Logger::warn("Workspace '{}' exists and will be cleared.", workDirPath);
   }
 
-  // 7. Create StatusLine
+  // Fail before building if this checkout is not the one the plan was generated from.
+  // The generation stage takes the verified plan instead of reading it again.
+  std::optional<sentinel::MutantPlan> plan;
+  if (!alreadyComplete && !resuming && !cfg.planFile.empty()) {
+    sentinel::Logger::info("Loading mutant plan '{}'...", cfg.planFile.string());
+    plan = sentinel::MutantPlan::load(cfg.planFile);
+    plan->verify(cfg.sourceDir);
+  }
+
+  if (cfg.shared && !cfg.dryRun) {
+    ws->setWorkerName(getProcessName());
+  }
+
+  const std::shared_ptr<sentinel::Jobserver> jobserver = startJobserver(cfg);
+  const auto pressureMonitor = startPressureMonitor(cfg, jobserver.get());
+
+  // 8. Create StatusLine
   auto statusLine = std::make_shared<sentinel::StatusLine>();
   statusLine->setDryRun(cfg.dryRun);
   statusLine->enable();
 
-  // 8. Initialize workspace for fresh runs
+  // 9. Initialize workspace for fresh runs
   if (!alreadyComplete && !resuming) {
     sentinel::Logger::info("Initializing workspace '{}'...", workDirPath);
     ws->initialize();
@@ -153,32 +392,77 @@ static int runApplication(sentinel::CliConfigParser* cliParser) {
     ws->saveStatus(versionStatus);
   }
 
-  // 9. Create stage-specific dependencies
+  if (cfg.serveAddress && !cfg.dryRun) {
+    // Workers compare every mutant with the original results of the build command and the whole suite.
+    cfg.scopes.clear();
+    cfg.staticTestSelection = false;
+  }
+
+  // 10. Create stage-specific dependencies
   auto repo = std::make_shared<sentinel::GitRepository>(cfg.sourceDir, cfg.extensions, cfg.patterns);
   if (cfg.from) {
     repo->validateRevision(*cfg.from);
   }
   auto generator = sentinel::MutantGenerator::getInstance(cfg.generator, cfg.compileDbDir);
 
-  // 10. Assemble stage chain
+  // 11. Assemble stage chain
   auto originalBuild = std::make_shared<sentinel::OriginalBuildStage>();
   auto originalTest = std::make_shared<sentinel::OriginalTestStage>();
   auto generation = std::make_shared<sentinel::GenerationStage>(repo, generator);
+  if (plan) {
+    generation->setPlan(std::move(*plan));
+  }
   auto dryRunStage = std::make_shared<sentinel::DryRunStage>();
+  auto weakMutation = std::make_shared<sentinel::WeakMutationStage>(
+      [&cfg](const std::vector<std::pair<int, sentinel::Mutant>>& mutants, std::set<int>* probed) {
+        return sentinel::WeakMutationInstrumenter(cfg.compileDbDir).instrument(cfg.sourceDir, mutants, probed);
+      });
   auto evaluation = std::make_shared<sentinel::EvaluationStage>(repo);
   auto report = std::make_shared<sentinel::ReportStage>();
 
-  originalBuild->setNext(originalTest)->setNext(generation)->setNext(dryRunStage)->setNext(evaluation)->setNext(report);
+  if (!cfg.generateOnly.empty()) {
+    // The plan is written by the generation stage, which then ends the chain.
+    // The original build stays in front of it: it writes compile_commands.json
+    // and any generated headers the sources are parsed with.
+    originalBuild->setNext(generation);
+  } else if (cfg.serveAddress && !cfg.dryRun) {
+    // Workers evaluate the mutants; this process only hands them out.
+    auto coordinator = std::make_shared<sentinel::CoordinatorStage>(repo, *cfg.serveAddress, serveToken);
+    auto baseline = std::make_shared<sentinel::OverlappedStage>(originalTest, generation);
+    originalBuild->setNext(baseline)->setNext(coordinator)->setNext(report);
+  } else if (cfg.stream && !cfg.dryRun && !cfg.partition && cfg.planFile.empty()) {
+    auto streaming = std::make_shared<sentinel::ConcurrentStage>(generation, evaluation);
+    originalBuild->setNext(originalTest)->setNext(streaming)->setNext(report);
+  } else {
+    // Generation only needs compile_commands.json and the sources, so it runs
+    // alongside the original test and is discarded if that test fails.
+    auto baseline = std::make_shared<sentinel::OverlappedStage>(originalTest, generation);
+    originalBuild->setNext(baseline)->setNext(dryRunStage)->setNext(weakMutation)->setNext(evaluation)->setNext(report);
+  }
 
-  // 11. Install signal handlers
+  // 12. Install signal handlers
   const std::vector<int> signals = {SIGABRT, SIGINT, SIGFPE, SIGILL, SIGSEGV, SIGTERM, SIGQUIT, SIGHUP, SIGUSR1};
   sentinel::SignalHandler::add(signals, [ws, src = cfg.sourceDir]() { ws->restoreBackup(src); });
   sentinel::SignalHandler::add(signals, [statusLine]() { statusLine->disable(); });
+  // The tokens held by running commands and by the pressure monitor; they would
+  // be lost to every sentinel sharing the pool until it is recreated.
+  if (jobserver) {
+    sentinel::SignalHandler::add(signals, [jobserver]() { jobserver->releaseAll(); });
+  }
 
   sentinel::installOomHandlers();
 
-  // 12. Create pipeline context and run
+  // 13. Create pipeline context and run
   sentinel::PipelineContext ctx{cfg, *statusLine, *ws};
+  if (cfg.watch && !cfg.dryRun && !cfg.partition && !cfg.shared && !cfg.serveAddress && cfg.generateOnly.empty()) {
+    // A score below --threshold is reported but does not end the session.
+    try {
+      originalBuild->run(&ctx);
+    } catch (const sentinel::ThresholdError&) {
+    }
+    sentinel::WatchSession(repo, generator).run(&ctx);
+    return 0;
+  }
   originalBuild->run(&ctx);
   return 0;
 }
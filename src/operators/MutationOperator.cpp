@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include "sentinel/operators/MutationOperator.hpp"
+#include "sentinel/util/io.hpp"
 #include "sentinel/util/string.hpp"
 #include "sentinel/operators/aor.hpp"
 #include "sentinel/operators/bor.hpp"
@@ -213,6 +214,17 @@ void MutationOperator::emitMutant(Mutants* mutables, const std::string& path, co
                          mSrcMgr.getExpansionLineNumber(startLoc), mSrcMgr.getExpansionColumnNumber(startLoc),
                          mSrcMgr.getExpansionLineNumber(endLoc), mSrcMgr.getExpansionColumnNumber(endLoc),
                          token);
+  // Mutants are in the main file, outside macros (isValidMutantSourceRange), so
+  // the offsets of both locations are offsets in that file.
+  if (mFileHash.empty()) {
+    bool invalid = false;
+    const llvm::StringRef content = mSrcMgr.getBufferData(mSrcMgr.getMainFileID(), &invalid);
+    if (invalid) {
+      return;
+    }
+    mFileHash = io::hashContent(content.str());
+  }
+  mutables->back().setOffsets(mSrcMgr.getFileOffset(startLoc), mSrcMgr.getFileOffset(endLoc), mFileHash);
 }
 
 void resolveExpansionLineRange(clang::Stmt* s, clang::SourceManager* srcMgr,
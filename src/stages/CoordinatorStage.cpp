@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <yaml-cpp/yaml.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#include "sentinel/CoverageInfo.hpp"
+#include "sentinel/Evaluator.hpp"
+#include "sentinel/Logger.hpp"
+#include "sentinel/VerdictCache.hpp"
+#include "sentinel/WorkerProtocol.hpp"
+#include "sentinel/Workspace.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/stages/CoordinatorStage.hpp"
+#include "sentinel/stages/EvaluationStage.hpp"
+#include "sentinel/util/ScopeGuard.hpp"
+#include "sentinel/util/net.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct Assignment {
+  std::size_t position;
+  int id;
+  Mutant mutant;
+};
+
+struct WorkerConnection {
+  int fd;
+  std::string name;
+  net::FrameReader reader;
+  std::optional<Assignment> assigned;
+  bool ready = false;
+  std::chrono::steady_clock::time_point lastSeen;
+  bool refused = false;
+  bool stalled = false;
+};
+
+/**
+ * SETUP body: the time limit and the original test results every worker
+ * compares its mutant test results against.
+ */
+std::string makeSetup(std::size_t timeLimit, const fs::path& resultsDir) {
+  YAML::Emitter out;
+  out << YAML::BeginMap;
+  out << YAML::Key << "timeout" << YAML::Value << timeLimit;
+  out << YAML::Key << "results" << YAML::Value << YAML::BeginMap;
+  if (fs::is_directory(resultsDir)) {
+    for (const auto& entry : fs::recursive_directory_iterator(resultsDir)) {
+      if (!entry.is_regular_file()) {
+        continue;
+      }
+      std::ifstream in(entry.path());
+      std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+      out << YAML::Key << entry.path().lexically_relative(resultsDir).string() << YAML::Value << content;
+    }
+  }
+  out << YAML::EndMap;
+  out << YAML::EndMap;
+  return out.c_str();
+}
+
+void writeLog(const fs::path& path, const std::string& content) {
+  std::ofstream out(path);
+  out << content;
+}
+
+using ResultCallback = std::function<void(const Assignment&, const MutationResult&)>;
+
+/**
+ * Accept workers on @p address and hand out @p pending until every mutant has
+ * a result. Returns once all results are in; remaining workers receive DONE.
+ * @p setup is the encoded SETUP frame sent to every worker that says HELLO.
+ */
+void serve(const std::string& address, const std::string& token, const std::string& setup, Workspace* workspace,
+           std::deque<Assignment>* pending, const ResultCallback& onResult) {
+  const int listenFd = net::listen(address);
+  ScopeGuard closeListener{[&] {
+    ::close(listenFd);
+    if (address.rfind("unix:", 0) == 0) {
+      std::error_code ec;
+      fs::remove(address.substr(std::strlen("unix:")), ec);
+    }
+  }};
+  Logger::info("Waiting for workers on '{}'...", net::getLocalAddress(listenFd));
+
+  std::list<WorkerConnection> workers;
+  ScopeGuard closeWorkers{[&] {
+    for (auto& w : workers) {
+      net::sendFrame(w.fd, protocol::encode(protocol::kDone));
+      ::close(w.fd);
+    }
+  }};
+
+  auto drop = [&](std::list<WorkerConnection>::iterator it, const std::string& reason) {
+    const std::string name = it->name.empty() ? "(unnamed)" : it->name;
+    if (it->assigned) {
+      Logger::warn("Worker '{}' {}; mutant {} is handed out again.", name, reason, it->assigned->id);
+      pending->push_front(std::move(*it->assigned));
+    } else {
+      Logger::info("Worker '{}' {}.", name, reason);
+    }
+    ::close(it->fd);
+    return workers.erase(it);
+  };
+
+  // Returns false if the worker broke the protocol.
+  auto handle = [&](WorkerConnection* w, const protocol::Message& msg) {
+    if (msg.type == protocol::kHeartbeat) {
+      return true;
+    }
+    if (msg.type == protocol::kHello) {
+      if (!w->name.empty()) {
+        return false;
+      }
+      const protocol::Message hello = protocol::decode(msg.body);
+      const protocol::Message identity = protocol::decode(hello.body);
+      if (hello.type != std::to_string(protocol::kVersion) || !protocol::matchesToken(token, identity.type)) {
+        w->refused = true;
+        net::sendFrame(w->fd, protocol::encode(protocol::kRefused));
+        return false;
+      }
+      if (identity.body.empty()) {
+        return false;
+      }
+      w->name = identity.body;
+      Logger::info("Worker '{}' connected.", w->name);
+      if (!net::sendFrame(w->fd, setup)) {
+        w->stalled = true;
+        return false;
+      }
+      return true;
+    }
+    if (w->name.empty()) {
+      return false;
+    }
+    if (msg.type == protocol::kReady) {
+      // A worker asks for the next mutant only after sending the result of the
+      // last one; accepting READY before would lose the mutant it holds.
+      if (w->assigned) {
+        return false;
+      }
+      w->ready = true;
+      return true;
+    }
+    if (msg.type != protocol::kResult || !w->assigned) {
+      return false;
+    }
+    const YAML::Node node = YAML::Load(msg.body);
+    if (!node["id"] || node["id"].as<int>() != w->assigned->id || !node["result"]) {
+      return false;
+    }
+    std::istringstream in(node["result"].as<std::string>());
+    MutationResult result;
+    if (!(in >> result)) {
+      return false;
+    }
+    const int id = w->assigned->id;
+    writeLog(workspace->getMutantBuildLog(id), node["build-log"].as<std::string>(""));
+    writeLog(workspace->getMutantTestLog(id), node["test-log"].as<std::string>(""));
+    const Assignment assignment = std::move(*w->assigned);
+    w->assigned.reset();
+    onResult(assignment, result);
+    return true;
+  };
+
+  auto hasAssignment = [&] {
+    for (const auto& w : workers) {
+      if (w.assigned) return true;
+    }
+    return false;
+  };
+
+  static constexpr int kPollTimeoutMs = 1000;
+  while (!pending->empty() || hasAssignment()) {
+    std::vector<pollfd> fds{{listenFd, POLLIN, 0}};
+    for (const auto& w : workers) {
+      fds.push_back({w.fd, POLLIN, 0});
+    }
+    if (::poll(fds.data(), fds.size(), kPollTimeoutMs) < 0 && errno != EINTR) {
+      throw IOException(errno, fmt::format("Failed to wait for workers: {}", std::strerror(errno)));
+    }
+    const auto now = std::chrono::steady_clock::now();
+
+    std::size_t index = 1;
+    for (auto it = workers.begin(); it != workers.end(); ++index) {
+      if ((fds[index].revents & (POLLIN | POLLHUP | POLLERR)) == 0) {
+        ++it;
+        continue;
+      }
+      char buffer[64 * 1024];
+      const ssize_t n = ::recv(it->fd, buffer, sizeof(buffer), 0);
+      if (n <= 0) {
+        it = drop(it, "disconnected");
+        continue;
+      }
+      it->reader.append(buffer, static_cast<std::size_t>(n));
+      it->lastSeen = now;
+      bool valid = true;
+      while (valid) {
+        auto frame = it->reader.next();
+        if (!frame) break;
+        try {
+          valid = handle(&*it, protocol::decode(*frame));
+        } catch (const YAML::Exception&) {
+          valid = false;
+        }
+      }
+      if (!valid && it->stalled) {
+        it = drop(it, "did not accept the setup");
+        continue;
+      }
+      if (!valid && it->refused) {
+        it = drop(it, fmt::format("was refused: another sentinel version or {}", protocol::kTokenEnv));
+        continue;
+      }
+      if (!valid || it->reader.isMalformed()) {
+        it = drop(it, "sent an invalid message and was disconnected");
+        continue;
+      }
+      ++it;
+    }
+
+    if ((fds[0].revents & POLLIN) != 0) {
+      const int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+      if (fd >= 0) {
+        // The loop serves every worker, so a worker that stops reading must not block it.
+        net::setSendTimeout(fd, protocol::kSendTimeout);
+        workers.push_back(WorkerConnection{fd, "", {}, std::nullopt, false, now, false, false});
+      }
+    }
+
+    for (auto it = workers.begin(); it != workers.end();) {
+      if (now - it->lastSeen > protocol::kHeartbeatTimeout) {
+        it = drop(it, "stopped sending heartbeats");
+        continue;
+      }
+      if (it->ready && !pending->empty()) {
+        Assignment next = std::move(pending->front());
+        pending->pop_front();
+        std::ostringstream body;
+        body << next.id << '\n' << next.mutant;
+        it->ready = false;
+        it->assigned = std::move(next);
+        if (!net::sendFrame(it->fd, protocol::encode(protocol::kMutant, body.str()))) {
+          it = drop(it, "disconnected or stopped reading");
+          continue;
+        }
+      }
+      ++it;
+    }
+  }
+}
+
+}  // namespace
+
+CoordinatorStage::CoordinatorStage(std::shared_ptr<GitRepository> repo, std::string address, std::string token) :
+    mRepo(std::move(repo)), mAddress(std::move(address)), mToken(std::move(token)) {
+}
+
+bool CoordinatorStage::shouldSkip(const PipelineContext& ctx) const {
+  return ctx.workspace.isComplete();
+}
+
+StatusLine::Phase CoordinatorStage::getPhase() const {
+  return StatusLine::Phase::EVALUATION;
+}
+
+bool CoordinatorStage::execute(PipelineContext* ctx) {
+  Workspace& workspace = ctx->workspace;
+  const auto mutants = workspace.loadMutants();
+  const std::size_t total = mutants.size();
+  Logger::info("Evaluating {} mutant{} on workers...", total, total == 1 ? "" : "s");
+  ctx->statusLine.setProgressTotal(total);
+
+  Evaluator evaluator(workspace.getOriginalResultsDir());
+  CoverageInfo coverageInfo(ctx->config.lcovTracefiles);
+  const bool hasCoverage = !ctx->config.lcovTracefiles.empty();
+  std::unique_ptr<VerdictCache> cache = EvaluationStage::openVerdictCache(*ctx, mRepo.get());
+
+  std::size_t completed = 0;
+  auto complete = [&](std::size_t position, int id, const MutationResult& result) {
+    EvaluationStage::printResult(position, total, id, result, workspace);
+    workspace.setDone(id, result);
+    ctx->statusLine.recordResult(result.getMutationState(), result.isUncovered());
+    ctx->statusLine.setProgressCurrent(++completed);
+  };
+
+  // Mutants that need no build are resolved here; the rest go to the workers.
+  std::deque<Assignment> pending;
+  std::size_t position = 0;
+  for (const auto& [id, m] : mutants) {
+    ++position;
+    if (workspace.isDone(id)) {
+      auto doneResult = workspace.getDoneResult(id);
+      ctx->statusLine.recordResult(doneResult.getMutationState(), doneResult.isUncovered());
+      ctx->statusLine.setProgressCurrent(++completed);
+      continue;
+    }
+    if (hasCoverage) {
+      std::error_code ec;
+      const auto absPath = fs::canonical(ctx->config.sourceDir / m.getPath(), ec);
+      if (ec || !coverageInfo.cover(absPath.string(), m.getFirst().line)) {
+        complete(position, id, evaluator.compare(m, workspace.getActualDir(), TestExecutionState::UNCOVERED));
+        continue;
+      }
+    }
+    if (cache) {
+      if (auto cached = cache->find(m)) {
+        complete(position, id, *cached);
+        continue;
+      }
+    }
+    pending.push_back({position, id, m});
+  }
+
+  if (!pending.empty()) {
+    const std::string setup = protocol::encode(
+        protocol::kSetup, makeSetup(EvaluationStage::getTimeLimit(*ctx), workspace.getOriginalResultsDir()));
+    // Every result file goes out in one frame; a larger one could never be sent.
+    if (setup.size() > net::kMaxFrameSize) {
+      throw std::runtime_error(
+          fmt::format("The original test results in '{}' are too large to send to workers ({} bytes; at most {}).",
+                      workspace.getOriginalResultsDir().string(), setup.size(), net::kMaxFrameSize));
+    }
+    serve(mAddress, mToken, setup, &workspace, &pending, [&](const Assignment& a, const MutationResult& result) {
+      if (cache && result.getMutationState() != MutationState::TIMEOUT) {
+        cache->store(result);
+      }
+      complete(a.position, a.id, result);
+    });
+  }
+
+  workspace.setComplete();
+  return true;
+}
+
+}  // namespace sentinel
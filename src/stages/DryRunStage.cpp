@@ -3,11 +3,130 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <fmt/core.h>
+#include <algorithm>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "sentinel/Console.hpp"
+#include "sentinel/JitTestExecutor.hpp"
 #include "sentinel/Logger.hpp"
+#include "sentinel/PartitionPlanner.hpp"
+#include "sentinel/RuntimeEstimator.hpp"
+#include "sentinel/Subprocess.hpp"
+#include "sentinel/Timestamper.hpp"
+#include "sentinel/exceptions/IOException.hpp"
 #include "sentinel/stages/DryRunStage.hpp"
+#include "sentinel/util/Utf8Char.hpp"
 
 namespace sentinel {
 
+namespace fs = std::filesystem;
+
+static constexpr std::size_t kSummaryWidth = 80;
+static constexpr std::size_t kRebuildSamples = 3;
+static constexpr std::size_t kPartitionLevels[] = {2, 4, 8};
+
+/**
+ * @brief Touch a source file and time the incremental rebuild it triggers.
+ *
+ * Only the modification time changes, so the tree is left as it was and the
+ * rebuild reproduces the work evaluation does after restoring a mutated file.
+ */
+static std::optional<double> measureRebuild(const PipelineContext& ctx, const fs::path& file,
+                                            const fs::path& log, bool silent) {
+  std::error_code ec;
+  fs::last_write_time(file, fs::file_time_type::clock::now(), ec);
+  if (ec) {
+    Logger::verbose("Cannot touch '{}' for rebuild sampling: {}", file.string(), ec.message());
+    return std::nullopt;
+  }
+  Timestamper timer;
+  Subprocess buildProc(ctx.config.buildCmd, 0, log.string(), silent);
+  buildProc.execute();
+  if (!buildProc.isSuccessfulExit()) {
+    Logger::verbose("Rebuild after touching '{}' failed. See: {}", file.string(), log.string());
+    return std::nullopt;
+  }
+  return timer.toDouble();
+}
+
+/**
+ * @brief Time one run of the original test program in the JIT (jit-bitcode).
+ *
+ * The run is made in a forked child, like the runs of the mutants, and
+ * includes the compilation of the program.
+ */
+static std::optional<double> measureJitRun(const PipelineContext& ctx, const fs::path& log, bool silent) {
+  std::unique_ptr<JitTestExecutor> jit;
+  try {
+    jit = std::make_unique<JitTestExecutor>(ctx.config.jitBitcode);
+  } catch (const IOException& e) {
+    Logger::warn("Cannot time a JIT test run: {}", e.what());
+    return std::nullopt;
+  }
+  Timestamper timer;
+  Subprocess testProc([&jit] { return jit->run(nullptr, ""); }, 0, log, silent);
+  testProc.execute();
+  if (!testProc.isSuccessfulExit()) {
+    Logger::verbose("The JIT test run of the original program failed. See: {}", log.string());
+    return std::nullopt;
+  }
+  return timer.toDouble();
+}
+
+static void printRuntimeEstimate(const RuntimeEstimator& estimator, const std::vector<fs::path>& files,
+                                 double testSeconds, const std::map<fs::path, double>& samples,
+                                 const WorkspaceStatus& status, const PartitionPlanner& planner,
+                                 std::optional<double> jitSeconds) {
+  const std::string thick = Utf8Char::ThickLine * kSummaryWidth;
+  const std::string thin = Utf8Char::ThinLine * kSummaryWidth;
+  const bool partitioned = status.partCount.value_or(0) > 0;
+  const double total = estimator.estimate(files);
+
+  Console::out("{}", thick);
+  Console::out("{:^{}}", "Runtime Estimate", kSummaryWidth);
+  Console::out("{}", thick);
+  Console::out("  Test run:   {}", Timestamper::format(testSeconds));
+  if (samples.empty()) {
+    Console::out("  Rebuild:    not measured (assumed 0s)");
+  } else {
+    double sum = 0.0;
+    for (const auto& [file, seconds] : samples) {
+      sum += seconds;
+    }
+    Console::out("  Rebuild:    {} per file (mean of {} sampled file{})",
+                 Timestamper::format(sum / static_cast<double>(samples.size())), samples.size(),
+                 samples.size() == 1 ? "" : "s");
+  }
+  if (jitSeconds) {
+    Console::out("  JIT run:    {} per mutant applied to the IR (no rebuild)", Timestamper::format(*jitSeconds));
+  }
+  Console::out("  Mutants:    {}", files.size());
+  if (partitioned) {
+    Console::out("  Estimate:   {} (partition {}/{})", Timestamper::format(total), *status.partIndex,
+                 *status.partCount);
+  } else {
+    Console::out("  Estimate:   {}", Timestamper::format(total));
+    Console::out("{}", thin);
+    Console::out("  {:<14}{:>24}", "--partition", "Slowest partition");
+    Console::out("{}", thin);
+    for (std::size_t count : kPartitionLevels) {
+      if (count > files.size()) {
+        break;
+      }
+      auto parts = estimator.estimatePartitions(files, count, planner);
+      Console::out("  {:<14}{:>24}", fmt::format("N/{}", count),
+                   Timestamper::format(*std::max_element(parts.begin(), parts.end())));
+    }
+  }
+  Console::out("{}", thick);
+}
+
 bool DryRunStage::shouldSkip(const PipelineContext& ctx) const {
   return !ctx.config.dryRun;
 }
@@ -17,7 +136,46 @@ StatusLine::Phase DryRunStage::getPhase() const {
 }
 
 bool DryRunStage::execute(PipelineContext* ctx) {
-  ctx->statusLine.setProgressTotal(ctx->workspace.loadMutants().size());
+  auto mutants = ctx->workspace.loadMutants();
+  ctx->statusLine.setProgressTotal(mutants.size());
+
+  const WorkspaceStatus status = ctx->workspace.loadStatus();
+  if (mutants.empty()) {
+    Logger::info("Evaluation skipped (dry run).");
+    return false;
+  }
+  if (!status.originalTestSeconds) {
+    Logger::info("Runtime estimate unavailable: the original test time was not recorded in this workspace.");
+    Logger::info("Evaluation skipped (dry run).");
+    return false;
+  }
+
+  std::vector<fs::path> files;
+  files.reserve(mutants.size());
+  for (const auto& [id, m] : mutants) {
+    files.push_back(m.getPath());
+  }
+
+  Logger::info("Sampling incremental rebuild time...");
+  const fs::path log = ctx->workspace.getOriginalDir() / "rebuild-sample.log";
+  std::map<fs::path, double> samples;
+  for (const auto& file : RuntimeEstimator::selectSamples(files, kRebuildSamples)) {
+    auto seconds = measureRebuild(*ctx, ctx->config.sourceDir / file, log, !isVerbose(*ctx));
+    if (seconds) {
+      Logger::verbose("Rebuild after touching '{}': {}", file.string(), Timestamper::format(*seconds));
+      samples.emplace(file, *seconds);
+    }
+  }
+
+  std::optional<double> jitSeconds;
+  if (!ctx->config.jitBitcode.empty()) {
+    Logger::info("Timing a JIT test run...");
+    jitSeconds = measureJitRun(*ctx, ctx->workspace.getOriginalDir() / "jit-sample.log", !isVerbose(*ctx));
+  }
+
+  RuntimeEstimator estimator(*status.originalTestSeconds, samples);
+  printRuntimeEstimate(estimator, files, *status.originalTestSeconds, samples, status,
+                       PartitionPlanner::fromConfig(ctx->config), jitSeconds);
   Logger::info("Evaluation skipped (dry run).");
   return false;
 }
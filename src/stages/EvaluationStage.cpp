@@ -5,23 +5,38 @@
 
 #include <fmt/core.h>
 #include <algorithm>
+#include <chrono>
+#include <cctype>
 #include <filesystem>  // NOLINT
+#include <fstream>
 #include <map>
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include "sentinel/Console.hpp"
 #include "sentinel/CoverageInfo.hpp"
 #include "sentinel/Evaluator.hpp"
 #include "sentinel/GitRepository.hpp"
+#include "sentinel/IrMutator.hpp"
+#include "sentinel/JitTestExecutor.hpp"
 #include "sentinel/Logger.hpp"
+#include "sentinel/NinjaGraph.hpp"
 #include "sentinel/StatusLine.hpp"
 #include "sentinel/Subprocess.hpp"
+#include "sentinel/TestCallGraph.hpp"
 #include "sentinel/Timestamper.hpp"
+#include "sentinel/VerdictCache.hpp"
 #include "sentinel/Workspace.hpp"
+#include "sentinel/exceptions/IOException.hpp"
 #include "sentinel/stages/EvaluationStage.hpp"
 #include "sentinel/util/Utf8Char.hpp"
+#include "sentinel/util/PeriodicTask.hpp"
 #include "sentinel/util/ScopeGuard.hpp"
 #include "sentinel/util/io.hpp"
 #include "sentinel/util/string.hpp"
@@ -30,6 +45,35 @@ namespace sentinel {
 
 namespace fs = std::filesystem;
 
+std::unique_ptr<VerdictCache> EvaluationStage::openVerdictCache(const PipelineContext& ctx, GitRepository* repo) {
+  const Config& config = ctx.config;
+  if (config.cacheDir.empty()) {
+    return nullptr;
+  }
+  const fs::path root = fs::canonical(config.sourceDir);
+  std::vector<fs::path> dirs = {ctx.workspace.getRoot(), config.compileDbDir, config.testResultDir, config.outputDir,
+                                config.cacheDir};
+  for (const auto& scope : config.scopes) {
+    dirs.push_back(scope.testResultDir);
+  }
+  std::vector<fs::path> skipDirs;
+  for (const auto& dir : dirs) {
+    std::error_code ec;
+    fs::path canon = fs::weakly_canonical(dir, ec);
+    if (!dir.empty() && !ec && canon != root) {
+      skipDirs.push_back(canon);
+    }
+  }
+  std::vector<fs::path> contextFiles;
+  for (const auto& file : io::listSourceFiles(root, skipDirs, config.extensions)) {
+    if (!repo->isTargetPath(file)) {
+      contextFiles.push_back(file);
+    }
+  }
+  Logger::verbose("Verdict cache: '{}' ({} context files)", config.cacheDir.string(), contextFiles.size());
+  return std::make_unique<VerdictCache>(config, contextFiles);
+}
+
 EvaluationStage::EvaluationStage(std::shared_ptr<GitRepository> repo) :
     mRepo(std::move(repo)) {
 }
@@ -43,39 +87,106 @@ StatusLine::Phase EvaluationStage::getPhase() const {
 }
 
 bool EvaluationStage::execute(PipelineContext* ctx) {
-  auto indexedMutants = ctx->workspace.loadMutants();
-  std::size_t totalMutants = indexedMutants.size();
-  Logger::info("Evaluating {} mutant{}...", totalMutants, totalMutants == 1 ? "" : "s");
-  ctx->statusLine.setProgressTotal(totalMutants);
-
-  // Determine timeout
-  const bool isAutoTimeout = !ctx->config.timeout.has_value();
-  std::size_t computedTimeLimit = 0;
-  if (isAutoTimeout) {
-    auto status = ctx->workspace.loadStatus();
-    computedTimeLimit = status.originalTime.value_or(0);
+  // While generation streams mutants through ctx->mutantQueue the total is not
+  // known up front; it grows with every mutant the generator hands over.
+  MutantQueue* queue = ctx->mutantQueue;
+  // The budget needs every mutant up front to spread the evaluated ones over
+  // the files and operators, and a single process to account for the time.
+  const std::optional<std::size_t> budget =
+      queue == nullptr && !ctx->config.shared ? ctx->config.timeBudget : std::nullopt;
+  std::vector<std::pair<int, Mutant>> indexedMutants;
+  std::size_t totalMutants = 0;
+  if (queue == nullptr) {
+    indexedMutants = ctx->workspace.loadMutants();
+    totalMutants = indexedMutants.size();
+    if (budget) {
+      indexedMutants = stratify(indexedMutants);
+      Logger::info("Evaluating {} mutant{} within a time budget of {}...", totalMutants,
+                   totalMutants == 1 ? "" : "s", Timestamper::format(static_cast<double>(*budget)));
+    } else {
+      Logger::info("Evaluating {} mutant{}...", totalMutants, totalMutants == 1 ? "" : "s");
+    }
+    ctx->statusLine.setProgressTotal(totalMutants);
   } else {
-    computedTimeLimit = *ctx->config.timeout;
+    Logger::info("Evaluating mutants as they are generated...");
   }
+  auto nextIt = indexedMutants.begin();
+  auto nextMutant = [&]() -> std::optional<std::pair<int, Mutant>> {
+    if (queue != nullptr) {
+      return queue->pop();
+    }
+    if (nextIt == indexedMutants.end()) {
+      return std::nullopt;
+    }
+    return *nextIt++;
+  };
+
+  const std::size_t computedTimeLimit = getTimeLimit(*ctx);
   Evaluator evaluator(ctx->workspace.getOriginalResultsDir());
 
+  // Mutants in a scope are compared with the original results and timed
+  // against the original test of that scope.
+  const auto& scopes = ctx->config.scopes;
+  std::vector<std::unique_ptr<Evaluator>> scopeEvaluators;
+  std::vector<std::size_t> scopeTimeLimits;
+  if (!scopes.empty()) {
+    const auto scopeTimes = ctx->workspace.loadStatus().scopeOriginalTimes;
+    for (std::size_t i = 0; i < scopes.size(); i++) {
+      scopeEvaluators.push_back(std::make_unique<Evaluator>(ctx->workspace.getOriginalScopeResultsDir(i)));
+      scopeTimeLimits.push_back(ctx->config.timeout ? *ctx->config.timeout
+                                : scopeTimes && i < scopeTimes->size() ? (*scopeTimes)[i]
+                                : computedTimeLimit);
+    }
+  }
+
   CoverageInfo coverageInfo(ctx->config.lcovTracefiles);
   const bool hasCoverage = !ctx->config.lcovTracefiles.empty();
+  if (ctx->config.staticTestSelection && !hasCoverage && !mCallGraph) {
+    Logger::info("Building the static call graph of the tests...");
+    mCallGraph = std::make_unique<TestCallGraph>(ctx->config.compileDbDir);
+    const auto& failed = mCallGraph->getFailedFiles();
+    if (!failed.empty()) {
+      Logger::warn("Static test selection is disabled: {} of {} files could not be parsed without errors "
+                   "(first: '{}'). Every mutant runs the whole test suite.", failed.size(),
+                   mCallGraph->getFileCount(), failed.front());
+    } else {
+      Logger::info("Static call graph: {} test{} in {} file{}.", mCallGraph->getTests().size(),
+                   mCallGraph->getTests().size() == 1 ? "" : "s", mCallGraph->getFileCount(),
+                   mCallGraph->getFileCount() == 1 ? "" : "s");
+    }
+  }
+  if (!ctx->config.jitBitcode.empty() && !mJit) {
+    Logger::info("Reading the test program '{}' for JIT test runs...", ctx->config.jitBitcode.string());
+    try {
+      mJit = std::make_unique<JitTestExecutor>(ctx->config.jitBitcode);
+    } catch (const IOException& e) {
+      Logger::warn("JIT test runs are disabled: {}. Every mutant is built and tested with the commands.", e.what());
+    }
+  }
+  std::unique_ptr<VerdictCache> cache = openVerdictCache(*ctx, mRepo.get());
+  std::size_t cacheHits = 0;
+
+  // Mutants whose value never differed from the original while the tests ran
+  // against the instrumented build (WeakMutationStage).
+  std::set<int> notInfectedIds;
+  if (const auto notInfected = ctx->workspace.loadStatus().notInfected) {
+    notInfectedIds.insert(notInfected->begin(), notInfected->end());
+  }
 
   // Cache canonical paths so repeated mutants on the same file do not pay the
   // filesystem cost N times in the per-mutant hot loop.
   std::map<fs::path, std::string> canonCache;
   std::size_t current = 0;
 
-  for (const auto& [id, m] : indexedMutants) {
-    ++current;
-    if (ctx->workspace.isDone(id)) {
-      auto doneResult = ctx->workspace.getDoneResult(id);
-      ctx->statusLine.recordResult(doneResult.getMutationState(), doneResult.isUncovered());
-      continue;
+  Workspace& workspace = ctx->workspace;
+  const bool shared = ctx->config.shared;
+  auto evaluateClaimed = [&](std::size_t position, int id, const Mutant& m) {
+    // Renew the lock while the mutant is evaluated so that processes sharing
+    // the workspace do not take it over.
+    std::optional<PeriodicTask> renewal;
+    if (shared) {
+      renewal.emplace(kLockRenewInterval, [&workspace, id] { workspace.renewLock(id); });
     }
-    // isLocked: treat as incomplete — fall through to re-evaluate
-    ctx->workspace.setLock(id);
 
     bool uncovered = false;
     if (hasCoverage) {
@@ -87,98 +198,593 @@ bool EvaluationStage::execute(PipelineContext* ctx) {
         it->second = ec ? std::string{} : absPath.string();
       }
       uncovered = it->second.empty() || !coverageInfo.cover(it->second, m.getFirst().line);
+    } else if (mCallGraph) {
+      // No test calls the mutated function, directly or indirectly.
+      const auto tests = mCallGraph->getReachingTests(m.getQualifiedFunction());
+      uncovered = tests && tests->empty();
     }
 
-    ctx->statusLine.setProgressCurrent(current);
+    const bool notInfected = !uncovered && notInfectedIds.count(id) != 0;
+
+    const auto scope = Scope::find(scopes, m.getPath());
+    Evaluator& mutantEvaluator = scope ? *scopeEvaluators[*scope] : evaluator;
+    const std::size_t timeLimit = scope ? scopeTimeLimits[*scope] : computedTimeLimit;
 
+    ctx->statusLine.setProgressCurrent(position);
+
+    std::optional<MutationResult> cached;
+    if (cache && !uncovered && !notInfected) {
+      cached = cache->find(m);
+    }
     MutationResult result = uncovered
-        ? evaluator.compare(m, ctx->workspace.getActualDir(), TestExecutionState::UNCOVERED)
-        : evaluateMutant(m, id, computedTimeLimit, &evaluator, ctx);
-
-    static constexpr const char* kUncoveredLabel = "SURVIVED*";
-    static constexpr const char* kUncoveredTiming = "  [no coverage]";
-    const auto state = result.getMutationState();
-    const auto relPath = m.getPath();
-    const std::string token = m.getToken().empty()
-        ? "DELETE" : fmt::format("{} {}", Utf8Char::ArrowRight, m.getToken());
-    // Single source of truth: derive label/timing from the result's metadata,
-    // not the local `uncovered` flag (which only gates evaluator dispatch above).
-    const bool isUncov = result.isUncovered();
-    const char* label = isUncov ? kUncoveredLabel : mutationStateToStr(state);
-    const std::string timing = isUncov ? kUncoveredTiming : fmt::format("  [{}/{}]",
-        Timestamper::format(result.getBuildSecs()), Timestamper::format(result.getTestSecs()));
-    Console::out("  [{:>{}}/{}] {} {:<13} {}  {}:{}:{} ({}){}", current,
-                 fmt::formatted_size("{}", totalMutants), totalMutants,
-                 mutationStateIcon(state), label, m.getOperator(),
-                 relPath, m.getFirst().line, m.getFirst().column, token, timing);
-    if (!result.getKillingTest().empty()) {
-      static constexpr std::size_t kMaxDisplayedTests = 2;
-      auto tests = string::split(result.getKillingTest(), ", ");
-      std::string summary = tests[0];
-      for (std::size_t i = 1; i < std::min(tests.size(), kMaxDisplayedTests); ++i) {
-        summary += ", " + tests[i];
+        ? mutantEvaluator.compare(m, workspace.getActualDir(), TestExecutionState::UNCOVERED)
+        : notInfected ? mutantEvaluator.compare(m, workspace.getActualDir(), TestExecutionState::NOT_INFECTED)
+        : cached ? *cached : evaluateMutant(m, id, timeLimit, &mutantEvaluator, ctx);
+    if (cached) {
+      cacheHits++;
+    } else if (cache && !uncovered && !notInfected && result.getMutationState() != MutationState::TIMEOUT) {
+      // A timeout depends on the machine load at the time, so it is evaluated again next time.
+      cache->store(result);
+    }
+
+    printResult(position, totalMutants, id, result, workspace);
+
+    // The result is in place before the lock goes away, so a process sharing
+    // the workspace never finds the mutant both unlocked and unfinished.
+    renewal.reset();
+    workspace.setDone(id, result);
+    workspace.clearLock(id);
+    ctx->statusLine.recordResult(result.getMutationState(), result.isUncovered());
+  };
+
+  // Claims the mutant for this process. A mutant finished by another process
+  // between the isDone() check and the claim is released again.
+  auto claim = [&](int id) {
+    if (!shared) {
+      // isLocked: treat as incomplete — fall through to re-evaluate
+      workspace.setLock(id);
+      return true;
+    }
+    if (!workspace.tryLock(id, workspace.getWorkerName())) {
+      return false;
+    }
+    if (workspace.isDone(id)) {
+      workspace.clearLock(id);
+      return false;
+    }
+    return true;
+  };
+
+  // Mutants locked by other processes sharing the workspace (--shared), with
+  // their position in the list.
+  std::vector<std::tuple<std::size_t, int, Mutant>> claimedElsewhere;
+
+  // With a budget, the next mutant is expected to take as long as the average
+  // of those evaluated so far in this run.
+  const auto budgetStart = std::chrono::steady_clock::now();
+  std::size_t evaluatedHere = 0;
+  bool budgetUsed = false;
+
+  while (auto next = nextMutant()) {
+    const auto& [id, m] = *next;
+    ++current;
+    if (queue != nullptr) {
+      totalMutants = queue->getPushedCount();
+      ctx->statusLine.setProgressTotal(totalMutants);
+    }
+    if (workspace.isDone(id)) {
+      auto doneResult = workspace.getDoneResult(id);
+      ctx->statusLine.recordResult(doneResult.getMutationState(), doneResult.isUncovered());
+      continue;
+    }
+    if (budget) {
+      const double elapsed =
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - budgetStart).count();
+      const double expected = evaluatedHere > 0 ? elapsed / static_cast<double>(evaluatedHere) : 0.0;
+      if (elapsed + expected > static_cast<double>(*budget)) {
+        budgetUsed = true;
+        break;
       }
-      if (tests.size() > kMaxDisplayedTests) {
-        summary += fmt::format(" (+{} more)", tests.size() - kMaxDisplayedTests);
+    }
+    if (!claim(id)) {
+      claimedElsewhere.emplace_back(current, id, m);
+      continue;
+    }
+    evaluateClaimed(current, id, m);
+    ++evaluatedHere;
+  }
+
+  if (!claimedElsewhere.empty()) {
+    Logger::info("Waiting for {} mutant{} evaluated by other processes...", claimedElsewhere.size(),
+                 claimedElsewhere.size() == 1 ? "" : "s");
+  }
+  // A lock that is not renewed within kStaleLockTimeout belongs to a process
+  // that stopped; the mutant is taken over. Staleness is measured with the
+  // local clock from the last observed change, so clock skew between hosts
+  // sharing the workspace does not matter.
+  std::map<int, std::pair<fs::file_time_type, std::chrono::steady_clock::time_point>> lastRenewal;
+  while (!claimedElsewhere.empty()) {
+    std::this_thread::sleep_for(kPollInterval);
+    for (auto it = claimedElsewhere.begin(); it != claimedElsewhere.end();) {
+      const auto& [position, id, m] = *it;
+      if (workspace.isDone(id)) {
+        auto doneResult = workspace.getDoneResult(id);
+        ctx->statusLine.recordResult(doneResult.getMutationState(), doneResult.isUncovered());
+        it = claimedElsewhere.erase(it);
+        continue;
+      }
+      const auto lockTime = workspace.getLockTime(id);
+      const auto now = std::chrono::steady_clock::now();
+      if (lockTime) {
+        auto [seen, inserted] = lastRenewal.try_emplace(id, *lockTime, now);
+        if (!inserted && seen->second.first != *lockTime) {
+          seen->second = {*lockTime, now};
+        }
+        if (now - seen->second.second < kStaleLockTimeout || !workspace.breakLock(id, *lockTime)) {
+          ++it;
+          continue;
+        }
+        Logger::warn("Mutant {}: its lock was not renewed for {}s; evaluating it here.", id,
+                     kStaleLockTimeout.count());
+      }
+      lastRenewal.erase(id);
+      if (!claim(id)) {
+        ++it;
+        continue;
       }
-      Console::out("          {} {}", Utf8Char::ArrowLeft, summary);
+      evaluateClaimed(position, id, m);
+      it = claimedElsewhere.erase(it);
+    }
+  }
+
+  if (cacheHits > 0) {
+    Logger::info("Reused {} cached verdict{} from '{}'.", cacheHits, cacheHits == 1 ? "" : "s",
+                 ctx->config.cacheDir.string());
+  }
+
+  if (queue != nullptr && queue->isAborted()) {
+    // Generation failed; its error is reported by the ConcurrentStage.
+    return false;
+  }
+  if (budgetUsed) {
+    // The run stays incomplete: the next run resumes it, and the report is a sampled estimate.
+    const auto done = std::count_if(indexedMutants.begin(), indexedMutants.end(),
+                                    [&workspace](const auto& entry) { return workspace.isDone(entry.first); });
+    Logger::info("Time budget of {} used: {} of {} mutant{} evaluated. Run sentinel again to continue.",
+                 Timestamper::format(static_cast<double>(*budget)), done, totalMutants, totalMutants == 1 ? "" : "s");
+    return true;
+  }
+  if (shared) {
+    // Every process sharing the workspace gets here; the first one to mark the
+    // run complete writes the report.
+    if (!workspace.trySetComplete()) {
+      Logger::info("All mutants are evaluated. The report is written by another process sharing '{}'.",
+                   workspace.getRoot().string());
+      return false;
     }
-    if (state == MutationState::BUILD_FAILURE) {
-      Console::out("          {} {}", Utf8Char::ArrowHook, ctx->workspace.getMutantBuildLog(id));
-    } else if (state == MutationState::RUNTIME_ERROR || state == MutationState::TIMEOUT) {
-      Console::out("          {} {}", Utf8Char::ArrowHook, ctx->workspace.getMutantTestLog(id));
+    return true;
+  }
+  workspace.setComplete();
+  return true;
+}
+
+bool EvaluationStage::isCompilerErrorIn(const std::string& line, const fs::path& file) {
+  std::string text;
+  for (std::size_t i = 0; i < line.size(); ++i) {
+    if (line[i] == '\x1b' && i + 1 < line.size() && line[i + 1] == '[') {
+      i = std::min(line.find('m', i), line.size() - 1);
+    } else {
+      text += line[i];
     }
+  }
 
-    ctx->workspace.clearLock(id);
-    ctx->workspace.setDone(id, result);
-    ctx->statusLine.recordResult(result.getMutationState(), result.isUncovered());
+  std::size_t pos = std::string::npos;
+  for (const char* marker : {": error", ": fatal error"}) {
+    const std::size_t found = text.find(marker);
+    const std::size_t next = found + std::char_traits<char>::length(marker);
+    if (found != std::string::npos && next < text.size() && (text[next] == ':' || text[next] == ' ')) {
+      pos = std::min(pos, found);
+    }
+  }
+  if (pos == std::string::npos) {
+    return false;
   }
 
-  ctx->workspace.setComplete();
+  // Drop the position: "(line[,col])" for MSVC, ":line[:col]" otherwise.
+  std::string location = string::trim(text.substr(0, pos));
+  std::replace(location.begin(), location.end(), '\\', '/');
+  auto isDigits = [](const std::string& s) {
+    return !s.empty() && std::all_of(s.begin(), s.end(), [](unsigned char c) { return std::isdigit(c); });
+  };
+  if (string::endsWith(location, ")") && location.rfind('(') != std::string::npos) {
+    location.erase(location.rfind('('));
+  } else {
+    for (int i = 0; i < 2; ++i) {
+      const std::size_t colon = location.rfind(':');
+      if (colon == std::string::npos || !isDigits(location.substr(colon + 1))) {
+        break;
+      }
+      location.erase(colon);
+    }
+  }
+  if (location.empty()) {
+    return false;
+  }
+
+  std::vector<std::string> reported;
+  for (const auto& part : fs::path(location).lexically_normal()) {
+    if (part != "." && part != ".." && part != "/" && !part.empty()) {
+      reported.push_back(part.string());
+    }
+  }
+  std::vector<std::string> expected;
+  for (const auto& part : file.lexically_normal()) {
+    if (part != "." && part != ".." && part != "/" && !part.empty()) {
+      expected.push_back(part.string());
+    }
+  }
+  const std::size_t n = std::min(reported.size(), expected.size());
+  return n > 0 && std::equal(reported.end() - n, reported.end(), expected.end() - n);
+}
+
+std::vector<std::pair<int, Mutant>> EvaluationStage::stratify(const std::vector<std::pair<int, Mutant>>& mutants) {
+  using Entry = const std::pair<int, Mutant>*;
+  // Round-robin over the groups: the first of each group, then the second of each, ...
+  auto interleave = [](const std::vector<std::vector<Entry>>& groups) {
+    std::size_t total = 0;
+    for (const auto& group : groups) {
+      total += group.size();
+    }
+    std::vector<Entry> order;
+    order.reserve(total);
+    for (std::size_t round = 0; order.size() < total; ++round) {
+      for (const auto& group : groups) {
+        if (round < group.size()) {
+          order.push_back(group[round]);
+        }
+      }
+    }
+    return order;
+  };
+
+  // Files and their operators in order of first appearance.
+  std::vector<std::vector<std::vector<Entry>>> files;
+  std::map<fs::path, std::size_t> fileIndex;
+  std::vector<std::map<std::string, std::size_t>> operatorIndex;
+  for (const auto& entry : mutants) {
+    const Mutant& m = entry.second;
+    auto [fileIt, newFile] = fileIndex.try_emplace(m.getPath(), files.size());
+    if (newFile) {
+      files.emplace_back();
+      operatorIndex.emplace_back();
+    }
+    auto& operators = files[fileIt->second];
+    auto [opIt, newOp] = operatorIndex[fileIt->second].try_emplace(m.getOperator(), operators.size());
+    if (newOp) {
+      operators.emplace_back();
+    }
+    operators[opIt->second].push_back(&entry);
+  }
+
+  std::vector<std::vector<Entry>> perFile;
+  perFile.reserve(files.size());
+  for (const auto& operators : files) {
+    perFile.push_back(interleave(operators));
+  }
+  std::vector<std::pair<int, Mutant>> result;
+  result.reserve(mutants.size());
+  for (Entry entry : interleave(perFile)) {
+    result.push_back(*entry);
+  }
+  return result;
+}
+
+std::size_t EvaluationStage::getTimeLimit(const PipelineContext& ctx) {
+  if (ctx.config.timeout.has_value()) {
+    return *ctx.config.timeout;
+  }
+  return ctx.workspace.loadStatus().originalTime.value_or(0);
+}
+
+void EvaluationStage::printResult(std::size_t position, std::size_t total, int id, const MutationResult& result,
+                                  const Workspace& workspace) {
+  static constexpr const char* kUncoveredLabel = "SURVIVED*";
+  static constexpr const char* kUncoveredTiming = "  [no coverage]";
+  static constexpr const char* kCachedTiming = "  [cached]";
+  static constexpr const char* kNotInfectedTiming = "  [not infected]";
+  const auto state = result.getMutationState();
+  const Mutant& m = result.getMutant();
+  const auto relPath = m.getPath();
+  const std::string token = m.getToken().empty()
+      ? "DELETE" : fmt::format("{} {}", Utf8Char::ArrowRight, m.getToken());
+  // Single source of truth: derive label/timing from the result's metadata.
+  const bool isUncov = result.isUncovered();
+  const char* label = isUncov ? kUncoveredLabel : mutationStateToStr(state);
+  const std::string timing = isUncov ? kUncoveredTiming
+      : result.isCached() ? kCachedTiming
+      : result.isNotInfected() ? kNotInfectedTiming
+      : fmt::format("  [{}/{}]", Timestamper::format(result.getBuildSecs()),
+                    Timestamper::format(result.getTestSecs()));
+  Console::out("  [{:>{}}/{}] {} {:<13} {}  {}:{}:{} ({}){}", position,
+               fmt::formatted_size("{}", total), total,
+               mutationStateIcon(state), label, m.getOperator(),
+               relPath, m.getFirst().line, m.getFirst().column, token, timing);
+  if (!result.getKillingTest().empty()) {
+    static constexpr std::size_t kMaxDisplayedTests = 2;
+    auto tests = string::split(result.getKillingTest(), ", ");
+    std::string summary = tests[0];
+    for (std::size_t i = 1; i < std::min(tests.size(), kMaxDisplayedTests); ++i) {
+      summary += ", " + tests[i];
+    }
+    if (tests.size() > kMaxDisplayedTests) {
+      summary += fmt::format(" (+{} more)", tests.size() - kMaxDisplayedTests);
+    }
+    Console::out("          {} {}", Utf8Char::ArrowLeft, summary);
+  }
+  // A cached or not-infected verdict has no build or test log in this workspace.
+  const bool hasLogs = !result.isCached() && !result.isNotInfected();
+  if (hasLogs && state == MutationState::BUILD_FAILURE) {
+    Console::out("          {} {}", Utf8Char::ArrowHook, workspace.getMutantBuildLog(id));
+  } else if (hasLogs && (state == MutationState::RUNTIME_ERROR || state == MutationState::TIMEOUT)) {
+    Console::out("          {} {}", Utf8Char::ArrowHook, workspace.getMutantTestLog(id));
+  }
+}
+
+namespace {
+
+// The operator @p m replaces, read from its line of @p source (empty if it spans lines).
+std::string readOriginalToken(const fs::path& source, const Mutant& m) {
+  std::ifstream in(source);
+  std::string line;
+  std::size_t lineNumber = 0;
+  while (lineNumber < m.getFirst().line && std::getline(in, line)) {
+    lineNumber++;
+  }
+  if (lineNumber != m.getFirst().line || m.getFirst().line != m.getLast().line || m.getFirst().column == 0 ||
+      m.getFirst().column >= m.getLast().column || m.getLast().column > line.size() + 1) {
+    return "";
+  }
+  return line.substr(m.getFirst().column - 1, m.getLast().column - m.getFirst().column);
+}
+
+}  // namespace
+
+bool EvaluationStage::patchObject(const Mutant& m, PipelineContext* ctx) {
+  const Config& config = ctx->config;
+  if (!config.irMutation || !IrMutator::isSupported(m.getOperator())) {
+    return false;
+  }
+  std::error_code ec;
+  const fs::path root = fs::canonical(config.sourceDir, ec);
+  const fs::path source = fs::canonical(config.sourceDir / m.getPath(), ec);
+  if (ec) {
+    return false;
+  }
+  if (!mBitcodeCompiler) {
+    mBitcodeCompiler = std::make_unique<BitcodeCompiler>(config.compileDbDir);
+  }
+  auto [unit, inserted] = mBitcodeUnits.try_emplace(source);
+  if (inserted) {
+    unit->second = mBitcodeCompiler->compile(source);
+    // The original object is restored from the backup directory, relative to the source root.
+    if (unit->second) {
+      unit->second->object = fs::weakly_canonical(unit->second->object, ec);
+      const fs::path relative = unit->second->object.lexically_relative(root);
+      if (ec || relative.empty() || *relative.begin() == "..") {
+        unit->second.reset();
+      }
+    }
+    if (!unit->second) {
+      Logger::verbose("The mutants of '{}' cannot be applied to IR; they are built from source.",
+                      m.getPath().string());
+    }
+  }
+  if (!unit->second) {
+    return false;
+  }
+  const BitcodeUnit& bitcode = *unit->second;
+  const fs::path relative = bitcode.object.lexically_relative(root);
+  const fs::path original = ctx->workspace.getObjectDir() / "original" / relative;
+  if (mSavedObjects.count(source) == 0) {
+    // After a mutant built from source, the object holds that mutant until the next build recompiles it.
+    const auto objectTime = fs::last_write_time(bitcode.object, ec);
+    if (ec || objectTime < fs::last_write_time(source)) {
+      return false;
+    }
+    fs::create_directories(original.parent_path());
+    fs::copy_file(bitcode.object, original, fs::copy_options::overwrite_existing);
+    mSavedObjects.insert(source);
+  }
+
+  const std::string originalToken = readOriginalToken(source, m);
+  if (originalToken.empty()) {
+    return false;
+  }
+
+  const fs::path mutated = ctx->workspace.getObjectDir() / "mutant.o";
+  try {
+    if (!IrMutator::writeObject(bitcode, m, originalToken, mutated)) {
+      Logger::verbose("Mutant {}:{}:{} does not match its IR; building it from source.", m.getPath().string(),
+                      m.getFirst().line, m.getFirst().column);
+      return false;
+    }
+  } catch (const IOException& e) {
+    Logger::warn("Failed to generate the object of '{}' ({}); its mutants are built from source.",
+                 m.getPath().string(), e.what());
+    unit->second.reset();
+    return false;
+  }
+  // Backed up like a mutated source: restored after the mutant, or by the signal handler.
+  const fs::path backup = ctx->workspace.getBackupDir() / relative;
+  fs::create_directories(backup.parent_path());
+  fs::copy_file(original, backup, fs::copy_options::overwrite_existing);
+  // Newer than the source, so the build command only relinks.
+  fs::copy_file(mutated, bitcode.object, fs::copy_options::overwrite_existing);
+  fs::remove(mutated, ec);
   return true;
 }
 
+std::pair<std::string, std::string> EvaluationStage::getCommands(const Mutant& m, const PipelineContext& ctx) {
+  const Config& config = ctx.config;
+  // A build that never reported back (it threw) may have left anything behind.
+  finishTargetedBuild(false);
+  // A scope has its own build, so the targets left stale in the default build are kept.
+  if (const auto scope = Scope::find(config.scopes, m.getPath())) {
+    return {config.scopes[*scope].buildCmd, config.scopes[*scope].testCmd};
+  }
+  if (!mNinjaResolved) {
+    mNinjaResolved = true;
+    if (config.targetedBuild && NinjaGraph::isNinjaBuild(config.compileDbDir)) {
+      mNinja = std::make_unique<NinjaGraph>(config.compileDbDir);
+    }
+  }
+  if (!mNinja) {
+    return {config.buildCmd, config.testCmd};
+  }
+  const auto targets = mNinja->getAffectedTargets(fs::canonical(config.sourceDir) / m.getPath());
+  if (targets.empty()) {
+    Logger::verbose("'{}' is not in the Ninja build graph; using the build command.", m.getPath().string());
+    mStaleTargets.reset();
+    return {config.buildCmd, config.testCmd};
+  }
+  // Binaries built for the previous mutant still hold its code until they are
+  // rebuilt. If they are unknown (first mutant of this process, or a file outside
+  // the graph), a full build brings everything up to date.
+  std::string buildCmd = config.buildCmd;
+  if (mStaleTargets) {
+    std::vector<std::string> build = targets;
+    build.insert(build.end(), mStaleTargets->begin(), mStaleTargets->end());
+    std::sort(build.begin(), build.end());
+    build.erase(std::unique(build.begin(), build.end()), build.end());
+    buildCmd = mNinja->getBuildCommand(build);
+  }
+  mBuildingTargets = targets;
+  const std::string testCmd = fmt::format("{}={}; export {}; {}", NinjaGraph::kAffectedTargetsEnv,
+                                          string::shellQuote(string::join(' ', targets)),
+                                          NinjaGraph::kAffectedTargetsEnv, config.testCmd);
+  return {buildCmd, testCmd};
+}
+
+void EvaluationStage::finishTargetedBuild(bool succeeded) {
+  if (!mBuildingTargets) {
+    return;
+  }
+  if (succeeded) {
+    mStaleTargets = std::move(mBuildingTargets);
+  } else if (mStaleTargets) {
+    // Nothing is known to be relinked: the stale targets stay stale, and
+    // those of this mutant may hold its code.
+    mStaleTargets->insert(mStaleTargets->end(), mBuildingTargets->begin(), mBuildingTargets->end());
+    std::sort(mStaleTargets->begin(), mStaleTargets->end());
+    mStaleTargets->erase(std::unique(mStaleTargets->begin(), mStaleTargets->end()), mStaleTargets->end());
+  }
+  // A failed full build leaves the stale targets unknown, so the next mutant gets a full build again.
+  mBuildingTargets.reset();
+}
+
 MutationResult EvaluationStage::evaluateMutant(const Mutant& m, int id, std::size_t timeLimit,
                                                Evaluator* evaluator, PipelineContext* ctx) {
   const fs::path backupDir = ctx->workspace.getBackupDir();
-  const fs::path actualDir = ctx->workspace.getActualDir();
 
   // Install cleanup BEFORE modify so that a throw mid-modify (e.g. backup
-  // copy succeeded but the rewrite failed) still restores any partial backup
-  // and clears actualDir. restoreBackup is a no-op on an empty backup dir.
-  ScopeGuard cleanup{[&] {
-    ctx->workspace.restoreBackup(ctx->config.sourceDir);
-    fs::remove_all(actualDir);
-  }};
-  mRepo->getSourceTree()->modify(m, backupDir.string());
-
+  // copy succeeded but the rewrite failed) still restores any partial backup.
+  // restoreBackup is a no-op on an empty backup dir.
+  ScopeGuard cleanup{[&] { ctx->workspace.restoreBackup(ctx->config.sourceDir); }};
+  // A mutant the JIT can run is neither written nor built.
+  const auto scope = Scope::find(ctx->config.scopes, m.getPath());
+  std::string jitToken;
+  if (mJit && !scope && IrMutator::isSupported(m.getOperator())) {
+    std::error_code ec;
+    const fs::path source = fs::canonical(ctx->config.sourceDir / m.getPath(), ec);
+    const std::string token = ec ? "" : readOriginalToken(source, m);
+    if (!token.empty() && mJit->canApply(m, token)) {
+      jitToken = token;
+    }
+  }
+  // Generating the object of a mutant counts as building it.
   Timestamper buildTimer;
-  Subprocess buildProc(ctx->config.buildCmd, 0, ctx->workspace.getMutantBuildLog(id).string(),
-                       !isVerbose(*ctx));
-  buildProc.execute();
-  const double buildSecs = buildTimer.toDouble();
+  if (jitToken.empty() && !patchObject(m, ctx)) {
+    mRepo->getSourceTree()->modify(m, backupDir.string());
+  }
+
+  std::string buildCmd;
+  std::string testCmd;
+  if (jitToken.empty()) {
+    std::tie(buildCmd, testCmd) = getCommands(m, *ctx);
+  }
+  // Google Test runs only the tests matching the filter; the others are left out of the comparison.
+  // A filter too long for the environment falls back to the whole suite.
+  static constexpr std::size_t kMaxFilterLength = 65536;
+  std::optional<std::vector<std::string>> selectedTests =
+      mCallGraph ? mCallGraph->getReachingTests(m.getQualifiedFunction()) : std::nullopt;
+  const std::string filter = selectedTests ? string::join(':', *selectedTests) : "";
+  if (filter.empty() || filter.size() > kMaxFilterLength) {
+    selectedTests.reset();
+  } else {
+    Logger::verbose("Running {} of {} tests reaching '{}'.", selectedTests->size(), mCallGraph->getTests().size(),
+                    m.getQualifiedFunction());
+    testCmd = fmt::format("{}={}; export {}; {}", TestCallGraph::kFilterEnv, string::shellQuote(filter),
+                          TestCallGraph::kFilterEnv, testCmd);
+  }
+  bool built = true;
+  double buildSecs = 0.0;
+  if (jitToken.empty()) {
+    const fs::path buildLog = ctx->workspace.getMutantBuildLog(id);
+    Subprocess buildProc(buildCmd, 0, buildLog.string(), !isVerbose(*ctx));
+    if (ctx->config.failFastBuild) {
+      buildProc.setOutputWatcher([&m](const std::string& line) { return isCompilerErrorIn(line, m.getPath()); });
+    }
+    buildProc.execute();
+    buildSecs = buildTimer.toDouble();
+    if (buildProc.isStoppedByWatcher()) {
+      Logger::verbose("Stopped the build at the first error in '{}'.", m.getPath().string());
+      std::ofstream(buildLog, std::ios::app) << fmt::format(
+          "\nsentinel: stopped the build at the first error in '{}' (fail-fast-build).\n", m.getPath().string());
+    }
+    built = buildProc.isSuccessfulExit() && !buildProc.isStoppedByWatcher();
+    finishTargetedBuild(built);
+  }
 
+  const fs::path& testResultDir = scope ? ctx->config.scopes[*scope].testResultDir : ctx->config.testResultDir;
   double testSecs = 0.0;
   TestExecutionState testState = TestExecutionState::SUCCESS;
-  if (buildProc.isSuccessfulExit()) {
-    fs::remove_all(ctx->config.testResultDir);
-    Subprocess testProc(ctx->config.testCmd, timeLimit, ctx->workspace.getMutantTestLog(id).string(),
-                        !isVerbose(*ctx));
+  if (built) {
+    fs::remove_all(testResultDir);
+    const fs::path testLog = ctx->workspace.getMutantTestLog(id);
+    std::optional<Subprocess> testProc;
+    if (jitToken.empty()) {
+      testProc.emplace(testCmd, timeLimit, testLog.string(), !isVerbose(*ctx));
+    } else {
+      // The forked child writes the Google Test report where the test command would. Everything it
+      // needs is prepared here, so the child only runs the program.
+      fs::create_directories(testResultDir);
+      std::vector<std::string> args = {fmt::format("--gtest_output=xml:{}/", testResultDir.string())};
+      if (selectedTests) {
+        args.push_back(fmt::format("--gtest_filter={}", filter));
+      }
+      auto runJit = [&]() { return mJit->run(&m, jitToken, args); };
+      testProc.emplace(runJit, timeLimit, testLog, !isVerbose(*ctx));
+    }
     Timestamper testTimer;
-    testProc.execute();
+    testProc->execute();
     testSecs = testTimer.toDouble();
-    if (testProc.isTimedOut()) {
+    if (testProc->isTimedOut()) {
       testState = TestExecutionState::TIMEOUT;
-    } else if (testProc.isSignaled() || testProc.isSignalExit()) {
+    } else if (testProc->isSignaled() || testProc->isSignalExit()) {
       testState = TestExecutionState::RUNTIME_ERROR;
     } else {
-      io::syncXmlFiles(ctx->config.testResultDir, actualDir);
+      // The results are read where the test wrote them; a test that wrote
+      // none compares as one that ran no tests.
+      fs::create_directories(testResultDir);
     }
   } else {
     testState = TestExecutionState::BUILD_FAILURE;
   }
 
-  MutationResult result = evaluator->compare(m, actualDir, testState);
+  MutationResult result = evaluator->compare(m, testResultDir, testState, selectedTests);
+  if (ctx->config.keepTestResults && built && fs::is_directory(testResultDir)) {
+    io::moveDirectory(testResultDir, ctx->workspace.getMutantResultsDir(id));
+  }
   result.setBuildSecs(buildSecs);
   result.setTestSecs(testSecs);
   return result;
@@ -6,9 +6,13 @@
 #include <fmt/core.h>
 #include <fmt/ranges.h>
 #include <algorithm>
+#include <chrono>
+#include <exception>
 #include <filesystem>  // NOLINT
+#include <future>
 #include <map>
 #include <memory>
+#include <optional>
 #include <random>
 #include <set>
 #include <stdexcept>
@@ -18,16 +22,32 @@
 #include "sentinel/Console.hpp"
 #include "sentinel/CoverageInfo.hpp"
 #include "sentinel/Logger.hpp"
+#include "sentinel/MutantPlan.hpp"
 #include "sentinel/MutationFactory.hpp"
+#include "sentinel/PartitionPlanner.hpp"
 #include "sentinel/operators/MutationOperatorExpansion.hpp"
 #include "sentinel/stages/GenerationStage.hpp"
+#include "sentinel/util/ScopeGuard.hpp"
 #include "sentinel/util/Utf8Char.hpp"
 #include "sentinel/util/string.hpp"
+#include "sentinel/version.hpp"
 
 namespace sentinel {
 
 namespace fs = std::filesystem;
 
+namespace {
+/// Thrown from the progress callback to stop parsing once the overlapped original test failed.
+class GenerationCancelled : public std::exception {
+ public:
+  const char* what() const noexcept override { return "mutant generation cancelled"; }
+};
+}  // namespace
+
+static bool hasFailed(const std::shared_future<bool>& result) {
+  return result.wait_for(std::chrono::seconds(0)) == std::future_status::ready && !result.get();
+}
+
 static constexpr std::size_t kSummaryWidth = 80;
 static constexpr std::size_t kMutantsCol = 13;
 static constexpr std::size_t kLinesCol = 9;
@@ -131,8 +151,14 @@ GenerationStage::GenerationStage(std::shared_ptr<GitRepository> repo,
     mRepo(std::move(repo)), mGenerator(std::move(generator)) {
 }
 
+void GenerationStage::setPlan(MutantPlan plan) {
+  mPlan = std::move(plan);
+}
+
 bool GenerationStage::shouldSkip(const PipelineContext& ctx) const {
-  return ctx.workspace.hasMutants();
+  // A streamed generation that was interrupted leaves a partial mutant list
+  // behind; regenerate it instead of evaluating only the first part.
+  return ctx.workspace.hasGeneratedMutants();
 }
 
 StatusLine::Phase GenerationStage::getPhase() const {
@@ -140,7 +166,125 @@ StatusLine::Phase GenerationStage::getPhase() const {
 }
 
 bool GenerationStage::execute(PipelineContext* ctx) {
-  Logger::info("Generating mutants...");
+  MutantPlan plan;
+  if (mPlan) {
+    plan = std::move(*mPlan);
+    mPlan.reset();
+  } else if (!ctx->config.planFile.empty()) {
+    // A resumed run whose mutants were not generated yet.
+    Logger::info("Loading mutant plan '{}'...", ctx->config.planFile.string());
+    plan = MutantPlan::load(ctx->config.planFile);
+    plan.verify(ctx->config.sourceDir);
+  } else {
+    if (ctx->foregroundResult != nullptr) {
+      Logger::info("Generating mutants alongside the original test...");
+    } else {
+      Logger::info("Generating mutants...");
+    }
+    if (!generate(ctx, &plan)) {
+      return false;
+    }
+  }
+  const Mutants& mutants = plan.mutants;
+
+  if (mutants.size() > static_cast<std::size_t>(Workspace::kMaxMutantCount)) {
+    throw std::runtime_error(
+        fmt::format("Too many mutants: {} generated, maximum is {}. "
+                    "Use --limit to reduce the number of mutants.",
+                    mutants.size(), Workspace::kMaxMutantCount));
+  }
+
+  // Print summary before partition (shows full generation results)
+  std::string partition = ctx->config.partition.value_or("");
+  printGenerationSummary(mutants, plan.candidateCount, plan.getLinesByPath(ctx->config.sourceDir),
+                         ctx->config.sourceDir, plan.generator, plan.seed, plan.limit, plan.mutantsPerLine,
+                         plan.from, plan.uncommitted, partition);
+
+  if (mutants.empty()) {
+    Logger::warn("No mutants generated.\n"
+                 "      Check --source-dir, file extensions (--extension),"
+                 " and scope options (--from, --uncommitted).");
+  }
+
+  if (!ctx->config.generateOnly.empty()) {
+    plan.programVersion = PROGRAM_VERSION;
+    plan.hashSources(ctx->config.sourceDir);
+    plan.save(ctx->config.generateOnly);
+    Logger::info("Wrote mutant plan '{}' ({} mutant{}).", ctx->config.generateOnly.string(), mutants.size(),
+                 mutants.size() == 1 ? "" : "s");
+    return false;
+  }
+
+  // Apply partition. IDs are positions in the full list, so the IDs of all
+  // partitions are distinct and merge back into one workspace.
+  MutantQueue* queue = ctx->mutantQueue;
+  std::size_t partIdx = 0;
+  std::size_t partCount = 0;
+  std::optional<std::string> partitionStrategy;
+  if (queue == nullptr) {
+    // Processes attaching to a shared workspace wait until the list is final.
+    // The scope is recorded so an interrupted run regenerates the same list.
+    WorkspaceStatus pending;
+    pending.generationPending = true;
+    pending.seed = plan.seed;
+    if (plan.from) {
+      pending.from = plan.from;
+    }
+    if (plan.uncommitted) {
+      pending.uncommitted = plan.uncommitted;
+    }
+    if (plan.limit > 0) {
+      pending.limit = plan.limit;
+    }
+    ctx->workspace.saveStatus(pending);
+  }
+  if (queue == nullptr && partition.empty()) {
+    int id = 1;
+    for (const auto& m : mutants) {
+      ctx->workspace.createMutant(id, m);
+      id++;
+    }
+  } else if (queue == nullptr) {
+    auto part = Partition::parse(partition);
+    partIdx = part.index;
+    partCount = part.count;
+    const PartitionPlanner planner = PartitionPlanner::fromConfig(ctx->config);
+    partitionStrategy = planner.getStrategy();
+    std::vector<fs::path> files;
+    files.reserve(mutants.size());
+    for (const auto& m : mutants) {
+      files.push_back(m.getPath());
+    }
+    const auto positions = planner.plan(files, partCount)[partIdx - 1];
+    for (std::size_t pos : positions) {
+      ctx->workspace.createMutant(static_cast<int>(pos) + 1, mutants[pos]);
+    }
+    Logger::verbose("Partition {}: {} of {} mutants ({}).", partition, positions.size(), mutants.size(),
+                    *partitionStrategy);
+  }
+
+  WorkspaceStatus status;
+  status.seed = plan.seed;
+  status.candidateCount = plan.candidateCount;
+  status.partIndex = partIdx;
+  status.partCount = partCount;
+  status.partitionStrategy = partitionStrategy;
+  if (plan.from) {
+    status.from = plan.from;
+  }
+  if (plan.uncommitted) {
+    status.uncommitted = plan.uncommitted;
+  }
+  if (plan.limit > 0) {
+    status.limit = plan.limit;
+  }
+  status.generationPending = false;
+  ctx->workspace.saveStatus(status);
+
+  return true;
+}
+
+bool GenerationStage::generate(PipelineContext* ctx, MutantPlan* plan) {
   if (!fs::exists(ctx->config.compileDbDir / "compile_commands.json")) {
     throw std::runtime_error(
         fmt::format("compile_commands.json not found in '{}'.\n"
@@ -150,8 +294,17 @@ bool GenerationStage::execute(PipelineContext* ctx) {
                     "https://clang.llvm.org/docs/JSONCompilationDatabase.html",
                     ctx->config.compileDbDir.string()));
   }
+  // --from, --uncommitted, --limit and --seed are not part of config.yaml.
+  // When regenerating after an interrupted generation, reuse the
+  // values recorded when it started so that the same mutant list comes out.
+  const WorkspaceStatus previous = ctx->workspace.loadStatus();
+  const bool regenerating = previous.generationPending.value_or(false);
+  const std::optional<std::string> from = regenerating ? previous.from : ctx->config.from;
+  const bool uncommitted = regenerating ? previous.uncommitted.value_or(false) : ctx->config.uncommitted;
+  const std::size_t limit = regenerating ? previous.limit.value_or(0) : ctx->config.limit;
+
   mRepo->addSkipDir(ctx->workspace.getRoot());
-  SourceLines sourceLines = mRepo->getSourceLines(ctx->config.from, ctx->config.uncommitted);
+  SourceLines sourceLines = mRepo->getSourceLines(from, uncommitted);
 
   if (ctx->config.restrictGeneration && !ctx->config.lcovTracefiles.empty()) {
     CoverageInfo coverageInfo(ctx->config.lcovTracefiles);
@@ -191,77 +344,121 @@ bool GenerationStage::execute(PipelineContext* ctx) {
     }
   }
 
-  unsigned int seed = ctx->config.seed ? *ctx->config.seed : std::random_device {}();
+  unsigned int seed = 0;
+  if (regenerating && previous.seed) {
+    seed = *previous.seed;
+  } else {
+    seed = ctx->config.seed ? *ctx->config.seed : std::random_device {}();
+  }
   std::shuffle(sourceLines.begin(), sourceLines.end(), std::mt19937(seed));
 
+  // While streaming, generation runs on a background thread; the status line
+  // belongs to the evaluation running in the foreground. While overlapped with
+  // the original test, progress is shown next to the test phase instead, and
+  // parsing stops early once the original test has failed.
+  MutantQueue* queue = ctx->mutantQueue;
+  const std::shared_future<bool>* foreground = ctx->foregroundResult;
   mGenerator->setOperators(ctx->config.operators);
-  mGenerator->setProgressCallback(
-      [ctx](std::size_t done, std::size_t total) {
-        ctx->statusLine.setProgressTotal(total);
-        ctx->statusLine.setProgressCurrent(done);
-      });
+  mGenerator->setWorkerLimits(ctx->config.generationMemoryLimit, ctx->config.generationTimeout);
+  mGenerator->setCandidateCacheDir(ctx->config.candidateCacheDir);
+  if (queue != nullptr) {
+    mGenerator->setProgressCallback(nullptr);
+  } else if (foreground != nullptr) {
+    mGenerator->setProgressCallback(
+        [ctx, foreground](std::size_t done, std::size_t total) {
+          if (hasFailed(*foreground)) {
+            throw GenerationCancelled();
+          }
+          ctx->statusLine.setBackgroundProgress(StatusLine::Phase::GENERATION, done, total);
+        });
+  } else {
+    mGenerator->setProgressCallback(
+        [ctx](std::size_t done, std::size_t total) {
+          ctx->statusLine.setProgressTotal(total);
+          ctx->statusLine.setProgressCurrent(done);
+        });
+  }
+  ScopeGuard clearBackground([ctx, foreground] {
+    if (foreground != nullptr) {
+      ctx->statusLine.clearBackgroundProgress();
+    }
+  });
   MutationFactory factory(mGenerator);
-  auto mutants = factory.generate(ctx->config.sourceDir, sourceLines, ctx->config.limit, seed,
-                                  ctx->config.mutantsPerLine);
-  std::size_t candidateCount = mGenerator->getCandidateCount();
-
-  if (mutants.size() > static_cast<std::size_t>(Workspace::kMaxMutantCount)) {
-    throw std::runtime_error(
-        fmt::format("Too many mutants: {} generated, maximum is {}. "
-                    "Use --limit to reduce the number of mutants.",
-                    mutants.size(), Workspace::kMaxMutantCount));
+  Mutants mutants;
+  if (queue == nullptr) {
+    try {
+      mutants = factory.generate(ctx->config.sourceDir, sourceLines, limit, seed, ctx->config.mutantsPerLine);
+    } catch (const GenerationCancelled&) {
+      Logger::verbose("Mutant generation cancelled because the original test failed.");
+      return false;
+    }
+  } else {
+    // Streaming never partitions, so IDs are simply assigned in selection
+    // order, exactly as the batch path below does for an unpartitioned run.
+    WorkspaceStatus pending;
+    pending.generationPending = true;
+    pending.seed = seed;
+    if (from) {
+      pending.from = from;
+    }
+    if (uncommitted) {
+      pending.uncommitted = uncommitted;
+    }
+    if (limit > 0) {
+      pending.limit = limit;
+    }
+    ctx->workspace.saveStatus(pending);
+
+    int nextId = 1;
+    mutants = factory.generate(
+        ctx->config.sourceDir, sourceLines, limit, seed, ctx->config.mutantsPerLine,
+        [&](const Mutant& m) {
+          if (nextId > Workspace::kMaxMutantCount) {
+            throw std::runtime_error(
+                fmt::format("Too many mutants: more than {} generated. "
+                            "Use --limit to reduce the number of mutants.",
+                            Workspace::kMaxMutantCount));
+          }
+          ctx->workspace.createMutant(nextId, m);
+          if (!queue->push({nextId, m})) {
+            throw std::runtime_error("Mutant evaluation stopped before generation finished.");
+          }
+          nextId++;
+        });
   }
-
-  // Print summary before partition (shows full generation results)
-  std::string partition = ctx->config.partition.value_or("");
-  auto linesByPath = mGenerator->getLinesByPath();
-  printGenerationSummary(mutants, candidateCount, linesByPath, ctx->config.sourceDir, ctx->config.generator, seed,
-                         ctx->config.limit, ctx->config.mutantsPerLine, ctx->config.from, ctx->config.uncommitted,
-                         partition);
-
-  if (mutants.empty()) {
-    Logger::warn("No mutants generated.\n"
-                 "      Check --source-dir, file extensions (--extension),"
-                 " and scope options (--from, --uncommitted).");
+  if (!mGenerator->getSkippedFiles().empty()) {
+    std::vector<std::string> skipped;
+    for (const auto& [path, reason] : mGenerator->getSkippedFiles()) {
+      skipped.push_back(fmt::format("  {}: {}", path.string(), reason));
+    }
+    Logger::warn("No mutants were generated for {} file{}:\n{}", skipped.size(), skipped.size() == 1 ? "" : "s",
+                 fmt::join(skipped, "\n"));
   }
-
-  // Apply partition slice
-  std::size_t partIdx = 0;
-  std::size_t partCount = 0;
-  std::size_t partStart = 0;
-  if (!partition.empty()) {
-    auto part = Partition::parse(partition);
-    partIdx = part.index;
-    partCount = part.count;
-    std::size_t total = mutants.size();
-    partStart = (partIdx - 1) * total / partCount;
-    std::size_t end = partIdx * total / partCount;
-    mutants = Mutants(mutants.begin() + static_cast<std::ptrdiff_t>(partStart),
-                      mutants.begin() + static_cast<std::ptrdiff_t>(end));
+  // Nothing has been written to the workspace yet; drop the result if the
+  // original test it was overlapped with did not succeed.
+  if (foreground != nullptr && !foreground->get()) {
+    Logger::verbose("Discarding {} generated mutants because the original test failed.", mutants.size());
+    return false;
   }
 
-  int id = static_cast<int>(partStart) + 1;
+  plan->seed = seed;
+  plan->candidateCount = mGenerator->getCandidateCount();
+  plan->generator = ctx->config.generator;
+  plan->mutantsPerLine = ctx->config.mutantsPerLine;
+  plan->from = from;
+  plan->uncommitted = uncommitted;
+  plan->limit = limit;
+  const fs::path root = fs::canonical(ctx->config.sourceDir);
   for (const auto& m : mutants) {
-    ctx->workspace.createMutant(id, m);
-    id++;
+    plan->files[m.getPath()];
   }
-
-  WorkspaceStatus status;
-  status.seed = seed;
-  status.candidateCount = candidateCount;
-  status.partIndex = partIdx;
-  status.partCount = partCount;
-  if (ctx->config.from) {
-    status.from = ctx->config.from;
-  }
-  if (ctx->config.uncommitted) {
-    status.uncommitted = ctx->config.uncommitted;
-  }
-  if (ctx->config.limit > 0) {
-    status.limit = ctx->config.limit;
+  for (const auto& [absPath, count] : mGenerator->getLinesByPath()) {
+    auto it = plan->files.find(absPath.lexically_relative(root));
+    if (it != plan->files.end()) {
+      it->second.lines = count;
+    }
   }
-  ctx->workspace.saveStatus(status);
-
+  plan->mutants = std::move(mutants);
   return true;
 }
 
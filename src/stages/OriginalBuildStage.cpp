@@ -4,6 +4,7 @@
  */
 
 #include <fmt/core.h>
+#include <cstddef>
 #include <filesystem>  // NOLINT
 #include <string>
 #include "sentinel/Logger.hpp"
@@ -24,22 +25,41 @@ StatusLine::Phase OriginalBuildStage::getPhase() const {
   return StatusLine::Phase::BUILD_ORIG;
 }
 
-bool OriginalBuildStage::execute(PipelineContext* ctx) {
-  Logger::info("Running original build...");
-  fs::path buildLog = ctx->workspace.getOriginalBuildLog();
-  Logger::verbose("Build command: {}", ctx->config.buildCmd);
+/**
+ * @brief Run one original build and throw if it fails.
+ *
+ * @param buildCmd Build command.
+ * @param buildLog Log file of the build.
+ * @param suffix   Appended to "original build" in messages (e.g. " of scope 'x'").
+ * @param verbose  Show the build output.
+ */
+static void runBuild(const std::string& buildCmd, const fs::path& buildLog, const std::string& suffix,
+                     bool verbose) {
+  Logger::info("Running original build{}...", suffix);
+  Logger::verbose("Build command: {}", buildCmd);
   Logger::verbose("Build log: {}", buildLog);
+  fs::create_directories(buildLog.parent_path());
   Timestamper ts;
-  Subprocess buildProc(ctx->config.buildCmd, 0, buildLog.string(), !isVerbose(*ctx));
+  Subprocess buildProc(buildCmd, 0, buildLog.string(), !verbose);
   buildProc.execute();
   if (!buildProc.isSuccessfulExit()) {
     io::throwStageFailure(
-        fmt::format("Original build failed.\n       See: {}", buildLog.string()),
+        fmt::format("Original build{} failed.\n       See: {}", suffix, buildLog.string()),
         buildLog, "build output",
-        fmt::format("Build command: {}", ctx->config.buildCmd),
-        !isVerbose(*ctx));
+        fmt::format("Build command: {}", buildCmd),
+        !verbose);
+  }
+  Logger::info("Original build{} completed ({})", suffix, Timestamper::format(ts.toDouble()));
+}
+
+bool OriginalBuildStage::execute(PipelineContext* ctx) {
+  // The scopes go first: the original build log marks the stage as done on resume.
+  const auto& scopes = ctx->config.scopes;
+  for (std::size_t i = 0; i < scopes.size(); i++) {
+    runBuild(scopes[i].buildCmd, ctx->workspace.getOriginalScopeBuildLog(i),
+             fmt::format(" of scope '{}'", scopes[i].path), isVerbose(*ctx));
   }
-  Logger::info("Original build completed ({})", Timestamper::format(ts.toDouble()));
+  runBuild(ctx->config.buildCmd, ctx->workspace.getOriginalBuildLog(), "", isVerbose(*ctx));
   return true;
 }
 
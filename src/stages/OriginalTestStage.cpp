@@ -6,6 +6,7 @@
 #include <fmt/core.h>
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <filesystem>  // NOLINT
 #include <string>
 #include <utility>
@@ -32,59 +33,105 @@ StatusLine::Phase OriginalTestStage::getPhase() const {
   return StatusLine::Phase::TEST_ORIG;
 }
 
-bool OriginalTestStage::execute(PipelineContext* ctx) {
-  Logger::info("Running original test...");
-  fs::path testLog = ctx->workspace.getOriginalTestLog();
-  Logger::verbose("Test command: {}", ctx->config.testCmd);
+/**
+ * @brief Run one original test, collect its results and throw if it was killed or left no results.
+ *
+ * @param testCmd       Test command.
+ * @param testResultDir Directory the test command writes its results to.
+ * @param testLog       Log file of the test.
+ * @param resultsDir    Directory the results are copied to.
+ * @param timeLimit     Time limit in seconds (0 for none).
+ * @param suffix        Appended to "original test" in messages (e.g. " of scope 'x'").
+ * @param verbose       Show the test output.
+ * @return the elapsed seconds.
+ */
+static double runTest(const std::string& testCmd, const fs::path& testResultDir, const fs::path& testLog,
+                      const fs::path& resultsDir, std::size_t timeLimit, const std::string& suffix, bool verbose) {
+  Logger::info("Running original test{}...", suffix);
+  Logger::verbose("Test command: {}", testCmd);
   Logger::verbose("Test log: {}", testLog);
-  Logger::verbose("Test result dir: {}", ctx->config.testResultDir.string());
-
-  std::size_t computedTimeLimit = 0;
-  if (ctx->config.timeout.has_value()) {
-    computedTimeLimit = *ctx->config.timeout;
-    Logger::info("Timeout: {}", Timestamper::format(computedTimeLimit));
-  }
+  Logger::verbose("Test result dir: {}", testResultDir.string());
+  fs::create_directories(testLog.parent_path());
 
   Timestamper testTimer;
-  Subprocess testProc(ctx->config.testCmd, computedTimeLimit, testLog.string(),
-                      !isVerbose(*ctx));
+  Subprocess testProc(testCmd, timeLimit, testLog.string(), !verbose);
   testProc.execute();
   const double testElapsed = testTimer.toDouble();
 
   if (testProc.isSignaled() || testProc.isSignalExit()) {
     io::throwStageFailure(
-        fmt::format("Original test command was killed by a signal.\n"
-                    "       See: {}", testLog.string()),
+        fmt::format("Original test command{} was killed by a signal.\n"
+                    "       See: {}", suffix, testLog.string()),
         testLog, "test output",
-        fmt::format("Test command: {}", ctx->config.testCmd),
-        !isVerbose(*ctx));
-  }
-
-  if (!ctx->config.timeout) {
-    computedTimeLimit = static_cast<std::size_t>(std::ceil(testElapsed * kAutoTimeoutFactor)) + kAutoTimeoutPaddingSecs;
-    Logger::info("Timeout: {} (auto)", Timestamper::format(computedTimeLimit));
-    WorkspaceStatus status;
-    status.originalTime = computedTimeLimit;
-    ctx->workspace.saveStatus(status);
+        fmt::format("Test command: {}", testCmd),
+        !verbose);
   }
 
   bool testFailed = !testProc.isSuccessfulExit();
 
-  io::syncXmlFiles(ctx->config.testResultDir, ctx->workspace.getOriginalResultsDir());
+  io::syncXmlFiles(testResultDir, resultsDir);
 
-  if (fs::is_empty(ctx->workspace.getOriginalResultsDir())) {
+  if (fs::is_empty(resultsDir)) {
     std::string headline = testFailed
-        ? fmt::format("Original test command failed with no test results.\n"
-                      "       See: {}", testLog.string())
-        : fmt::format("No test result files found in '{}' after running test command.\n"
-                      "       See: {}", ctx->config.testResultDir.string(), testLog.string());
+        ? fmt::format("Original test command{} failed with no test results.\n"
+                      "       See: {}", suffix, testLog.string())
+        : fmt::format("No test result files found in '{}' after running test command{}.\n"
+                      "       See: {}", testResultDir.string(), suffix, testLog.string());
     io::throwStageFailure(
         std::move(headline), testLog, "test output",
-        fmt::format("Test command: {}", ctx->config.testCmd),
-        !isVerbose(*ctx));
+        fmt::format("Test command: {}", testCmd),
+        !verbose);
   }
 
-  Logger::info("Original test completed ({})", Timestamper::format(testElapsed));
+  Logger::info("Original test{} completed ({})", suffix, Timestamper::format(testElapsed));
+  return testElapsed;
+}
+
+/**
+ * @brief Return the time limit derived from the elapsed seconds of an original test.
+ */
+static std::size_t autoTimeLimit(double testElapsed) {
+  return static_cast<std::size_t>(std::ceil(testElapsed * kAutoTimeoutFactor)) + kAutoTimeoutPaddingSecs;
+}
+
+bool OriginalTestStage::execute(PipelineContext* ctx) {
+  std::size_t computedTimeLimit = 0;
+  if (ctx->config.timeout.has_value()) {
+    computedTimeLimit = *ctx->config.timeout;
+    Logger::info("Timeout: {}", Timestamper::format(computedTimeLimit));
+  }
+
+  WorkspaceStatus status;
+  // The scopes go first: the original test log marks the stage as done on resume.
+  const auto& scopes = ctx->config.scopes;
+  if (!scopes.empty()) {
+    std::vector<std::size_t> scopeTimes;
+    for (std::size_t i = 0; i < scopes.size(); i++) {
+      const std::string suffix = fmt::format(" of scope '{}'", scopes[i].path);
+      const double elapsed = runTest(scopes[i].testCmd, scopes[i].testResultDir,
+                                     ctx->workspace.getOriginalScopeTestLog(i),
+                                     ctx->workspace.getOriginalScopeResultsDir(i), computedTimeLimit, suffix,
+                                     isVerbose(*ctx));
+      if (!ctx->config.timeout) {
+        scopeTimes.push_back(autoTimeLimit(elapsed));
+        Logger::info("Timeout{}: {} (auto)", suffix, Timestamper::format(scopeTimes.back()));
+      }
+    }
+    if (!ctx->config.timeout) {
+      status.scopeOriginalTimes = scopeTimes;
+    }
+  }
+
+  const double testElapsed = runTest(ctx->config.testCmd, ctx->config.testResultDir,
+                                     ctx->workspace.getOriginalTestLog(), ctx->workspace.getOriginalResultsDir(),
+                                     computedTimeLimit, "", isVerbose(*ctx));
+  status.originalTestSeconds = testElapsed;
+  if (!ctx->config.timeout) {
+    computedTimeLimit = autoTimeLimit(testElapsed);
+    Logger::info("Timeout: {} (auto)", Timestamper::format(computedTimeLimit));
+    status.originalTime = computedTimeLimit;
+  }
+  ctx->workspace.saveStatus(status);
   ctx->workspace.saveConfig(ctx->config);
   return true;
 }
@@ -50,6 +50,10 @@ bool ReportStage::execute(PipelineContext* ctx) {
   }
 
   MutationSummary summary(results, reportCfg.sourceDir);
+  if (reportCfg.timeBudget && !ctx->workspace.isComplete()) {
+    // Evaluation stopped at the time budget; the results are a sample of the run.
+    summary.plannedMutantCount = ctx->workspace.loadMutants().size();
+  }
   XmlReport xmlReport(summary);
   xmlReport.printSummary();
   if (!reportCfg.outputDir.empty()) {
@@ -66,11 +70,17 @@ bool ReportStage::execute(PipelineContext* ctx) {
   }
 
   std::string scoreStr = score ? fmt::format("{:.1f}%", *score) : "-";
+  if (const auto interval = summary.getScoreInterval()) {
+    scoreStr = fmt::format("estimated {} (95% CI {:.1f}% - {:.1f}%, {} of {} mutants)", scoreStr, interval->first,
+                           interval->second, summary.results.size(), summary.plannedMutantCount);
+  }
+  const std::string headline =
+      summary.isSampled() ? "Mutation testing stopped at the time budget" : "Mutation testing complete";
   if (reportCfg.threshold) {
     bool passed = !score || *score >= *reportCfg.threshold;
     auto icon = passed ? Utf8Char::CheckMark : Utf8Char::CrossMark;
-    std::string msg = fmt::format("Mutation testing complete {} {} {} (threshold: {:.1f}%)",
-                                  Utf8Char::EmDash, scoreStr, icon, *reportCfg.threshold);
+    std::string msg = fmt::format("{} {} {} {} (threshold: {:.1f}%)", headline, Utf8Char::EmDash, scoreStr, icon,
+                                  *reportCfg.threshold);
     if (passed) {
       Logger::info("{}", msg);
     } else {
@@ -78,7 +88,7 @@ bool ReportStage::execute(PipelineContext* ctx) {
       throw ThresholdError(*score, *reportCfg.threshold);
     }
   } else {
-    Logger::info("Mutation testing complete {} {}", Utf8Char::EmDash, scoreStr);
+    Logger::info("{} {} {}", headline, Utf8Char::EmDash, scoreStr);
   }
   return false;
 }
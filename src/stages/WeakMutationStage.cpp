@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <algorithm>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#include "sentinel/Logger.hpp"
+#include "sentinel/MutationState.hpp"
+#include "sentinel/Result.hpp"
+#include "sentinel/Subprocess.hpp"
+#include "sentinel/Timestamper.hpp"
+#include "sentinel/WeakMutationInstrumenter.hpp"
+#include "sentinel/Workspace.hpp"
+#include "sentinel/stages/EvaluationStage.hpp"
+#include "sentinel/stages/WeakMutationStage.hpp"
+#include "sentinel/util/ScopeGuard.hpp"
+#include "sentinel/util/string.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+WeakMutationStage::WeakMutationStage(InstrumentFunction instrument) : mInstrument(std::move(instrument)) {
+}
+
+WeakMutationStage::Record WeakMutationStage::readRecord(const fs::path& path) {
+  Record record;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (string::startsWith(line, WeakMutationInstrumenter::kLoadedMarker)) {
+      record.loaded.insert(line.substr(std::string(WeakMutationInstrumenter::kLoadedMarker).size()));
+      continue;
+    }
+    try {
+      std::size_t end = 0;
+      const int id = std::stoi(line, &end);
+      if (end == line.size()) {
+        record.infected.insert(id);
+      }
+    } catch (const std::exception&) {
+    }
+  }
+  return record;
+}
+
+bool WeakMutationStage::shouldSkip(const PipelineContext& ctx) const {
+  return !ctx.config.weakMutation || ctx.config.shared || ctx.workspace.isComplete() ||
+         ctx.workspace.loadStatus().notInfected.has_value();
+}
+
+StatusLine::Phase WeakMutationStage::getPhase() const {
+  return StatusLine::Phase::EVALUATION;
+}
+
+bool WeakMutationStage::execute(PipelineContext* ctx) {
+  const Config& config = ctx->config;
+  Workspace& workspace = ctx->workspace;
+  // The pre-screen runs the default build and test, which do not cover the mutants of a scope.
+  auto mutants = workspace.loadMutants();
+  mutants.erase(std::remove_if(mutants.begin(), mutants.end(),
+                               [&config](const auto& entry) {
+                                 return Scope::find(config.scopes, entry.second.getPath()).has_value();
+                               }),
+                mutants.end());
+
+  WorkspaceStatus status;
+  status.notInfected.emplace();
+  std::set<int> probed;
+  const auto instrumented = mInstrument(mutants, &probed);
+  if (instrumented.empty() || probed.empty()) {
+    Logger::info("Weak mutation: none of the {} mutant{} can be probed.", mutants.size(),
+                 mutants.size() == 1 ? "" : "s");
+    workspace.saveStatus(status);
+    return true;
+  }
+  Logger::info("Weak mutation: probing {} of {} mutant{} in {} file{}...", probed.size(), mutants.size(),
+               mutants.size() == 1 ? "" : "s", instrumented.size(), instrumented.size() == 1 ? "" : "s");
+
+  const fs::path dir = workspace.getWeakMutationDir();
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  const fs::path buildLog = dir / "build.log";
+  const fs::path testLog = dir / "test.log";
+  const fs::path record = dir / "infected";
+
+  // The originals go to the backup directory, which the signal handlers and
+  // the next run restore from if sentinel is interrupted here.
+  const fs::path root = fs::canonical(config.sourceDir);
+  const fs::path backupDir = workspace.getBackupDir();
+  ScopeGuard restore{[&] { workspace.restoreBackup(config.sourceDir); }};
+  for (const auto& [path, contents] : instrumented) {
+    const fs::path backup = backupDir / path.lexically_relative(root);
+    fs::create_directories(backup.parent_path());
+    fs::copy_file(path, backup, fs::copy_options::overwrite_existing);
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out || !(out << contents)) {
+      throw std::runtime_error(fmt::format("Failed to write instrumented source '{}'.", path.string()));
+    }
+  }
+
+  Logger::verbose("Build command: {}", config.buildCmd);
+  Logger::verbose("Build log: {}", buildLog);
+  Timestamper buildTimer;
+  Subprocess buildProc(config.buildCmd, 0, buildLog.string(), !isVerbose(*ctx));
+  buildProc.execute();
+  if (!buildProc.isSuccessfulExit()) {
+    Logger::warn("Weak mutation: the instrumented build failed; every mutant is evaluated.\n"
+                 "       See: {}", buildLog.string());
+    workspace.saveStatus(status);
+    return true;
+  }
+  const double buildSecs = buildTimer.toDouble();
+
+  const std::string testCmd = fmt::format("{}={}; export {}; {}", WeakMutationInstrumenter::kRecordEnv,
+                                          string::shellQuote(record.string()), WeakMutationInstrumenter::kRecordEnv,
+                                          config.testCmd);
+  Logger::verbose("Test log: {}", testLog);
+  fs::remove_all(config.testResultDir);
+  Timestamper testTimer;
+  Subprocess testProc(testCmd, EvaluationStage::getTimeLimit(*ctx), testLog.string(), !isVerbose(*ctx));
+  testProc.execute();
+  if (testProc.isTimedOut() || testProc.isSignaled() || testProc.isSignalExit()) {
+    Logger::warn("Weak mutation: the instrumented test run did not finish; every mutant is evaluated.\n"
+                 "       See: {}", testLog.string());
+    workspace.saveStatus(status);
+    return true;
+  }
+  const double testSecs = testTimer.toDouble();
+
+  // A probe must not change what the tests do; if it did, its verdicts cannot be trusted.
+  fs::create_directories(config.testResultDir);
+  std::string killingTest;
+  std::string errorTest;
+  if (Result::compare(Result(workspace.getOriginalResultsDir().string()), Result(config.testResultDir.string()),
+                      &killingTest, &errorTest) != MutationState::SURVIVED) {
+    Logger::warn("Weak mutation: the instrumented test results differ from the original ones; "
+                 "every mutant is evaluated.\n"
+                 "       See: {}", testLog.string());
+    workspace.saveStatus(status);
+    return true;
+  }
+
+  // Without a loaded marker the probes of a file never ran (the test command
+  // dropped the environment, or ran binaries that were not rebuilt), so the
+  // absence of its mutants from the record says nothing.
+  const Record result = readRecord(record);
+  if (result.loaded.empty()) {
+    Logger::warn("Weak mutation: the test command did not load any instrumented code; every mutant is evaluated.\n"
+                 "       Check that it passes {} on to the tests.", WeakMutationInstrumenter::kRecordEnv);
+    workspace.saveStatus(status);
+    return true;
+  }
+  for (const auto& [path, contents] : instrumented) {
+    if (result.loaded.count(path.string()) == 0) {
+      Logger::verbose("Weak mutation: the instrumented code of '{}' was not loaded.", path.string());
+    }
+  }
+  for (const auto& [id, m] : mutants) {
+    if (probed.count(id) == 0 || result.infected.count(id) != 0 || workspace.isDone(id)) {
+      continue;
+    }
+    std::error_code ec;
+    const fs::path path = fs::canonical(root / m.getPath(), ec);
+    if (!ec && result.loaded.count(path.string()) != 0) {
+      status.notInfected->push_back(id);
+    }
+  }
+  workspace.saveStatus(status);
+  Logger::info("Weak mutation: {} of {} probed mutant{} never infected ({}/{}).", status.notInfected->size(),
+               probed.size(), probed.size() == 1 ? " was" : "s were", Timestamper::format(buildSecs),
+               Timestamper::format(testSecs));
+  return true;
+}
+
+}  // namespace sentinel
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "sentinel/util/diff.hpp"
+
+namespace sentinel::diff {
+
+/// Largest middle part (old lines x new lines) matched with the quadratic LCS table.
+static constexpr std::size_t kMaxLcsCells = 4 * 1024 * 1024;
+
+LineChanges compareLines(const std::vector<std::string>& before, const std::vector<std::string>& after) {
+  LineChanges changes;
+
+  std::size_t prefix = 0;
+  while (prefix < before.size() && prefix < after.size() && before[prefix] == after[prefix]) {
+    changes.lineMap[prefix + 1] = prefix + 1;
+    ++prefix;
+  }
+  std::size_t suffix = 0;
+  while (suffix < before.size() - prefix && suffix < after.size() - prefix &&
+         before[before.size() - 1 - suffix] == after[after.size() - 1 - suffix]) {
+    changes.lineMap[before.size() - suffix] = after.size() - suffix;
+    ++suffix;
+  }
+
+  const std::size_t n = before.size() - prefix - suffix;
+  const std::size_t m = after.size() - prefix - suffix;
+  std::vector<bool> kept(m, false);
+  if (n > 0 && m > 0 && (n + 1) * (m + 1) <= kMaxLcsCells) {
+    // lcs[i][j] = LCS length of before[prefix+i..] and after[prefix+j..]
+    std::vector<std::vector<std::size_t>> lcs(n + 1, std::vector<std::size_t>(m + 1, 0));
+    for (std::size_t i = n; i-- > 0;) {
+      for (std::size_t j = m; j-- > 0;) {
+        lcs[i][j] = before[prefix + i] == after[prefix + j]
+            ? lcs[i + 1][j + 1] + 1
+            : std::max(lcs[i + 1][j], lcs[i][j + 1]);
+      }
+    }
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < n && j < m) {
+      if (before[prefix + i] == after[prefix + j]) {
+        changes.lineMap[prefix + i + 1] = prefix + j + 1;
+        kept[j] = true;
+        ++i;
+        ++j;
+      } else if (lcs[i + 1][j] >= lcs[i][j + 1]) {
+        ++i;
+      } else {
+        ++j;
+      }
+    }
+  }
+  for (std::size_t j = 0; j < m; ++j) {
+    if (!kept[j]) {
+      changes.changedLines.push_back(prefix + j + 1);
+    }
+  }
+  return changes;
+}
+
+}  // namespace sentinel::diff
@@ -4,11 +4,20 @@
  */
 
 #include <fmt/core.h>
+#include <git2.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <deque>
+#include <filesystem>  // NOLINT
 #include <fstream>
+#include <set>
 #include <sstream>
 #include <string>
+#include <system_error>
 #include <utility>
+#include <vector>
 #include "sentinel/util/io.hpp"
 
 namespace sentinel::io {
@@ -60,4 +69,114 @@ void appendLogTail(std::string* msg, const std::filesystem::path& logPath,
   }
 }
 
+bool isSourceFile(const std::filesystem::path& path, const std::vector<std::string>& extensions) {
+  static const std::set<std::string> kHeaderExtensions = {"h", "hh", "hpp", "hxx", "inl", "ipp"};
+  const std::string ext = path.extension().string();
+  if (ext.size() < 2) {
+    return false;
+  }
+  return kHeaderExtensions.count(ext.substr(1)) != 0 ||
+         std::find(extensions.begin(), extensions.end(), ext.substr(1)) != extensions.end();
+}
+
+std::vector<std::filesystem::path> listSourceFiles(const std::filesystem::path& root,
+                                                   const std::vector<std::filesystem::path>& skipDirs,
+                                                   const std::vector<std::string>& extensions) {
+  namespace fs = std::filesystem;
+  std::vector<fs::path> files;
+  std::error_code ec;
+  for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator();
+       it.increment(ec)) {
+    const fs::path& path = it->path();
+    if (it->is_directory(ec)) {
+      const std::string name = path.filename().string();
+      if ((!name.empty() && name[0] == '.') ||
+          std::find(skipDirs.begin(), skipDirs.end(), path) != skipDirs.end()) {
+        it.disable_recursion_pending();
+      }
+      continue;
+    }
+    if (isSourceFile(path, extensions)) {
+      files.push_back(path);
+    }
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+void moveDirectory(const std::filesystem::path& from, const std::filesystem::path& to) {
+  namespace fs = std::filesystem;
+  fs::remove_all(to);
+  fs::create_directories(to.parent_path());
+  std::error_code ec;
+  fs::rename(from, to, ec);
+  if (ec == std::errc::cross_device_link) {
+    fs::copy(from, to, fs::copy_options::recursive);
+    fs::remove_all(from);
+  } else if (ec) {
+    throw fs::filesystem_error("Failed to move directory", from, to, ec);
+  }
+}
+
+// libgit2 is initialized on the first hash and stays so until the process
+// exits; initializing it per call would redo its global setup every time.
+static void initLibgit2() {
+  static const struct Libgit2 {
+    Libgit2() {
+      git_libgit2_init();
+    }
+    ~Libgit2() {
+      git_libgit2_shutdown();
+    }
+  } libgit2;
+}
+
+static std::string oidToString(const git_oid& oid) {
+  char buf[GIT_OID_MAX_HEXSIZE + 1];
+  git_oid_tostr(buf, sizeof(buf), &oid);
+  return buf;
+}
+
+std::string hashContent(const std::string& content) {
+  initLibgit2();
+  git_oid oid;
+  git_odb_hash(&oid, content.data(), content.size(), GIT_OBJECT_BLOB);
+  return oidToString(oid);
+}
+
+std::string hashFile(const std::filesystem::path& path) {
+  initLibgit2();
+  git_oid oid;
+  const int rc = git_odb_hashfile(&oid, path.c_str(), GIT_OBJECT_BLOB);
+  return rc == 0 ? oidToString(oid) : "";
+}
+
+void writeFileAtomically(const std::filesystem::path& path, const std::string& content) {
+  namespace fs = std::filesystem;
+  static std::atomic<unsigned> counter{0};
+  fs::path tmp = path;
+  tmp += fmt::format(".{}.{}.tmp", getpid(), counter++);
+
+  fs::create_directories(path.parent_path());
+  std::error_code ec;
+  {
+    std::ofstream out(tmp, std::ios::binary);
+    if (out) {
+      out << content;
+    }
+    if (!out) {
+      const int err = errno != 0 ? errno : EIO;
+      out.close();
+      fs::remove(tmp, ec);
+      throw fs::filesystem_error("Failed to write file", tmp, std::error_code(err, std::generic_category()));
+    }
+  }
+  fs::rename(tmp, path, ec);
+  if (ec) {
+    std::error_code rmEc;
+    fs::remove(tmp, rmEc);
+    throw fs::filesystem_error("Failed to rename file", tmp, path, ec);
+  }
+}
+
 }  // namespace sentinel::io
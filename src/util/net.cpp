@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <arpa/inet.h>
+#include <fmt/core.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <optional>
+#include <string>
+#include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/util/net.hpp"
+
+namespace sentinel::net {
+
+static constexpr const char* kUnixPrefix = "unix:";
+
+namespace {
+
+struct Endpoint {
+  bool isUnix = false;
+  std::string path;
+  std::string host;
+  std::string port;
+};
+
+Endpoint parseAddress(const std::string& address) {
+  Endpoint endpoint;
+  if (address.rfind(kUnixPrefix, 0) == 0) {
+    endpoint.isUnix = true;
+    endpoint.path = address.substr(std::strlen(kUnixPrefix));
+    if (endpoint.path.empty() || endpoint.path.size() >= sizeof(sockaddr_un::sun_path)) {
+      throw IOException(EINVAL, fmt::format("Invalid socket path in '{}'", address));
+    }
+    return endpoint;
+  }
+  const std::size_t colon = address.rfind(':');
+  if (colon == std::string::npos || colon + 1 == address.size()) {
+    throw IOException(EINVAL, fmt::format("Invalid address '{}': expected HOST:PORT or unix:PATH", address));
+  }
+  endpoint.host = address.substr(0, colon);
+  endpoint.port = address.substr(colon + 1);
+  if (endpoint.host.size() >= 2 && endpoint.host.front() == '[' && endpoint.host.back() == ']') {
+    endpoint.host = endpoint.host.substr(1, endpoint.host.size() - 2);
+  }
+  return endpoint;
+}
+
+sockaddr_un unixAddress(const std::string& path) {
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+  return addr;
+}
+
+// Connect or bind+listen the first address getaddrinfo returns that works.
+int openTcp(const Endpoint& endpoint, const std::string& address, bool passive) {
+  addrinfo hints{};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  // Without AI_PASSIVE, an empty host resolves to the loopback addresses for
+  // listening too; all interfaces have to be asked for (0.0.0.0 or [::]).
+  hints.ai_flags = 0;
+  addrinfo* result = nullptr;
+  const char* host = endpoint.host.empty() ? nullptr : endpoint.host.c_str();
+  if (int rc = ::getaddrinfo(host, endpoint.port.c_str(), &hints, &result); rc != 0) {
+    throw IOException(EINVAL, fmt::format("Cannot resolve '{}': {}", address, ::gai_strerror(rc)));
+  }
+  int error = 0;
+  int fd = -1;
+  for (addrinfo* ai = result; ai != nullptr; ai = ai->ai_next) {
+    fd = ::socket(ai->ai_family, ai->ai_socktype | SOCK_CLOEXEC, ai->ai_protocol);
+    if (fd < 0) {
+      error = errno;
+      continue;
+    }
+    if (passive) {
+      const int on = 1;
+      ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+      if (::bind(fd, ai->ai_addr, ai->ai_addrlen) == 0 && ::listen(fd, SOMAXCONN) == 0) {
+        break;
+      }
+    } else if (::connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+      break;
+    }
+    error = errno;
+    ::close(fd);
+    fd = -1;
+  }
+  ::freeaddrinfo(result);
+  if (fd < 0) {
+    throw IOException(error, fmt::format("Cannot {} '{}': {}", passive ? "listen on" : "connect to", address,
+                                         std::strerror(error)));
+  }
+  return fd;
+}
+
+bool writeAll(int fd, const char* data, std::size_t size) {
+  while (size > 0) {
+    const ssize_t n = ::send(fd, data, size, MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    data += n;
+    size -= static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+bool readAll(int fd, char* data, std::size_t size) {
+  while (size > 0) {
+    const ssize_t n = ::recv(fd, data, size, 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    data += n;
+    size -= static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+std::uint32_t decodeLength(const char* bytes) {
+  std::uint32_t length = 0;
+  std::memcpy(&length, bytes, sizeof(length));
+  return ntohl(length);
+}
+
+}  // namespace
+
+int listen(const std::string& address) {
+  const Endpoint endpoint = parseAddress(address);
+  if (!endpoint.isUnix) {
+    return openTcp(endpoint, address, true);
+  }
+  // A socket file left behind by a coordinator that was killed blocks bind().
+  struct stat st {};
+  if (::lstat(endpoint.path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) {
+    ::unlink(endpoint.path.c_str());
+  }
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    throw IOException(errno, fmt::format("Cannot create socket for '{}': {}", address, std::strerror(errno)));
+  }
+  const sockaddr_un addr = unixAddress(endpoint.path);
+  // Only processes of the same user may connect.
+  if (::bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      ::chmod(endpoint.path.c_str(), S_IRUSR | S_IWUSR) != 0 || ::listen(fd, SOMAXCONN) != 0) {
+    const int error = errno;
+    ::close(fd);
+    throw IOException(error, fmt::format("Cannot listen on '{}': {}", address, std::strerror(error)));
+  }
+  return fd;
+}
+
+int connect(const std::string& address) {
+  const Endpoint endpoint = parseAddress(address);
+  if (!endpoint.isUnix) {
+    return openTcp(endpoint, address, false);
+  }
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    throw IOException(errno, fmt::format("Cannot create socket for '{}': {}", address, std::strerror(errno)));
+  }
+  const sockaddr_un addr = unixAddress(endpoint.path);
+  if (::connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+    const int error = errno;
+    ::close(fd);
+    throw IOException(error, fmt::format("Cannot connect to '{}': {}", address, std::strerror(error)));
+  }
+  return fd;
+}
+
+std::string getLocalAddress(int fd) {
+  sockaddr_storage storage{};
+  socklen_t length = sizeof(storage);
+  if (::getsockname(fd, reinterpret_cast<sockaddr*>(&storage), &length) != 0) {
+    return "";
+  }
+  char host[INET6_ADDRSTRLEN] = {};
+  switch (storage.ss_family) {
+    case AF_UNIX:
+      return std::string(kUnixPrefix) + reinterpret_cast<const sockaddr_un*>(&storage)->sun_path;
+    case AF_INET: {
+      const auto* in = reinterpret_cast<const sockaddr_in*>(&storage);
+      ::inet_ntop(AF_INET, &in->sin_addr, host, sizeof(host));
+      return fmt::format("{}:{}", host, ntohs(in->sin_port));
+    }
+    case AF_INET6: {
+      const auto* in6 = reinterpret_cast<const sockaddr_in6*>(&storage);
+      ::inet_ntop(AF_INET6, &in6->sin6_addr, host, sizeof(host));
+      return fmt::format("[{}]:{}", host, ntohs(in6->sin6_port));
+    }
+    default:
+      return "";
+  }
+}
+
+void setSendTimeout(int fd, std::chrono::milliseconds timeout) {
+  const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(timeout - seconds);
+  timeval tv{};
+  tv.tv_sec = static_cast<time_t>(seconds.count());
+  tv.tv_usec = static_cast<suseconds_t>(micros.count());
+  ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+}
+
+bool sendFrame(int fd, const std::string& payload) {
+  if (payload.size() > kMaxFrameSize) {
+    return false;
+  }
+  const std::uint32_t length = htonl(static_cast<std::uint32_t>(payload.size()));
+  std::string frame(sizeof(length), '\0');
+  std::memcpy(frame.data(), &length, sizeof(length));
+  frame += payload;
+  return writeAll(fd, frame.data(), frame.size());
+}
+
+std::optional<std::string> receiveFrame(int fd) {
+  char header[sizeof(std::uint32_t)];
+  if (!readAll(fd, header, sizeof(header))) {
+    return std::nullopt;
+  }
+  const std::uint32_t length = decodeLength(header);
+  if (length > kMaxFrameSize) {
+    return std::nullopt;
+  }
+  std::string payload(length, '\0');
+  if (!readAll(fd, payload.data(), length)) {
+    return std::nullopt;
+  }
+  return payload;
+}
+
+void FrameReader::append(const char* data, std::size_t size) {
+  mBuffer.append(data, size);
+}
+
+std::optional<std::string> FrameReader::next() {
+  constexpr std::size_t kHeaderSize = sizeof(std::uint32_t);
+  if (mMalformed || mBuffer.size() < kHeaderSize) {
+    return std::nullopt;
+  }
+  const std::uint32_t length = decodeLength(mBuffer.data());
+  if (length > kMaxFrameSize) {
+    mMalformed = true;
+    return std::nullopt;
+  }
+  if (mBuffer.size() < kHeaderSize + length) {
+    return std::nullopt;
+  }
+  std::string payload = mBuffer.substr(kHeaderSize, length);
+  mBuffer.erase(0, kHeaderSize + length);
+  return payload;
+}
+
+bool FrameReader::isMalformed() const {
+  return mMalformed;
+}
+
+}  // namespace sentinel::net
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <gtest/gtest.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/IR/DebugInfoMetadata.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/InstrTypes.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/BitcodeCompiler.hpp"
+#include "sentinel/IrMutator.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class BitcodeCompilerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_BITCODECOMPILER_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase / "out");
+    testutil::writeFile(mBase / "calc.cpp", kCalcSource);
+    testutil::writeFile(mBase / "out" / "calc.o", "");
+  }
+
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+
+  void writeCompileDb(const std::string& flags) {
+    testutil::writeFile(mBase / "compile_commands.json",
+                        fmt::format(R"([{{"directory": "{}", "command": "/usr/bin/c++ {} -c calc.cpp -o out/calc.o", )"
+                                    R"("file": "{}"}}])",
+                                    mBase.string(), flags, (mBase / "calc.cpp").string()));
+  }
+
+  std::unique_ptr<llvm::Module> parse(const BitcodeUnit& unit) {
+    auto buffer = llvm::MemoryBuffer::getMemBuffer(unit.bitcode, "calc.bc", false);
+    auto module = llvm::parseBitcodeFile(buffer->getMemBufferRef(), mContext);
+    EXPECT_TRUE(static_cast<bool>(module));
+    return module ? std::move(*module) : nullptr;
+  }
+
+  // Opcode, predicate and flags of the operator instruction at @p line and @p column.
+  static std::string describe(llvm::Module* module, std::size_t line, std::size_t column) {
+    for (llvm::Function& fn : *module) {
+      for (llvm::Instruction& inst : llvm::instructions(fn)) {
+        const llvm::DILocation* loc = inst.getDebugLoc().get();
+        if (loc == nullptr || loc->getLine() != line || loc->getColumn() != column) {
+          continue;
+        }
+        if (auto* cmp = llvm::dyn_cast<llvm::CmpInst>(&inst)) {
+          const std::string predicate = llvm::CmpInst::getPredicateName(cmp->getPredicate()).str();
+          return fmt::format("{} {}", inst.getOpcodeName(), predicate);
+        }
+        if (llvm::isa<llvm::BinaryOperator>(inst)) {
+          const bool nsw = llvm::isa<llvm::OverflowingBinaryOperator>(inst) && inst.hasNoSignedWrap();
+          return fmt::format("{}{}", inst.getOpcodeName(), nsw ? " nsw" : "");
+        }
+      }
+    }
+    return "";
+  }
+
+  static std::string getLine(std::size_t line) {
+    std::istringstream in(kCalcSource);
+    std::string text;
+    for (std::size_t i = 0; i < line; i++) {
+      std::getline(in, text);
+    }
+    return text;
+  }
+
+  fs::path mBase;
+  llvm::LLVMContext mContext;
+
+  static constexpr const char* kCalcSource = R"(int add(int a, int b) { return a + b; }
+unsigned divide(unsigned a, unsigned b) { return a / b; }
+bool less(int a, int b) { return a < b; }
+bool below(unsigned a, unsigned b) { return a < b; }
+int shift(int a, int b) { return a >> b; }
+double scale(double a, double b) { return a * b; }
+int mask(int a, int b) { return a & b; }
+)";
+};
+
+TEST_F(BitcodeCompilerTest, testCompilesFileWithItsBuildOptions) {
+  writeCompileDb("-O2 -fPIC -ffunction-sections");
+  BitcodeCompiler compiler(mBase);
+  const std::optional<BitcodeUnit> unit = compiler.compile(mBase / "calc.cpp");
+
+  ASSERT_TRUE(unit.has_value());
+  EXPECT_EQ(mBase / "out" / "calc.o", unit->object);
+  EXPECT_EQ(2U, unit->optLevel);
+  EXPECT_TRUE(unit->pic);
+  EXPECT_TRUE(unit->functionSections);
+  EXPECT_FALSE(unit->debugInfo);
+  auto module = parse(*unit);
+  ASSERT_NE(nullptr, module);
+  EXPECT_EQ("add nsw", describe(module.get(), 1, 34));
+}
+
+TEST_F(BitcodeCompilerTest, testIrMutantsMatchSourceMutants) {
+  struct Case {
+    std::string op;
+    std::size_t line;
+    std::string original;
+    std::string token;
+  };
+  const std::vector<Case> cases = {
+      {"AOR", 1, "+", "-"},  {"AOR", 1, "+", "%"},  {"AOR", 2, "/", "*"},   {"AOR", 2, "/", "%"},
+      {"ROR", 3, "<", ">="}, {"ROR", 4, "<", "<="}, {"SOR", 5, ">>", "<<"}, {"AOR", 6, "*", "/"},
+      {"BOR", 7, "&", "^"},
+  };
+  writeCompileDb("-O0");
+  BitcodeCompiler compiler(mBase);
+  const std::optional<BitcodeUnit> original = compiler.compile(mBase / "calc.cpp");
+  ASSERT_TRUE(original.has_value());
+
+  for (const auto& c : cases) {
+    const std::string line = getLine(c.line);
+    const std::size_t column = line.find(c.original, line.find("return")) + 1;
+    const Mutant m(c.op, "calc.cpp", "", c.line, column, c.line, column + c.original.size(), c.token);
+    SCOPED_TRACE(fmt::format("{}:{} {} -> {}", c.line, column, c.original, c.token));
+
+    auto irMutated = parse(*original);
+    ASSERT_NE(nullptr, irMutated);
+    ASSERT_EQ(1U, IrMutator::apply(irMutated.get(), m, c.original));
+
+    std::string source = kCalcSource;
+    std::size_t offset = 0;
+    for (std::size_t i = 1; i < c.line; i++) {
+      offset = source.find('\n', offset) + 1;
+    }
+    source.replace(offset + column - 1, c.original.size(), c.token);
+    testutil::writeFile(mBase / "calc.cpp", source);
+    const std::optional<BitcodeUnit> mutated = compiler.compile(mBase / "calc.cpp");
+    testutil::writeFile(mBase / "calc.cpp", kCalcSource);
+    ASSERT_TRUE(mutated.has_value());
+    auto sourceMutated = parse(*mutated);
+    ASSERT_NE(nullptr, sourceMutated);
+
+    EXPECT_NE("", describe(sourceMutated.get(), c.line, column));
+    EXPECT_EQ(describe(sourceMutated.get(), c.line, column), describe(irMutated.get(), c.line, column));
+  }
+}
+
+TEST_F(BitcodeCompilerTest, testInstrumentedBuildIsNotCompiled) {
+  writeCompileDb("-O0 --coverage");
+  BitcodeCompiler compiler(mBase);
+  EXPECT_FALSE(compiler.compile(mBase / "calc.cpp").has_value());
+}
+
+TEST_F(BitcodeCompilerTest, testFileWithoutObjectIsNotCompiled) {
+  writeCompileDb("-O0");
+  fs::remove(mBase / "out" / "calc.o");
+  BitcodeCompiler compiler(mBase);
+  EXPECT_FALSE(compiler.compile(mBase / "calc.cpp").has_value());
+  EXPECT_FALSE(compiler.compile(mBase / "other.cpp").has_value());
+}
+
+TEST_F(BitcodeCompilerTest, testThrowsWithoutCompileDb) {
+  EXPECT_THROW(BitcodeCompiler compiler(mBase / "missing"), IOException);
+}
+
+}  // namespace sentinel
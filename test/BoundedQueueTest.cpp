@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "sentinel/util/BoundedQueue.hpp"
+
+namespace sentinel {
+
+TEST(BoundedQueueTest, testPopReturnsItemsInPushOrder) {
+  BoundedQueue<int> queue(4);
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  EXPECT_TRUE(queue.push(3));
+  EXPECT_EQ(1, queue.pop().value());
+  EXPECT_EQ(2, queue.pop().value());
+  EXPECT_EQ(3, queue.pop().value());
+  EXPECT_EQ(3u, queue.getPushedCount());
+}
+
+TEST(BoundedQueueTest, testCloseDrainsRemainingItems) {
+  BoundedQueue<int> queue(4);
+  queue.push(7);
+  queue.close();
+  EXPECT_FALSE(queue.push(8));
+  EXPECT_EQ(7, queue.pop().value());
+  EXPECT_FALSE(queue.pop().has_value());
+  EXPECT_FALSE(queue.isAborted());
+}
+
+TEST(BoundedQueueTest, testAbortDiscardsItemsAndRejectsPush) {
+  BoundedQueue<int> queue(4);
+  queue.push(1);
+  queue.abort();
+  EXPECT_TRUE(queue.isAborted());
+  EXPECT_FALSE(queue.pop().has_value());
+  EXPECT_FALSE(queue.push(2));
+}
+
+TEST(BoundedQueueTest, testPushBlocksWhileFull) {
+  BoundedQueue<int> queue(1);
+  queue.push(1);
+  std::atomic<bool> pushed{false};
+  std::thread producer([&] {
+    queue.push(2);
+    pushed = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(pushed);
+  EXPECT_EQ(1, queue.pop().value());
+  producer.join();
+  EXPECT_TRUE(pushed);
+  EXPECT_EQ(2, queue.pop().value());
+}
+
+TEST(BoundedQueueTest, testPopBlocksUntilCloseFromAnotherThread) {
+  BoundedQueue<int> queue(2);
+  std::vector<int> received;
+  std::thread consumer([&] {
+    while (auto item = queue.pop()) {
+      received.push_back(*item);
+    }
+  });
+  for (int i = 0; i < 10; ++i) {
+    queue.push(i);
+  }
+  queue.close();
+  consumer.join();
+  ASSERT_EQ(10u, received.size());
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(i, received[static_cast<std::size_t>(i)]);
+  }
+}
+
+TEST(BoundedQueueTest, testAbortWakesBlockedProducer) {
+  BoundedQueue<int> queue(1);
+  queue.push(1);
+  bool result = true;
+  std::thread producer([&] { result = queue.push(2); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  queue.abort();
+  producer.join();
+  EXPECT_FALSE(result);
+}
+
+}  // namespace sentinel
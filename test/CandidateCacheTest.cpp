@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <string>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/CandidateCache.hpp"
+#include "sentinel/FileCandidates.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class CandidateCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_CANDIDATECACHE_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase / "src");
+    testutil::writeFile(mBase / "src" / "foo.cpp", "#include \"foo.hpp\"\nint foo() { return 1 + kTwo; }\n");
+    testutil::writeFile(mBase / "src" / "foo.hpp", "constexpr int kTwo = 2;\n");
+    mCandidates.mutants.emplace_back("AOR", (mBase / "src" / "foo.cpp").string(), "foo", 2, 22, 2, 23, "-");
+    mCandidates.depths = {{2, 1}};
+    mCandidates.includes = {(mBase / "src" / "foo.cpp").string(), (mBase / "src" / "foo.hpp").string()};
+  }
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+
+  fs::path mBase;
+  FileCandidates mCandidates;
+  const std::string mKey = "clang++ -c foo.cpp\nlines 2";
+};
+
+TEST_F(CandidateCacheTest, testStoredCandidatesAreFound) {
+  CandidateCache(mBase / "cache", "1.0 AOR").store(mBase / "src" / "foo.cpp", mKey, mCandidates);
+
+  auto found = CandidateCache(mBase / "cache", "1.0 AOR").find(mBase / "src" / "foo.cpp", mKey);
+  ASSERT_TRUE(found.has_value());
+  EXPECT_EQ(mCandidates.mutants, found->mutants);
+  EXPECT_EQ(mCandidates.depths, found->depths);
+  EXPECT_EQ(mCandidates.includes, found->includes);
+}
+
+TEST_F(CandidateCacheTest, testChangedKeyOrContextMisses) {
+  CandidateCache(mBase / "cache", "1.0 AOR").store(mBase / "src" / "foo.cpp", mKey, mCandidates);
+  EXPECT_FALSE(CandidateCache(mBase / "cache", "1.0 AOR").find(mBase / "src" / "foo.cpp", mKey + " 3"));
+  EXPECT_FALSE(CandidateCache(mBase / "cache", "1.0 AOR BOR").find(mBase / "src" / "foo.cpp", mKey));
+}
+
+TEST_F(CandidateCacheTest, testChangedFileOrHeaderMisses) {
+  CandidateCache(mBase / "cache", "").store(mBase / "src" / "foo.cpp", mKey, mCandidates);
+
+  testutil::writeFile(mBase / "src" / "foo.hpp", "constexpr int kTwo = 3;\n");
+  EXPECT_FALSE(CandidateCache(mBase / "cache", "").find(mBase / "src" / "foo.cpp", mKey));
+  testutil::writeFile(mBase / "src" / "foo.hpp", "constexpr int kTwo = 2;\n");
+  EXPECT_TRUE(CandidateCache(mBase / "cache", "").find(mBase / "src" / "foo.cpp", mKey));
+
+  fs::remove(mBase / "src" / "foo.hpp");
+  EXPECT_FALSE(CandidateCache(mBase / "cache", "").find(mBase / "src" / "foo.cpp", mKey));
+
+  testutil::writeFile(mBase / "src" / "foo.cpp", "int foo() { return 1 + 2; }\n");
+  EXPECT_FALSE(CandidateCache(mBase / "cache", "").find(mBase / "src" / "foo.cpp", mKey));
+}
+
+TEST_F(CandidateCacheTest, testCandidatesWithoutIncludesAreNotStored) {
+  mCandidates.includes.clear();
+  CandidateCache(mBase / "cache", "").store(mBase / "src" / "foo.cpp", mKey, mCandidates);
+  EXPECT_FALSE(fs::exists(mBase / "cache"));
+}
+
+TEST_F(CandidateCacheTest, testCorruptEntryMisses) {
+  CandidateCache(mBase / "cache", "").store(mBase / "src" / "foo.cpp", mKey, mCandidates);
+  for (const auto& entry : fs::recursive_directory_iterator(mBase / "cache")) {
+    if (entry.is_regular_file()) {
+      testutil::writeFile(entry.path(), "garbage");
+    }
+  }
+  EXPECT_FALSE(CandidateCache(mBase / "cache", "").find(mBase / "src" / "foo.cpp", mKey));
+}
+
+}  // namespace sentinel
@@ -6,6 +6,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <filesystem>  // NOLINT
+#include <optional>
 #include <string>
 #include <vector>
 #include "sentinel/CliConfigParser.hpp"
@@ -273,6 +274,21 @@ TEST_F(CliConfigParserTest, testMergePartitionDefaultsToEmpty) {
   EXPECT_TRUE(cfg.mergeWorkspaces.empty());
 }
 
+TEST_F(CliConfigParserTest, testTargetedBuildParsed) {
+  EXPECT_FALSE(parse({}).targetedBuild);
+  EXPECT_TRUE(parse({"--targeted-build"}).targetedBuild);
+}
+
+TEST_F(CliConfigParserTest, testMergeIndexOnlyParsed) {
+  EXPECT_FALSE(parse({"--merge-partition", "/data/part1"}).mergeIndexOnly);
+  EXPECT_TRUE(parse({"--merge-partition", "/data/part1", "--merge-index-only"}).mergeIndexOnly);
+}
+
+TEST_F(CliConfigParserTest, testMergeHardLinkParsed) {
+  EXPECT_FALSE(parse({"--merge-partition", "/data/part1"}).mergeHardLink);
+  EXPECT_TRUE(parse({"--merge-partition", "/data/part1", "--merge-hard-link"}).mergeHardLink);
+}
+
 TEST_F(CliConfigParserTest, testApplyReportOnlyToAppliesThreshold) {
   args::ArgumentParser parser("test", "");
   CliConfigParser cliParser(parser);
@@ -283,6 +299,21 @@ TEST_F(CliConfigParserTest, testApplyReportOnlyToAppliesThreshold) {
   EXPECT_DOUBLE_EQ(*cfg.threshold, 80.5);
 }
 
+TEST_F(CliConfigParserTest, testTimeBudgetAppliedWhenStartingAndResuming) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--time-budget", "21600"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ(std::optional<std::size_t>(21600), cfg.timeBudget);
+
+  Config resumed = Config::withDefaults();
+  cliParser.applyReportOnlyTo(&resumed);
+  EXPECT_EQ(std::optional<std::size_t>(21600), resumed.timeBudget);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Not(::testing::Contains("--time-budget")));
+}
+
 TEST_F(CliConfigParserTest, testApplyReportOnlyToAppliesOutputDir) {
   args::ArgumentParser parser("test", "");
   CliConfigParser cliParser(parser);
@@ -406,6 +437,38 @@ TEST_F(CliConfigParserTest, testResumeFlowNoWarningWhenOnlyReportOptions) {
   EXPECT_TRUE(ignored.empty());
 }
 
+TEST_F(CliConfigParserTest, testStreamFlagParsed) {
+  EXPECT_FALSE(parse({}).stream);
+  EXPECT_TRUE(parse({"--stream"}).stream);
+}
+
+TEST_F(CliConfigParserTest, testStreamAppliedWhenResuming) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--stream"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyReportOnlyTo(&cfg);
+  EXPECT_TRUE(cfg.stream);
+  EXPECT_TRUE(cliParser.getEffectiveCliOptions().empty());
+}
+
+TEST_F(CliConfigParserTest, testWatchFlagParsed) {
+  EXPECT_FALSE(parse({}).watch);
+  EXPECT_TRUE(parse({"--watch"}).watch);
+}
+
+TEST_F(CliConfigParserTest, testWatchAppliedWhenResuming) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--watch"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyReportOnlyTo(&cfg);
+  EXPECT_TRUE(cfg.watch);
+  EXPECT_TRUE(cliParser.getEffectiveCliOptions().empty());
+}
+
 TEST_F(CliConfigParserTest, testResumeFlowWarnsAllNonReportOptions) {
   args::ArgumentParser parser("test", "");
   CliConfigParser cliParser(parser);
@@ -417,4 +480,201 @@ TEST_F(CliConfigParserTest, testResumeFlowWarnsAllNonReportOptions) {
       "--from", "--uncommitted", "--timeout", "--operator"));
 }
 
+TEST_F(CliConfigParserTest, testSharedAppliesCheckoutOptionsWhenResuming) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--shared", "--source-dir", "/src2", "--build-command", "make -C b2",
+                                            "--timeout", "10"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyReportOnlyTo(&cfg);
+  EXPECT_TRUE(cfg.shared);
+  EXPECT_EQ(std::filesystem::path("/src2"), cfg.sourceDir);
+  EXPECT_EQ("make -C b2", cfg.buildCmd);
+  EXPECT_FALSE(cfg.timeout.has_value());
+  EXPECT_EQ(std::vector<std::string>{"--timeout"}, cliParser.getEffectiveCliOptions());
+}
+
+TEST_F(CliConfigParserTest, testCheckoutOptionsIgnoredWhenResumingWithoutShared) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--source-dir", "/src2"});
+
+  Config cfg = Config::withDefaults();
+  const std::filesystem::path before = cfg.sourceDir;
+  cliParser.applyReportOnlyTo(&cfg);
+  EXPECT_EQ(before, cfg.sourceDir);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--source-dir"));
+}
+
+TEST_F(CliConfigParserTest, testServeAndWorkerAddresses) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--serve=:7000", "--worker=unix:/tmp/sentinel.sock"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ(std::optional<std::string>(":7000"), cfg.serveAddress);
+  EXPECT_EQ(std::optional<std::string>("unix:/tmp/sentinel.sock"), cfg.workerAddress);
+  EXPECT_TRUE(cliParser.getEffectiveCliOptions().empty());
+}
+
+TEST_F(CliConfigParserTest, testServeIsKeptWhenResuming) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--serve=:7000"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyReportOnlyTo(&cfg);
+  EXPECT_EQ(std::optional<std::string>(":7000"), cfg.serveAddress);
+}
+
+TEST_F(CliConfigParserTest, testPartitionByParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--partition=1/2", "--partition-by=cost", "--partition-costs=prev"});
+
+  Config cfg = Config::withDefaults();
+  EXPECT_EQ("count", cfg.partitionBy);
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ("cost", cfg.partitionBy);
+  EXPECT_EQ(std::filesystem::absolute("prev").lexically_normal(), cfg.partitionCosts);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--partition-by"));
+}
+
+TEST_F(CliConfigParserTest, testPlanOptionsParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--generate-only=out/plan.yaml", "--plan=plan.yaml"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ(std::filesystem::absolute("out/plan.yaml").lexically_normal(), cfg.generateOnly);
+  EXPECT_EQ(std::filesystem::absolute("plan.yaml").lexically_normal(), cfg.planFile);
+  EXPECT_TRUE(cliParser.isGenerateOnly());
+  const auto opts = cliParser.getEffectiveCliOptions();
+  EXPECT_THAT(opts, ::testing::Contains("--plan"));
+  EXPECT_THAT(opts, ::testing::Not(::testing::Contains("--generate-only")));
+}
+
+TEST_F(CliConfigParserTest, testFailFastBuildParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--fail-fast-build"});
+
+  Config cfg = Config::withDefaults();
+  EXPECT_FALSE(cfg.failFastBuild);
+  cliParser.applyTo(&cfg);
+  EXPECT_TRUE(cfg.failFastBuild);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--fail-fast-build"));
+}
+
+TEST_F(CliConfigParserTest, testJobserverParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--jobserver=16"});
+
+  Config cfg = Config::withDefaults();
+  EXPECT_FALSE(cfg.jobserver.has_value());
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ(std::optional<std::size_t>(16), cfg.jobserver);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--jobserver"));
+}
+
+TEST_F(CliConfigParserTest, testPressureTargetsParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--pressure-target=memory:10", "--pressure-target", "io:40"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ((std::vector<std::string>{"memory:10", "io:40"}), cfg.pressureTargets);
+  EXPECT_FALSE(cfg.jobserver.has_value());
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--pressure-target"));
+}
+
+TEST_F(CliConfigParserTest, testWeakMutationParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--weak-mutation"});
+
+  Config cfg = Config::withDefaults();
+  EXPECT_FALSE(cfg.weakMutation);
+  cliParser.applyTo(&cfg);
+  EXPECT_TRUE(cfg.weakMutation);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--weak-mutation"));
+}
+
+TEST_F(CliConfigParserTest, testStaticTestSelectionParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--static-test-selection"});
+
+  Config cfg = Config::withDefaults();
+  EXPECT_FALSE(cfg.staticTestSelection);
+  cliParser.applyTo(&cfg);
+  EXPECT_TRUE(cfg.staticTestSelection);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--static-test-selection"));
+}
+
+TEST_F(CliConfigParserTest, testIrMutationParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--ir-mutation"});
+
+  Config cfg = Config::withDefaults();
+  EXPECT_FALSE(cfg.irMutation);
+  cliParser.applyTo(&cfg);
+  EXPECT_TRUE(cfg.irMutation);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--ir-mutation"));
+}
+
+TEST_F(CliConfigParserTest, testJitBitcodeParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--jit-bitcode=/tmp/unittest.bc"});
+
+  Config cfg = Config::withDefaults();
+  EXPECT_TRUE(cfg.jitBitcode.empty());
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ(std::filesystem::path("/tmp/unittest.bc"), cfg.jitBitcode);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--jit-bitcode"));
+}
+
+TEST_F(CliConfigParserTest, testKeepTestResultsParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--keep-test-results"});
+
+  Config cfg = Config::withDefaults();
+  EXPECT_FALSE(cfg.keepTestResults);
+  cliParser.applyTo(&cfg);
+  EXPECT_TRUE(cfg.keepTestResults);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--keep-test-results"));
+}
+
+TEST_F(CliConfigParserTest, testGenerationLimitsParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--generation-memory-limit", "2048", "--generation-timeout", "300"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ(std::optional<std::size_t>(2048), cfg.generationMemoryLimit);
+  EXPECT_EQ(std::optional<std::size_t>(300), cfg.generationTimeout);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--generation-memory-limit"));
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--generation-timeout"));
+}
+
+TEST_F(CliConfigParserTest, testCandidateCacheDirParsed) {
+  args::ArgumentParser parser("test", "");
+  CliConfigParser cliParser(parser);
+  parser.ParseArgs(std::vector<std::string>{"--candidate-cache-dir", "/tmp/candidates/../cache"});
+
+  Config cfg = Config::withDefaults();
+  cliParser.applyTo(&cfg);
+  EXPECT_EQ(std::filesystem::path("/tmp/cache"), cfg.candidateCacheDir);
+  EXPECT_THAT(cliParser.getEffectiveCliOptions(), ::testing::Contains("--candidate-cache-dir"));
+}
+
 }  // namespace sentinel
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "helper/TestTempDir.hpp"
+#include "sentinel/ConcurrentStage.hpp"
+#include "sentinel/Mutant.hpp"
+#include "sentinel/PipelineContext.hpp"
+#include "sentinel/Workspace.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class PushingStage : public Stage {
+ public:
+  PushingStage(int count, bool skip = false, bool fail = false) : mCount(count), mSkip(skip), mFail(fail) {
+  }
+  bool wasExecuted() const { return mExecuted; }
+  bool wasStopped() const { return mStopped; }
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override {
+    (void)ctx;
+    return mSkip;
+  }
+  StatusLine::Phase getPhase() const override { return StatusLine::Phase::GENERATION; }
+  bool execute(PipelineContext* ctx) override {
+    mExecuted = true;
+    for (int id = 1; id <= mCount; ++id) {
+      Mutant m("AOR", "foo.cpp", "foo", static_cast<std::size_t>(id), 1, static_cast<std::size_t>(id), 2, "-");
+      if (!ctx->mutantQueue->push({id, m})) {
+        mStopped = true;
+        return false;
+      }
+    }
+    if (mFail) {
+      throw std::runtime_error("generation failed");
+    }
+    return true;
+  }
+
+ private:
+  int mCount;
+  bool mSkip;
+  bool mFail;
+  bool mExecuted = false;
+  bool mStopped = false;
+};
+
+class PoppingStage : public Stage {
+ public:
+  explicit PoppingStage(int failAfter = -1) : mFailAfter(failAfter) {
+  }
+  const std::vector<int>& getIds() const { return mIds; }
+  bool wasExecuted() const { return mExecuted; }
+  bool hadQueue() const { return mHadQueue; }
+  bool sawAbort() const { return mSawAbort; }
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override {
+    (void)ctx;
+    return false;
+  }
+  StatusLine::Phase getPhase() const override { return StatusLine::Phase::EVALUATION; }
+  bool execute(PipelineContext* ctx) override {
+    mExecuted = true;
+    mHadQueue = ctx->mutantQueue != nullptr;
+    if (!mHadQueue) {
+      return true;
+    }
+    while (auto item = ctx->mutantQueue->pop()) {
+      if (static_cast<int>(mIds.size()) == mFailAfter) {
+        throw std::runtime_error("evaluation failed");
+      }
+      mIds.push_back(item->first);
+    }
+    mSawAbort = ctx->mutantQueue->isAborted();
+    return !mSawAbort;
+  }
+
+ private:
+  int mFailAfter;
+  std::vector<int> mIds;
+  bool mExecuted = false;
+  bool mHadQueue = false;
+  bool mSawAbort = false;
+};
+
+class ConcurrentStageTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_CONCURRENTSTAGE_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase);
+    mWorkspace = std::make_shared<Workspace>(mBase / "ws");
+  }
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+  PipelineContext makeCtx() {
+    return {mConfig, mStatusLine, *mWorkspace};
+  }
+
+  fs::path mBase;
+  Config mConfig;
+  StatusLine mStatusLine;
+  std::shared_ptr<Workspace> mWorkspace;
+};
+
+TEST_F(ConcurrentStageTest, testConsumerReceivesAllMutantsInOrder) {
+  auto producer = std::make_shared<PushingStage>(100);
+  auto consumer = std::make_shared<PoppingStage>();
+  auto stage = std::make_shared<ConcurrentStage>(producer, consumer, 4);
+  auto ctx = makeCtx();
+  stage->run(&ctx);
+
+  ASSERT_EQ(100u, consumer->getIds().size());
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(i + 1, consumer->getIds()[static_cast<std::size_t>(i)]);
+  }
+  EXPECT_FALSE(consumer->sawAbort());
+  EXPECT_EQ(nullptr, ctx.mutantQueue);
+}
+
+TEST_F(ConcurrentStageTest, testProceedsToNextStage) {
+  auto producer = std::make_shared<PushingStage>(3);
+  auto consumer = std::make_shared<PoppingStage>();
+  auto next = std::make_shared<PoppingStage>();
+  auto stage = std::make_shared<ConcurrentStage>(producer, consumer);
+  stage->setNext(next);
+  auto ctx = makeCtx();
+  stage->run(&ctx);
+
+  EXPECT_EQ(3u, consumer->getIds().size());
+  EXPECT_TRUE(next->wasExecuted());
+  EXPECT_FALSE(next->hadQueue());
+}
+
+TEST_F(ConcurrentStageTest, testSkippedProducerRunsConsumerWithoutQueue) {
+  auto producer = std::make_shared<PushingStage>(3, /*skip=*/true);
+  auto consumer = std::make_shared<PoppingStage>();
+  auto stage = std::make_shared<ConcurrentStage>(producer, consumer);
+  auto ctx = makeCtx();
+  stage->run(&ctx);
+
+  EXPECT_FALSE(producer->wasExecuted());
+  EXPECT_FALSE(consumer->hadQueue());
+}
+
+TEST_F(ConcurrentStageTest, testProducerFailureAbortsConsumerAndRethrows) {
+  auto producer = std::make_shared<PushingStage>(2, false, /*fail=*/true);
+  auto consumer = std::make_shared<PoppingStage>();
+  auto next = std::make_shared<PoppingStage>();
+  auto stage = std::make_shared<ConcurrentStage>(producer, consumer);
+  stage->setNext(next);
+  auto ctx = makeCtx();
+
+  EXPECT_THROW(stage->run(&ctx), std::runtime_error);
+  EXPECT_TRUE(consumer->sawAbort());
+  EXPECT_FALSE(next->wasExecuted());
+}
+
+TEST_F(ConcurrentStageTest, testConsumerFailureStopsProducer) {
+  auto producer = std::make_shared<PushingStage>(1000);
+  auto consumer = std::make_shared<PoppingStage>(/*failAfter=*/2);
+  auto stage = std::make_shared<ConcurrentStage>(producer, consumer, 2);
+  auto ctx = makeCtx();
+
+  EXPECT_THROW(stage->run(&ctx), std::runtime_error);
+  EXPECT_TRUE(producer->wasStopped());
+}
+
+}  // namespace sentinel
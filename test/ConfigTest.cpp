@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <filesystem>  // NOLINT
 #include <fstream>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -87,6 +88,20 @@ test-result-dir: ./results
 lcov-tracefile:
   - coverage.info
 restrict: true
+cache-dir: ./cache
+targeted-build: true
+fail-fast-build: true
+jobserver: 12
+pressure-target:
+  - memory:10
+weak-mutation: true
+static-test-selection: true
+ir-mutation: true
+jit-bitcode: ./build/unittest.bc
+keep-test-results: true
+generation-memory-limit: 2048
+generation-timeout: 300
+candidate-cache-dir: ./candidates
 generator: random
 mutants-per-line: 3
 timeout: 30
@@ -99,6 +114,19 @@ operator:
   YamlConfigParser::applyTo(&cfg, configPath("sentinel.yaml"));
 
   EXPECT_TRUE(cfg.restrictGeneration);
+  EXPECT_EQ((mTmpDir / "cache").lexically_normal(), cfg.cacheDir);
+  EXPECT_TRUE(cfg.targetedBuild);
+  EXPECT_TRUE(cfg.failFastBuild);
+  EXPECT_EQ(std::optional<std::size_t>(12), cfg.jobserver);
+  EXPECT_EQ(std::vector<std::string>{"memory:10"}, cfg.pressureTargets);
+  EXPECT_TRUE(cfg.weakMutation);
+  EXPECT_TRUE(cfg.staticTestSelection);
+  EXPECT_TRUE(cfg.irMutation);
+  EXPECT_EQ((mTmpDir / "build" / "unittest.bc").lexically_normal(), cfg.jitBitcode);
+  EXPECT_TRUE(cfg.keepTestResults);
+  EXPECT_EQ(std::optional<std::size_t>(2048), cfg.generationMemoryLimit);
+  EXPECT_EQ(std::optional<std::size_t>(300), cfg.generationTimeout);
+  EXPECT_EQ((mTmpDir / "candidates").lexically_normal(), cfg.candidateCacheDir);
   EXPECT_EQ((mTmpDir / "src").lexically_normal(), cfg.sourceDir);
   EXPECT_EQ((mTmpDir / "out").lexically_normal(), cfg.outputDir);
   EXPECT_EQ((mTmpDir / "build").lexically_normal(), cfg.compileDbDir);
@@ -116,6 +144,42 @@ operator:
   EXPECT_EQ(std::vector<std::string>({"AOR", "ROR"}), cfg.operators);
 }
 
+TEST_F(ConfigTest, testYamlApplyParsesScopes) {
+  writeFile("sentinel.yaml", R"(
+version: 1
+scopes:
+  - path: services/billing/*
+    build-command: make -C services/billing
+    test-command: make -C services/billing test
+    test-result-dir: ./services/billing/results
+)");
+
+  Config cfg = Config::withDefaults();
+  YamlConfigParser::applyTo(&cfg, configPath("sentinel.yaml"));
+
+  ASSERT_EQ(1U, cfg.scopes.size());
+  EXPECT_EQ("services/billing/*", cfg.scopes[0].path);
+  EXPECT_EQ("make -C services/billing", cfg.scopes[0].buildCmd);
+  EXPECT_EQ("make -C services/billing test", cfg.scopes[0].testCmd);
+  EXPECT_EQ((mTmpDir / "services/billing/results").lexically_normal(), cfg.scopes[0].testResultDir);
+}
+
+TEST_F(ConfigTest, testYamlApplyThrowsOnInvalidScopes) {
+  Config cfg = Config::withDefaults();
+  writeFile("not-list.yaml", "version: 1\nscopes: services/*\n");
+  EXPECT_THROW_MESSAGE(
+      YamlConfigParser::applyTo(&cfg, configPath("not-list.yaml")),
+      std::runtime_error, HasSubstr("must be a list"));
+  writeFile("missing.yaml", "version: 1\nscopes:\n  - path: a/*\n    build-command: make\n");
+  EXPECT_THROW_MESSAGE(
+      YamlConfigParser::applyTo(&cfg, configPath("missing.yaml")),
+      std::runtime_error, HasSubstr("needs 'test-command'"));
+  writeFile("unknown.yaml", "version: 1\nscopes:\n  - path: a/*\n    timeout: 3\n");
+  EXPECT_THROW_MESSAGE(
+      YamlConfigParser::applyTo(&cfg, configPath("unknown.yaml")),
+      std::runtime_error, HasSubstr("Unknown key 'timeout' in 'scopes'"));
+}
+
 TEST_F(ConfigTest, testYamlApplyPartialConfig) {
   writeFile("sentinel.yaml", R"(
 version: 1
@@ -348,6 +412,41 @@ TEST_F(ConfigTest, testPartitionParseThrowsOnSlashAtEnd) {
   EXPECT_THROW(Partition::parse("1/"), std::invalid_argument);
 }
 
+TEST_F(ConfigTest, testPressureTargetParseValid) {
+  auto t = PressureTarget::parse("Memory:12.5");
+  EXPECT_EQ("memory", t.resource);
+  EXPECT_DOUBLE_EQ(12.5, t.percent);
+  EXPECT_DOUBLE_EQ(100.0, PressureTarget::parse("io:100").percent);
+}
+
+TEST_F(ConfigTest, testPressureTargetParseThrowsOnInvalidValue) {
+  EXPECT_THROW(PressureTarget::parse("memory"), std::invalid_argument);
+  EXPECT_THROW(PressureTarget::parse("disk:10"), std::invalid_argument);
+  EXPECT_THROW(PressureTarget::parse("cpu:"), std::invalid_argument);
+  EXPECT_THROW(PressureTarget::parse("cpu:10%"), std::invalid_argument);
+  EXPECT_THROW(PressureTarget::parse("cpu:0"), std::invalid_argument);
+  EXPECT_THROW(PressureTarget::parse("cpu:101"), std::invalid_argument);
+}
+
+TEST_F(ConfigTest, testScopeFindPrefersMostSpecificMatch) {
+  const std::vector<Scope> scopes = {{"services/*", "make", "make test", "/r0"},
+                                     {"services/billing/*", "make -C b", "make -C b test", "/r1"},
+                                     {"services/billing/*.cpp", "make -C c", "make -C c test", "/r2"},
+                                     {"services/*/legacy/*", "make -C l", "make -C l test", "/r3"}};
+  EXPECT_EQ(std::optional<std::size_t>(0), Scope::find(scopes, "services/auth/login.cpp"));
+  EXPECT_EQ(std::optional<std::size_t>(2), Scope::find(scopes, "services/billing/invoice.cpp"));
+  EXPECT_EQ(std::optional<std::size_t>(1), Scope::find(scopes, "services/billing/sub/tax.cc"));
+  EXPECT_EQ(std::optional<std::size_t>(1), Scope::find(scopes, "services/billing/legacy/old.cc"));
+  EXPECT_EQ(std::optional<std::size_t>(3), Scope::find(scopes, "services/auth/legacy/old.cpp"));
+  EXPECT_FALSE(Scope::find(scopes, "tools/main.cpp").has_value());
+  EXPECT_FALSE(Scope::find({}, "services/auth/login.cpp").has_value());
+}
+
+TEST_F(ConfigTest, testScopeFindPrefersFirstListedOnTie) {
+  const std::vector<Scope> scopes = {{"lib/*.cpp", "a", "a", "/a"}, {"lib/*.cpp", "b", "b", "/b"}};
+  EXPECT_EQ(std::optional<std::size_t>(0), Scope::find(scopes, "lib/x.cpp"));
+}
+
 TEST_F(ConfigTest, testPartitionParseThrowsOnNonNumeric) {
   EXPECT_THROW(Partition::parse("abc/def"), std::invalid_argument);
 }
@@ -525,6 +624,152 @@ TEST_F(ConfigTest, testStreamOperatorOmitsRestrictByDefault) {
   EXPECT_EQ(std::string::npos, yaml.find("restrict"));
 }
 
+TEST_F(ConfigTest, testStreamOperatorEmitsCacheDirWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("cache-dir"));
+  cfg.cacheDir = "/tmp/sentinel-cache";
+  std::ostringstream outWithCache;
+  outWithCache << cfg;
+  EXPECT_NE(std::string::npos, outWithCache.str().find("cache-dir: /tmp/sentinel-cache"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsTargetedBuildWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("targeted-build"));
+  cfg.targetedBuild = true;
+  std::ostringstream outWithTargeted;
+  outWithTargeted << cfg;
+  EXPECT_NE(std::string::npos, outWithTargeted.str().find("targeted-build: true"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsFailFastBuildWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("fail-fast-build"));
+  cfg.failFastBuild = true;
+  std::ostringstream outWithFailFast;
+  outWithFailFast << cfg;
+  EXPECT_NE(std::string::npos, outWithFailFast.str().find("fail-fast-build: true"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsJobserverWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("jobserver"));
+  cfg.jobserver = 0;
+  std::ostringstream outWithJobserver;
+  outWithJobserver << cfg;
+  EXPECT_NE(std::string::npos, outWithJobserver.str().find("jobserver: 0"));
+  cfg.pressureTargets = {"memory:10", "io:40"};
+  std::ostringstream outWithTargets;
+  outWithTargets << cfg;
+  EXPECT_NE(std::string::npos, outWithTargets.str().find("pressure-target:\n  - memory:10\n  - io:40"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsWeakMutationWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("weak-mutation"));
+  cfg.weakMutation = true;
+  std::ostringstream outWithWeak;
+  outWithWeak << cfg;
+  EXPECT_NE(std::string::npos, outWithWeak.str().find("weak-mutation: true"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsStaticTestSelectionWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("static-test-selection"));
+  cfg.staticTestSelection = true;
+  std::ostringstream outWithSelection;
+  outWithSelection << cfg;
+  EXPECT_NE(std::string::npos, outWithSelection.str().find("static-test-selection: true"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsIrMutationWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("ir-mutation"));
+  cfg.irMutation = true;
+  std::ostringstream outWithIr;
+  outWithIr << cfg;
+  EXPECT_NE(std::string::npos, outWithIr.str().find("ir-mutation: true"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsJitBitcodeWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("jit-bitcode"));
+  cfg.jitBitcode = "/tmp/unittest.bc";
+  std::ostringstream outWithJit;
+  outWithJit << cfg;
+  EXPECT_NE(std::string::npos, outWithJit.str().find("jit-bitcode: /tmp/unittest.bc"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsKeepTestResultsWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("keep-test-results"));
+  cfg.keepTestResults = true;
+  std::ostringstream outWithKeep;
+  outWithKeep << cfg;
+  EXPECT_NE(std::string::npos, outWithKeep.str().find("keep-test-results: true"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsGenerationLimitsWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("generation-"));
+  cfg.generationMemoryLimit = 4096;
+  cfg.generationTimeout = 600;
+  std::ostringstream outWithLimits;
+  outWithLimits << cfg;
+  EXPECT_NE(std::string::npos, outWithLimits.str().find("generation-memory-limit: 4096"));
+  EXPECT_NE(std::string::npos, outWithLimits.str().find("generation-timeout: 600"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsCandidateCacheDirWhenSet) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("candidate-cache-dir"));
+  cfg.candidateCacheDir = "/tmp/sentinel-candidates";
+  std::ostringstream outWithCache;
+  outWithCache << cfg;
+  EXPECT_NE(std::string::npos, outWithCache.str().find("candidate-cache-dir: /tmp/sentinel-candidates"));
+}
+
+TEST_F(ConfigTest, testStreamOperatorEmitsScopesThatParseBack) {
+  Config cfg = Config::withDefaults();
+  std::ostringstream out;
+  out << cfg;
+  EXPECT_EQ(std::string::npos, out.str().find("scopes"));
+  cfg.scopes = {{"lib/*", "make -C lib", "make -C lib test", mTmpDir / "lib-results"}};
+  std::ostringstream outWithScopes;
+  outWithScopes << cfg;
+  writeFile("emitted.yaml", outWithScopes.str());
+
+  Config parsed = Config::withDefaults();
+  YamlConfigParser::applyTo(&parsed, configPath("emitted.yaml"));
+  ASSERT_EQ(1U, parsed.scopes.size());
+  EXPECT_EQ("lib/*", parsed.scopes[0].path);
+  EXPECT_EQ("make -C lib", parsed.scopes[0].buildCmd);
+  EXPECT_EQ("make -C lib test", parsed.scopes[0].testCmd);
+  EXPECT_EQ(mTmpDir / "lib-results", parsed.scopes[0].testResultDir);
+}
+
 TEST_F(ConfigTest, testStreamOperatorWeightedGenerator) {
   Config cfg = Config::withDefaults();
   cfg.generator = Generator::WEIGHTED;
@@ -71,6 +71,31 @@ TEST_F(ConfigValidatorTest, testThresholdBelowZeroThrows) {
   EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
 }
 
+TEST_F(ConfigValidatorTest, testThrowsWhenTimeBudgetIsZero) {
+  mConfig.timeBudget = 0;
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+  mConfig.timeBudget = 1;
+  EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
+}
+
+TEST_F(ConfigValidatorTest, testThrowsWhenJitBitcodeIsCombinedWithStream) {
+  mConfig.jitBitcode = "unittest.bc";
+  mConfig.stream = true;
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+  mConfig.stream = false;
+  EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
+}
+
+TEST_F(ConfigValidatorTest, testThrowsWhenGenerationLimitIsZero) {
+  mConfig.generationMemoryLimit = 0;
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+  mConfig.generationMemoryLimit = 1;
+  mConfig.generationTimeout = 0;
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+  mConfig.generationTimeout = 1;
+  EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
+}
+
 TEST_F(ConfigValidatorTest, testThresholdAtBoundaryIsValid) {
   mConfig.threshold = 0.0;
   EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
@@ -78,6 +103,13 @@ TEST_F(ConfigValidatorTest, testThresholdAtBoundaryIsValid) {
   EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
 }
 
+TEST_F(ConfigValidatorTest, testThrowsOnInvalidPressureTarget) {
+  mConfig.pressureTargets = {"memory:10", "swap:5"};
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+  mConfig.pressureTargets = {"memory:10", "io:40"};
+  EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
+}
+
 TEST_F(ConfigValidatorTest, testThrowsOnInvalidPartitionFormat) {
   mConfig.partition = std::string("bad");
   EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
@@ -121,6 +153,31 @@ TEST_F(ConfigValidatorTest, testThrowsWhenPartitionIndexExceedsCount) {
   EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
 }
 
+TEST_F(ConfigValidatorTest, testThrowsOnUnknownPartitionBy) {
+  mConfig.partitionBy = "size";
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+  mConfig.partitionBy = "cost";
+  EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
+}
+
+TEST_F(ConfigValidatorTest, testThrowsWhenPartitionCostsIsNotWorkspace) {
+  mConfig.partitionBy = "cost";
+  mConfig.partitionCosts = mBase;
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+}
+
+TEST_F(ConfigValidatorTest, testThrowsWhenPlanIsMissingOrCombinedWithGenerateOnly) {
+  mConfig.planFile = mBase / "missing-plan.yaml";
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+  mConfig.planFile = mBase;
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+  mConfig.planFile.clear();
+  mConfig.generateOnly = mBase / "plan.yaml";
+  EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
+  mConfig.planFile = mConfig.generateOnly;
+  EXPECT_THROW(ConfigValidator::validate(mConfig), InvalidArgumentException);
+}
+
 TEST_F(ConfigValidatorTest, testWarningForTimeoutZero) {
   mConfig.timeout = static_cast<size_t>(0);
   EXPECT_NO_THROW(ConfigValidator::validate(mConfig));
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <chrono>
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "git-harness/GitHarness.hpp"
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/Config.hpp"
+#include "sentinel/GitRepository.hpp"
+#include "sentinel/Mutant.hpp"
+#include "sentinel/MutationResult.hpp"
+#include "sentinel/MutationState.hpp"
+#include "sentinel/PipelineContext.hpp"
+#include "sentinel/StatusLine.hpp"
+#include "sentinel/Worker.hpp"
+#include "sentinel/WorkerProtocol.hpp"
+#include "sentinel/Workspace.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/stages/CoordinatorStage.hpp"
+#include "sentinel/util/net.hpp"
+
+namespace fs = std::filesystem;
+
+namespace sentinel {
+
+static const char* const kTestResultXml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<testsuites><testsuite name=\"S\" tests=\"1\">"
+    "<testcase name=\"t1\" classname=\"C\" status=\"run\"/>"
+    "</testsuite></testsuites>\n";
+
+class CoordinatorStageTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_COORDINATOR_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase);
+
+    mRepoDir = mBase / "repo";
+    mHarness = std::make_shared<GitHarness>(mRepoDir.string());
+    mRepoDir = fs::canonical(mRepoDir);
+    mHarness->addFile("foo.cpp", "int foo() { return 1 + 2; }\n");
+    mHarness->stageFile({"foo.cpp"});
+    mHarness->commit("init");
+
+    mWorkspace = std::make_shared<Workspace>(mBase / "workspace");
+    mWorkspace->initialize();
+    auto origDir = mWorkspace->getOriginalResultsDir();
+    fs::create_directories(origDir);
+    testutil::writeFile(origDir / "results.xml", kTestResultXml);
+    mWorkspace->createMutant(1, Mutant("AOR", "foo.cpp", "foo", 1, 24, 1, 25, "-"));
+    mWorkspace->createMutant(2, Mutant("AOR", "foo.cpp", "foo", 1, 24, 1, 25, "*"));
+
+    fs::create_directories(mBase / "test_results");
+    mConfig.sourceDir = mRepoDir;
+    mConfig.workDir = mBase / "workspace";
+    mConfig.buildCmd = "false";
+    mConfig.testCmd = "true";
+    mConfig.testResultDir = mBase / "test_results";
+    mConfig.timeout = 5;
+
+    // Socket paths are limited to 108 bytes; the test directory may be longer.
+    mSocketPath = fs::temp_directory_path() / ("sentinel-coordinator-" + std::to_string(::getpid()) + ".sock");
+    mAddress = "unix:" + mSocketPath.string();
+    mGitRepo = std::make_shared<GitRepository>(mRepoDir);
+  }
+
+  void TearDown() override {
+    fs::remove_all(mBase);
+    fs::remove(mSocketPath);
+  }
+
+  /**
+   * @brief Run the coordinator on a background thread and wait until it listens.
+   */
+  std::thread startCoordinator() {
+    std::thread coordinator([this] {
+      CoordinatorStage stage(mGitRepo, mAddress, kToken);
+      PipelineContext ctx{mConfig, mStatusLine, *mWorkspace};
+      stage.run(&ctx);
+    });
+    for (int i = 0; i < 500; ++i) {
+      try {
+        ::close(net::connect(mAddress));
+        break;
+      } catch (const IOException&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    }
+    return coordinator;
+  }
+
+  std::size_t runWorker(const std::string& name, const std::string& token = kToken) {
+    Config workerConfig = mConfig;
+    workerConfig.workDir = mBase / name;
+    Worker worker(workerConfig, std::make_shared<Workspace>(workerConfig.workDir), token);
+    return worker.run(mAddress);
+  }
+
+  static constexpr const char* kToken = "secret";
+
+  fs::path mBase;
+  fs::path mRepoDir;
+  fs::path mSocketPath;
+  std::string mAddress;
+  Config mConfig;
+  StatusLine mStatusLine;
+  std::shared_ptr<GitHarness> mHarness;
+  std::shared_ptr<Workspace> mWorkspace;
+  std::shared_ptr<GitRepository> mGitRepo;
+};
+
+TEST_F(CoordinatorStageTest, testWorkerEvaluatesAllMutants) {
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  std::thread coordinator = startCoordinator();
+  const std::size_t evaluated = runWorker("worker");
+  coordinator.join();
+  testing::internal::GetCapturedStderr();
+  const std::string output = testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(2U, evaluated);
+  EXPECT_TRUE(mWorkspace->isComplete());
+  for (int id : {1, 2}) {
+    ASSERT_TRUE(mWorkspace->isDone(id));
+    EXPECT_EQ(MutationState::BUILD_FAILURE, mWorkspace->getDoneResult(id).getMutationState());
+  }
+  EXPECT_NE(std::string::npos, output.find("[2/2]"));
+  EXPECT_FALSE(fs::exists(mSocketPath));
+}
+
+TEST_F(CoordinatorStageTest, testMutantOfDisconnectedWorkerIsHandedOutAgain) {
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  std::thread coordinator = startCoordinator();
+
+  const int fd = net::connect(mAddress);
+  ASSERT_TRUE(net::sendFrame(fd, protocol::encode(protocol::kHello, std::to_string(protocol::kVersion) + "\nsecret\nfake")));
+  auto setup = net::receiveFrame(fd);
+  ASSERT_TRUE(setup.has_value());
+  EXPECT_EQ(protocol::kSetup, protocol::decode(*setup).type);
+  ASSERT_TRUE(net::sendFrame(fd, protocol::encode(protocol::kReady)));
+  auto assignment = net::receiveFrame(fd);
+  ASSERT_TRUE(assignment.has_value());
+  EXPECT_EQ(protocol::kMutant, protocol::decode(*assignment).type);
+  ::close(fd);
+
+  const std::size_t evaluated = runWorker("worker");
+  coordinator.join();
+  const std::string log = testing::internal::GetCapturedStderr();
+  testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(2U, evaluated);
+  EXPECT_NE(std::string::npos, log.find("is handed out again"));
+  EXPECT_TRUE(mWorkspace->isComplete());
+  EXPECT_TRUE(mWorkspace->isDone(1));
+  EXPECT_TRUE(mWorkspace->isDone(2));
+}
+
+TEST_F(CoordinatorStageTest, testReadyWhileAssignedDropsWorker) {
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  std::thread coordinator = startCoordinator();
+
+  const int fd = net::connect(mAddress);
+  const std::string hello = std::to_string(protocol::kVersion) + "\nsecret\nfake";
+  ASSERT_TRUE(net::sendFrame(fd, protocol::encode(protocol::kHello, hello)));
+  ASSERT_TRUE(net::receiveFrame(fd).has_value());
+  ASSERT_TRUE(net::sendFrame(fd, protocol::encode(protocol::kReady)));
+  auto assignment = net::receiveFrame(fd);
+  ASSERT_TRUE(assignment.has_value());
+  EXPECT_EQ(protocol::kMutant, protocol::decode(*assignment).type);
+  ASSERT_TRUE(net::sendFrame(fd, protocol::encode(protocol::kReady)));
+  EXPECT_FALSE(net::receiveFrame(fd).has_value());
+  ::close(fd);
+
+  const std::size_t evaluated = runWorker("worker");
+  coordinator.join();
+  const std::string log = testing::internal::GetCapturedStderr();
+  testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(2U, evaluated);
+  EXPECT_NE(std::string::npos, log.find("sent an invalid message and was disconnected; mutant"));
+  EXPECT_TRUE(mWorkspace->isDone(1));
+  EXPECT_TRUE(mWorkspace->isDone(2));
+}
+
+TEST_F(CoordinatorStageTest, testWorkerWithWrongTokenIsRefused) {
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  std::thread coordinator = startCoordinator();
+
+  const int fd = net::connect(mAddress);
+  const std::string hello = std::to_string(protocol::kVersion) + "\nguess\nfake";
+  ASSERT_TRUE(net::sendFrame(fd, protocol::encode(protocol::kHello, hello)));
+  auto reply = net::receiveFrame(fd);
+  ASSERT_TRUE(reply.has_value());
+  EXPECT_EQ(protocol::kRefused, protocol::decode(*reply).type);
+  EXPECT_FALSE(net::receiveFrame(fd).has_value());
+  ::close(fd);
+  EXPECT_THROW(runWorker("intruder", "guess"), std::runtime_error);
+
+  const std::size_t evaluated = runWorker("worker");
+  coordinator.join();
+  const std::string log = testing::internal::GetCapturedStderr();
+  testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(2U, evaluated);
+  EXPECT_NE(std::string::npos, log.find("was refused"));
+  EXPECT_FALSE(fs::exists(Workspace(mBase / "intruder").getOriginalResultsDir() / "results.xml"));
+}
+
+TEST_F(CoordinatorStageTest, testDoneMutantsAreNotHandedOut) {
+  mWorkspace->setDone(1, MutationResult(Mutant("AOR", "foo.cpp", "foo", 1, 24, 1, 25, "-"), "", "",
+                                        MutationState::BUILD_FAILURE));
+
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  std::thread coordinator = startCoordinator();
+  const std::size_t evaluated = runWorker("worker");
+  coordinator.join();
+  testing::internal::GetCapturedStderr();
+  testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(1U, evaluated);
+  EXPECT_TRUE(mWorkspace->isComplete());
+}
+
+TEST_F(CoordinatorStageTest, testWorkerRefusesWorkspaceWithSentinelRun) {
+  testutil::writeFile(mBase / "workspace" / "config.yaml", "source-dir: .\n");
+  Worker worker(mConfig, mWorkspace, kToken);
+  EXPECT_THROW(worker.run(mAddress), std::runtime_error);
+}
+
+}  // namespace sentinel
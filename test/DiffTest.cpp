@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+#include "sentinel/util/diff.hpp"
+
+namespace sentinel {
+
+TEST(DiffTest, testIdenticalFilesKeepEveryLine) {
+  const std::vector<std::string> lines = {"a", "b", "c"};
+  auto changes = diff::compareLines(lines, lines);
+  EXPECT_TRUE(changes.changedLines.empty());
+  const std::map<std::size_t, std::size_t> expected = {{1, 1}, {2, 2}, {3, 3}};
+  EXPECT_EQ(expected, changes.lineMap);
+}
+
+TEST(DiffTest, testInsertedLinesShiftFollowingLines) {
+  auto changes = diff::compareLines({"a", "b", "c"}, {"a", "x", "y", "b", "c"});
+  EXPECT_EQ((std::vector<std::size_t>{2, 3}), changes.changedLines);
+  const std::map<std::size_t, std::size_t> expected = {{1, 1}, {2, 4}, {3, 5}};
+  EXPECT_EQ(expected, changes.lineMap);
+}
+
+TEST(DiffTest, testModifiedLineIsChangedAndNotMapped) {
+  auto changes = diff::compareLines({"a", "b", "c"}, {"a", "B", "c"});
+  EXPECT_EQ((std::vector<std::size_t>{2}), changes.changedLines);
+  const std::map<std::size_t, std::size_t> expected = {{1, 1}, {3, 3}};
+  EXPECT_EQ(expected, changes.lineMap);
+}
+
+TEST(DiffTest, testDeletedLinesAreNotMapped) {
+  auto changes = diff::compareLines({"a", "b", "c", "d"}, {"a", "d"});
+  EXPECT_TRUE(changes.changedLines.empty());
+  const std::map<std::size_t, std::size_t> expected = {{1, 1}, {4, 2}};
+  EXPECT_EQ(expected, changes.lineMap);
+}
+
+TEST(DiffTest, testMovedBlockInsideChangedRegion) {
+  auto changes = diff::compareLines({"h", "a", "b", "c", "t"}, {"h", "c", "a", "b", "t"});
+  EXPECT_EQ((std::vector<std::size_t>{2}), changes.changedLines);
+  const std::map<std::size_t, std::size_t> expected = {{1, 1}, {2, 3}, {3, 4}, {5, 5}};
+  EXPECT_EQ(expected, changes.lineMap);
+}
+
+TEST(DiffTest, testNewFileReportsEveryLine) {
+  auto changes = diff::compareLines({}, {"a", "b"});
+  EXPECT_EQ((std::vector<std::size_t>{1, 2}), changes.changedLines);
+  EXPECT_TRUE(changes.lineMap.empty());
+}
+
+}  // namespace sentinel
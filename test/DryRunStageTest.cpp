@@ -158,4 +158,42 @@ TEST_F(DryRunStageTest, testExecuteWithZeroMutants) {
   EXPECT_NE(std::string::npos, statusText.find("0")) << "Status text: " << statusText;
 }
 
+TEST_F(DryRunStageTest, testPrintsRuntimeEstimateWhenTestTimeRecorded) {
+  mConfig.dryRun = true;
+  mConfig.buildCmd = "true";
+  mConfig.sourceDir = mBase;
+
+  auto ws = makeWorkspace();
+  populateMutants(ws.get(), 3);
+  WorkspaceStatus status;
+  status.originalTestSeconds = 60.0;
+  ws->saveStatus(status);
+
+  auto stage = std::make_shared<DryRunStage>();
+  auto ctx = makeCtx(ws.get());
+  testing::internal::CaptureStdout();
+  EXPECT_NO_THROW(stage->run(&ctx));
+  std::string output = testing::internal::GetCapturedStdout();
+
+  EXPECT_NE(std::string::npos, output.find("Runtime Estimate")) << output;
+  EXPECT_NE(std::string::npos, output.find("Mutants:    3")) << output;
+  EXPECT_NE(std::string::npos, output.find("N/2")) << output;
+  EXPECT_EQ(std::string::npos, output.find("N/4")) << output;
+}
+
+TEST_F(DryRunStageTest, testSkipsRuntimeEstimateWithoutTestTime) {
+  mConfig.dryRun = true;
+
+  auto ws = makeWorkspace();
+  populateMutants(ws.get(), 1);
+
+  auto stage = std::make_shared<DryRunStage>();
+  auto ctx = makeCtx(ws.get());
+  testing::internal::CaptureStdout();
+  EXPECT_NO_THROW(stage->run(&ctx));
+  std::string output = testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(std::string::npos, output.find("Runtime Estimate")) << output;
+}
+
 }  // namespace sentinel
@@ -5,10 +5,12 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <chrono>
 #include <filesystem>  // NOLINT
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
 #include "git-harness/GitHarness.hpp"
 #include "helper/FileTestHelper.hpp"
 #include "helper/TestTempDir.hpp"
@@ -41,6 +43,49 @@ class EvaluationStageTest : public ::testing::Test {
   fs::path mBase;
 };
 
+TEST_F(EvaluationStageTest, testIsCompilerErrorInGccAndClang) {
+  EXPECT_TRUE(EvaluationStage::isCompilerErrorIn("src/foo.cpp:12:5: error: expected ';'", "src/foo.cpp"));
+  EXPECT_TRUE(EvaluationStage::isCompilerErrorIn("/home/u/proj/src/foo.cpp:12: error: x", "src/foo.cpp"));
+  EXPECT_TRUE(EvaluationStage::isCompilerErrorIn("../src/foo.cpp:3:1: fatal error: x.h: No such file", "src/foo.cpp"));
+  EXPECT_TRUE(EvaluationStage::isCompilerErrorIn("foo.cpp:1:1: error: x", "src/foo.cpp"));
+  EXPECT_TRUE(EvaluationStage::isCompilerErrorIn("\x1b[1msrc/foo.cpp:1:2: \x1b[0;1;31merror: \x1b[0mx", "src/foo.cpp"));
+}
+
+TEST_F(EvaluationStageTest, testIsCompilerErrorInMsvc) {
+  EXPECT_TRUE(EvaluationStage::isCompilerErrorIn("C:\\proj\\src\\foo.cpp(12): error C2065: 'x'", "foo.cpp"));
+  EXPECT_TRUE(EvaluationStage::isCompilerErrorIn("src/foo.cpp(12,5): error C2143: syntax error", "src/foo.cpp"));
+}
+
+TEST_F(EvaluationStageTest, testIsCompilerErrorInRejectsOtherLines) {
+  EXPECT_FALSE(EvaluationStage::isCompilerErrorIn("src/foo.cpp:12:5: warning: unused variable", "src/foo.cpp"));
+  EXPECT_FALSE(EvaluationStage::isCompilerErrorIn("src/bar.cpp:12:5: error: expected ';'", "src/foo.cpp"));
+  EXPECT_FALSE(EvaluationStage::isCompilerErrorIn("lib/foo.cpp:12:5: error: expected ';'", "src/foo.cpp"));
+  EXPECT_FALSE(EvaluationStage::isCompilerErrorIn("make: *** [Makefile:2: all] Error 1", "src/foo.cpp"));
+  EXPECT_FALSE(EvaluationStage::isCompilerErrorIn("src/foo.cpp:12:5: note: error: in expansion", "src/foo.cpp"));
+  EXPECT_FALSE(EvaluationStage::isCompilerErrorIn(": error: no file", "src/foo.cpp"));
+}
+
+TEST_F(EvaluationStageTest, testStratifyInterleavesFilesAndOperators) {
+  std::vector<std::pair<int, Mutant>> mutants = {
+      {1, Mutant("AOR", "a.cpp", "f", 1, 1, 1, 2, "-")}, {2, Mutant("AOR", "a.cpp", "f", 2, 1, 2, 2, "-")},
+      {3, Mutant("ROR", "a.cpp", "f", 3, 1, 3, 2, "<")}, {4, Mutant("AOR", "a.cpp", "f", 4, 1, 4, 2, "-")},
+      {5, Mutant("SDL", "b.cpp", "g", 1, 1, 1, 2, "{}")}, {6, Mutant("SDL", "b.cpp", "g", 2, 1, 2, 2, "{}")},
+      {7, Mutant("UOI", "c.cpp", "h", 1, 1, 1, 2, "x++")},
+  };
+
+  std::vector<int> ids;
+  for (const auto& [id, m] : EvaluationStage::stratify(mutants)) {
+    ids.push_back(id);
+  }
+
+  // a.cpp: 1 (AOR), 3 (ROR), 2 (AOR), 4 (AOR); b.cpp: 5, 6; c.cpp: 7
+  EXPECT_EQ((std::vector<int>{1, 5, 7, 3, 6, 2, 4}), ids);
+}
+
+TEST_F(EvaluationStageTest, testStratifyEmpty) {
+  EXPECT_TRUE(EvaluationStage::stratify({}).empty());
+}
+
 TEST_F(EvaluationStageTest, testRestoreBackupCopiesFilesToSrcRoot) {
   Workspace ws(mBase);
   auto srcRoot = mBase / "src";
@@ -206,6 +251,40 @@ TEST_F(EvaluationStageFlowTest, testShouldSkipWhenComplete) {
   EXPECT_THAT(output, ::testing::Not(HasSubstr("AOR")));
 }
 
+TEST_F(EvaluationStageFlowTest, testEvaluatesMutantsFromQueue) {
+  Mutant m("AOR", "foo.cpp", "foo", 1, 24, 1, 25, "-");
+  mWorkspace->createMutant(1, m);
+  mConfig.buildCmd = "false";
+
+  MutantQueue queue(4);
+  queue.push({1, m});
+  queue.close();
+
+  auto stage = std::make_shared<EvaluationStage>(mGitRepo);
+  auto ctx = makeCtx();
+  ctx.mutantQueue = &queue;
+
+  testing::internal::CaptureStdout();
+  EXPECT_NO_THROW(stage->run(&ctx));
+  std::string output = testing::internal::GetCapturedStdout();
+
+  EXPECT_THAT(output, HasSubstr("[1/1]"));
+  EXPECT_TRUE(mWorkspace->isDone(1));
+  EXPECT_TRUE(mWorkspace->isComplete());
+}
+
+TEST_F(EvaluationStageFlowTest, testAbortedQueueLeavesRunIncomplete) {
+  MutantQueue queue(4);
+  queue.abort();
+
+  auto stage = std::make_shared<EvaluationStage>(mGitRepo);
+  auto ctx = makeCtx();
+  ctx.mutantQueue = &queue;
+
+  EXPECT_NO_THROW(stage->run(&ctx));
+  EXPECT_FALSE(mWorkspace->isComplete());
+}
+
 TEST_F(EvaluationStageFlowTest, testEvaluateMutantBuildFailure) {
   createDefaultMutant();
   mConfig.buildCmd = "false";
@@ -225,6 +304,99 @@ TEST_F(EvaluationStageFlowTest, testEvaluateMutantBuildFailure) {
   EXPECT_EQ(MutationState::BUILD_FAILURE, result.getMutationState());
 }
 
+TEST_F(EvaluationStageFlowTest, testCachedVerdictIsReusedAcrossRuns) {
+  createDefaultMutant();
+  const fs::path counter = mBase / "builds.txt";
+  mConfig.buildCmd = fmt::format("echo build >> {} && false", counter.string());
+  mConfig.cacheDir = mBase / "cache";
+
+  auto ctx = makeCtx();
+  testing::internal::CaptureStdout();
+  std::make_shared<EvaluationStage>(mGitRepo)->run(&ctx);
+  testing::internal::GetCapturedStdout();
+  EXPECT_FALSE(mWorkspace->getDoneResult(1).isCached());
+
+  mWorkspace->clearResults();
+  testing::internal::CaptureStdout();
+  std::make_shared<EvaluationStage>(mGitRepo)->run(&ctx);
+  std::string output = testing::internal::GetCapturedStdout();
+
+  EXPECT_THAT(output, HasSubstr("[cached]"));
+  auto result = mWorkspace->getDoneResult(1);
+  EXPECT_TRUE(result.isCached());
+  EXPECT_EQ(MutationState::BUILD_FAILURE, result.getMutationState());
+  EXPECT_EQ("build\n", testutil::readFile(counter));
+}
+
+TEST_F(EvaluationStageFlowTest, testCachedVerdictIsNotReusedAfterTestSourceChange) {
+  createDefaultMutant();
+  mConfig.buildCmd = "false";
+  mConfig.cacheDir = mBase / "cache";
+  mConfig.patterns = {"!test/*"};
+  mGitRepo = std::make_shared<GitRepository>(mRepoDir, mConfig.extensions, mConfig.patterns);
+  fs::create_directories(mRepoDir / "test");
+  testutil::writeFile(mRepoDir / "test" / "foo_test.cpp", "// v1\n");
+
+  auto ctx = makeCtx();
+  testing::internal::CaptureStdout();
+  std::make_shared<EvaluationStage>(mGitRepo)->run(&ctx);
+  testing::internal::GetCapturedStdout();
+
+  testutil::writeFile(mRepoDir / "test" / "foo_test.cpp", "// v2\n");
+  mWorkspace->clearResults();
+  testing::internal::CaptureStdout();
+  std::make_shared<EvaluationStage>(mGitRepo)->run(&ctx);
+  std::string output = testing::internal::GetCapturedStdout();
+
+  EXPECT_THAT(output, ::testing::Not(HasSubstr("[cached]")));
+  EXPECT_FALSE(mWorkspace->getDoneResult(1).isCached());
+}
+
+TEST_F(EvaluationStageFlowTest, testSharedWaitsForMutantLockedByAnotherProcess) {
+  createDefaultMutant();
+  const fs::path counter = mBase / "builds.txt";
+  mConfig.buildCmd = fmt::format("echo build >> {} && false", counter.string());
+  mConfig.shared = true;
+  mWorkspace->setWorkerName("host.1");
+  ASSERT_TRUE(mWorkspace->tryLock(1, "host.2"));
+
+  Mutant m("AOR", "foo.cpp", "foo", 1, 24, 1, 25, "-");
+  std::thread other([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    mWorkspace->setDone(1, MutationResult(m, "C.t1", "", MutationState::KILLED));
+    mWorkspace->clearLock(1);
+  });
+
+  Logger::setLevel(Logger::Level::INFO);
+  auto ctx = makeCtx();
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  std::make_shared<EvaluationStage>(mGitRepo)->run(&ctx);
+  testing::internal::GetCapturedStdout();
+  std::string stderrOutput = testing::internal::GetCapturedStderr();
+  other.join();
+
+  EXPECT_THAT(stderrOutput, HasSubstr("Waiting for 1 mutant evaluated by other processes"));
+  EXPECT_FALSE(fs::exists(counter));
+  EXPECT_EQ(MutationState::KILLED, mWorkspace->getDoneResult(1).getMutationState());
+  EXPECT_TRUE(mWorkspace->isComplete());
+}
+
+TEST_F(EvaluationStageFlowTest, testSharedClaimsAndReleasesUnlockedMutant) {
+  createDefaultMutant();
+  mConfig.buildCmd = "false";
+  mConfig.shared = true;
+  mWorkspace->setWorkerName("host.1");
+
+  auto ctx = makeCtx();
+  testing::internal::CaptureStdout();
+  std::make_shared<EvaluationStage>(mGitRepo)->run(&ctx);
+  testing::internal::GetCapturedStdout();
+  EXPECT_TRUE(mWorkspace->isDone(1));
+  EXPECT_FALSE(mWorkspace->isLocked(1));
+  EXPECT_TRUE(mWorkspace->isComplete());
+}
+
 TEST_F(EvaluationStageFlowTest, testSkipAlreadyDoneMutant) {
   createDefaultMutant();
 
@@ -305,6 +477,28 @@ TEST_F(EvaluationStageFlowTest, testEvaluateMutantSurvived) {
   EXPECT_EQ(MutationState::SURVIVED, result.getMutationState());
 }
 
+TEST_F(EvaluationStageFlowTest, testMutantInScopeUsesScopeCommandsAndResults) {
+  createDefaultMutant();
+  mConfig.buildCmd = "false";
+  const fs::path scopeResultDir = mBase / "scope_results";
+  const fs::path scopeOrigDir = mWorkspace->getOriginalScopeResultsDir(0);
+  fs::create_directories(scopeOrigDir);
+  testutil::writeFile(scopeOrigDir / "scope.xml", kTestResultXml);
+  mConfig.scopes = {{"*.cpp", "true",
+                     fmt::format("mkdir -p {} && cp {} {}", scopeResultDir.string(), (scopeOrigDir / "scope.xml").string(),
+                                 (scopeResultDir / "scope.xml").string()),
+                     scopeResultDir}};
+
+  auto stage = std::make_shared<EvaluationStage>(mGitRepo);
+  auto ctx = makeCtx();
+
+  testing::internal::CaptureStdout();
+  EXPECT_NO_THROW(stage->run(&ctx));
+  testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(MutationState::SURVIVED, mWorkspace->getDoneResult(1).getMutationState());
+}
+
 TEST_F(EvaluationStageFlowTest, testEvaluateMutantStoresBuildAndTestTime) {
   createDefaultMutant();
 
@@ -554,6 +748,101 @@ TEST_F(EvaluationStageFlowTest, testUncoveredMutantSetsUncoveredFlagOnResult) {
   EXPECT_TRUE(result.isUncovered());
 }
 
+TEST_F(EvaluationStageFlowTest, testNotInfectedMutantSkippedAsSurvived) {
+  createDefaultMutant();
+  WorkspaceStatus status;
+  status.notInfected = std::vector<int>{1};
+  mWorkspace->saveStatus(status);
+  mConfig.buildCmd = "false";
+
+  auto stage = std::make_shared<EvaluationStage>(mGitRepo);
+  auto ctx = makeCtx();
+
+  testing::internal::CaptureStdout();
+  EXPECT_NO_THROW(stage->run(&ctx));
+  std::string output = testing::internal::GetCapturedStdout();
+
+  auto result = mWorkspace->getDoneResult(1);
+  EXPECT_EQ(MutationState::SURVIVED, result.getMutationState());
+  EXPECT_TRUE(result.isNotInfected());
+  EXPECT_FALSE(result.isUncovered());
+  EXPECT_THAT(output, HasSubstr("[not infected]"));
+}
+
+TEST_F(EvaluationStageFlowTest, testFailFastBuildStopsAtErrorInMutatedFile) {
+  createDefaultMutant();
+  mConfig.failFastBuild = true;
+  mConfig.buildCmd = "echo 'src/bar.cpp:3:1: warning: unused'; echo '../repo/foo.cpp:1:24: error: bad'; sleep 30";
+
+  auto stage = std::make_shared<EvaluationStage>(mGitRepo);
+  auto ctx = makeCtx();
+
+  const auto start = std::chrono::steady_clock::now();
+  testing::internal::CaptureStdout();
+  EXPECT_NO_THROW(stage->run(&ctx));
+  testing::internal::GetCapturedStdout();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(20));
+
+  auto result = mWorkspace->getDoneResult(1);
+  EXPECT_EQ(MutationState::BUILD_FAILURE, result.getMutationState());
+  const std::string log = testutil::readFile(mWorkspace->getMutantBuildLog(1));
+  EXPECT_THAT(log, HasSubstr("foo.cpp:1:24: error: bad"));
+  EXPECT_THAT(log, HasSubstr("stopped the build at the first error in 'foo.cpp'"));
+}
+
+TEST_F(EvaluationStageFlowTest, testFailFastBuildIgnoresErrorsInOtherFiles) {
+  createDefaultMutant();
+  mConfig.failFastBuild = true;
+  mConfig.buildCmd = "echo 'bar.cpp:1:2: error: unrelated'";
+
+  auto stage = std::make_shared<EvaluationStage>(mGitRepo);
+  auto ctx = makeCtx();
+
+  testing::internal::CaptureStdout();
+  EXPECT_NO_THROW(stage->run(&ctx));
+  testing::internal::GetCapturedStdout();
+
+  auto result = mWorkspace->getDoneResult(1);
+  EXPECT_NE(MutationState::BUILD_FAILURE, result.getMutationState());
+  EXPECT_THAT(testutil::readFile(mWorkspace->getMutantBuildLog(1)), ::testing::Not(HasSubstr("fail-fast-build")));
+}
+
+TEST_F(EvaluationStageFlowTest, testTimeBudgetStopsBeforeMutantThatWouldNotFit) {
+  mWorkspace->createMutant(1, Mutant("AOR", "foo.cpp", "foo", 1, 24, 1, 25, "-"));
+  mWorkspace->createMutant(2, Mutant("AOR", "foo.cpp", "foo", 1, 24, 1, 25, "*"));
+  mWorkspace->createMutant(3, Mutant("AOR", "foo.cpp", "foo", 1, 24, 1, 25, "/"));
+  mConfig.buildCmd = "sleep 1; false";
+  mConfig.timeBudget = 1;
+  Logger::setLevel(Logger::Level::INFO);
+
+  auto stage = std::make_shared<EvaluationStage>(mGitRepo);
+  auto ctx = makeCtx();
+
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  EXPECT_NO_THROW(stage->run(&ctx));
+  testing::internal::GetCapturedStdout();
+  std::string output = testing::internal::GetCapturedStderr();
+
+  EXPECT_TRUE(mWorkspace->isDone(1));
+  EXPECT_FALSE(mWorkspace->isDone(2));
+  EXPECT_FALSE(mWorkspace->isDone(3));
+  EXPECT_FALSE(mWorkspace->isComplete());
+  EXPECT_THAT(output, HasSubstr("1 of 3 mutants evaluated"));
+
+  // The next run resumes with the remaining mutants.
+  mConfig.timeBudget.reset();
+  mConfig.buildCmd = "false";
+  auto resumed = std::make_shared<EvaluationStage>(mGitRepo);
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  EXPECT_NO_THROW(resumed->run(&ctx));
+  testing::internal::GetCapturedStderr();
+  testing::internal::GetCapturedStdout();
+  EXPECT_TRUE(mWorkspace->isDone(3));
+  EXPECT_TRUE(mWorkspace->isComplete());
+}
+
 TEST_F(EvaluationStageFlowTest, testCoveredMutantIsEvaluated) {
   createDefaultMutant();
   mConfig.lcovTracefiles = {writeCoverageFile(1)};
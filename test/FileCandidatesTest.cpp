@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include "sentinel/FileCandidates.hpp"
+
+namespace sentinel {
+
+TEST(FileCandidatesTest, testSerializeRoundTrips) {
+  FileCandidates candidates;
+  candidates.mutants.emplace_back("AOR", "src/calc.cpp", "calc::add", 3, 12, 3, 13, "-");
+  candidates.mutants.emplace_back("SDL", "src/calc.cpp", "calc::sub", 7, 3, 8, 4, "{}");
+  candidates.mutants.back().setOffsets(120, 141, "0123456789abcdef0123456789abcdef01234567");
+  candidates.depths = {{3, 4}, {7, 2}, {9, -1}};
+  candidates.includes = {"/work/src/calc.cpp", "/work/include/calc.hpp", "/usr/include/c++/11/vector"};
+
+  const FileCandidates read = FileCandidates::deserialize(candidates.serialize());
+  EXPECT_EQ(candidates.mutants, read.mutants);
+  ASSERT_TRUE(read.mutants[1].hasOffsets());
+  EXPECT_EQ(120u, read.mutants[1].getFirstOffset());
+  EXPECT_EQ(candidates.mutants[1].getFileHash(), read.mutants[1].getFileHash());
+  EXPECT_EQ(candidates.depths, read.depths);
+  EXPECT_EQ(candidates.includes, read.includes);
+}
+
+TEST(FileCandidatesTest, testSerializeEmptyCandidates) {
+  const FileCandidates read = FileCandidates::deserialize(FileCandidates().serialize());
+  EXPECT_TRUE(read.mutants.empty());
+  EXPECT_TRUE(read.depths.empty());
+  EXPECT_TRUE(read.includes.empty());
+}
+
+TEST(FileCandidatesTest, testDeserializeThrowsOnInvalidData) {
+  EXPECT_THROW(FileCandidates::deserialize(""), std::runtime_error);
+  EXPECT_THROW(FileCandidates::deserialize("out of memory"), std::runtime_error);
+  EXPECT_THROW(FileCandidates::deserialize("---\ndepths: {}\n---\n[1, 2]\n"), std::runtime_error);
+}
+
+}  // namespace sentinel
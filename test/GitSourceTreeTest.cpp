@@ -12,6 +12,7 @@
 #include "helper/SampleFileGeneratorForTest.hpp"
 #include "sentinel/GitSourceTree.hpp"
 #include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/util/io.hpp"
 
 namespace fs = std::filesystem;
 
@@ -158,6 +159,41 @@ TEST_F(GitSourceTreeTest, testModifyPreservesTrailingNewline) {
   EXPECT_EQ("int a = 2;\nint b = 2;\n", mutated);
 }
 
+TEST_F(GitSourceTreeTest, testModifySplicesTokenAtOffsets) {
+  fs::path src = mBaseDir / "offsets.cpp";
+  const std::string content = "int a = 1;\r\nint b = a + 2;";
+  testutil::writeFile(src, content);
+
+  // The line and column are ignored when the byte range is known.
+  Mutant m{"AOR", fs::path("offsets.cpp"), "", 9, 9, 9, 9, "-"};
+  m.setOffsets(22, 23, io::hashContent(content));
+  GitSourceTree tree(mBaseDir);
+  fs::path backupPath = mBaseDir / "BACKUP_DIR";
+  fs::create_directories(backupPath);
+  tree.modify(m, backupPath);
+
+  EXPECT_EQ("int a = 1;\r\nint b = a - 2;", testutil::readFile(src));
+  EXPECT_EQ(content, testutil::readFile(backupPath / "offsets.cpp"));
+}
+
+TEST_F(GitSourceTreeTest, testModifyRefusesFileChangedSinceGeneration) {
+  fs::path src = mBaseDir / "offsets.cpp";
+  testutil::writeFile(src, "int b = a + 2;\n");
+  Mutant m{"AOR", fs::path("offsets.cpp"), "", 1, 11, 1, 12, "-"};
+  m.setOffsets(10, 11, io::hashContent("int b = a + 2;\n"));
+  testutil::writeFile(src, "int b = a  + 2;\n");
+  GitSourceTree tree(mBaseDir);
+  fs::path backupPath = mBaseDir / "BACKUP_DIR";
+  fs::create_directories(backupPath);
+
+  EXPECT_THROW(tree.modify(m, backupPath), IOException);
+  EXPECT_EQ("int b = a  + 2;\n", testutil::readFile(src));
+
+  m.setOffsets(10, 99, io::hashContent("int b = a  + 2;\n"));
+  EXPECT_THROW(tree.modify(m, backupPath), IOException);
+  EXPECT_EQ("int b = a  + 2;\n", testutil::readFile(src));
+}
+
 TEST_F(GitSourceTreeTest, testBackupWorks) {
   // create a temporary copy of target file
   auto tempSubDirPath = mBaseDir / "SUB_DIR";
@@ -511,6 +511,55 @@ TEST_F(HtmlReportTest, testMutationsJsonContainsUncoveredField) {
   expectContains(content, "\"uncovered\":false");
 }
 
+TEST_F(HtmlReportTest, testMutationsJsonContainsCachedField) {
+  auto OUT_DIR = BASE / "OUT_DIR_MUT_CACHED_FIELD";
+  auto MRs = buildStandardMRs();
+  MRs[0].setCached(true);
+  HtmlReport htmlreport(MutationSummary(MRs, SOURCE_DIR), Config{});
+  htmlreport.save(OUT_DIR);
+
+  auto content = testutil::readFile(OUT_DIR / "index.html");
+  expectContains(content, "\"cached\":true");
+  expectContains(content, "\"cached\":false");
+  expectContains(content, "chip--cached");
+}
+
+TEST_F(HtmlReportTest, testSampledSummaryContainsScoreInterval) {
+  auto OUT_DIR = BASE / "OUT_DIR_SAMPLED";
+  MutationSummary summary(buildStandardMRs(), SOURCE_DIR);
+  summary.plannedMutantCount = 100;
+  HtmlReport htmlreport(summary, Config{});
+  htmlreport.save(OUT_DIR);
+
+  auto content = testutil::readFile(OUT_DIR / "index.html");
+  expectContains(content, "\"plannedMutants\":100");
+  expectContains(content, "\"scoreLow\":");
+  expectContains(content, "\"scoreHigh\":");
+  expectContains(content, "Estimated Mutation Score");
+}
+
+TEST_F(HtmlReportTest, testCompleteSummaryHasNoScoreInterval) {
+  auto OUT_DIR = BASE / "OUT_DIR_NOT_SAMPLED";
+  HtmlReport htmlreport(MutationSummary(buildStandardMRs(), SOURCE_DIR), Config{});
+  htmlreport.save(OUT_DIR);
+
+  auto content = testutil::readFile(OUT_DIR / "index.html");
+  EXPECT_EQ(std::string::npos, content.find("\"plannedMutants\""));
+}
+
+TEST_F(HtmlReportTest, testMutationsJsonContainsNotInfectedField) {
+  auto OUT_DIR = BASE / "OUT_DIR_MUT_NOT_INFECTED_FIELD";
+  auto MRs = buildStandardMRs();
+  MRs[0].setNotInfected(true);
+  HtmlReport htmlreport(MutationSummary(MRs, SOURCE_DIR), Config{});
+  htmlreport.save(OUT_DIR);
+
+  auto content = testutil::readFile(OUT_DIR / "index.html");
+  expectContains(content, "\"notInfected\":true");
+  expectContains(content, "\"notInfected\":false");
+  expectContains(content, "Not infected");
+}
+
 TEST_F(HtmlReportTest, testStatusChipsHelperEmittedInJs) {
   auto OUT_DIR = BASE / "OUT_DIR_STATUS_CHIPS";
   auto MRs = buildStandardMRs();
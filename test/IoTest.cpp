@@ -6,6 +6,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <filesystem>  // NOLINT
+#include <iterator>
 #include <string>
 #include "helper/FileTestHelper.hpp"
 #include "helper/TestTempDir.hpp"
@@ -236,4 +237,50 @@ TEST_F(IoTest, testAppendLogTailDoesNothingForNonexistentFile) {
   EXPECT_EQ(msg, "Error occurred");
 }
 
+TEST_F(IoTest, testMoveDirectoryReplacesDestination) {
+  auto from = mTestDir / "from";
+  auto to = mTestDir / "archive" / "to";
+  writeFile(from / "sub" / "a.xml", "<xml/>");
+  writeFile(to / "old.xml", "old");
+
+  io::moveDirectory(from, to);
+
+  EXPECT_FALSE(fs::exists(from));
+  EXPECT_FALSE(fs::exists(to / "old.xml"));
+  EXPECT_EQ("<xml/>", testutil::readFile(to / "sub" / "a.xml"));
+}
+
+TEST_F(IoTest, testMoveDirectoryThrowsWhenSourceIsMissing) {
+  EXPECT_THROW(io::moveDirectory(mTestDir / "missing", mTestDir / "to"), fs::filesystem_error);
+}
+
+TEST_F(IoTest, testHashContentMatchesGitObjectId) {
+  EXPECT_EQ("e69de29bb2d1d6434b8b29ae775ad8c2e48c5391", io::hashContent(""));
+  EXPECT_EQ("ce013625030ba8dba906f756967f9e9ca394464a", io::hashContent("hello\n"));
+}
+
+TEST_F(IoTest, testHashFileMatchesGitObjectId) {
+  writeFile(mTestDir / "hello.txt", "hello\n");
+
+  EXPECT_EQ("ce013625030ba8dba906f756967f9e9ca394464a", io::hashFile(mTestDir / "hello.txt"));
+  EXPECT_EQ("", io::hashFile(mTestDir / "missing.txt"));
+}
+
+TEST_F(IoTest, testWriteFileAtomicallyReplacesFileAndLeavesNoTemporary) {
+  const fs::path path = mTestDir / "a" / "b" / "entry";
+
+  io::writeFileAtomically(path, "first");
+  io::writeFileAtomically(path, "second");
+
+  EXPECT_EQ("second", testutil::readFile(path));
+  EXPECT_EQ(1, std::distance(fs::directory_iterator(path.parent_path()), fs::directory_iterator()));
+}
+
+TEST_F(IoTest, testWriteFileAtomicallyThrowsWhenTargetIsDirectory) {
+  fs::create_directories(mTestDir / "entry" / "child");
+
+  EXPECT_THROW(io::writeFileAtomically(mTestDir / "entry", "content"), fs::filesystem_error);
+  EXPECT_EQ(1, std::distance(fs::directory_iterator(mTestDir), fs::directory_iterator()));
+}
+
 }  // namespace sentinel
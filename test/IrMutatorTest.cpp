@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <llvm/AsmParser/Parser.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/raw_ostream.h>
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <string>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/IrMutator.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class IrMutatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_IRMUTATOR_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase);
+    llvm::SMDiagnostic error;
+    mModule = llvm::parseAssemblyString(kCalcModule, error, mContext);
+    ASSERT_NE(nullptr, mModule) << error.getMessage().str();
+  }
+
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+
+  std::string print() const {
+    std::string text;
+    llvm::raw_string_ostream out(text);
+    mModule->print(out, nullptr);
+    out.flush();
+    return text;
+  }
+
+  static Mutant mutant(const std::string& op, std::size_t line, std::size_t column, const std::string& original,
+                       const std::string& token, const fs::path& path = "src/calc.cpp") {
+    return Mutant(op, path, "", line, column, line, column + original.size(), token);
+  }
+
+  fs::path mBase;
+  llvm::LLVMContext mContext;
+  std::unique_ptr<llvm::Module> mModule;
+
+  // Line N of src/calc.cpp holds the operator of function N, at column 12.
+  static constexpr const char* kCalcModule = R"(
+target triple = "x86_64-pc-linux-gnu"
+
+define i32 @add(i32 %a, i32 %b) !dbg !10 {
+  %r = add nsw i32 %a, %b, !dbg !11
+  ret i32 %r, !dbg !11
+}
+
+define i1 @less(i32 %a, i32 %b) !dbg !20 {
+  %r = icmp slt i32 %a, %b, !dbg !21
+  ret i1 %r, !dbg !21
+}
+
+define i1 @equal(i32 %a, i32 %b) !dbg !30 {
+  %r = icmp eq i32 %a, %b, !dbg !31
+  ret i1 %r, !dbg !31
+}
+
+define i32 @divide(i32 %a, i32 %b) !dbg !40 {
+  %r = udiv i32 %a, %b, !dbg !41
+  ret i32 %r, !dbg !41
+}
+
+define i32 @shift(i32 %a, i32 %b) !dbg !50 {
+  %r = shl i32 %a, %b, !dbg !51
+  ret i32 %r, !dbg !51
+}
+
+define double @scale(double %a, double %b) !dbg !60 {
+  %r = fmul double %a, %b, !dbg !61
+  ret double %r, !dbg !61
+}
+
+define i1 @before(double %a, double %b) !dbg !70 {
+  %r = fcmp olt double %a, %b, !dbg !71
+  ret i1 %r, !dbg !71
+}
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+!0 = distinct !DICompileUnit(language: DW_LANG_C_plus_plus_14, file: !1, producer: "clang", isOptimized: false, runtimeVersion: 0, emissionKind: LineTablesOnly)
+!1 = !DIFile(filename: "src/calc.cpp", directory: "/work")
+!2 = !{i32 7, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = !DISubroutineType(types: !5)
+!5 = !{}
+!10 = distinct !DISubprogram(name: "add", scope: !1, file: !1, line: 1, type: !4, scopeLine: 1, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !5)
+!11 = !DILocation(line: 1, column: 12, scope: !10)
+!20 = distinct !DISubprogram(name: "less", scope: !1, file: !1, line: 2, type: !4, scopeLine: 2, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !5)
+!21 = !DILocation(line: 2, column: 12, scope: !20)
+!30 = distinct !DISubprogram(name: "equal", scope: !1, file: !1, line: 3, type: !4, scopeLine: 3, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !5)
+!31 = !DILocation(line: 3, column: 12, scope: !30)
+!40 = distinct !DISubprogram(name: "divide", scope: !1, file: !1, line: 4, type: !4, scopeLine: 4, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !5)
+!41 = !DILocation(line: 4, column: 12, scope: !40)
+!50 = distinct !DISubprogram(name: "shift", scope: !1, file: !1, line: 5, type: !4, scopeLine: 5, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !5)
+!51 = !DILocation(line: 5, column: 12, scope: !50)
+!60 = distinct !DISubprogram(name: "scale", scope: !1, file: !1, line: 6, type: !4, scopeLine: 6, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !5)
+!61 = !DILocation(line: 6, column: 12, scope: !60)
+!70 = distinct !DISubprogram(name: "before", scope: !1, file: !1, line: 7, type: !4, scopeLine: 7, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !5)
+!71 = !DILocation(line: 7, column: 12, scope: !70)
+)";
+};
+
+TEST_F(IrMutatorTest, testSupportsOperatorsWithInstructions) {
+  EXPECT_TRUE(IrMutator::isSupported("AOR"));
+  EXPECT_TRUE(IrMutator::isSupported("BOR"));
+  EXPECT_TRUE(IrMutator::isSupported("ROR"));
+  EXPECT_TRUE(IrMutator::isSupported("SOR"));
+  EXPECT_FALSE(IrMutator::isSupported("LCR"));
+  EXPECT_FALSE(IrMutator::isSupported("SDL"));
+  EXPECT_FALSE(IrMutator::isSupported("UOI"));
+}
+
+TEST_F(IrMutatorTest, testArithmeticOperatorKeepsSignedness) {
+  EXPECT_EQ(1U, IrMutator::apply(mModule.get(), mutant("AOR", 1, 12, "+", "-"), "+"));
+  EXPECT_NE(std::string::npos, print().find("sub nsw i32 %a, %b"));
+  EXPECT_EQ(std::string::npos, print().find("add nsw"));
+}
+
+TEST_F(IrMutatorTest, testSignedAdditionBecomesSignedDivision) {
+  EXPECT_EQ(1U, IrMutator::apply(mModule.get(), mutant("AOR", 1, 12, "+", "/"), "+"));
+  EXPECT_NE(std::string::npos, print().find("sdiv i32 %a, %b"));
+}
+
+TEST_F(IrMutatorTest, testUnsignedDivisionBecomesUnsignedRemainder) {
+  EXPECT_EQ(1U, IrMutator::apply(mModule.get(), mutant("AOR", 4, 12, "/", "%"), "/"));
+  EXPECT_NE(std::string::npos, print().find("urem i32 %a, %b"));
+}
+
+TEST_F(IrMutatorTest, testRelationalOperatorTakesSignednessFromPredicate) {
+  EXPECT_EQ(1U, IrMutator::apply(mModule.get(), mutant("ROR", 2, 12, "<", ">="), "<"));
+  EXPECT_NE(std::string::npos, print().find("icmp sge i32 %a, %b"));
+}
+
+TEST_F(IrMutatorTest, testFloatingPointOperators) {
+  EXPECT_EQ(1U, IrMutator::apply(mModule.get(), mutant("AOR", 6, 12, "*", "+"), "*"));
+  EXPECT_EQ(1U, IrMutator::apply(mModule.get(), mutant("ROR", 7, 12, "<", "!="), "<"));
+  EXPECT_NE(std::string::npos, print().find("fadd double %a, %b"));
+  EXPECT_NE(std::string::npos, print().find("fcmp une double %a, %b"));
+}
+
+TEST_F(IrMutatorTest, testUnknownSignednessIsNotApplied) {
+  EXPECT_EQ(0U, IrMutator::apply(mModule.get(), mutant("ROR", 3, 12, "==", "<"), "=="));
+  EXPECT_EQ(0U, IrMutator::apply(mModule.get(), mutant("SOR", 5, 12, "<<", ">>"), "<<"));
+  EXPECT_EQ(1U, IrMutator::apply(mModule.get(), mutant("ROR", 3, 12, "==", "!="), "=="));
+  EXPECT_NE(std::string::npos, print().find("icmp ne i32 %a, %b"));
+  EXPECT_NE(std::string::npos, print().find("shl i32 %a, %b"));
+}
+
+TEST_F(IrMutatorTest, testMismatchedMutantIsNotApplied) {
+  const std::string before = print();
+  EXPECT_EQ(0U, IrMutator::apply(mModule.get(), mutant("AOR", 1, 13, "+", "-"), "+"));
+  EXPECT_EQ(0U, IrMutator::apply(mModule.get(), mutant("AOR", 1, 12, "-", "+"), "-"));
+  EXPECT_EQ(0U, IrMutator::apply(mModule.get(), mutant("AOR", 1, 12, "+", "-", "lib/calc.cpp"), "+"));
+  EXPECT_EQ(0U, IrMutator::apply(mModule.get(), mutant("LCR", 1, 12, "+", "-"), "+"));
+  EXPECT_EQ(before, print());
+  EXPECT_EQ(1U, IrMutator::apply(mModule.get(), mutant("AOR", 1, 12, "+", "-", "calc.cpp"), "+"));
+}
+
+TEST_F(IrMutatorTest, testWriteObjectGeneratesObjectOfMutatedModule) {
+  BitcodeUnit unit;
+  llvm::raw_string_ostream out(unit.bitcode);
+  llvm::WriteBitcodeToFile(*mModule, out);
+  out.flush();
+  unit.object = mBase / "calc.o";
+  unit.optLevel = 2;
+
+  const fs::path object = mBase / "mutant.o";
+  EXPECT_FALSE(IrMutator::writeObject(unit, mutant("AOR", 1, 13, "+", "-"), "+", object));
+  EXPECT_FALSE(fs::exists(object));
+  ASSERT_TRUE(IrMutator::writeObject(unit, mutant("AOR", 1, 12, "+", "-"), "+", object));
+  EXPECT_EQ("\x7f" "ELF", testutil::readFile(object).substr(0, 4));
+}
+
+TEST_F(IrMutatorTest, testWriteObjectThrowsOnInvalidBitcode) {
+  BitcodeUnit unit;
+  unit.bitcode = "not bitcode";
+  unit.object = mBase / "calc.o";
+
+  EXPECT_THROW(IrMutator::writeObject(unit, mutant("AOR", 1, 12, "+", "-"), "+", mBase / "mutant.o"), IOException);
+}
+
+}  // namespace sentinel
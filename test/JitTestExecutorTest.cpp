@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <string>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/JitTestExecutor.hpp"
+#include "sentinel/Subprocess.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class JitTestExecutorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_JITTESTEXECUTOR_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase);
+    mProgram = mBase / "unittest.ll";
+    testutil::writeFile(mProgram, kProgram);
+  }
+
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+
+  static Mutant mutant(const std::string& token, std::size_t column = 12) {
+    return Mutant("AOR", "src/calc.cpp", "", 1, column, 1, column + 1, token);
+  }
+
+  fs::path mBase;
+  fs::path mProgram;
+
+  // main() returns 0 if add(2, 3) is 5 and add(7, 0) is 7; the addition is at line 1, column 12 of src/calc.cpp.
+  static constexpr const char* kProgram = R"(
+define i32 @add(i32 %a, i32 %b) !dbg !10 {
+  %r = add nsw i32 %a, %b, !dbg !11
+  ret i32 %r, !dbg !11
+}
+
+define i32 @main(i32 %argc, i8** %argv) {
+  %r = call i32 @add(i32 2, i32 3)
+  %s = call i32 @add(i32 7, i32 0)
+  %ok1 = icmp eq i32 %r, 5
+  %ok2 = icmp eq i32 %s, 7
+  %ok = and i1 %ok1, %ok2
+  %code = select i1 %ok, i32 0, i32 1
+  ret i32 %code
+}
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+!0 = distinct !DICompileUnit(language: DW_LANG_C_plus_plus_14, file: !1, producer: "clang", isOptimized: false, runtimeVersion: 0, emissionKind: LineTablesOnly)
+!1 = !DIFile(filename: "src/calc.cpp", directory: "/work")
+!2 = !{i32 7, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = !DISubroutineType(types: !5)
+!5 = !{}
+!10 = distinct !DISubprogram(name: "add", scope: !1, file: !1, line: 1, type: !4, scopeLine: 1, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !5)
+!11 = !DILocation(line: 1, column: 12, scope: !10)
+)";
+};
+
+TEST_F(JitTestExecutorTest, testRunsOriginalProgram) {
+  JitTestExecutor jit(mProgram);
+  EXPECT_EQ(0, jit.run(nullptr, ""));
+}
+
+TEST_F(JitTestExecutorTest, testRunsProgramWithMutant) {
+  JitTestExecutor jit(mProgram);
+  const Mutant m = mutant("-");
+  EXPECT_EQ(1, jit.run(&m, "+"));
+}
+
+TEST_F(JitTestExecutorTest, testCanApplyOnlyMatchingMutants) {
+  JitTestExecutor jit(mProgram);
+  EXPECT_TRUE(jit.canApply(mutant("-"), "+"));
+  EXPECT_FALSE(jit.canApply(mutant("-", 13), "+"));
+  EXPECT_FALSE(jit.canApply(mutant("+"), "-"));
+  const Mutant mismatched = mutant("-", 13);
+  EXPECT_THROW(jit.run(&mismatched, "+"), IOException);
+}
+
+TEST_F(JitTestExecutorTest, testCrashOfMutantIsIsolatedInChild) {
+  JitTestExecutor jit(mProgram);
+  const Mutant m = mutant("/");
+  Subprocess proc([&jit, &m] { return jit.run(&m, "+"); }, 0, "", true);
+  proc.execute();
+  EXPECT_TRUE(proc.isSignaled());
+  // The program of the parent is left for the next mutant.
+  EXPECT_TRUE(jit.canApply(mutant("-"), "+"));
+}
+
+TEST_F(JitTestExecutorTest, testPassesArgumentsToMain) {
+  testutil::writeFile(mBase / "argc.ll", "define i32 @main(i32 %argc, i8** %argv) {\n  ret i32 %argc\n}\n");
+  JitTestExecutor jit(mBase / "argc.ll");
+  EXPECT_EQ(3, jit.run(nullptr, "", {"--gtest_output=xml:results/", "--gtest_filter=A.*"}));
+}
+
+TEST_F(JitTestExecutorTest, testThrowsOnInvalidProgram) {
+  testutil::writeFile(mBase / "invalid.ll", "not IR");
+  EXPECT_THROW(JitTestExecutor jit(mBase / "invalid.ll"), IOException);
+  testutil::writeFile(mBase / "library.ll", "define i32 @f() {\n  ret i32 0\n}\n");
+  EXPECT_THROW(JitTestExecutor jit(mBase / "library.ll"), IOException);
+  EXPECT_THROW(JitTestExecutor jit(mBase / "missing.bc"), IOException);
+}
+
+}  // namespace sentinel
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <filesystem>  // NOLINT
+#include <memory>
+#include <string>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/Jobserver.hpp"
+#include "sentinel/Subprocess.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class JobserverTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_JOBSERVER_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase);
+    mDir = mBase / "jobserver";
+  }
+
+  void TearDown() override {
+    Subprocess::setJobserver(nullptr);
+    fs::remove_all(mBase);
+  }
+
+  /**
+   * @brief Return the number of tokens left in the pool without taking any of them.
+   */
+  std::size_t countTokens(const Jobserver& jobserver) const {
+    const int fd = ::open(jobserver.getFifo().c_str(), O_RDWR | O_NONBLOCK);
+    EXPECT_GE(fd, 0);
+    char buf[256];
+    const ssize_t nb = ::read(fd, buf, sizeof(buf));
+    const std::size_t count = nb > 0 ? static_cast<std::size_t>(nb) : 0;
+    // Written back directly: release() accounts for the tokens the jobserver handed out.
+    EXPECT_EQ(nb > 0 ? nb : 0, ::write(fd, buf, count));
+    ::close(fd);
+    return count;
+  }
+
+  fs::path mBase;
+  fs::path mDir;
+};
+
+TEST_F(JobserverTest, testNewPoolHoldsAllTokens) {
+  Jobserver jobserver(mDir, 3);
+
+  EXPECT_EQ(3U, jobserver.getJobs());
+  EXPECT_EQ(mDir / "fifo", jobserver.getFifo());
+  EXPECT_EQ(3U, countTokens(jobserver));
+  EXPECT_EQ(0700U, static_cast<unsigned>(fs::status(mDir).permissions() & fs::perms::all));
+}
+
+TEST_F(JobserverTest, testAcquireAndRelease) {
+  Jobserver jobserver(mDir, 2);
+
+  const char first = jobserver.acquire();
+  const char second = jobserver.acquire();
+  EXPECT_EQ('+', first);
+  EXPECT_EQ(0U, countTokens(jobserver));
+
+  jobserver.release(first);
+  jobserver.release(second);
+  EXPECT_EQ(2U, countTokens(jobserver));
+}
+
+TEST_F(JobserverTest, testReleaseAllReturnsTokensTakenOnce) {
+  Jobserver jobserver(mDir, 3);
+
+  const char token = jobserver.acquire();
+  char held = 0;
+  ASSERT_TRUE(jobserver.tryAcquire(&held));
+  EXPECT_EQ(1U, countTokens(jobserver));
+
+  jobserver.releaseAll();
+  EXPECT_EQ(3U, countTokens(jobserver));
+  // The owners of the tokens giving them back later must not grow the pool.
+  jobserver.release(token);
+  jobserver.release(held);
+  EXPECT_EQ(3U, countTokens(jobserver));
+}
+
+TEST_F(JobserverTest, testSecondUserJoinsPoolInUse) {
+  Jobserver first(mDir, 2);
+  const char token = first.acquire();
+
+  Jobserver second(mDir, 8);
+  EXPECT_EQ(2U, second.getJobs());
+  EXPECT_EQ(1U, countTokens(second));
+  first.release(token);
+  EXPECT_EQ(2U, countTokens(second));
+}
+
+TEST_F(JobserverTest, testPoolIsRecreatedAfterLastUser) {
+  {
+    Jobserver first(mDir, 2);
+    first.acquire();  // lost with the pool
+  }
+  Jobserver next(mDir, 4);
+  EXPECT_EQ(4U, next.getJobs());
+  EXPECT_EQ(4U, countTokens(next));
+}
+
+TEST_F(JobserverTest, testMakeflagsNameFifo) {
+  Jobserver jobserver(mDir, 5);
+  EXPECT_EQ("-j5 --jobserver-auth=fifo:" + (mDir / "fifo").string(), jobserver.getMakeflags());
+}
+
+TEST_F(JobserverTest, testSubprocessRunsOnTokenAndExportsMakeflags) {
+  Jobserver jobserver(mDir, 2);
+  Subprocess::setJobserver(&jobserver);
+  const fs::path seen = mBase / "seen";
+  const fs::path fifo = jobserver.getFifo();
+
+  // The command sees MAKEFLAGS and one token fewer in the pool.
+  Subprocess sp("echo \"$MAKEFLAGS\" > " + seen.string() + "; dd if=" + fifo.string() +
+                " iflag=nonblock bs=16 count=1 2>/dev/null | wc -c >> " + seen.string(),
+                0, "", true);
+  sp.execute();
+
+  EXPECT_TRUE(sp.isSuccessfulExit());
+  const std::string content = testutil::readFile(seen);
+  EXPECT_NE(std::string::npos, content.find("--jobserver-auth=fifo:" + fifo.string()));
+  EXPECT_NE(std::string::npos, content.find("\n1\n"));
+  // The command took the remaining token and did not give it back; the command's own was returned.
+  EXPECT_EQ(1U, countTokens(jobserver));
+}
+
+}  // namespace sentinel
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include "helper/TestTempDir.hpp"
+#include "sentinel/Mutant.hpp"
+#include "sentinel/MutantPlan.hpp"
+#include "sentinel/version.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class MutantPlanTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    BASE = testTempDir("SENTINEL_MUTANTPLAN_TEST");
+    fs::remove_all(BASE);
+    SRC_DIR = BASE / "src";
+    fs::create_directories(SRC_DIR / "sub");
+    writeFile(SRC_DIR / "a.cpp", "int a() { return 1 + 2; }\n");
+    writeFile(SRC_DIR / "sub" / "b.cpp", "int b() { return 3 - 4; }\n");
+  }
+
+  void TearDown() override {
+    fs::remove_all(BASE);
+  }
+
+  static void writeFile(const fs::path& path, const std::string& contents) {
+    std::ofstream(path) << contents;
+  }
+
+  MutantPlan makePlan() const {
+    MutantPlan plan;
+    plan.programVersion = PROGRAM_VERSION;
+    plan.seed = 42;
+    plan.candidateCount = 7;
+    plan.generator = Generator::WEIGHTED;
+    plan.mutantsPerLine = 2;
+    plan.from = "HEAD~1";
+    plan.limit = 10;
+    plan.mutants.push_back(Mutant("AOR", "a.cpp", "a", 1, 19, 1, 24, "1 - 2"));
+    plan.mutants.push_back(Mutant("AOR", "sub/b.cpp", "b", 1, 19, 1, 24, "3 + 4"));
+    plan.mutants.push_back(Mutant("ROR", "a.cpp", "a", 1, 19, 1, 20, "0"));
+    plan.files["a.cpp"].lines = 1;
+    plan.files["sub/b.cpp"].lines = 1;
+    return plan;
+  }
+
+  fs::path BASE;
+  fs::path SRC_DIR;
+};
+
+TEST_F(MutantPlanTest, testSaveAndLoadRoundTrip) {
+  MutantPlan plan = makePlan();
+  plan.hashSources(SRC_DIR);
+  plan.save(BASE / "plan.yaml");
+
+  const MutantPlan loaded = MutantPlan::load(BASE / "plan.yaml");
+  EXPECT_EQ(42u, loaded.seed);
+  EXPECT_EQ(7u, loaded.candidateCount);
+  EXPECT_EQ(Generator::WEIGHTED, loaded.generator);
+  EXPECT_EQ(2u, loaded.mutantsPerLine);
+  EXPECT_EQ(std::optional<std::string>("HEAD~1"), loaded.from);
+  EXPECT_FALSE(loaded.uncommitted);
+  EXPECT_EQ(10u, loaded.limit);
+  ASSERT_EQ(3u, loaded.mutants.size());
+  for (std::size_t i = 0; i < plan.mutants.size(); i++) {
+    EXPECT_EQ(plan.mutants[i], loaded.mutants[i]);
+  }
+  ASSERT_EQ(2u, loaded.files.size());
+  EXPECT_EQ(plan.files.at("a.cpp").hash, loaded.files.at("a.cpp").hash);
+  EXPECT_EQ(1u, loaded.files.at("sub/b.cpp").lines);
+}
+
+TEST_F(MutantPlanTest, testHashSourcesRecordsEveryMutatedFile) {
+  MutantPlan plan = makePlan();
+  plan.files.clear();
+  plan.hashSources(SRC_DIR);
+  ASSERT_EQ(2u, plan.files.size());
+  EXPECT_EQ(40u, plan.files.at("a.cpp").hash.size());
+  EXPECT_NE(plan.files.at("a.cpp").hash, plan.files.at("sub/b.cpp").hash);
+
+  fs::remove(SRC_DIR / "a.cpp");
+  EXPECT_THROW(plan.hashSources(SRC_DIR), std::runtime_error);
+}
+
+TEST_F(MutantPlanTest, testVerifyDetectsChangedAndMissingFiles) {
+  MutantPlan plan = makePlan();
+  plan.hashSources(SRC_DIR);
+  EXPECT_NO_THROW(plan.verify(SRC_DIR));
+
+  writeFile(SRC_DIR / "sub" / "b.cpp", "int b() { return 3 * 4; }\n");
+  try {
+    plan.verify(SRC_DIR);
+    FAIL() << "verify() accepted a changed file";
+  } catch (const std::runtime_error& e) {
+    EXPECT_NE(std::string::npos, std::string(e.what()).find("sub/b.cpp"));
+    EXPECT_EQ(std::string::npos, std::string(e.what()).find("a.cpp,"));
+  }
+
+  fs::remove(SRC_DIR / "a.cpp");
+  EXPECT_THROW(plan.verify(SRC_DIR), std::runtime_error);
+}
+
+TEST_F(MutantPlanTest, testGetLinesByPathUsesCanonicalPaths) {
+  const MutantPlan plan = makePlan();
+  const auto lines = plan.getLinesByPath(SRC_DIR);
+  const fs::path root = fs::canonical(SRC_DIR);
+  EXPECT_EQ((std::map<fs::path, std::size_t>{{root / "a.cpp", 1}, {root / "sub/b.cpp", 1}}), lines);
+}
+
+TEST_F(MutantPlanTest, testLoadRejectsOtherVersions) {
+  MutantPlan plan = makePlan();
+  plan.hashSources(SRC_DIR);
+  plan.programVersion = "0.0.0-other";
+  plan.save(BASE / "other.yaml");
+  EXPECT_THROW(MutantPlan::load(BASE / "other.yaml"), std::runtime_error);
+
+  writeFile(BASE / "format.yaml", "plan-version: 999\nversion: " + std::string(PROGRAM_VERSION) + "\n");
+  EXPECT_THROW(MutantPlan::load(BASE / "format.yaml"), std::runtime_error);
+
+  writeFile(BASE / "broken.yaml", "plan-version: [\n");
+  EXPECT_THROW(MutantPlan::load(BASE / "broken.yaml"), std::runtime_error);
+
+  EXPECT_THROW(MutantPlan::load(BASE / "missing.yaml"), std::runtime_error);
+}
+
+}  // namespace sentinel
@@ -260,6 +260,32 @@ TEST_F(MutantsTest, testStreamOperatorYamlRoundTripEmptyToken) {
   EXPECT_TRUE(equal(original, loaded));
 }
 
+TEST_F(MutantsTest, testStreamOperatorYamlRoundTripOffsets) {
+  Mutant original("AOR", NORMAL_FILENAME, "foo", 2, 3, 2, 4, "-");
+  original.setOffsets(14, 15, "0123abcd");
+  std::ostringstream out;
+  out << original;
+  std::istringstream in(out.str());
+  Mutant loaded;
+  in >> loaded;
+  EXPECT_TRUE(equal(original, loaded));
+  ASSERT_TRUE(loaded.hasOffsets());
+  EXPECT_EQ(14U, loaded.getFirstOffset());
+  EXPECT_EQ(15U, loaded.getLastOffset());
+  EXPECT_EQ("0123abcd", loaded.getFileHash());
+}
+
+TEST_F(MutantsTest, testMutantWithoutOffsets) {
+  Mutant original("AOR", NORMAL_FILENAME, "foo", 2, 3, 2, 4, "-");
+  std::ostringstream out;
+  out << original;
+  EXPECT_EQ(std::string::npos, out.str().find("offsets"));
+  std::istringstream in(out.str());
+  Mutant loaded;
+  in >> loaded;
+  EXPECT_FALSE(loaded.hasOffsets());
+}
+
 TEST_F(MutantsTest, testStreamOperatorEmptyInputSetsFail) {
   std::istringstream in("");
   Mutant m;
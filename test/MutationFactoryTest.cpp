@@ -8,11 +8,13 @@
 #include <filesystem>  // NOLINT
 #include <memory>
 #include <string>
+#include "helper/FileTestHelper.hpp"
 #include "helper/SampleFileGeneratorForTest.hpp"
 #include "helper/ThrowMessageMatcher.hpp"
 #include "sentinel/MutationFactory.hpp"
 #include "sentinel/UniformMutantGenerator.hpp"
 #include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/util/io.hpp"
 
 namespace sentinel {
 
@@ -36,8 +38,20 @@ TEST_F(MutationFactoryTest, testGenerateWorks) {
   EXPECT_EQ(selected.size(), 2);
   EXPECT_EQ(selected.at(0).getFirst().line, 58);
   EXPECT_EQ(selected.at(1).getFirst().line, 59);
+  const std::string content = testutil::readFile(SAMPLE1_PATH);
   for (const auto& m : selected) {
     EXPECT_TRUE(m.getPath().is_relative());
+    // The byte range is the (line, column) range of the mutant in the file it was generated from.
+    ASSERT_TRUE(m.hasOffsets());
+    EXPECT_EQ(io::hashContent(content), m.getFileHash());
+    std::size_t lineStart = 0;
+    for (std::size_t line = 1; line < m.getFirst().line; line++) {
+      lineStart = content.find('\n', lineStart) + 1;
+    }
+    EXPECT_EQ(lineStart + m.getFirst().column - 1, m.getFirstOffset());
+    if (m.getFirst().line == m.getLast().line) {
+      EXPECT_EQ(m.getLastOffset() - m.getFirstOffset(), m.getLast().column - m.getFirst().column);
+    }
   }
 }
 
@@ -377,4 +377,36 @@ TEST_F(MutationResultsTest, uncoveredFlagAbsentInLegacyFormatReadsAsFalse) {
   EXPECT_FALSE(result.isUncovered());
 }
 
+TEST_F(MutationResultsTest, testCachedFlagRoundTrip) {
+  Mutant m("AOR", TARGET_FILE, "f", 1, 1, 1, 2, "+");
+  MutationResult original(m, "t1", "", MutationState::KILLED);
+  EXPECT_FALSE(original.isCached());
+  original.setCached(true);
+
+  std::ostringstream out;
+  out << original;
+  std::istringstream in(out.str());
+  MutationResult restored;
+  in >> restored;
+
+  EXPECT_TRUE(restored.isCached());
+  EXPECT_TRUE(restored.compare(original));
+}
+
+TEST_F(MutationResultsTest, testNotInfectedFlagRoundTrip) {
+  Mutant m("AOR", TARGET_FILE, "f", 1, 1, 1, 2, "+");
+  MutationResult original(m, "", "", MutationState::SURVIVED);
+  EXPECT_FALSE(original.isNotInfected());
+  original.setNotInfected(true);
+
+  std::ostringstream out;
+  out << original;
+  std::istringstream in(out.str());
+  MutationResult restored;
+  in >> restored;
+
+  EXPECT_TRUE(restored.isNotInfected());
+  EXPECT_TRUE(restored.compare(original));
+}
+
 }  // namespace sentinel
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <filesystem>  // NOLINT
+#include <string>
+#include "helper/TestTempDir.hpp"
+#include "sentinel/WorkerProtocol.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+#include "sentinel/util/net.hpp"
+
+namespace fs = std::filesystem;
+
+namespace sentinel {
+
+TEST(NetTest, testFrameRoundTripOverSocketPair) {
+  int fds[2];
+  ASSERT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+  EXPECT_TRUE(net::sendFrame(fds[0], "hello"));
+  EXPECT_TRUE(net::sendFrame(fds[0], ""));
+  EXPECT_EQ(std::optional<std::string>("hello"), net::receiveFrame(fds[1]));
+  EXPECT_EQ(std::optional<std::string>(""), net::receiveFrame(fds[1]));
+  ::close(fds[0]);
+  EXPECT_FALSE(net::receiveFrame(fds[1]).has_value());
+  ::close(fds[1]);
+}
+
+TEST(NetTest, testSendFrameFailsWhenPeerStopsReading) {
+  int fds[2];
+  ASSERT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+  net::setSendTimeout(fds[0], std::chrono::milliseconds(100));
+
+  // The peer never reads, so the socket buffer fills and the send times out.
+  EXPECT_FALSE(net::sendFrame(fds[0], std::string(16U * 1024U * 1024U, 'x')));
+
+  ::close(fds[0]);
+  ::close(fds[1]);
+}
+
+TEST(NetTest, testFrameReaderWaitsForCompleteFrames) {
+  const std::string frame = std::string("\0\0\0\3abc", 7) + std::string("\0\0\0\1x", 5);
+  net::FrameReader reader;
+  reader.append(frame.data(), 5);
+  EXPECT_FALSE(reader.next().has_value());
+  reader.append(frame.data() + 5, frame.size() - 5);
+  EXPECT_EQ(std::optional<std::string>("abc"), reader.next());
+  EXPECT_EQ(std::optional<std::string>("x"), reader.next());
+  EXPECT_FALSE(reader.next().has_value());
+  EXPECT_FALSE(reader.isMalformed());
+}
+
+TEST(NetTest, testFrameReaderRejectsOversizedFrame) {
+  const std::string prefix("\xff\xff\xff\xff", 4);
+  net::FrameReader reader;
+  reader.append(prefix.data(), prefix.size());
+  EXPECT_FALSE(reader.next().has_value());
+  EXPECT_TRUE(reader.isMalformed());
+}
+
+TEST(NetTest, testTcpListenOnFreePortAndConnect) {
+  const int listenFd = net::listen("127.0.0.1:0");
+  const std::string address = net::getLocalAddress(listenFd);
+  EXPECT_EQ(0U, address.rfind("127.0.0.1:", 0));
+  EXPECT_NE("127.0.0.1:0", address);
+
+  const int client = net::connect(address);
+  const int server = ::accept(listenFd, nullptr, nullptr);
+  ASSERT_GE(server, 0);
+  EXPECT_TRUE(net::sendFrame(client, protocol::encode(protocol::kReady)));
+  auto frame = net::receiveFrame(server);
+  ASSERT_TRUE(frame.has_value());
+  EXPECT_EQ(protocol::kReady, protocol::decode(*frame).type);
+  ::close(client);
+  ::close(server);
+  ::close(listenFd);
+}
+
+TEST(NetTest, testUnixListenReplacesStaleSocketFile) {
+  const fs::path base = testTempDir("SENTINEL_NET_TEST");
+  fs::remove_all(base);
+  fs::create_directories(base);
+  const std::string address = "unix:" + (base / "sock").string();
+
+  ::close(net::listen(address));
+  ASSERT_TRUE(fs::exists(base / "sock"));
+  EXPECT_EQ(fs::perms::owner_read | fs::perms::owner_write, fs::status(base / "sock").permissions());
+  const int listenFd = net::listen(address);
+  EXPECT_EQ(address, net::getLocalAddress(listenFd));
+  const int client = net::connect(address);
+  EXPECT_GE(client, 0);
+  ::close(client);
+  ::close(listenFd);
+  fs::remove_all(base);
+}
+
+TEST(NetTest, testEmptyHostListensOnLoopbackOnly) {
+  const int listenFd = net::listen(":0");
+  const std::string address = net::getLocalAddress(listenFd);
+  EXPECT_TRUE(address.rfind("127.0.0.1:", 0) == 0 || address.rfind("[::1]:", 0) == 0) << address;
+  ::close(listenFd);
+}
+
+TEST(NetTest, testInvalidAddressThrows) {
+  EXPECT_THROW(net::listen("no-port"), IOException);
+  EXPECT_THROW(net::connect("127.0.0.1:notaport"), IOException);
+}
+
+TEST(NetTest, testProtocolMessageRoundTrip) {
+  const protocol::Message msg = protocol::decode(protocol::encode(protocol::kMutant, "7\nbody\nlines"));
+  EXPECT_EQ(protocol::kMutant, msg.type);
+  EXPECT_EQ("7\nbody\nlines", msg.body);
+  EXPECT_EQ(protocol::kDone, protocol::decode(protocol::encode(protocol::kDone)).type);
+}
+
+TEST(NetTest, testMatchesTokenOnlyWhenEqual) {
+  EXPECT_TRUE(protocol::matchesToken("secret", "secret"));
+  EXPECT_FALSE(protocol::matchesToken("secret", "secreT"));
+  EXPECT_FALSE(protocol::matchesToken("secret", "secretsecret"));
+  EXPECT_FALSE(protocol::matchesToken("secret", ""));
+  EXPECT_FALSE(protocol::matchesToken("", ""));
+}
+
+}  // namespace sentinel
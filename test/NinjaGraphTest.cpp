@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include "helper/TestTempDir.hpp"
+#include "sentinel/NinjaGraph.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+using Targets = std::vector<std::string>;
+
+class NinjaGraphTest : public ::testing::Test {
+ protected:
+  // libfoo/x.cpp -> x.o -> libfoo.a -> {app, foo_test}; libfoo.a is also behind the phony 'all' and 'foo'.
+  NinjaGraph makeGraph() {
+    mQueries.clear();
+    return NinjaGraph("/build", [this](const std::string& target) -> std::optional<std::string> {
+      mQueries.push_back(target);
+      auto it = kOutputs.find(target);
+      if (it == kOutputs.end()) {
+        return std::nullopt;
+      }
+      return it->second;
+    });
+  }
+
+  const std::map<std::string, std::string> kOutputs = {
+      {"/src/libfoo/x.cpp", "/src/libfoo/x.cpp:\n  outputs:\n    CMakeFiles/foo.dir/x.cpp.o\n"},
+      {"../src/util/y.cpp", "../src/util/y.cpp:\n  outputs:\n    CMakeFiles/util.dir/y.cpp.o\n"},
+      {"CMakeFiles/foo.dir/x.cpp.o",
+       "CMakeFiles/foo.dir/x.cpp.o:\n"
+       "  input: CXX_COMPILER__foo_Debug\n"
+       "    /src/libfoo/x.cpp\n"
+       "    || cmake_object_order_depends_target_foo\n"
+       "  outputs:\n"
+       "    libfoo.a\n"},
+      {"CMakeFiles/util.dir/y.cpp.o",
+       "CMakeFiles/util.dir/y.cpp.o:\n  input: CXX_COMPILER__util_Debug\n    ../src/util/y.cpp\n  outputs:\n"
+       "    util_test\n"},
+      {"libfoo.a",
+       "libfoo.a:\n"
+       "  input: CXX_STATIC_LIBRARY_LINKER__foo_Debug\n"
+       "    CMakeFiles/foo.dir/x.cpp.o\n"
+       "  outputs:\n"
+       "    all\n"
+       "    app\n"
+       "    foo\n"
+       "    foo_test\n"},
+      {"app", "app:\n  input: CXX_EXECUTABLE_LINKER__app_Debug\n    libfoo.a\n  outputs:\n    all\n"},
+      {"foo_test", "foo_test:\n  input: CXX_EXECUTABLE_LINKER__foo_test_Debug\n    libfoo.a\n  outputs:\n    all\n"},
+      {"util_test", "util_test:\n  input: CXX_EXECUTABLE_LINKER__util_test_Debug\n  outputs:\n"},
+      {"all", "all:\n  input: phony\n    app\n    foo_test\n  outputs:\n"},
+      {"foo", "foo:\n  input: phony\n    libfoo.a\n  outputs:\n"},
+  };
+  std::vector<std::string> mQueries;
+};
+
+TEST_F(NinjaGraphTest, testParseQuery) {
+  const auto node = NinjaGraph::parseQuery(kOutputs.at("libfoo.a"));
+  EXPECT_EQ("CXX_STATIC_LIBRARY_LINKER__foo_Debug", node.rule);
+  EXPECT_EQ((Targets{"all", "app", "foo", "foo_test"}), node.outputs);
+
+  const auto source = NinjaGraph::parseQuery(kOutputs.at("/src/libfoo/x.cpp"));
+  EXPECT_TRUE(source.rule.empty());
+  EXPECT_EQ((Targets{"CMakeFiles/foo.dir/x.cpp.o"}), source.outputs);
+
+  const auto validations = NinjaGraph::parseQuery("a:\n  input: cc\n    a.c\n  validations:\n    check\n");
+  EXPECT_TRUE(validations.outputs.empty());
+}
+
+TEST_F(NinjaGraphTest, testAffectedTargetsSkipPhonyNodes) {
+  NinjaGraph graph = makeGraph();
+  EXPECT_EQ((Targets{"app", "foo_test"}), graph.getAffectedTargets("/src/libfoo/x.cpp"));
+}
+
+TEST_F(NinjaGraphTest, testAffectedTargetsFallBackToPathRelativeToBuildDir) {
+  NinjaGraph graph = makeGraph();
+  EXPECT_EQ((Targets{"util_test"}), graph.getAffectedTargets("/src/util/y.cpp"));
+}
+
+TEST_F(NinjaGraphTest, testUnknownSourceHasNoTargets) {
+  NinjaGraph graph = makeGraph();
+  EXPECT_TRUE(graph.getAffectedTargets("/src/include/z.hpp").empty());
+}
+
+TEST_F(NinjaGraphTest, testQueriesAreCached) {
+  NinjaGraph graph = makeGraph();
+  graph.getAffectedTargets("/src/libfoo/x.cpp");
+  const std::size_t first = mQueries.size();
+  EXPECT_EQ((Targets{"app", "foo_test"}), graph.getAffectedTargets("/src/libfoo/x.cpp"));
+  EXPECT_EQ(first, mQueries.size());
+}
+
+TEST_F(NinjaGraphTest, testBuildCommandQuotesTargets) {
+  NinjaGraph graph("/my build", [](const std::string&) { return std::nullopt; });
+  EXPECT_EQ("ninja -C '/my build' 'app' 'foo test'", graph.getBuildCommand({"app", "foo test"}));
+}
+
+TEST_F(NinjaGraphTest, testIsNinjaBuild) {
+  const fs::path base = testTempDir("SENTINEL_NINJAGRAPH_TEST");
+  fs::remove_all(base);
+  fs::create_directories(base);
+  EXPECT_FALSE(NinjaGraph::isNinjaBuild(base));
+  std::ofstream(base / "build.ninja") << "ninja_required_version = 1.5\n";
+  EXPECT_TRUE(NinjaGraph::isNinjaBuild(base));
+  fs::remove_all(base);
+}
+
+}  // namespace sentinel
@@ -149,4 +149,33 @@ TEST_F(OriginalBuildStageTest, testFailedBuildMessageContainsBuildCommand) {
             HasSubstr("Build command: echo 'cmake error output' && false")));
 }
 
+TEST_F(OriginalBuildStageTest, testScopesAreBuiltBeforeTheDefaultBuild) {
+  fs::create_directories(mWorkspace->getOriginalDir());
+
+  const fs::path order = mBase / "order";
+  mConfig.buildCmd = "echo default >> " + order.string();
+  mConfig.scopes = {{"lib/*", "echo lib >> " + order.string(), "true", mBase / "lib-results"}};
+  auto stage = std::make_shared<OriginalBuildStage>();
+  auto ctx = makeCtx();
+
+  EXPECT_NO_THROW(stage->run(&ctx));
+  EXPECT_EQ("lib\ndefault\n", testutil::readFile(order));
+  EXPECT_TRUE(fs::exists(mWorkspace->getOriginalScopeBuildLog(0)));
+}
+
+TEST_F(OriginalBuildStageTest, testFailedScopeBuildThrowsBeforeTheDefaultBuild) {
+  fs::create_directories(mWorkspace->getOriginalDir());
+
+  mConfig.buildCmd = "true";
+  mConfig.scopes = {{"lib/*", "false", "true", mBase / "lib-results"}};
+  auto stage = std::make_shared<OriginalBuildStage>();
+  auto ctx = makeCtx();
+
+  EXPECT_THROW_MESSAGE(
+      stage->run(&ctx),
+      std::runtime_error, HasSubstr("Original build of scope 'lib/*' failed"));
+  // The default build log marks the stage as done on resume.
+  EXPECT_FALSE(fs::exists(mWorkspace->getOriginalBuildLog()));
+}
+
 }  // namespace sentinel
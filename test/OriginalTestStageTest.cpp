@@ -117,7 +117,7 @@ TEST_F(OriginalTestStageTest, testAutoTimeoutSavesStatus) {
   EXPECT_GE(*status.originalTime, static_cast<std::size_t>(5));
 }
 
-TEST_F(OriginalTestStageTest, testExplicitTimeoutDoesNotSaveStatus) {
+TEST_F(OriginalTestStageTest, testExplicitTimeoutDoesNotSaveOriginalTime) {
   // Explicit timeout — status.originalTime must NOT be written
   mConfig.timeout = 30;
   createTestResultFile();
@@ -128,6 +128,8 @@ TEST_F(OriginalTestStageTest, testExplicitTimeoutDoesNotSaveStatus) {
 
   WorkspaceStatus status = mWorkspace->loadStatus();
   EXPECT_FALSE(status.originalTime.has_value());
+  // The measured test time is recorded regardless, for the dry-run estimate.
+  EXPECT_TRUE(status.originalTestSeconds.has_value());
 }
 
 TEST_F(OriginalTestStageTest, testEmptyTestResultsThrows) {
@@ -296,4 +298,38 @@ TEST_F(OriginalTestStageTest, testEmptyResultsMessageContainsTestCommand) {
             HasSubstr("Test command: echo 'no results' >&2")));
 }
 
+TEST_F(OriginalTestStageTest, testScopeResultsAndTimeoutsAreSaved) {
+  createTestResultFile();
+  const fs::path scopeResultDir = mBase / "lib-results";
+  mConfig.scopes = {{"lib/*", "true",
+                     "mkdir -p " + scopeResultDir.string() + " && echo '<testsuites/>' > " +
+                         (scopeResultDir / "lib.xml").string(),
+                     scopeResultDir}};
+
+  auto stage = std::make_shared<OriginalTestStage>();
+  auto ctx = makeCtx();
+  stage->run(&ctx);
+
+  EXPECT_TRUE(fs::exists(mWorkspace->getOriginalScopeTestLog(0)));
+  EXPECT_TRUE(fs::exists(mWorkspace->getOriginalScopeResultsDir(0) / "lib.xml"));
+  EXPECT_FALSE(fs::exists(mWorkspace->getOriginalResultsDir() / "lib.xml"));
+  EXPECT_TRUE(fs::exists(mWorkspace->getOriginalResultsDir() / "results.xml"));
+  const auto scopeTimes = mWorkspace->loadStatus().scopeOriginalTimes;
+  ASSERT_TRUE(scopeTimes.has_value());
+  ASSERT_EQ(1U, scopeTimes->size());
+  EXPECT_GE((*scopeTimes)[0], static_cast<std::size_t>(5));
+}
+
+TEST_F(OriginalTestStageTest, testScopeWithoutResultsThrows) {
+  createTestResultFile();
+  mConfig.scopes = {{"lib/*", "true", "true", mBase / "lib-results"}};
+
+  auto stage = std::make_shared<OriginalTestStage>();
+  auto ctx = makeCtx();
+  EXPECT_THROW_MESSAGE(
+      stage->run(&ctx),
+      std::runtime_error, HasSubstr("after running test command of scope 'lib/*'"));
+  EXPECT_FALSE(mWorkspace->hasPreviousRun());
+}
+
 }  // namespace sentinel
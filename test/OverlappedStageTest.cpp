@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>  // NOLINT
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include "helper/TestTempDir.hpp"
+#include "sentinel/OverlappedStage.hpp"
+#include "sentinel/PipelineContext.hpp"
+#include "sentinel/Workspace.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class ForegroundStage : public Stage {
+ public:
+  explicit ForegroundStage(bool skip = false, bool fail = false) : mSkip(skip), mFail(fail) {
+  }
+  bool wasExecuted() const { return mExecuted; }
+  bool sawResultPointer() const { return mSawResultPointer; }
+  std::thread::id getThreadId() const { return mThreadId; }
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override {
+    (void)ctx;
+    return mSkip;
+  }
+  StatusLine::Phase getPhase() const override { return StatusLine::Phase::TEST_ORIG; }
+  bool execute(PipelineContext* ctx) override {
+    mExecuted = true;
+    mSawResultPointer = ctx->foregroundResult != nullptr;
+    mThreadId = std::this_thread::get_id();
+    if (mFail) {
+      throw std::runtime_error("original test failed");
+    }
+    return true;
+  }
+
+ private:
+  bool mSkip;
+  bool mFail;
+  bool mExecuted = false;
+  bool mSawResultPointer = false;
+  std::thread::id mThreadId;
+};
+
+class BackgroundStage : public Stage {
+ public:
+  explicit BackgroundStage(bool skip = false, bool fail = false) : mSkip(skip), mFail(fail) {
+  }
+  bool wasExecuted() const { return mExecuted; }
+  bool wasCommitted() const { return mCommitted; }
+  bool hadResult() const { return mHadResult; }
+  std::thread::id getThreadId() const { return mThreadId; }
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override {
+    (void)ctx;
+    return mSkip;
+  }
+  StatusLine::Phase getPhase() const override { return StatusLine::Phase::GENERATION; }
+  bool execute(PipelineContext* ctx) override {
+    mExecuted = true;
+    mThreadId = std::this_thread::get_id();
+    if (mFail) {
+      throw std::runtime_error("generation failed");
+    }
+    mHadResult = ctx->foregroundResult != nullptr;
+    if (mHadResult && !ctx->foregroundResult->get()) {
+      return false;
+    }
+    mCommitted = true;
+    return true;
+  }
+
+ private:
+  bool mSkip;
+  bool mFail;
+  bool mExecuted = false;
+  bool mCommitted = false;
+  bool mHadResult = false;
+  std::thread::id mThreadId;
+};
+
+class NextStage : public Stage {
+ public:
+  bool wasExecuted() const { return mExecuted; }
+
+ protected:
+  bool shouldSkip(const PipelineContext& ctx) const override {
+    (void)ctx;
+    return false;
+  }
+  StatusLine::Phase getPhase() const override { return StatusLine::Phase::EVALUATION; }
+  bool execute(PipelineContext* ctx) override {
+    (void)ctx;
+    mExecuted = true;
+    return true;
+  }
+
+ private:
+  bool mExecuted = false;
+};
+
+class OverlappedStageTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_OVERLAPPEDSTAGE_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase);
+    mWorkspace = std::make_shared<Workspace>(mBase / "ws");
+  }
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+  PipelineContext makeCtx() {
+    return {mConfig, mStatusLine, *mWorkspace};
+  }
+
+  fs::path mBase;
+  Config mConfig;
+  StatusLine mStatusLine;
+  std::shared_ptr<Workspace> mWorkspace;
+};
+
+TEST_F(OverlappedStageTest, testRunsBothStagesOnSeparateThreads) {
+  auto foreground = std::make_shared<ForegroundStage>();
+  auto background = std::make_shared<BackgroundStage>();
+  auto next = std::make_shared<NextStage>();
+  auto stage = std::make_shared<OverlappedStage>(foreground, background);
+  stage->setNext(next);
+  auto ctx = makeCtx();
+  stage->run(&ctx);
+
+  EXPECT_TRUE(foreground->wasExecuted());
+  EXPECT_FALSE(foreground->sawResultPointer());
+  EXPECT_TRUE(background->hadResult());
+  EXPECT_TRUE(background->wasCommitted());
+  EXPECT_EQ(std::this_thread::get_id(), foreground->getThreadId());
+  EXPECT_NE(std::this_thread::get_id(), background->getThreadId());
+  EXPECT_TRUE(next->wasExecuted());
+}
+
+TEST_F(OverlappedStageTest, testForegroundFailureDiscardsBackgroundWork) {
+  auto foreground = std::make_shared<ForegroundStage>(false, /*fail=*/true);
+  auto background = std::make_shared<BackgroundStage>();
+  auto next = std::make_shared<NextStage>();
+  auto stage = std::make_shared<OverlappedStage>(foreground, background);
+  stage->setNext(next);
+  auto ctx = makeCtx();
+
+  EXPECT_THROW(stage->run(&ctx), std::runtime_error);
+  EXPECT_TRUE(background->wasExecuted());
+  EXPECT_FALSE(background->wasCommitted());
+  EXPECT_FALSE(next->wasExecuted());
+}
+
+TEST_F(OverlappedStageTest, testBackgroundFailureIsRethrownAfterForeground) {
+  auto foreground = std::make_shared<ForegroundStage>();
+  auto background = std::make_shared<BackgroundStage>(false, /*fail=*/true);
+  auto next = std::make_shared<NextStage>();
+  auto stage = std::make_shared<OverlappedStage>(foreground, background);
+  stage->setNext(next);
+  auto ctx = makeCtx();
+
+  EXPECT_THROW(stage->run(&ctx), std::runtime_error);
+  EXPECT_TRUE(foreground->wasExecuted());
+  EXPECT_FALSE(next->wasExecuted());
+}
+
+TEST_F(OverlappedStageTest, testSkippedForegroundRunsBackgroundInline) {
+  auto foreground = std::make_shared<ForegroundStage>(/*skip=*/true);
+  auto background = std::make_shared<BackgroundStage>();
+  auto stage = std::make_shared<OverlappedStage>(foreground, background);
+  auto ctx = makeCtx();
+  stage->run(&ctx);
+
+  EXPECT_FALSE(foreground->wasExecuted());
+  EXPECT_TRUE(background->wasCommitted());
+  EXPECT_FALSE(background->hadResult());
+  EXPECT_EQ(std::this_thread::get_id(), background->getThreadId());
+}
+
+TEST_F(OverlappedStageTest, testSkippedBackgroundRunsForegroundOnly) {
+  auto foreground = std::make_shared<ForegroundStage>();
+  auto background = std::make_shared<BackgroundStage>(/*skip=*/true);
+  auto next = std::make_shared<NextStage>();
+  auto stage = std::make_shared<OverlappedStage>(foreground, background);
+  stage->setNext(next);
+  auto ctx = makeCtx();
+  stage->run(&ctx);
+
+  EXPECT_TRUE(foreground->wasExecuted());
+  EXPECT_FALSE(background->wasExecuted());
+  EXPECT_TRUE(next->wasExecuted());
+}
+
+}  // namespace sentinel
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include "helper/TestTempDir.hpp"
+#include "sentinel/Config.hpp"
+#include "sentinel/Mutant.hpp"
+#include "sentinel/MutationResult.hpp"
+#include "sentinel/MutationState.hpp"
+#include "sentinel/PartitionPlanner.hpp"
+#include "sentinel/RuntimeEstimator.hpp"
+#include "sentinel/Workspace.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+using Positions = std::vector<std::size_t>;
+
+TEST(PartitionPlannerTest, testByCountUsesContiguousSlices) {
+  PartitionPlanner planner;
+  auto parts = planner.plan({"a.cpp", "a.cpp", "b.cpp", "b.cpp", "c.cpp"}, 2);
+  ASSERT_EQ(2u, parts.size());
+  EXPECT_EQ((Positions{0, 1}), parts[0]);
+  EXPECT_EQ((Positions{2, 3, 4}), parts[1]);
+  EXPECT_EQ("count", planner.getStrategy());
+  EXPECT_TRUE(planner.plan({"a.cpp"}, 0).empty());
+}
+
+TEST(PartitionPlannerTest, testByCostKeepsFilesTogether) {
+  PartitionPlanner planner(std::map<fs::path, double>{});
+  const std::vector<fs::path> files = {"a.cpp", "b.cpp", "a.cpp", "c.cpp", "b.cpp", "c.cpp"};
+  auto parts = planner.plan(files, 3);
+  ASSERT_EQ(3u, parts.size());
+  std::set<std::size_t> seen;
+  for (const auto& part : parts) {
+    ASSERT_EQ(2u, part.size());
+    EXPECT_EQ(files[part[0]], files[part[1]]);
+    EXPECT_TRUE(std::is_sorted(part.begin(), part.end()));
+    seen.insert(part.begin(), part.end());
+  }
+  EXPECT_EQ(6u, seen.size());
+}
+
+TEST(PartitionPlannerTest, testByCostBalancesExpensiveFiles) {
+  PartitionPlanner planner({{"slow.cpp", 10.0}, {"fast.cpp", 1.0}});
+  const std::vector<fs::path> files = {"slow.cpp", "slow.cpp", "fast.cpp", "fast.cpp",
+                                       "fast.cpp", "fast.cpp", "fast.cpp", "fast.cpp"};
+  // An equal-count split would cost 22 and 4. The slow file costs more than an even share (13), so it is split.
+  auto parts = planner.plan(files, 2);
+  ASSERT_EQ(2u, parts.size());
+  EXPECT_EQ((Positions{0, 2, 3, 4, 5, 6, 7}), parts[0]);
+  EXPECT_EQ((Positions{1}), parts[1]);
+}
+
+TEST(PartitionPlannerTest, testUnknownFileCostsMeanOfKnownFiles) {
+  PartitionPlanner planner({{"a.cpp", 2.0}, {"b.cpp", 4.0}});
+  // c.cpp costs 3, so its two mutants (6) outweigh b.cpp (4) and a.cpp (2) and fill one partition alone.
+  auto parts = planner.plan({"c.cpp", "c.cpp", "a.cpp", "b.cpp"}, 2);
+  EXPECT_EQ((Positions{0, 1}), parts[0]);
+  EXPECT_EQ((Positions{2, 3}), parts[1]);
+}
+
+TEST(PartitionPlannerTest, testPlanIsDeterministic) {
+  PartitionPlanner planner({{"a.cpp", 3.0}, {"b.cpp", 1.0}});
+  const std::vector<fs::path> files = {"a.cpp", "b.cpp", "c.cpp", "a.cpp", "d.cpp", "b.cpp", "e.cpp"};
+  EXPECT_EQ(planner.plan(files, 3), PartitionPlanner({{"a.cpp", 3.0}, {"b.cpp", 1.0}}).plan(files, 3));
+}
+
+TEST(PartitionPlannerTest, testStrategyFingerprintsCostTable) {
+  PartitionPlanner a({{"a.cpp", 1.0}});
+  PartitionPlanner b({{"a.cpp", 2.0}});
+  EXPECT_EQ(0u, a.getStrategy().rfind("cost:", 0));
+  EXPECT_EQ(a.getStrategy(), PartitionPlanner({{"a.cpp", 1.0}}).getStrategy());
+  EXPECT_NE(a.getStrategy(), b.getStrategy());
+}
+
+TEST(PartitionPlannerTest, testLoadFileCostsAveragesBuildAndTestTime) {
+  const fs::path base = testTempDir("SENTINEL_PARTITIONPLANNER_TEST");
+  fs::remove_all(base);
+  Workspace ws(base);
+  ws.initialize();
+  ws.saveConfig(Config::withDefaults());
+  auto addDone = [&ws](int id, const char* path, double buildSecs, double testSecs) {
+    Mutant m("AOR", path, "f", id, 1, id, 2, "-");
+    ws.createMutant(id, m);
+    MutationResult result(m, "", "", MutationState::KILLED);
+    result.setBuildSecs(buildSecs);
+    result.setTestSecs(testSecs);
+    ws.setDone(id, result);
+  };
+  addDone(1, "a.cpp", 1.0, 2.0);
+  addDone(2, "a.cpp", 3.0, 2.0);
+  addDone(3, "b.cpp", 0.0, 0.0);
+  ws.createMutant(4, Mutant("AOR", "c.cpp", "f", 4, 1, 4, 2, "-"));
+
+  const auto costs = PartitionPlanner::loadFileCosts(base);
+  EXPECT_EQ((std::map<fs::path, double>{{"a.cpp", 4.0}}), costs);
+  EXPECT_THROW(PartitionPlanner::loadFileCosts(base / "missing"), std::runtime_error);
+  fs::remove_all(base);
+}
+
+TEST(PartitionPlannerTest, testRuntimeEstimateFollowsPlan) {
+  RuntimeEstimator estimator(1.0, {{"fast.cpp", 0.0}, {"slow.cpp", 10.0}});
+  const std::vector<fs::path> files = {"slow.cpp", "slow.cpp", "fast.cpp", "fast.cpp"};
+  auto parts = estimator.estimatePartitions(files, 2, PartitionPlanner({{"slow.cpp", 21.0}, {"fast.cpp", 1.0}}));
+  ASSERT_EQ(2u, parts.size());
+  EXPECT_DOUBLE_EQ(23.0, parts[0]);
+  EXPECT_DOUBLE_EQ(11.0, parts[1]);
+}
+
+}  // namespace sentinel
@@ -317,6 +317,44 @@ TEST_F(PartitionedWorkspaceMergerTest,
   EXPECT_THROW(merger.merge(), std::runtime_error);
 }
 
+TEST_F(PartitionedWorkspaceMergerTest,
+       testThrowsWhenPartitionStrategyMismatch) {
+  fs::path target = mBase / "merged";
+  fs::path src1 = createPartitionWorkspace(1, 2);
+  fs::path src2 = createPartitionWorkspace(2, 2);
+  WorkspaceStatus status;
+  status.partitionStrategy = "cost:0123456789abcdef";
+  Workspace(src2).saveStatus(status);
+  addMutant(src1, 1, MutationState::KILLED);
+  addMutant(src2, 2, MutationState::SURVIVED);
+
+  PartitionedWorkspaceMerger merger(target, {src1, src2}, false);
+  EXPECT_THROW(merger.merge(), std::runtime_error);
+}
+
+TEST_F(PartitionedWorkspaceMergerTest,
+       testMergeKeepsPartitionStrategy) {
+  fs::path target = mBase / "merged";
+  fs::path src1 = createPartitionWorkspace(1, 2);
+  fs::path src2 = createPartitionWorkspace(2, 2);
+  WorkspaceStatus status;
+  status.partitionStrategy = "cost:0123456789abcdef";
+  Workspace(src1).saveStatus(status);
+  Workspace(src2).saveStatus(status);
+  addMutant(src1, 3, MutationState::KILLED);
+  addMutant(src2, 1, MutationState::SURVIVED);
+
+  {
+    PartitionedWorkspaceMerger merger(target, {src1}, false);
+    merger.merge();
+  }
+  EXPECT_EQ("cost:0123456789abcdef", Workspace(target).loadStatus().partitionStrategy.value_or(""));
+
+  PartitionedWorkspaceMerger merger(target, {src2}, false);
+  EXPECT_NO_THROW(merger.merge());
+  EXPECT_TRUE(Workspace(target).isComplete());
+}
+
 TEST_F(PartitionedWorkspaceMergerTest,
        testThrowsWhenSeedMismatchWithTarget) {
   fs::path target = mBase / "merged";
@@ -679,4 +717,88 @@ TEST_F(PartitionedWorkspaceMergerTest,
   EXPECT_EQ(output.find("[1/1]"), std::string::npos);
 }
 
+TEST_F(PartitionedWorkspaceMergerTest,
+       testIndexOnlyLinksLogsToSources) {
+  fs::path target = mBase / "merged";
+  fs::path src1 = createPartitionWorkspace(1, 2);
+  fs::path src2 = createPartitionWorkspace(2, 2);
+  addMutant(src1, 1, MutationState::KILLED);
+  addMutant(src2, 2, MutationState::SURVIVED);
+
+  PartitionedWorkspaceMerger merger(target, {src1, src2}, false, true);
+  merger.merge();
+
+  Workspace targetWs(target);
+  EXPECT_TRUE(targetWs.isComplete());
+  EXPECT_FALSE(fs::is_symlink(targetWs.getMutantDir(2) / "mt.done"));
+  ASSERT_TRUE(fs::is_symlink(targetWs.getMutantBuildLog(2)));
+  EXPECT_EQ(Workspace(src2).getMutantBuildLog(2), fs::read_symlink(targetWs.getMutantBuildLog(2)));
+  std::ifstream log(targetWs.getMutantTestLog(1));
+  std::string line;
+  std::getline(log, line);
+  EXPECT_EQ("test mutant 1", line);
+  EXPECT_EQ(MutationState::SURVIVED, targetWs.getDoneResult(2).getMutationState());
+}
+
+TEST_F(PartitionedWorkspaceMergerTest,
+       testMergedFilesDoNotShareInodesWithSources) {
+  fs::path target = mBase / "merged";
+  fs::path src1 = createPartitionWorkspace(1, 1);
+  addMutant(src1, 1, MutationState::KILLED);
+
+  PartitionedWorkspaceMerger merger(target, {src1}, false);
+  merger.merge();
+
+  // Resuming the merged workspace must not rewrite the partition's results.
+  Workspace targetWs(target);
+  EXPECT_EQ(1U, fs::hard_link_count(targetWs.getMutantDir(1) / "mt.done"));
+  EXPECT_EQ(1U, fs::hard_link_count(targetWs.getMutantBuildLog(1)));
+  EXPECT_EQ(MutationState::KILLED, targetWs.getDoneResult(1).getMutationState());
+}
+
+TEST_F(PartitionedWorkspaceMergerTest,
+       testHardLinkSharesFilesWithSources) {
+  fs::path target = mBase / "merged";
+  fs::path src1 = createPartitionWorkspace(1, 1);
+  addMutant(src1, 1, MutationState::KILLED);
+
+  PartitionedWorkspaceMerger merger(target, {src1}, false, false, true);
+  merger.merge();
+
+  // Both workspaces live in the same directory, so the files are cloned or hard-linked.
+  Workspace targetWs(target);
+  const fs::path done = targetWs.getMutantDir(1) / "mt.done";
+  EXPECT_EQ(fs::hard_link_count(done), fs::hard_link_count(Workspace(src1).getMutantDir(1) / "mt.done"));
+  EXPECT_EQ(MutationState::KILLED, targetWs.getDoneResult(1).getMutationState());
+}
+
+TEST_F(PartitionedWorkspaceMergerTest,
+       testParallelMergeCollectsEveryPartition) {
+  fs::path target = mBase / "merged";
+  std::vector<fs::path> sources;
+  for (std::size_t idx = 1; idx <= 6; ++idx) {
+    sources.push_back(createPartitionWorkspace(idx, 6));
+    addMutant(sources.back(), static_cast<int>(idx), MutationState::KILLED);
+  }
+
+  PartitionedWorkspaceMerger merger(target, sources, false);
+  merger.merge();
+
+  Workspace targetWs(target);
+  EXPECT_TRUE(targetWs.isComplete());
+  for (int id = 1; id <= 6; ++id) {
+    EXPECT_TRUE(targetWs.isDone(id));
+    EXPECT_FALSE(fs::is_symlink(targetWs.getMutantBuildLog(id)));
+    std::ifstream log(targetWs.getMutantBuildLog(id));
+    std::string line;
+    std::getline(log, line);
+    EXPECT_EQ(fmt::format("build mutant {}", id), line);
+  }
+
+  // Removing a partition afterwards leaves the merged results intact.
+  fs::remove_all(sources[0]);
+  EXPECT_TRUE(fs::exists(targetWs.getMutantBuildLog(1)));
+  EXPECT_TRUE(targetWs.isDone(1));
+}
+
 }  // namespace sentinel
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fcntl.h>
+#include <fmt/core.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <optional>
+#include <string>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/Jobserver.hpp"
+#include "sentinel/PressureMonitor.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class PressureMonitorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_PRESSURE_MONITOR_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase);
+    mFiles = {{"cpu", mBase / "cpu"}, {"memory", mBase / "memory"}, {"io", mBase / "io"}};
+    setPressure("cpu", 0.0);
+    setPressure("memory", 0.0);
+    setPressure("io", 0.0);
+  }
+
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+
+  void setPressure(const std::string& resource, double avg10) {
+    testutil::writeFile(mFiles.at(resource),
+                        fmt::format("some avg10={:.2f} avg60=0.00 avg300=0.00 total=0\n"
+                                    "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n",
+                                    avg10));
+  }
+
+  /**
+   * @brief Return the number of tokens left in the pool without taking any of them.
+   */
+  std::size_t countTokens(const Jobserver& jobserver) const {
+    const int fd = ::open(jobserver.getFifo().c_str(), O_RDONLY | O_NONBLOCK);
+    EXPECT_GE(fd, 0);
+    char buf[256];
+    const ssize_t nb = ::read(fd, buf, sizeof(buf));
+    const std::size_t count = nb > 0 ? static_cast<std::size_t>(nb) : 0;
+    for (std::size_t i = 0; i < count; i++) {
+      jobserver.release(buf[i]);
+    }
+    ::close(fd);
+    return count;
+  }
+
+  fs::path mBase;
+  std::map<std::string, fs::path> mFiles;
+};
+
+TEST_F(PressureMonitorTest, testReadPressureParsesSomeAvg10) {
+  testutil::writeFile(mBase / "psi", "some avg10=12.34 avg60=5.00 avg300=1.00 total=99\n"
+                                     "full avg10=50.00 avg60=0.00 avg300=0.00 total=0\n");
+  EXPECT_EQ(std::optional<double>(12.34), PressureMonitor::readPressure(mBase / "psi"));
+}
+
+TEST_F(PressureMonitorTest, testReadPressureWithoutSomeLine) {
+  testutil::writeFile(mBase / "psi", "full avg10=50.00 avg60=0.00 avg300=0.00 total=0\n");
+  EXPECT_FALSE(PressureMonitor::readPressure(mBase / "psi").has_value());
+  EXPECT_FALSE(PressureMonitor::readPressure(mBase / "missing").has_value());
+}
+
+TEST_F(PressureMonitorTest, testPressureAboveTargetHoldsBackTokens) {
+  Jobserver jobserver(mBase / "jobserver", 3);
+  PressureMonitor monitor(jobserver, {{"memory", 10.0}}, mFiles);
+  EXPECT_EQ(3U, monitor.getLimit());
+
+  setPressure("memory", 25.0);
+  monitor.update();
+  EXPECT_EQ(2U, monitor.getLimit());
+  EXPECT_EQ(2U, countTokens(jobserver));
+
+  monitor.update();
+  monitor.update();
+  EXPECT_EQ(1U, monitor.getLimit());
+  EXPECT_EQ(1U, countTokens(jobserver));
+}
+
+TEST_F(PressureMonitorTest, testTokensAreGivenBackBelowReleaseRatio) {
+  Jobserver jobserver(mBase / "jobserver", 3);
+  PressureMonitor monitor(jobserver, {{"io", 40.0}}, mFiles);
+  setPressure("io", 50.0);
+  monitor.update();
+  monitor.update();
+  EXPECT_EQ(1U, monitor.getLimit());
+
+  // Below the target, but not below 80% of it.
+  setPressure("io", 35.0);
+  monitor.update();
+  EXPECT_EQ(1U, monitor.getLimit());
+
+  setPressure("io", 10.0);
+  monitor.update();
+  EXPECT_EQ(2U, monitor.getLimit());
+  EXPECT_EQ(2U, countTokens(jobserver));
+}
+
+TEST_F(PressureMonitorTest, testTokenInUseIsHeldBackOnceReturned) {
+  Jobserver jobserver(mBase / "jobserver", 2);
+  const char first = jobserver.acquire();
+  const char second = jobserver.acquire();
+  PressureMonitor monitor(jobserver, {{"cpu", 50.0}}, mFiles);
+
+  setPressure("cpu", 90.0);
+  monitor.update();
+  EXPECT_EQ(1U, monitor.getLimit());
+
+  jobserver.release(first);
+  jobserver.release(second);
+  setPressure("cpu", 45.0);
+  monitor.update();
+  EXPECT_EQ(1U, countTokens(jobserver));
+}
+
+TEST_F(PressureMonitorTest, testHeldTokensAreGivenBackOnDestruction) {
+  Jobserver jobserver(mBase / "jobserver", 4);
+  {
+    PressureMonitor monitor(jobserver, {{"memory", 10.0}}, mFiles);
+    setPressure("memory", 30.0);
+    monitor.update();
+    monitor.update();
+    EXPECT_EQ(2U, countTokens(jobserver));
+  }
+  EXPECT_EQ(4U, countTokens(jobserver));
+}
+
+TEST_F(PressureMonitorTest, testUnreadableResourceIsIgnored) {
+  Jobserver jobserver(mBase / "jobserver", 2);
+  fs::remove(mFiles.at("io"));
+  PressureMonitor monitor(jobserver, {{"io", 10.0}}, mFiles);
+
+  testutil::writeFile(mFiles.at("io"), "some avg10=99.00 avg60=0.00 avg300=0.00 total=0\n");
+  monitor.update();
+  EXPECT_EQ(2U, monitor.getLimit());
+}
+
+}  // namespace sentinel
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <chrono>
+#include <csignal>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/ProcessPool.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class ProcessPoolTest : public ::testing::Test {
+ protected:
+  using Results = std::map<std::size_t, ProcessPool::Result>;
+
+  static Results run(const ProcessPool& pool, const std::vector<std::size_t>& indices, const ProcessPool::Job& job) {
+    Results results;
+    pool.run(indices, job, [&results](std::size_t index, const ProcessPool::Result& result) {
+      results[index] = result;
+    });
+    return results;
+  }
+};
+
+TEST_F(ProcessPoolTest, testReturnsOutputOfEachJobFromItsChild) {
+  int parentValue = 1;
+  const Results results = run(ProcessPool(2, std::nullopt, std::nullopt), {2, 0, 1}, [&parentValue](std::size_t i) {
+    parentValue = 42;
+    return std::to_string(i * 10);
+  });
+
+  ASSERT_EQ(3u, results.size());
+  for (std::size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(ProcessPool::Status::SUCCEEDED, results.at(i).status);
+    EXPECT_EQ(std::to_string(i * 10), results.at(i).output);
+  }
+  EXPECT_EQ(1, parentValue);
+}
+
+TEST_F(ProcessPoolTest, testReturnsLargeOutput) {
+  const std::string large(1 << 20, 'x');
+  const Results results = run(ProcessPool(1, std::nullopt, std::nullopt), {0}, [&large](std::size_t) {
+    return large;
+  });
+  EXPECT_EQ(ProcessPool::Status::SUCCEEDED, results.at(0).status);
+  EXPECT_EQ(large, results.at(0).output);
+}
+
+TEST_F(ProcessPoolTest, testReportsExceptionOfJob) {
+  const Results results = run(ProcessPool(1, std::nullopt, std::nullopt), {0}, [](std::size_t) -> std::string {
+    throw std::runtime_error("cannot parse");
+  });
+  EXPECT_EQ(ProcessPool::Status::FAILED, results.at(0).status);
+  EXPECT_EQ("cannot parse", results.at(0).output);
+}
+
+TEST_F(ProcessPoolTest, testReportsJobOverMemoryLimit) {
+  const Results results = run(ProcessPool(1, 512 * 1024 * 1024, std::nullopt), {0}, [](std::size_t) {
+    auto block = std::make_unique<char[]>(std::size_t(2) * 1024 * 1024 * 1024);
+    block[0] = 'x';
+    return std::string(1, block[0]);
+  });
+  EXPECT_EQ(ProcessPool::Status::OUT_OF_MEMORY, results.at(0).status);
+}
+
+TEST_F(ProcessPoolTest, testKillsJobOverTimeout) {
+  const auto start = std::chrono::steady_clock::now();
+  const Results results = run(ProcessPool(2, std::nullopt, 1), {0, 1}, [](std::size_t i) {
+    if (i == 1) {
+      std::this_thread::sleep_for(std::chrono::seconds(30));
+    }
+    return std::string("done");
+  });
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+  EXPECT_EQ(ProcessPool::Status::SUCCEEDED, results.at(0).status);
+  EXPECT_EQ(ProcessPool::Status::TIMED_OUT, results.at(1).status);
+}
+
+TEST_F(ProcessPoolTest, testReportsCrashOfJob) {
+  const Results results = run(ProcessPool(1, std::nullopt, std::nullopt), {0}, [](std::size_t) {
+    std::raise(SIGSEGV);
+    return std::string();
+  });
+  EXPECT_EQ(ProcessPool::Status::CRASHED, results.at(0).status);
+}
+
+TEST_F(ProcessPoolTest, testKillsChildrenWhenCallbackThrows) {
+  const auto start = std::chrono::steady_clock::now();
+  ProcessPool pool(2, std::nullopt, std::nullopt);
+  auto job = [](std::size_t i) {
+    if (i == 1) {
+      std::this_thread::sleep_for(std::chrono::seconds(30));
+    }
+    return std::string();
+  };
+  EXPECT_THROW(pool.run({0, 1}, job, [](std::size_t, const ProcessPool::Result&) {
+    throw std::runtime_error("cancelled");
+  }), std::runtime_error);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+}
+
+TEST_F(ProcessPoolTest, testGetAvailableMemory) {
+  const fs::path base = testTempDir("SENTINEL_PROCESSPOOL_TEST");
+  fs::remove_all(base);
+  fs::create_directories(base);
+  testutil::writeFile(base / "meminfo", "MemTotal:       16000000 kB\nMemAvailable:    2048 kB\n");
+  EXPECT_EQ(std::optional<std::size_t>(2048 * 1024), ProcessPool::getAvailableMemory(base / "meminfo"));
+  testutil::writeFile(base / "meminfo", "MemTotal:       16000000 kB\n");
+  EXPECT_EQ(std::nullopt, ProcessPool::getAvailableMemory(base / "meminfo"));
+  EXPECT_EQ(std::nullopt, ProcessPool::getAvailableMemory(base / "missing"));
+  fs::remove_all(base);
+}
+
+}  // namespace sentinel
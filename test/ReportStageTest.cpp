@@ -147,6 +147,50 @@ TEST_F(ReportStageTest, testMixedResultsScore) {
   EXPECT_THAT(output, ::testing::HasSubstr("50.0%"));
 }
 
+TEST_F(ReportStageTest, testIncompleteRunWithTimeBudgetReportsEstimate) {
+  addResult(1, MutationState::KILLED);
+  addResult(2, MutationState::SURVIVED);
+  mWorkspace->createMutant(3, makeMutant());
+  mWorkspace->createMutant(4, makeMutant());
+
+  Config cfg = makeConfig();
+  cfg.timeBudget = 60;
+  Logger::setLevel(Logger::Level::INFO);
+
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  auto stage = std::make_shared<ReportStage>();
+  auto ctx = makeCtx(&cfg);
+  EXPECT_NO_THROW(stage->run(&ctx));
+  std::string output = testing::internal::GetCapturedStderr();
+  testing::internal::GetCapturedStdout();
+
+  EXPECT_THAT(output, ::testing::HasSubstr("stopped at the time budget"));
+  EXPECT_THAT(output, ::testing::HasSubstr("estimated 50.0% (95% CI"));
+  EXPECT_THAT(output, ::testing::HasSubstr("2 of 4 mutants"));
+}
+
+TEST_F(ReportStageTest, testCompleteRunWithTimeBudgetReportsScore) {
+  addResult(1, MutationState::KILLED);
+  addResult(2, MutationState::SURVIVED);
+  mWorkspace->setComplete();
+
+  Config cfg = makeConfig();
+  cfg.timeBudget = 60;
+  Logger::setLevel(Logger::Level::INFO);
+
+  testing::internal::CaptureStdout();
+  testing::internal::CaptureStderr();
+  auto stage = std::make_shared<ReportStage>();
+  auto ctx = makeCtx(&cfg);
+  EXPECT_NO_THROW(stage->run(&ctx));
+  std::string output = testing::internal::GetCapturedStderr();
+  testing::internal::GetCapturedStdout();
+
+  EXPECT_THAT(output, ::testing::HasSubstr("Mutation testing complete"));
+  EXPECT_THAT(output, ::testing::Not(::testing::HasSubstr("estimated")));
+}
+
 TEST_F(ReportStageTest, testThresholdPassedDoesNotThrow) {
   // 2 killed, 1 survived => score = 66.7%, threshold = 50.0
   addResult(1, MutationState::KILLED);
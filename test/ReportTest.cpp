@@ -95,6 +95,52 @@ TEST_F(ReportTest, testPrintEmptyReport) {
   EXPECT_TRUE(string::contains(out2, "Skipped: 1 build failure, 1 runtime error, 1 timeout"));
 }
 
+TEST_F(ReportTest, testWilsonIntervalForLargePopulation) {
+  const auto [low, high] = MutationSummary::getWilsonInterval(50, 100, 1000000);
+  EXPECT_NEAR(0.404, low, 0.001);
+  EXPECT_NEAR(0.596, high, 0.001);
+}
+
+TEST_F(ReportTest, testWilsonIntervalNarrowsWithFinitePopulation) {
+  const auto [low, high] = MutationSummary::getWilsonInterval(50, 100, 200);
+  EXPECT_GT(low, 0.404);
+  EXPECT_LT(high, 0.596);
+  EXPECT_LT(low, 0.5);
+  EXPECT_GT(high, 0.5);
+
+  const auto [allLow, allHigh] = MutationSummary::getWilsonInterval(30, 40, 40);
+  EXPECT_DOUBLE_EQ(0.75, allLow);
+  EXPECT_DOUBLE_EQ(0.75, allHigh);
+}
+
+TEST_F(ReportTest, testWilsonIntervalStaysWithinBounds) {
+  const auto [low, high] = MutationSummary::getWilsonInterval(10, 10, 1000);
+  EXPECT_GT(low, 0.6);
+  EXPECT_DOUBLE_EQ(1.0, high);
+  const auto [zeroLow, zeroHigh] = MutationSummary::getWilsonInterval(0, 10, 1000);
+  EXPECT_DOUBLE_EQ(0.0, zeroLow);
+  EXPECT_LT(zeroHigh, 0.4);
+}
+
+TEST_F(ReportTest, testPrintSampledReportShowsEstimate) {
+  MutationResults MRs;
+  MRs.emplace_back(Mutant("AOR", REL_PATH2, "f", 2, 12, 2, 13, "+"), "testA", "", MutationState::KILLED);
+  MRs.emplace_back(Mutant("AOR", REL_PATH3, "f", 3, 12, 3, 13, "-"), "", "", MutationState::SURVIVED);
+  MutationSummary summary(MRs, SOURCE_DIR);
+  EXPECT_FALSE(summary.isSampled());
+  EXPECT_FALSE(summary.getScoreInterval().has_value());
+  summary.plannedMutantCount = 10;
+  EXPECT_TRUE(summary.isSampled());
+  ASSERT_TRUE(summary.getScoreInterval().has_value());
+
+  ReportForTest report(summary);
+  testing::internal::CaptureStdout();
+  report.printSummary();
+  std::string out = testing::internal::GetCapturedStdout();
+  EXPECT_TRUE(string::contains(out, "Sampled estimate: 2 of 10 mutants"));
+  EXPECT_TRUE(string::contains(out, "Estimated score: 50.0% (95% CI"));
+}
+
 TEST_F(ReportTest, testPrintReportWithNoRuntimeerrorAndNoBuildFailure) {
   auto MUT_RESULT_DIR = BASE / "MUT_RESULT_DIR_1";
   fs::create_directories(MUT_RESULT_DIR);
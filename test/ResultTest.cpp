@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <filesystem>  // NOLINT
 #include <string>
+#include <vector>
 #include "sentinel/Logger.hpp"
 #include "sentinel/MutationState.hpp"
 #include "sentinel/Result.hpp"
@@ -303,6 +304,27 @@ TEST_F(ResultTest, testResultWithErrorMutationErrorTCAndAddNewTc) {
   EXPECT_EQ("C2.TC2", errorTest);
 }
 
+TEST_F(ResultTest, testResultComparesOnlySelectedTests) {
+  // Only C1.TC1 was run (static-test-selection): the missing C2.TC2 is not an error.
+  auto MUT_DIR = BASE / "mut_dir_selected_tests";
+  fs::create_directories(MUT_DIR);
+  makeResultXml(MUT_DIR, TC1_FAIL);
+  Result ori(ORI_DIR);
+  Result mut(MUT_DIR);
+
+  std::string killingTest;
+  std::string errorTest;
+  const std::vector<std::string> selected = {"C1.TC1"};
+  EXPECT_EQ(Result::compare(ori, mut, &killingTest, &errorTest, selected), MutationState::KILLED);
+  EXPECT_EQ("C1.TC1", killingTest);
+  EXPECT_EQ("", errorTest);
+
+  const std::vector<std::string> other = {"C2.TC2"};
+  EXPECT_EQ(Result::compare(ori, mut, &killingTest, &errorTest, other), MutationState::RUNTIME_ERROR);
+  EXPECT_EQ("", killingTest);
+  EXPECT_EQ("C2.TC2", errorTest);
+}
+
 TEST_F(ResultTest, testResultWithEmptyMutationDir) {
   auto MUT_DIR = BASE / "mut_dir_kill_empty_mutation_dir";
   fs::create_directories(MUT_DIR);
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <vector>
+#include "sentinel/RuntimeEstimator.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+TEST(RuntimeEstimatorTest, testEstimateCountsRebuildTwiceExceptForLastMutant) {
+  RuntimeEstimator estimator(10.0, {{"a.cpp", 2.0}});
+  // a: 2 + 10 + 2, a: 2 + 10 (last restore is never rebuilt)
+  EXPECT_DOUBLE_EQ(26.0, estimator.estimate({"a.cpp", "a.cpp"}));
+  EXPECT_DOUBLE_EQ(0.0, estimator.estimate({}));
+}
+
+TEST(RuntimeEstimatorTest, testUnsampledFileUsesMeanRebuildTime) {
+  RuntimeEstimator estimator(1.0, {{"a.cpp", 2.0}, {"b.cpp", 4.0}});
+  EXPECT_DOUBLE_EQ(2.0, estimator.getRebuildSeconds("a.cpp"));
+  EXPECT_DOUBLE_EQ(3.0, estimator.getRebuildSeconds("c.cpp"));
+}
+
+TEST(RuntimeEstimatorTest, testNoSamplesAssumesZeroRebuildTime) {
+  RuntimeEstimator estimator(5.0, {});
+  EXPECT_DOUBLE_EQ(0.0, estimator.getRebuildSeconds("a.cpp"));
+  EXPECT_DOUBLE_EQ(15.0, estimator.estimate({"a.cpp", "b.cpp", "c.cpp"}));
+}
+
+TEST(RuntimeEstimatorTest, testEstimatePartitionsUsesContiguousSlices) {
+  RuntimeEstimator estimator(1.0, {{"fast.cpp", 0.0}, {"slow.cpp", 10.0}});
+  std::vector<fs::path> files = {"fast.cpp", "fast.cpp", "slow.cpp", "slow.cpp"};
+  auto parts = estimator.estimatePartitions(files, 2);
+  ASSERT_EQ(2u, parts.size());
+  EXPECT_DOUBLE_EQ(2.0, parts[0]);
+  EXPECT_DOUBLE_EQ(32.0, parts[1]);
+  EXPECT_DOUBLE_EQ(estimator.estimate(files), estimator.estimatePartitions(files, 1)[0]);
+  EXPECT_TRUE(estimator.estimatePartitions(files, 0).empty());
+}
+
+TEST(RuntimeEstimatorTest, testSelectSamplesSpreadsOverMutantCountRanking) {
+  std::vector<fs::path> files = {"a.cpp", "a.cpp", "a.cpp", "b.cpp", "b.cpp", "c.cpp", "d.cpp", "d.cpp", "d.cpp",
+                                 "d.cpp"};
+  auto samples = RuntimeEstimator::selectSamples(files, 3);
+  ASSERT_EQ(3u, samples.size());
+  EXPECT_EQ(fs::path("d.cpp"), samples[0]);
+  EXPECT_EQ(fs::path("a.cpp"), samples[1]);
+  EXPECT_EQ(fs::path("c.cpp"), samples[2]);
+
+  EXPECT_EQ(1u, RuntimeEstimator::selectSamples({"a.cpp", "a.cpp"}, 3).size());
+  EXPECT_TRUE(RuntimeEstimator::selectSamples({}, 3).empty());
+}
+
+}  // namespace sentinel
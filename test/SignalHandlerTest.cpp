@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 #include <csignal>
 #include <memory>
+#include <thread>
 #include <vector>
 #include "sentinel/SignalHandler.hpp"
 #include "sentinel/util/signal.hpp"
@@ -48,4 +49,20 @@ TEST_F(SignalHandlerTest, testMultipleCallbacksInvokedInRegistrationOrder) {
   EXPECT_EQ(order[1], 2);
 }
 
+TEST_F(SignalHandlerTest, testHelperThreadBlocksOnlyAsynchronousSignals) {
+  sigset_t mask;
+  sigemptyset(&mask);
+  std::thread([&mask] {
+    signal::blockSignalsInThread();
+    pthread_sigmask(SIG_BLOCK, nullptr, &mask);
+  }).join();
+
+  for (int signum : {SIGINT, SIGTERM, SIGHUP, SIGQUIT, SIGUSR1, SIGALRM, SIGCHLD}) {
+    EXPECT_EQ(1, sigismember(&mask, signum)) << signum;
+  }
+  for (int signum : {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT}) {
+    EXPECT_EQ(0, sigismember(&mask, signum)) << signum;
+  }
+}
+
 }  // namespace sentinel
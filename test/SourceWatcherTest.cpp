@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>  // NOLINT
+#include <fstream>
+#include <set>
+#include "helper/TestTempDir.hpp"
+#include "sentinel/SourceWatcher.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class SourceWatcherTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_SOURCEWATCHER_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase / "src");
+    fs::create_directories(mBase / "build");
+    // Reported paths are canonical.
+    mBase = fs::canonical(mBase);
+  }
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+  static void write(const fs::path& path) {
+    std::ofstream(path) << "int x;\n";
+  }
+
+  fs::path mBase;
+};
+
+TEST_F(SourceWatcherTest, testReportsWrittenFiles) {
+  SourceWatcher watcher(mBase, {mBase / "build"});
+  write(mBase / "src" / "a.cpp");
+  write(mBase / "b.cpp");
+
+  auto changed = watcher.waitForChanges(std::chrono::milliseconds(50));
+  EXPECT_EQ((std::set<fs::path>{mBase / "src" / "a.cpp", mBase / "b.cpp"}), changed);
+}
+
+TEST_F(SourceWatcherTest, testIgnoresSkippedDirectories) {
+  SourceWatcher watcher(mBase, {mBase / "build"});
+  write(mBase / "build" / "generated.cpp");
+  write(mBase / "src" / "a.cpp");
+
+  auto changed = watcher.waitForChanges(std::chrono::milliseconds(50));
+  EXPECT_EQ((std::set<fs::path>{mBase / "src" / "a.cpp"}), changed);
+}
+
+TEST_F(SourceWatcherTest, testWatchesNewDirectories) {
+  SourceWatcher watcher(mBase, {});
+  fs::create_directories(mBase / "new");
+  write(mBase / "src" / "a.cpp");
+  watcher.waitForChanges(std::chrono::milliseconds(50));
+
+  write(mBase / "new" / "c.cpp");
+  auto changed = watcher.waitForChanges(std::chrono::milliseconds(50));
+  EXPECT_EQ((std::set<fs::path>{mBase / "new" / "c.cpp"}), changed);
+}
+
+}  // namespace sentinel
@@ -175,6 +175,20 @@ TEST_F(StatusLineTest, testNonEvaluationPhaseLayout) {
   EXPECT_THAT(text, HasSubstr("0%"));
 }
 
+TEST_F(StatusLineTest, testBackgroundProgressShownNextToPhase) {
+  StatusLine sl;
+  sl.setPhase(StatusLine::Phase::TEST_ORIG);
+  sl.setBackgroundProgress(StatusLine::Phase::GENERATION, 3, 12);
+
+  std::string text = sl.getStatusText();
+
+  EXPECT_THAT(text, HasSubstr("TEST-ORIG"));
+  EXPECT_THAT(text, HasSubstr("GENERATION [3/12]"));
+
+  sl.clearBackgroundProgress();
+  EXPECT_THAT(sl.getStatusText(), Not(HasSubstr("GENERATION")));
+}
+
 TEST_F(StatusLineTest, testDryRunPrefix) {
   StatusLine sl;
   sl.setDryRun(true);
@@ -451,4 +465,20 @@ TEST_F(StatusLineTest, testSummaryWithoutUncoveredHasNoUncoveredToken) {
   EXPECT_THAT(text, Not(HasSubstr("(1)")));
 }
 
+TEST_F(StatusLineTest, testResetCountersClearsProgressAndResults) {
+  StatusLine sl;
+  sl.setPhase(StatusLine::Phase::EVALUATION);
+  sl.setProgressTotal(10);
+  sl.setProgressCurrent(4);
+  for (int i = 0; i < 4; ++i) sl.recordResult(MutationState::KILLED, false);
+  sl.resetCounters();
+  sl.setProgressTotal(2);
+  sl.setProgressCurrent(1);
+  sl.recordResult(MutationState::KILLED, false);
+
+  std::string text = sl.getStatusText();
+  EXPECT_THAT(text, HasSubstr("[1/2]"));
+  EXPECT_THAT(text, Not(HasSubstr("/10]")));
+}
+
 }  // namespace sentinel
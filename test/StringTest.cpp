@@ -301,4 +301,11 @@ TEST_F(StringTest, testTruncateVeryShortMaxLen) {
   EXPECT_EQ("rld", string::truncate("hello world", 3));
 }
 
+TEST_F(StringTest, testShellQuote) {
+  EXPECT_EQ("'plain'", string::shellQuote("plain"));
+  EXPECT_EQ("'a b $HOME'", string::shellQuote("a b $HOME"));
+  EXPECT_EQ("'it'\\''s'", string::shellQuote("it's"));
+  EXPECT_EQ("''", string::shellQuote(""));
+}
+
 }  // namespace sentinel
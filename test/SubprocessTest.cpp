@@ -5,10 +5,13 @@
 
 #include <gtest/gtest.h>
 #include <chrono>
+#include <csignal>
+#include <cstdio>
 #include <filesystem>  // NOLINT
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
 #include "sentinel/Subprocess.hpp"
 #include "helper/FileTestHelper.hpp"
 #include "helper/TestTempDir.hpp"
@@ -161,4 +164,70 @@ TEST_F(SubprocessTest, testChildHasNoControllingTerminal) {
   EXPECT_NE(content.find("NO_TTY"), std::string::npos);
 }
 
+TEST_F(SubprocessTest, testOutputWatcherSeesCompleteLines) {
+  std::vector<std::string> lines;
+  Subprocess sp("printf 'one\\ntw'; sleep 0.1; printf 'o\\nthree'", 0, "", true);
+  sp.setOutputWatcher([&lines](const std::string& line) {
+    lines.push_back(line);
+    return false;
+  });
+  sp.execute();
+  EXPECT_TRUE(sp.isSuccessfulExit());
+  EXPECT_FALSE(sp.isStoppedByWatcher());
+  EXPECT_EQ((std::vector<std::string>{"one", "two"}), lines);
+}
+
+TEST_F(SubprocessTest, testOutputWatcherStopsProcessGroup) {
+  auto logPath = mBase / "watched.log";
+  int calls = 0;
+  Subprocess sp("echo before; echo stop; sleep 30 & sleep 30; echo after", 0, logPath, true);
+  sp.setOutputWatcher([&calls](const std::string& line) {
+    calls++;
+    return line == "stop";
+  });
+  const auto start = std::chrono::steady_clock::now();
+  sp.execute();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+  EXPECT_TRUE(sp.isStoppedByWatcher());
+  EXPECT_FALSE(sp.isSuccessfulExit());
+  EXPECT_EQ(2, calls);
+  const std::string content = testutil::readFile(logPath);
+  EXPECT_NE(content.find("stop"), std::string::npos);
+  EXPECT_EQ(content.find("after"), std::string::npos);
+}
+
+TEST_F(SubprocessTest, testFunctionRunsInChild) {
+  auto logPath = mBase / "function.log";
+  int calls = 0;
+  Subprocess sp([&calls] {
+    calls++;
+    std::printf("function_marker\n");
+    return 3;
+  }, 0, logPath, true);
+  sp.execute();
+  EXPECT_EQ(0, calls);
+  EXPECT_FALSE(sp.isSuccessfulExit());
+  EXPECT_FALSE(sp.isSignaled());
+  EXPECT_NE(testutil::readFile(logPath).find("function_marker"), std::string::npos);
+}
+
+TEST_F(SubprocessTest, testFunctionCrashIsIsolated) {
+  Subprocess sp([] {
+    std::raise(SIGSEGV);
+    return 0;
+  }, 0, "", true);
+  sp.execute();
+  EXPECT_TRUE(sp.isSignaled());
+  EXPECT_FALSE(sp.isTimedOut());
+}
+
+TEST_F(SubprocessTest, testFunctionWithTimeout) {
+  Subprocess sp([] {
+    std::this_thread::sleep_for(std::chrono::seconds(10));
+    return 0;
+  }, 1, "", true);
+  sp.execute();
+  EXPECT_TRUE(sp.isTimedOut());
+}
+
 }  // namespace sentinel
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <optional>
+#include <string>
+#include <vector>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/TestCallGraph.hpp"
+#include "sentinel/exceptions/IOException.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+using Tests = std::optional<std::vector<std::string>>;
+
+class TestCallGraphTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_TESTCALLGRAPH_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase);
+    testutil::writeFile(mBase / "gtest.h", kGtestHeader);
+    testutil::writeFile(mBase / "calc.h", kCalcHeader);
+    testutil::writeFile(mBase / "calc.cpp", kCalcSource);
+    testutil::writeFile(mBase / "calc_test.cpp", kCalcTest);
+  }
+
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+
+  void writeCompileDb(const std::vector<std::string>& files) {
+    std::string entries;
+    for (const auto& file : files) {
+      entries += fmt::format(R"({}{{"directory": "{}", "command": "/usr/bin/c++ -std=c++14 -c {}", "file": "{}"}})",
+                             entries.empty() ? "" : ",\n", mBase.string(), file, (mBase / file).string());
+    }
+    testutil::writeFile(mBase / "compile_commands.json", "[\n" + entries + "\n]\n");
+  }
+
+  fs::path mBase;
+
+  // The parts of Google Test the graph looks at: the test classes and where their TestBody comes from.
+  static constexpr const char* kGtestHeader = R"(
+namespace testing {
+class Test {
+ public:
+  virtual ~Test() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+  virtual void TestBody() = 0;
+};
+template <typename T>
+class TestWithParam : public Test {};
+}  // namespace testing
+#define GTEST_TEST_(suite, name, parent) \
+  class suite##_##name##_Test : public parent { \
+   public: \
+    void TestBody() override; \
+  }; \
+  void suite##_##name##_Test::TestBody()
+#define TEST(suite, name) GTEST_TEST_(suite, name, ::testing::Test)
+#define TEST_F(fixture, name) GTEST_TEST_(fixture, name, fixture)
+#define TEST_P(fixture, name) GTEST_TEST_(fixture, name, fixture)
+)";
+
+  static constexpr const char* kCalcHeader = R"(
+namespace calc {
+int add(int a, int b);
+int twice(int a);
+int unused(int a);
+struct Shape {
+  virtual ~Shape() {}
+  virtual int area() const = 0;
+};
+struct Square : Shape {
+  int area() const override;
+  int side = 2;
+};
+int measure(const Shape& shape);
+void reset();
+int fromMain();
+int fromParam();
+}  // namespace calc
+)";
+
+  static constexpr const char* kCalcSource = R"(
+#include "calc.h"
+namespace calc {
+static int helper(int a) { return a; }
+int add(int a, int b) { return helper(a) + b; }
+int twice(int a) { return add(a, a); }
+int unused(int a) { return a * 3; }
+int Square::area() const { return side * side; }
+int measure(const Shape& shape) { return shape.area(); }
+void reset() {}
+int fromMain() { return 0; }
+int fromParam() { return 1; }
+}  // namespace calc
+)";
+
+  static constexpr const char* kCalcTest = R"(
+#include "gtest.h"
+#include "calc.h"
+TEST(CalcTest, Add) { calc::add(1, 2); }
+TEST(CalcTest, Twice) { calc::twice(1); }
+TEST(ShapeTest, Square) { calc::Square square; calc::measure(square); }
+class CalcFixture : public ::testing::Test {
+ protected:
+  void SetUp() override { calc::reset(); }
+};
+TEST_F(CalcFixture, Empty) {}
+class CalcParam : public ::testing::TestWithParam<int> {};
+TEST_P(CalcParam, Twice) { calc::fromParam(); }
+int main() { return calc::fromMain(); }
+)";
+};
+
+TEST_F(TestCallGraphTest, testTestsReachTheFunctionsTheyCall) {
+  writeCompileDb({"calc.cpp", "calc_test.cpp"});
+  TestCallGraph graph(mBase);
+
+  EXPECT_TRUE(graph.getFailedFiles().empty());
+  EXPECT_EQ(2U, graph.getFileCount());
+  EXPECT_EQ(4U, graph.getTests().size());
+  EXPECT_EQ(Tests({"CalcTest.Twice"}), graph.getReachingTests("calc::twice"));
+  EXPECT_EQ(Tests({"CalcTest.Add", "CalcTest.Twice"}), graph.getReachingTests("calc::helper"));
+  EXPECT_EQ(Tests(std::vector<std::string>{}), graph.getReachingTests("calc::unused"));
+}
+
+TEST_F(TestCallGraphTest, testVirtualCallReachesOverrider) {
+  writeCompileDb({"calc.cpp", "calc_test.cpp"});
+  TestCallGraph graph(mBase);
+
+  EXPECT_EQ(Tests({"ShapeTest.Square"}), graph.getReachingTests("calc::Square::area"));
+}
+
+TEST_F(TestCallGraphTest, testFixtureMethodsRunWithTheTest) {
+  writeCompileDb({"calc.cpp", "calc_test.cpp"});
+  TestCallGraph graph(mBase);
+
+  EXPECT_EQ(Tests({"CalcFixture.Empty"}), graph.getReachingTests("calc::reset"));
+}
+
+TEST_F(TestCallGraphTest, testFunctionReachedFromUnknownTestRunsWholeSuite) {
+  writeCompileDb({"calc.cpp", "calc_test.cpp"});
+  TestCallGraph graph(mBase);
+
+  // calc::fromParam is called from a TEST_P, and calc::fromMain from main().
+  EXPECT_EQ(std::nullopt, graph.getReachingTests("calc::fromParam"));
+  EXPECT_EQ(std::nullopt, graph.getReachingTests("calc::fromMain"));
+  EXPECT_EQ(std::nullopt, graph.getReachingTests("calc::notDefined"));
+  EXPECT_EQ(std::nullopt, graph.getReachingTests(""));
+}
+
+TEST_F(TestCallGraphTest, testFileWithErrorsDisablesSelection) {
+  testutil::writeFile(mBase / "broken.cpp", "int broken() { return undeclared; }\n");
+  writeCompileDb({"calc.cpp", "calc_test.cpp", "broken.cpp"});
+  TestCallGraph graph(mBase);
+
+  ASSERT_EQ(1U, graph.getFailedFiles().size());
+  EXPECT_EQ((mBase / "broken.cpp").string(), graph.getFailedFiles().front());
+  EXPECT_EQ(std::nullopt, graph.getReachingTests("calc::add"));
+}
+
+TEST_F(TestCallGraphTest, testThrowsWithoutCompileDb) {
+  EXPECT_THROW(TestCallGraph graph(mBase / "missing"), IOException);
+}
+
+TEST_F(TestCallGraphTest, testCallByNameReachesFunctionsOfThatNameInAnyScope) {
+  TestCallGraph graph;
+  graph.addDefinition("a::run");
+  graph.addDefinition("b::Runner::run");
+  graph.addCallByName("Template::call", "run");
+  graph.addCall("Suite_Name_Test::TestBody", "Template::call");
+  graph.addRoot("Suite_Name_Test::TestBody", "Suite.Name");
+
+  EXPECT_EQ(Tests({"Suite.Name"}), graph.getReachingTests("a::run"));
+  EXPECT_EQ(Tests({"Suite.Name"}), graph.getReachingTests("b::Runner::run"));
+}
+
+TEST_F(TestCallGraphTest, testRecursiveCallsAreVisitedOnce) {
+  TestCallGraph graph;
+  graph.addDefinition("f");
+  graph.addCall("f", "g");
+  graph.addCall("g", "f");
+  graph.addCall("T_A_Test::TestBody", "g");
+  graph.addCall("T_B_Test::TestBody", "f");
+  graph.addRoot("T_A_Test::TestBody", "T.A");
+  graph.addRoot("T_B_Test::TestBody", "T.B");
+
+  EXPECT_EQ(Tests({"T.A", "T.B"}), graph.getReachingTests("f"));
+  EXPECT_EQ(Tests({"T.A", "T.B"}), graph.getReachingTests("f"));
+}
+
+}  // namespace sentinel
@@ -286,6 +286,22 @@ TEST_F(UniformMutantGeneratorTest, testProgressCallbackInvokedPerFile) {
   }
 }
 
+TEST_F(UniformMutantGeneratorTest, testProgressCallbackCountsFilesParsedInParallelOnce) {
+  UniformMutantGenerator generator(SAMPLE1_DIR);
+  std::vector<std::pair<std::size_t, std::size_t>> calls;
+  generator.setProgressCallback(
+      [&calls](std::size_t done, std::size_t total) {
+        calls.emplace_back(done, total);
+      });
+
+  Mutants mutants = generator.generate(mSourceLines, 0, kSeed);
+
+  const std::vector<std::pair<std::size_t, std::size_t>> expected = {{0, 2}, {1, 2}, {2, 2}};
+  EXPECT_EQ(expected, calls);
+  UniformMutantGenerator baseline(SAMPLE1_DIR);
+  EXPECT_EQ(baseline.generate(mSourceLines, 0, kSeed), mutants);
+}
+
 TEST_F(UniformMutantGeneratorTest, testMissingDirectoryDoesNotAbort) {
   // Overwrite compile_commands.json so one entry's "directory" points at a
   // path that does not exist. Before the chdir-race fix, this aborted the
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <vector>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/Config.hpp"
+#include "sentinel/Mutant.hpp"
+#include "sentinel/MutationResult.hpp"
+#include "sentinel/MutationState.hpp"
+#include "sentinel/VerdictCache.hpp"
+
+namespace sentinel {
+
+namespace fs = std::filesystem;
+
+class VerdictCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_VERDICTCACHE_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase / "src");
+    testutil::writeFile(mBase / "src" / "foo.cpp", "int foo() { return 1 + 2; }\n");
+    testutil::writeFile(mBase / "src" / "foo_test.cpp", "// test\n");
+    mConfig.sourceDir = mBase / "src";
+    mConfig.cacheDir = mBase / "cache";
+    mConfig.buildCmd = "make";
+    mConfig.testCmd = "make test";
+  }
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+  std::vector<fs::path> contextFiles() const {
+    return {mBase / "src" / "foo_test.cpp"};
+  }
+
+  fs::path mBase;
+  Config mConfig;
+  Mutant mMutant{"AOR", "foo.cpp", "foo", 1, 22, 1, 23, "-"};
+};
+
+TEST_F(VerdictCacheTest, testStoredVerdictIsFoundAndFlaggedAsCached) {
+  MutationResult result(mMutant, "Suite.Test", "", MutationState::KILLED);
+  result.setBuildSecs(1.5);
+  VerdictCache(mConfig, contextFiles()).store(result);
+
+  VerdictCache cache(mConfig, contextFiles());
+  auto found = cache.find(mMutant);
+  ASSERT_TRUE(found.has_value());
+  EXPECT_TRUE(found->isCached());
+  EXPECT_EQ(MutationState::KILLED, found->getMutationState());
+  EXPECT_EQ("Suite.Test", found->getKillingTest());
+  EXPECT_DOUBLE_EQ(1.5, found->getBuildSecs());
+  EXPECT_FALSE(cache.find(Mutant("AOR", "foo.cpp", "foo", 1, 22, 1, 23, "*")).has_value());
+}
+
+TEST_F(VerdictCacheTest, testChangedMutatedFileMisses) {
+  VerdictCache(mConfig, contextFiles()).store(MutationResult(mMutant, "", "", MutationState::SURVIVED));
+  testutil::writeFile(mBase / "src" / "foo.cpp", "int foo() { return 1 + 3; }\n");
+  EXPECT_FALSE(VerdictCache(mConfig, contextFiles()).find(mMutant).has_value());
+}
+
+TEST_F(VerdictCacheTest, testChangedContextMisses) {
+  VerdictCache(mConfig, contextFiles()).store(MutationResult(mMutant, "", "", MutationState::SURVIVED));
+
+  testutil::writeFile(mBase / "src" / "foo_test.cpp", "// changed test\n");
+  EXPECT_FALSE(VerdictCache(mConfig, contextFiles()).find(mMutant).has_value());
+
+  testutil::writeFile(mBase / "src" / "foo_test.cpp", "// test\n");
+  EXPECT_TRUE(VerdictCache(mConfig, contextFiles()).find(mMutant).has_value());
+  mConfig.testCmd = "ctest";
+  EXPECT_FALSE(VerdictCache(mConfig, contextFiles()).find(mMutant).has_value());
+}
+
+TEST_F(VerdictCacheTest, testStoreLeavesNoTemporaryFiles) {
+  VerdictCache cache(mConfig, contextFiles());
+  cache.store(MutationResult(mMutant, "", "", MutationState::SURVIVED));
+  cache.store(MutationResult(mMutant, "t", "", MutationState::KILLED));
+
+  std::size_t entries = 0;
+  for (const auto& entry : fs::recursive_directory_iterator(mConfig.cacheDir)) {
+    if (entry.is_regular_file()) {
+      EXPECT_NE(".tmp", entry.path().extension());
+      entries++;
+    }
+  }
+  EXPECT_EQ(1u, entries);
+  EXPECT_EQ(MutationState::KILLED, cache.find(mMutant)->getMutationState());
+}
+
+}  // namespace sentinel
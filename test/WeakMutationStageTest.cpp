@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 LG Electronics Inc.
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <fmt/core.h>
+#include <gtest/gtest.h>
+#include <filesystem>  // NOLINT
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "helper/FileTestHelper.hpp"
+#include "helper/TestTempDir.hpp"
+#include "sentinel/Config.hpp"
+#include "sentinel/Mutant.hpp"
+#include "sentinel/MutationResult.hpp"
+#include "sentinel/MutationState.hpp"
+#include "sentinel/PipelineContext.hpp"
+#include "sentinel/StatusLine.hpp"
+#include "sentinel/Workspace.hpp"
+#include "sentinel/stages/WeakMutationStage.hpp"
+
+namespace fs = std::filesystem;
+
+namespace sentinel {
+
+static const char* const kOriginalSource = "int foo() { return 1 + 2; }\n";
+static const char* const kInstrumentedSource = "int foo() { return probe(1 + 2); }\n";
+static const char* const kPassedXml =
+    "<?xml version=\"1.0\"?>\n"
+    "<testsuites><testsuite name=\"S\" tests=\"1\">"
+    "<testcase name=\"t1\" classname=\"C\" status=\"run\"/>"
+    "</testsuite></testsuites>\n";
+static const char* const kFailedXml =
+    "<?xml version=\"1.0\"?>\n"
+    "<testsuites><testsuite name=\"S\" tests=\"1\">"
+    "<testcase name=\"t1\" classname=\"C\" status=\"run\"><failure message=\"mismatch\"/></testcase>"
+    "</testsuite></testsuites>\n";
+
+class WeakMutationStageTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    mBase = testTempDir("SENTINEL_WEAKMUTATION_STAGE_TEST");
+    fs::remove_all(mBase);
+    fs::create_directories(mBase / "src");
+    mSourceDir = fs::canonical(mBase / "src");
+    testutil::writeFile(mSourceDir / "foo.cpp", kOriginalSource);
+
+    mWorkspace = std::make_shared<Workspace>(mBase / "workspace");
+    mWorkspace->initialize();
+    mWorkspace->createMutant(1, Mutant("AOR", "foo.cpp", "foo", 1, 22, 1, 23, "-"));
+    mWorkspace->createMutant(2, Mutant("AOR", "foo.cpp", "foo", 1, 22, 1, 23, "*"));
+    mWorkspace->createMutant(3, Mutant("SDL", "foo.cpp", "foo", 1, 13, 1, 26, "{}"));
+    testutil::writeFile(mWorkspace->getOriginalResultsDir() / "results.xml", kPassedXml);
+    testutil::writeFile(mBase / "passed.xml", kPassedXml);
+    testutil::writeFile(mBase / "failed.xml", kFailedXml);
+
+    mConfig.sourceDir = mSourceDir;
+    mConfig.workDir = mBase / "workspace";
+    mConfig.weakMutation = true;
+    mConfig.buildCmd = "true";
+    mConfig.testCmd = makeTestCmd("passed.xml", mSourceDir / "foo.cpp");
+    mConfig.testResultDir = mBase / "test_results";
+  }
+
+  void TearDown() override {
+    fs::remove_all(mBase);
+  }
+
+  PipelineContext makeCtx() {
+    return {mConfig, mStatusLine, *mWorkspace};
+  }
+
+  /**
+   * @brief Instrument function that probes mutants 1 and 2 in foo.cpp.
+   */
+  WeakMutationStage::InstrumentFunction makeInstrument() {
+    return [this](const std::vector<std::pair<int, Mutant>>& mutants, std::set<int>* probed) {
+      mInstrumentCalls++;
+      EXPECT_EQ(3U, mutants.size());
+      probed->insert({1, 2});
+      return std::map<fs::path, std::string>{{mSourceDir / "foo.cpp", kInstrumentedSource}};
+    };
+  }
+
+  /**
+   * @brief Test command that writes the results in @p xml and, unless @p loaded
+   *        is empty, records that the instrumented code of @p loaded was loaded.
+   */
+  std::string makeTestCmd(const std::string& xml, const fs::path& loaded) {
+    std::string cmd = fmt::format("mkdir -p {0} && cp {1} {0}/results.xml", (mBase / "test_results").string(),
+                                  (mBase / xml).string());
+    if (!loaded.empty()) {
+      cmd += fmt::format(" && echo 'loaded {}' >> \"$SENTINEL_WEAK_MUTATION_FILE\"", loaded.string());
+    }
+    return cmd;
+  }
+
+  std::string runStage(WeakMutationStage* stage) {
+    auto ctx = makeCtx();
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    EXPECT_NO_THROW(stage->run(&ctx));
+    testing::internal::GetCapturedStderr();
+    return testing::internal::GetCapturedStdout();
+  }
+
+  fs::path mBase;
+  fs::path mSourceDir;
+  Config mConfig;
+  StatusLine mStatusLine;
+  std::shared_ptr<Workspace> mWorkspace;
+  int mInstrumentCalls = 0;
+};
+
+TEST_F(WeakMutationStageTest, testReadRecordIgnoresMalformedLines) {
+  const fs::path record = mBase / "infected";
+  testutil::writeFile(record, "3\n1\nfoo\n7x\n\n3\nloaded /src/a b.cpp\nloade\n12");
+
+  const auto result = WeakMutationStage::readRecord(record);
+
+  EXPECT_EQ((std::set<int>{1, 3, 12}), result.infected);
+  EXPECT_EQ((std::set<std::string>{"/src/a b.cpp"}), result.loaded);
+}
+
+TEST_F(WeakMutationStageTest, testReadRecordMissingFileIsEmpty) {
+  const auto result = WeakMutationStage::readRecord(mBase / "missing");
+
+  EXPECT_TRUE(result.infected.empty());
+  EXPECT_TRUE(result.loaded.empty());
+}
+
+TEST_F(WeakMutationStageTest, testShouldSkipWhenDisabled) {
+  mConfig.weakMutation = false;
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_EQ(0, mInstrumentCalls);
+  EXPECT_FALSE(mWorkspace->loadStatus().notInfected.has_value());
+}
+
+TEST_F(WeakMutationStageTest, testShouldSkipWithShared) {
+  mConfig.shared = true;
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_EQ(0, mInstrumentCalls);
+}
+
+TEST_F(WeakMutationStageTest, testShouldSkipWhenAlreadyScreened) {
+  WorkspaceStatus status;
+  status.notInfected = std::vector<int>{2};
+  mWorkspace->saveStatus(status);
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_EQ(0, mInstrumentCalls);
+  EXPECT_EQ(std::vector<int>{2}, *mWorkspace->loadStatus().notInfected);
+}
+
+TEST_F(WeakMutationStageTest, testProbedMutantsNotRecordedAreNotInfected) {
+  // The test command sees the instrumented source and reports mutant 2 as infected.
+  const fs::path seen = mBase / "seen.cpp";
+  mConfig.testCmd = "cp " + (mSourceDir / "foo.cpp").string() + " " + seen.string() + " && " + mConfig.testCmd +
+                    " && echo 2 >> \"$SENTINEL_WEAK_MUTATION_FILE\"";
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_EQ(1, mInstrumentCalls);
+  EXPECT_EQ(kInstrumentedSource, testutil::readFile(seen));
+  EXPECT_EQ(kOriginalSource, testutil::readFile(mSourceDir / "foo.cpp"));
+  const auto status = mWorkspace->loadStatus();
+  ASSERT_TRUE(status.notInfected.has_value());
+  EXPECT_EQ(std::vector<int>{1}, *status.notInfected);
+}
+
+TEST_F(WeakMutationStageTest, testDoneMutantsAreNotListed) {
+  mWorkspace->setDone(1, MutationResult(Mutant("AOR", "foo.cpp", "foo", 1, 22, 1, 23, "-"), "C.t1", "",
+                                        MutationState::KILLED));
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_EQ(std::vector<int>{2}, *mWorkspace->loadStatus().notInfected);
+}
+
+TEST_F(WeakMutationStageTest, testBuildFailureScreensNothing) {
+  mConfig.buildCmd = "false";
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_EQ(kOriginalSource, testutil::readFile(mSourceDir / "foo.cpp"));
+  const auto status = mWorkspace->loadStatus();
+  ASSERT_TRUE(status.notInfected.has_value());
+  EXPECT_TRUE(status.notInfected->empty());
+}
+
+TEST_F(WeakMutationStageTest, testCrashedTestRunScreensNothing) {
+  mConfig.testCmd = "kill -SEGV $$";
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_EQ(kOriginalSource, testutil::readFile(mSourceDir / "foo.cpp"));
+  EXPECT_TRUE(mWorkspace->loadStatus().notInfected->empty());
+}
+
+TEST_F(WeakMutationStageTest, testUnloadedInstrumentationScreensNothing) {
+  // The test command did not pass the record file on, so no probe could record anything.
+  mConfig.testCmd = makeTestCmd("passed.xml", "");
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  ASSERT_TRUE(mWorkspace->loadStatus().notInfected.has_value());
+  EXPECT_TRUE(mWorkspace->loadStatus().notInfected->empty());
+}
+
+TEST_F(WeakMutationStageTest, testMutantsOfUnloadedFilesAreNotScreened) {
+  mConfig.testCmd = makeTestCmd("passed.xml", mSourceDir / "bar.cpp");
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_TRUE(mWorkspace->loadStatus().notInfected->empty());
+}
+
+TEST_F(WeakMutationStageTest, testChangedTestResultsScreenNothing) {
+  mConfig.testCmd = makeTestCmd("failed.xml", mSourceDir / "foo.cpp");
+  WeakMutationStage stage(makeInstrument());
+
+  runStage(&stage);
+
+  EXPECT_EQ(kOriginalSource, testutil::readFile(mSourceDir / "foo.cpp"));
+  EXPECT_TRUE(mWorkspace->loadStatus().notInfected->empty());
+}
+
+TEST_F(WeakMutationStageTest, testNothingProbedScreensNothing) {
+  mConfig.buildCmd = "touch " + (mBase / "built").string();
+  WeakMutationStage stage([](const std::vector<std::pair<int, Mutant>>&, std::set<int>*) {
+    return std::map<fs::path, std::string>{};
+  });
+
+  runStage(&stage);
+
+  EXPECT_FALSE(fs::exists(mBase / "built"));
+  ASSERT_TRUE(mWorkspace->loadStatus().notInfected.has_value());
+  EXPECT_TRUE(mWorkspace->loadStatus().notInfected->empty());
+}
+
+}  // namespace sentinel
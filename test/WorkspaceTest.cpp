@@ -6,19 +6,23 @@
 #include <fmt/core.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <chrono>
 #include <filesystem>  // NOLINT
 #include <fstream>
 #include <iterator>
+#include <map>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
 #include "sentinel/Config.hpp"
+#include "sentinel/GitSourceTree.hpp"
 #include "sentinel/Mutant.hpp"
 #include "sentinel/MutationResult.hpp"
 #include "sentinel/MutationResults.hpp"
 #include "sentinel/MutationState.hpp"
 #include "sentinel/Workspace.hpp"
+#include "sentinel/util/io.hpp"
 #include "helper/FileTestHelper.hpp"
 #include "helper/TestTempDir.hpp"
 #include "helper/ThrowMessageMatcher.hpp"
@@ -142,6 +146,69 @@ TEST_F(WorkspaceTest, testLockLifecycle) {
   EXPECT_FALSE(ws.isLocked(1));
 }
 
+TEST_F(WorkspaceTest, testTryLockIsExclusive) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  Mutant m("AOR", mSrcFile, "func", 1, 1, 1, 1, "+");
+  ws.createMutant(1, m);
+
+  EXPECT_TRUE(ws.tryLock(1, "host.1"));
+  EXPECT_FALSE(ws.tryLock(1, "host.2"));
+  EXPECT_EQ("host.1\n", testutil::readFile(mRoot / "00001" / "mt.lock"));
+  ws.clearLock(1);
+  EXPECT_TRUE(ws.tryLock(1, "host.2"));
+}
+
+TEST_F(WorkspaceTest, testTryLockFailsWhenMutantDirMissing) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  EXPECT_THROW(ws.tryLock(1, "host.1"), std::runtime_error);
+}
+
+TEST_F(WorkspaceTest, testBreakLockRemovesOnlyUnrenewedLock) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  Mutant m("AOR", mSrcFile, "func", 1, 1, 1, 1, "+");
+  ws.createMutant(1, m);
+  EXPECT_FALSE(ws.getLockTime(1).has_value());
+
+  ASSERT_TRUE(ws.tryLock(1, "host.1"));
+  const fs::path lock = mRoot / "00001" / "mt.lock";
+  fs::last_write_time(lock, fs::last_write_time(lock) - std::chrono::hours(1));
+  const auto seen = ws.getLockTime(1);
+  ASSERT_TRUE(seen.has_value());
+
+  ws.renewLock(1);
+  EXPECT_NE(seen, ws.getLockTime(1));
+  EXPECT_FALSE(ws.breakLock(1, *seen));
+  EXPECT_TRUE(ws.isLocked(1));
+
+  EXPECT_TRUE(ws.breakLock(1, *ws.getLockTime(1)));
+  EXPECT_FALSE(ws.isLocked(1));
+  EXPECT_FALSE(fs::exists(mRoot / "00001" / "mt.lock.break"));
+}
+
+TEST_F(WorkspaceTest, testTrySetCompleteSucceedsOnce) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  EXPECT_TRUE(ws.trySetComplete());
+  EXPECT_FALSE(ws.trySetComplete());
+  EXPECT_TRUE(ws.isComplete());
+}
+
+TEST_F(WorkspaceTest, testWorkerNameSeparatesScratchDirs) {
+  Workspace ws(mRoot);
+  EXPECT_EQ(mRoot / "backup", ws.getBackupDir());
+  EXPECT_EQ(mRoot / "actual", ws.getActualDir());
+  EXPECT_EQ(mRoot / "objects", ws.getObjectDir());
+
+  ws.setWorkerName("host.42");
+  EXPECT_EQ("host.42", ws.getWorkerName());
+  EXPECT_EQ(mRoot / "workers" / "host.42" / "backup", ws.getBackupDir());
+  EXPECT_EQ(mRoot / "workers" / "host.42" / "actual", ws.getActualDir());
+  EXPECT_EQ(mRoot / "workers" / "host.42" / "objects", ws.getObjectDir());
+}
+
 TEST_F(WorkspaceTest, testDoneLifecycle) {
   Workspace ws(mRoot);
   ws.initialize();
@@ -307,6 +374,7 @@ TEST_F(WorkspaceTest, testGetMutantBuildLog) {
 TEST_F(WorkspaceTest, testGetMutantTestLog) {
   Workspace ws(mRoot);
   EXPECT_EQ(mRoot / "00001" / "test.log", ws.getMutantTestLog(1));
+  EXPECT_EQ(mRoot / "00001" / "results", ws.getMutantResultsDir(1));
 }
 
 TEST_F(WorkspaceTest, testLoadMutantsSkipsNumericDirWithoutCfg) {
@@ -535,6 +603,22 @@ TEST(WorkspaceStatusTest, testStreamOperatorRoundTrip) {
   EXPECT_EQ(*loaded.partCount, 4u);
 }
 
+TEST_F(WorkspaceTest, testSaveAndLoadStatusScopeOriginalTimes) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  WorkspaceStatus s;
+  s.scopeOriginalTimes = std::vector<std::size_t>{7, 12};
+  ws.saveStatus(s);
+  WorkspaceStatus other;
+  other.originalTime = 5;
+  ws.saveStatus(other);
+
+  auto loaded = ws.loadStatus();
+  ASSERT_TRUE(loaded.scopeOriginalTimes.has_value());
+  EXPECT_EQ((std::vector<std::size_t>{7, 12}), *loaded.scopeOriginalTimes);
+  EXPECT_EQ(mRoot / "original" / "scopes" / "1" / "results", ws.getOriginalScopeResultsDir(1));
+}
+
 TEST(WorkspaceStatusTest, testStreamOperatorPartialFields) {
   WorkspaceStatus original;
   original.originalTime = 10;
@@ -657,6 +741,26 @@ TEST_F(WorkspaceTest, testSaveAndLoadStatusMergedPartitions) {
   EXPECT_EQ(*loaded.candidateCount, 5000u);
 }
 
+TEST_F(WorkspaceTest, testSaveAndLoadStatusNotInfected) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  EXPECT_FALSE(ws.loadStatus().notInfected.has_value());
+  WorkspaceStatus s;
+  s.notInfected = std::vector<int>{};
+  ws.saveStatus(s);
+  ASSERT_TRUE(ws.loadStatus().notInfected.has_value());
+  EXPECT_TRUE(ws.loadStatus().notInfected->empty());
+
+  s.notInfected = std::vector<int>{2, 5};
+  ws.saveStatus(s);
+  WorkspaceStatus other;
+  other.originalTime = 10;
+  ws.saveStatus(other);
+  auto loaded = ws.loadStatus();
+  ASSERT_TRUE(loaded.notInfected.has_value());
+  EXPECT_EQ(*loaded.notInfected, (std::vector<int>{2, 5}));
+}
+
 TEST_F(WorkspaceTest, testLoadStatusMergedPartitionsAbsentByDefault) {
   Workspace ws(mRoot);
   ws.initialize();
@@ -802,6 +906,23 @@ TEST_F(WorkspaceTest, testHasMutantsReturnsTrueWhenMutantExists) {
   EXPECT_TRUE(ws.hasMutants());
 }
 
+TEST_F(WorkspaceTest, testMutantsAreNotGeneratedWhileGenerationIsPending) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  WorkspaceStatus pending;
+  pending.generationPending = true;
+  ws.saveStatus(pending);
+  ws.createMutant(1, Mutant("AOR", mSrcFile, "func", 1, 1, 1, 1, "+"));
+  EXPECT_TRUE(ws.hasMutants());
+  EXPECT_FALSE(ws.hasGeneratedMutants());
+
+  WorkspaceStatus done;
+  done.seed = 7;
+  done.generationPending = false;
+  ws.saveStatus(done);
+  EXPECT_TRUE(ws.hasGeneratedMutants());
+}
+
 TEST_F(WorkspaceTest, testHasMutantsIgnoresNumericDirWithoutCfg) {
   Workspace ws(mRoot);
   ws.initialize();
@@ -1012,6 +1133,22 @@ TEST_F(WorkspaceTest, testSaveAndLoadStatusLimit) {
   EXPECT_EQ(50u, *loaded.limit);
 }
 
+TEST_F(WorkspaceTest, testSaveAndLoadStatusGenerationPending) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  WorkspaceStatus s;
+  s.generationPending = true;
+  ws.saveStatus(s);
+  ASSERT_TRUE(ws.loadStatus().generationPending.value_or(false));
+
+  WorkspaceStatus done;
+  done.generationPending = false;
+  ws.saveStatus(done);
+  auto loaded = ws.loadStatus();
+  ASSERT_TRUE(loaded.generationPending.has_value());
+  EXPECT_FALSE(*loaded.generationPending);
+}
+
 TEST_F(WorkspaceTest, testLoadStatusFromAbsentByDefault) {
   Workspace ws(mRoot);
   ws.initialize();
@@ -1044,4 +1181,151 @@ TEST(WorkspaceStatusTest, testStreamOperatorFromUncommittedLimitRoundTrip) {
   EXPECT_EQ(100u, *loaded.limit);
 }
 
+TEST_F(WorkspaceTest, testSaveAndLoadStatusOriginalTestSeconds) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  WorkspaceStatus s;
+  s.originalTestSeconds = 12.5;
+  ws.saveStatus(s);
+
+  WorkspaceStatus other;
+  other.seed = 3;
+  ws.saveStatus(other);
+
+  auto loaded = ws.loadStatus();
+  ASSERT_TRUE(loaded.originalTestSeconds.has_value());
+  EXPECT_DOUBLE_EQ(12.5, *loaded.originalTestSeconds);
+}
+
+TEST_F(WorkspaceTest, testGetNextMutantIdFollowsLargestId) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  EXPECT_EQ(1, ws.getNextMutantId());
+  Mutant m("AOR", mSrcFile, "func", 1, 1, 1, 1, "+");
+  ws.createMutant(1, m);
+  ws.createMutant(5, m);
+  EXPECT_EQ(6, ws.getNextMutantId());
+  ws.removeMutant(5);
+  EXPECT_FALSE(fs::exists(mRoot / "00005"));
+  EXPECT_EQ(2, ws.getNextMutantId());
+}
+
+TEST_F(WorkspaceTest, testRelocateMutantsMovesKeptLinesAndRemovesEditedLines) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  const fs::path relPath = fs::path("src") / "foo.cpp";
+  Mutant kept("AOR", relPath, "func", 3, 5, 3, 6, "+");
+  Mutant edited("ROR", relPath, "func", 4, 5, 4, 6, "<");
+  Mutant other("AOR", fs::path("src") / "bar.cpp", "func", 3, 5, 3, 6, "+");
+  ws.createMutant(1, kept);
+  ws.createMutant(2, edited);
+  ws.createMutant(3, other);
+  ws.setDone(1, MutationResult(kept, "Suite.Test", "", MutationState::KILLED));
+
+  // Two lines inserted before line 3; line 4 modified.
+  const std::map<std::size_t, std::size_t> lineMap = {{1, 1}, {2, 2}, {3, 5}, {5, 7}};
+  EXPECT_EQ(1u, ws.relocateMutants(relPath, lineMap));
+
+  auto mutants = ws.loadMutants();
+  ASSERT_EQ(2u, mutants.size());
+  EXPECT_EQ(1, mutants[0].first);
+  EXPECT_EQ(5u, mutants[0].second.getFirst().line);
+  EXPECT_EQ(5u, mutants[0].second.getLast().line);
+  EXPECT_EQ(3, mutants[1].first);
+  EXPECT_EQ(3u, mutants[1].second.getFirst().line);
+
+  MutationResult loaded = ws.getDoneResult(1);
+  EXPECT_EQ(MutationState::KILLED, loaded.getMutationState());
+  EXPECT_EQ("Suite.Test", loaded.getKillingTest());
+  EXPECT_EQ(5u, loaded.getMutant().getFirst().line);
+}
+
+TEST_F(WorkspaceTest, testRelocatedMutantsApplyToEditedFile) {
+  // Watch mode: a line is inserted below one mutant and above another, then both are evaluated again.
+  const fs::path srcDir = mBase / "src";
+  fs::create_directories(srcDir);
+  const std::string before = "int a = 1 + 2;\nint b = 3 + 4;\n";
+  testutil::writeFile(srcDir / "foo.cpp", before);
+  Mutant above("AOR", "foo.cpp", "", 1, 11, 1, 12, "-");
+  above.setOffsets(10, 11, io::hashContent(before));
+  Mutant below("AOR", "foo.cpp", "", 2, 11, 2, 12, "-");
+  below.setOffsets(25, 26, io::hashContent(before));
+  Workspace ws(mRoot);
+  ws.initialize();
+  ws.createMutant(1, above);
+  ws.createMutant(2, below);
+  MutationResult result(above, "", "", MutationState::SURVIVED);
+  result.setNotInfected(true);
+  ws.setDone(1, result);
+
+  testutil::writeFile(srcDir / "foo.cpp", "int a = 1 + 2;\nint c = 0;\nint b = 3 + 4;\n");
+  EXPECT_EQ(0u, ws.relocateMutants("foo.cpp", {{1, 1}, {2, 3}}));
+  EXPECT_TRUE(ws.getDoneResult(1).isNotInfected());
+  ws.clearResults();
+
+  GitSourceTree tree(srcDir);
+  const fs::path backup = mBase / "backup";
+  fs::create_directories(backup);
+  auto mutants = ws.loadMutants();
+  ASSERT_EQ(2u, mutants.size());
+  tree.modify(mutants[0].second, backup);
+  EXPECT_EQ("int a = 1 - 2;\nint c = 0;\nint b = 3 + 4;\n", testutil::readFile(srcDir / "foo.cpp"));
+  testutil::writeFile(srcDir / "foo.cpp", "int a = 1 + 2;\nint c = 0;\nint b = 3 + 4;\n");
+  tree.modify(mutants[1].second, backup);
+  EXPECT_EQ("int a = 1 + 2;\nint c = 0;\nint b = 3 - 4;\n", testutil::readFile(srcDir / "foo.cpp"));
+}
+
+TEST_F(WorkspaceTest, testOnlyOneProcessClaimsInitialization) {
+  Workspace first(mRoot);
+  Workspace second(mRoot);
+  EXPECT_TRUE(first.claimInitialization("host.1"));
+  EXPECT_FALSE(second.claimInitialization("host.2"));
+  first.initialize();
+  EXPECT_FALSE(second.claimInitialization("host.2"));
+  EXPECT_EQ("host.1\n", testutil::readFile(mRoot / "init.lock"));
+}
+
+TEST_F(WorkspaceTest, testStaleInitializationClaimIsTakenOver) {
+  Workspace dead(mRoot);
+  Workspace waiting(mRoot);
+  ASSERT_TRUE(dead.claimInitialization("host.1"));
+  EXPECT_EQ("host.1", waiting.getInitializationOwner());
+  const auto seen = waiting.getInitializationTime();
+  ASSERT_TRUE(seen.has_value());
+
+  // A renewal in the meantime keeps the claim.
+  dead.renewInitialization();
+  fs::last_write_time(mRoot / "init.lock", *seen + std::chrono::seconds(1));
+  EXPECT_FALSE(waiting.breakInitialization(*seen));
+  EXPECT_FALSE(waiting.claimInitialization("host.2"));
+
+  EXPECT_TRUE(waiting.breakInitialization(*waiting.getInitializationTime()));
+  EXPECT_TRUE(waiting.claimInitialization("host.2"));
+  waiting.initialize();
+  EXPECT_EQ("host.2", waiting.getInitializationOwner());
+}
+
+TEST_F(WorkspaceTest, testInitializeRemovesClaimOfAnotherProcess) {
+  Workspace other(mRoot);
+  ASSERT_TRUE(other.claimInitialization("host.1"));
+  Workspace ws(mRoot);
+  ws.initialize();
+  EXPECT_FALSE(ws.getInitializationTime().has_value());
+  EXPECT_EQ("", ws.getInitializationOwner());
+}
+
+TEST_F(WorkspaceTest, testClearResultsRemovesDoneAndCompleteMarkers) {
+  Workspace ws(mRoot);
+  ws.initialize();
+  Mutant m("AOR", mSrcFile, "func", 1, 1, 1, 1, "+");
+  ws.createMutant(1, m);
+  ws.setDone(1, MutationResult(m, "", "", MutationState::SURVIVED));
+  ws.setComplete();
+
+  ws.clearResults();
+  EXPECT_FALSE(ws.isDone(1));
+  EXPECT_FALSE(ws.isComplete());
+  EXPECT_EQ(1u, ws.loadMutants().size());
+}
+
 }  // namespace sentinel
@@ -255,6 +255,50 @@ TEST_F(XmlReportTest, CoveredSurvivedMutantHasNoUncoveredAttribute) {
   EXPECT_EQ(std::string::npos, content.find("uncovered"));
 }
 
+TEST_F(XmlReportTest, CachedMutantHasCachedAttribute) {
+  MutationResults MRs;
+  Mutant M1("AOR", mRelPath1, "func", 4, 5, 6, 7, "+");
+  MutationResult MR1(M1, "testAdd", "", MutationState::KILLED);
+  MR1.setCached(true);
+  MRs.push_back(MR1);
+  Mutant M2("BOR", mRelPath2, "func", 1, 2, 3, 4, "|");
+  MRs.emplace_back(M2, "testAddBit", "", MutationState::KILLED);
+
+  auto MRPath = mMutResultDir / "MutationResultCached";
+  MRs.save(MRPath);
+
+  XmlReport xmlreport(MutationSummary(MRPath, mSourceDir));
+  auto outDir = mBase / "OUT_DIR_CACHED";
+  xmlreport.save(outDir);
+
+  auto content = testutil::readFile(outDir / "mutations.xml");
+  auto first = content.find("cached=\"true\"");
+  EXPECT_NE(std::string::npos, first);
+  EXPECT_EQ(std::string::npos, content.find("cached=\"true\"", first + 1));
+}
+
+TEST_F(XmlReportTest, NotInfectedSurvivedMutantHasNotInfectedAttribute) {
+  MutationResults MRs;
+  Mutant M1("AOR", mRelPath1, "func", 4, 5, 6, 7, "+");
+  MutationResult MR1(M1, "", "", MutationState::SURVIVED);
+  MR1.setNotInfected(true);
+  MRs.push_back(MR1);
+  Mutant M2("BOR", mRelPath2, "func", 1, 2, 3, 4, "|");
+  MRs.emplace_back(M2, "", "", MutationState::SURVIVED);
+
+  auto MRPath = mMutResultDir / "MutationResultNotInfected";
+  MRs.save(MRPath);
+
+  XmlReport xmlreport(MutationSummary(MRPath, mSourceDir));
+  auto outDir = mBase / "OUT_DIR_NOT_INFECTED";
+  xmlreport.save(outDir);
+
+  auto content = testutil::readFile(outDir / "mutations.xml");
+  auto first = content.find("notInfected=\"true\"");
+  EXPECT_NE(std::string::npos, first);
+  EXPECT_EQ(std::string::npos, content.find("notInfected=\"true\"", first + 1));
+}
+
 TEST_F(XmlReportTest, testMakeXmlReportMixedStates) {
   MutationResults MRs;
   Mutant M1("AOR", mRelPath1, "func", 4, 5, 6, 7, "+");